@@ -51,6 +51,13 @@ void Broadcast_impl( Matrix<T,D>& A, mpi::Comm const& comm, int rank )
     }
 }
 
+template<typename T, Device D>
+void Broadcast( Matrix<T,D>& A, mpi::Comm const& comm, int rank )
+{
+    EL_DEBUG_CSE
+    Broadcast_impl( A, comm, rank );
+}
+
 template<typename T>
 void Broadcast( AbstractMatrix<T>& A, mpi::Comm const& comm, int rank )
 {
@@ -95,7 +95,8 @@ void Helper
     if (includeViewers)
     {
         const int viewingSize = mpi::Size(g.ViewingComm());
-        const int distBSize = mpi::Size(B.DistComm());
+        // B.DistComm() is only valid on the processes which own B
+        const int distBSize = B.DistSize();
 
         vector<int> distBToViewing(distBSize);
         for(int distBRank=0; distBRank<distBSize; ++distBRank)
@@ -205,7 +206,9 @@ void GeneralPurpose
 
 #ifdef EL_HAVE_SCALAPACK
     const bool useBLACSRedist = true;
-    if (useBLACSRedist &&
+    // The BLACS context of A is used for the redistribution, so it must
+    // encompass the processes of B as well
+    if (useBLACSRedist && A.Grid() == B.Grid() &&
         A.ColDist() == MC && A.RowDist() == MR &&
         B.ColDist() == MC && B.RowDist() == MR &&
         A.ColCut() == 0 && A.RowCut() == 0 &&
@@ -218,10 +221,6 @@ void GeneralPurpose
 
         // This appears to be noticeably faster than the current
         // Elemental-native scheme which also transmits metadata
-        //
-        // Hmmm...should there be some type of check to ensure that the
-        // entire set of processes in contextA encompasses the entire set of
-        // processes used for A and B?
         blacs::Redistribute
         (A.Height(), A.Width(),
           A.LockedBuffer(), descA.data(),
@@ -23,6 +23,8 @@ Base<F> Nrm2( const Matrix<F>& x )
       if( x.Height() != 1 && x.Width() != 1 )
           LogicError("Expected vector input");
     )
+    if( IsBlasScalar<F>::value && ReproducibleReductions() )
+        return ReproducibleFrobeniusNorm( x, mpi::COMM_SELF );
     Base<F> norm;
     if( x.Width() == 1 )
         norm = blas::Nrm2( x.Height(), x.LockedBuffer(), 1 );
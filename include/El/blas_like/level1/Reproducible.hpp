@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_REPRODUCIBLE_HPP
+#define EL_BLAS_REPRODUCIBLE_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace El {
+
+// An exact accumulator for sums of doubles (a "superaccumulator" in the sense
+// of Kulisch). The sum is stored as a fixed-point number whose 32-bit digits
+// are held in 64-bit words that span the entire range of the finite doubles.
+// The spare bits of each word absorb carries, so any number of doubles can be
+// added, in any order, without rounding error, and, since integer addition is
+// associative, the accumulators of different threads and processes can be
+// combined with a plain integer sum.
+class Superaccumulator
+{
+public:
+    // Digit i has weight 2^(32 i - 1074)
+    static const Int numDigits = 66;
+    // The digits are followed by the numbers of NaN's, +Inf's, and -Inf's
+    static const Int size = numDigits + 3;
+
+    Superaccumulator() { Zero(); }
+    void Zero();
+
+    // sum := sum + alpha
+    void Update( double alpha );
+    // sum := sum + alpha beta, which is exact unless the product underflows
+    void UpdateProduct( double alpha, double beta );
+    // sum := sum + other
+    void Update( const Superaccumulator& other );
+
+    // Propagate carries so that every digit but the last lies in [0,2^32)
+    void Normalize();
+    // Return the sum rounded to the nearest double (with ties to even)
+    double Round() const;
+
+    long long* Buffer() EL_NO_EXCEPT { return digits_; }
+    const long long* LockedBuffer() const EL_NO_EXCEPT { return digits_; }
+
+private:
+    long long digits_[size];
+    // The number of updates since the last normalization
+    Int numUpdates_;
+};
+
+inline void Superaccumulator::Update( double alpha )
+{
+    std::uint64_t bits;
+    std::memcpy( &bits, &alpha, sizeof(double) );
+    const std::uint64_t mantissaMask = (std::uint64_t(1)<<52)-1;
+    const unsigned exponent = unsigned(bits>>52) & 0x7FF;
+    const bool negative = (bits>>63) != 0;
+    std::uint64_t mantissa = bits & mantissaMask;
+    if( exponent == 0x7FF )
+    {
+        if( mantissa != 0 )
+            ++digits_[numDigits];
+        else if( negative )
+            ++digits_[numDigits+2];
+        else
+            ++digits_[numDigits+1];
+        return;
+    }
+
+    // alpha = mantissa 2^(shift-1074)
+    unsigned shift = 0;
+    if( exponent != 0 )
+    {
+        mantissa |= std::uint64_t(1)<<52;
+        shift = exponent - 1;
+    }
+    const unsigned i = shift / 32;
+    const unsigned r = shift % 32;
+    const std::uint64_t digitMask = (std::uint64_t(1)<<32)-1;
+    const std::uint64_t high = mantissa >> (32-r);
+    const long long d0 = (mantissa << r) & digitMask;
+    const long long d1 = high & digitMask;
+    const long long d2 = high >> 32;
+    if( negative )
+    {
+        digits_[i]   -= d0;
+        digits_[i+1] -= d1;
+        digits_[i+2] -= d2;
+    }
+    else
+    {
+        digits_[i]   += d0;
+        digits_[i+1] += d1;
+        digits_[i+2] += d2;
+    }
+
+    // Each update changes a digit by less than 2^32, so 2^30 updates cannot
+    // overflow a word
+    if( ++numUpdates_ == (Int(1)<<30) )
+        Normalize();
+}
+
+inline void Superaccumulator::UpdateProduct( double alpha, double beta )
+{
+    const double product = alpha*beta;
+    Update( product );
+    if( std::isfinite(product) )
+    {
+        const double error = std::fma( alpha, beta, -product );
+        if( error != 0 )
+            Update( error );
+    }
+}
+
+// Sum each of the 'n' accumulators over the processes in 'comm'
+void AllReduce( Superaccumulator* sums, Int n, mpi::Comm const& comm );
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_REPRODUCIBLE_HPP
@@ -111,7 +111,8 @@ void SafeScale
 ( Base<Field> numerator, Base<Field> denominator, AbstractDistMatrix<Field>& A )
 {
     EL_DEBUG_CSE
-    SafeScale( numerator, denominator, A.Matrix() );
+    SafeScale
+    ( numerator, denominator, static_cast<Matrix<Field>&>(A.Matrix()) );
 }
 
 template<typename Field>
@@ -1320,6 +1320,42 @@ void RealPart
 ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<Base<T>>& AReal );
 /* TODO(poulson): Sparse versions */
 
+// Reproducible reductions
+// =======================
+// By default, a distributed sum adds up the partial sums of each process in
+// whatever order MPI chooses, so that, for example, the result of Dot or
+// FrobeniusNorm depends upon the process grid. When reproducible reductions
+// are enabled, the sums underlying Dot, HilbertSchmidt, Nrm2, FrobeniusNorm,
+// ColumnTwoNorms and RowTwoNorms of single- and double-precision data are
+// accumulated exactly and only rounded once, so that the results are bitwise
+// identical for any process grid and any number of threads.
+bool ReproducibleReductions();
+void SetReproducibleReductions( bool reproducible );
+
+// The following are only supported for the BLAS scalars (those for which
+// IsBlasScalar<T> is true) and each reduces over the local matrices held by
+// the processes in 'comm'
+
+// The sum of the entrywise products of Conj(A) and B
+template<typename Ring>
+Ring ReproducibleHilbertSchmidt
+( const Matrix<Ring>& ALoc, const Matrix<Ring>& BLoc,
+  mpi::Comm const& comm );
+
+template<typename Field>
+Base<Field> ReproducibleFrobeniusNorm
+( const Matrix<Field>& ALoc, mpi::Comm const& comm );
+
+template<typename Field>
+void ReproducibleColumnTwoNorms
+( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc,
+  mpi::Comm const& comm );
+
+template<typename Field>
+void ReproducibleRowTwoNorms
+( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc,
+  mpi::Comm const& comm );
+
 // Reshape
 // =======
 template<typename T>
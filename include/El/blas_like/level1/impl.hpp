@@ -47,6 +47,7 @@
 #include <El/blas_like/level1/QuasiDiagonalSolve.hpp>
 #include <El/blas_like/level1/RealPart.hpp>
 #include <El/blas_like/level1/Recv.hpp>
+#include <El/blas_like/level1/Reproducible.hpp>
 #include <El/blas_like/level1/Reshape.hpp>
 #include <El/blas_like/level1/Rotate.hpp>
 #include <El/blas_like/level1/Round.hpp>
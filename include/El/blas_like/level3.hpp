@@ -17,6 +17,10 @@ template<typename T> Int LocalTrrkBlocksize();
 template<typename T> void SetLocalTrr2kBlocksize( Int blocksize );
 template<typename T> Int LocalTrr2kBlocksize();
 
+// The problem size below which GEMM_STRASSEN switches to classical products
+template<typename T> void SetStrassenCutoff( Int cutoff );
+template<typename T> Int StrassenCutoff();
+
 // Gemm
 // ====
 namespace GemmAlgorithmNS {
@@ -26,7 +30,8 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_STRASSEN
 };
 }
 using namespace GemmAlgorithmNS;
@@ -61,6 +66,13 @@ void Gemm
 ( Orientation orientA, Orientation orientB,
   T alpha, const Matrix<T,D>& A, const Matrix<T,D>& B, Matrix<T,D>& C );
 
+// Only GEMM_STRASSEN changes the sequential algorithm
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta, Matrix<T>& C, GemmAlgorithm alg );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -198,6 +210,26 @@ void MultiShiftTrsm
   F alpha, const AbstractDistMatrix<F>& U, const AbstractDistMatrix<F>& shifts,
   AbstractDistMatrix<F>& X );
 
+// Multiply
+// ========
+// Y := alpha op(A) X + beta Y for a sparse A stored in CSR form; a Graph is
+// treated as a sparse matrix whose nonzeros are all one
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const Graph& A, const Matrix<T>& X,
+  T beta,                        Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
+  T beta,                                      DistMultiVec<T>& Y );
+
 // SafeMultiShiftTrsm
 // ==================
 template<typename F>
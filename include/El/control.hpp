@@ -82,6 +82,107 @@ void Sylvester
         ElementalMatrix<F>& X, 
   SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Low-rank solvers
+// ================
+// After a one-time reduction of the (dense) coefficient matrices to
+// Hessenberg form, each low-rank ADI step is a multi-shift Hessenberg solve
+// against the current k columns, which costs O(n^2 k) work, and the solution
+// is accumulated in factored form using O(n k) memory per step. The block
+// Krylov (Galerkin) variant of the Lyapunov solver only requires products
+// with A and therefore avoids the reduction entirely.
+template<typename Real>
+struct LowRankCtrl
+{
+    Int maxIts=100;
+    // Relative residual norm at which the iteration stops
+    Real tol=Real(1e-10);
+    // The number of ADI shifts chosen via Penzl's heuristic from the Ritz
+    // values of Arnoldi processes with the coefficient matrix and its inverse,
+    // each of which is run for numRitzSteps steps
+    Int numShifts=12;
+    Int numRitzSteps=24;
+    // Use a block Krylov subspace (Galerkin) method rather than ADI
+    // (only supported by the Lyapunov solver)
+    bool krylov=false;
+    bool progress=false;
+};
+
+template<typename Real>
+struct LowRankInfo
+{
+    Int numIts=0;
+    // For the Lyapunov solvers, both ADI and Krylov report
+    //   || A Z Z^H + Z Z^H A^H - G G^H ||_F / || G G^H ||_F
+    Real relResidual=Real(0);
+};
+
+// Returns Z such that X = Z Z^H approximately solves
+//   A X + X A^H = G G^H,
+// where A has all of its eigenvalues in the open right-half plane
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankLyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& G,
+        Matrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl=LowRankCtrl<Base<F>>() );
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankLyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& G,
+        ElementalMatrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl=LowRankCtrl<Base<F>>() );
+
+// Returns Z, d, and Y such that X = Z diag(d) Y^H approximately solves
+//   A X + X B = U V^H,
+// where A and B have all of their eigenvalues in the open right-half plane
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankSylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& U,
+  const Matrix<F>& V,
+        Matrix<F>& Z,
+        Matrix<F>& d,
+        Matrix<F>& Y,
+  const LowRankCtrl<Base<F>>& ctrl=LowRankCtrl<Base<F>>() );
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankSylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& U,
+  const ElementalMatrix<F>& V,
+        ElementalMatrix<F>& Z,
+        ElementalMatrix<F>& d,
+        ElementalMatrix<F>& Y,
+  const LowRankCtrl<Base<F>>& ctrl=LowRankCtrl<Base<F>>() );
+
+// Returns Z such that X = Z Z^H approximately solves
+//   X (B B^H) X - A^H X - X A = C^H C
+// via the Newton-Kleinman iteration, where each Newton step is a low-rank
+// ADI solve. A must have all of its eigenvalues in the open left-half plane
+// so that the zero matrix is a stabilizing initial guess. The number of
+// iterations in the returned info is the number of Newton steps.
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankRiccati
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl=LowRankCtrl<Base<F>>() );
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankRiccati
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl=LowRankCtrl<Base<F>>() );
+
 } // namespace El
 
 #endif // ifndef EL_CONTROL_HPP
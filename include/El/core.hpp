@@ -326,6 +326,12 @@ class DistMatrix;
 
 #include <El/core/DistMap.hpp>
 
+#include <El/core/Graph.hpp>
+#include <El/core/DistGraph.hpp>
+#include <El/core/SparseMatrix.hpp>
+#include <El/core/DistSparseMatrix.hpp>
+#include <El/core/DistMultiVec.hpp>
+
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
 
@@ -430,17 +430,10 @@ template<typename T>
 AbstractMatrix<T> const&
 AbstractMatrix<T>::operator*=(T const& alpha)
 {
-    switch(this->GetDevice()) {
-    case Device::CPU:
-      return static_cast<Matrix<T,Device::CPU>*>(this)->operator*=(alpha);
-#ifdef HYDROGEN_HAVE_CUDA
-    case Device::GPU:
-      return static_cast<Matrix<T,Device::GPU>*>(this)->operator*=(alpha);
-#endif // HYDROGEN_HAVE_CUDA
-    default:
-        LogicError("Unsupported device type.");
-    }
-    return *this;// silence compiler warning
+    // Neither Matrix specialization overrides this operator, so dispatching
+    // to them would recurse; Scale handles the device dispatch itself
+    Scale(alpha, *this);
+    return *this;
 }
 
 // Addition/subtraction
@@ -454,7 +447,10 @@ AbstractMatrix<T>::operator+=(AbstractMatrix<T> const& A)
 
     switch(this->GetDevice()) {
     case Device::CPU:
-      return static_cast<Matrix<T,Device::CPU>*>(this)->operator+=(A);
+      // Matrix<T,Device::CPU> does not override this operator, so
+      // dispatching to it would recurse
+      Axpy(T(1), A, *this);
+      return *this;
 #ifdef HYDROGEN_HAVE_CUDA
     case Device::GPU:
       return static_cast<Matrix<T,Device::GPU>*>(this)->operator+=(A);
@@ -474,7 +470,10 @@ AbstractMatrix<T>::operator-=(AbstractMatrix<T> const& A)
 
     switch(this->GetDevice()) {
     case Device::CPU:
-      return static_cast<Matrix<T,Device::CPU>*>(this)->operator-=(A);
+      // Matrix<T,Device::CPU> does not override this operator, so
+      // dispatching to it would recurse
+      Axpy(T(-1), A, *this);
+      return *this;
 #ifdef HYDROGEN_HAVE_CUDA
     case Device::GPU:
       return static_cast<Matrix<T,Device::GPU>*>(this)->operator-=(A);
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTGRAPH_HPP
+#define EL_CORE_DISTGRAPH_HPP
+
+namespace El {
+
+class Graph;
+template<typename T> class DistSparseMatrix;
+
+// The communication plan for multiplying a row-distributed sparse matrix
+// against a row-distributed multivector. Each process needs the rows of the
+// multivector indexed by the unique targets of its local edges (its 'halo');
+// they are requested from their owners once and the plan is then reused for
+// every subsequent product until the sparsity pattern changes.
+struct DistGraphMultMeta
+{
+    bool ready=false;
+
+    // NOTE: The 'send' and 'recv' roles reverse for adjoint multiplication
+    Int numRecvInds=0;
+    vector<int> sendSizes, sendOffs,
+                recvSizes, recvOffs;
+    // The local rows of the multivector to pack for the other processes
+    vector<Int> sendInds;
+    // The position of the target of each local edge within the received rows
+    vector<Int> colOffs;
+
+    void Clear()
+    {
+        ready = false;
+        numRecvInds = 0;
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( sendInds );
+        SwapClear( colOffs );
+    }
+};
+
+// A directed graph whose sources are distributed over the processes of a grid
+// in contiguous blocks (using the same convention as DistMap), with each
+// process storing the edges of its sources in CSR form.
+class DistGraph
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistGraph( const El::Grid& grid=El::Grid::Default() );
+    DistGraph( Int numSources, const El::Grid& grid=El::Grid::Default() );
+    DistGraph
+    ( Int numSources, Int numTargets,
+      const El::Grid& grid=El::Grid::Default() );
+    DistGraph( const DistGraph& graph );
+    ~DistGraph();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const DistGraph& operator=( const DistGraph& graph );
+
+    void Empty( bool freeMemory=true );
+    void Resize( Int numVertices );
+    void Resize( Int numSources, Int numTargets );
+    void SetGrid( const El::Grid& grid );
+
+    // Edge manipulation
+    // -----------------
+    void Reserve( Int numLocalEdges, Int numRemoteEdges=0 );
+
+    // Safe edge manipulation; these are collective since the connection may
+    // need to be forwarded to its owner
+    void Connect( Int source, Int target );
+    void ConnectLocal( Int localSource, Int target );
+    void Disconnect( Int source, Int target );
+    void DisconnectLocal( Int localSource, Int target );
+
+    // Queued edge manipulation; ProcessQueues must be called afterwards.
+    // If 'passive' is true, connections with non-local sources are dropped.
+    void QueueConnection
+    ( Int source, Int target, bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void QueueLocalConnection
+    ( Int localSource, Int target ) EL_NO_RELEASE_EXCEPT;
+    void QueueDisconnection
+    ( Int source, Int target, bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void QueueLocalDisconnection
+    ( Int localSource, Int target ) EL_NO_RELEASE_EXCEPT;
+    // Collectively forward remote updates and process the local queues
+    void ProcessQueues();
+    // Only process the local queues (which requires no communication)
+    void ProcessLocalQueues();
+
+    // Queries
+    // =======
+    Int NumSources() const EL_NO_EXCEPT;
+    Int NumTargets() const EL_NO_EXCEPT;
+    Int FirstLocalSource() const EL_NO_EXCEPT;
+    Int NumLocalSources() const EL_NO_EXCEPT;
+    Int NumLocalEdges() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool LocallyConsistent() const EL_NO_EXCEPT;
+
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    int SourceOwner( Int source ) const EL_NO_RELEASE_EXCEPT;
+    Int GlobalSource( Int localSource ) const EL_NO_RELEASE_EXCEPT;
+    Int LocalSource( Int source ) const EL_NO_RELEASE_EXCEPT;
+
+    Int Source( Int localEdge ) const EL_NO_RELEASE_EXCEPT;
+    Int Target( Int localEdge ) const EL_NO_RELEASE_EXCEPT;
+    Int SourceOffset( Int localSource ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int localSource, Int target ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int localSource ) const EL_NO_RELEASE_EXCEPT;
+    bool EdgeExists( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+
+    // Return the ratio of the maximum number of local edges to the
+    // average (collective)
+    double Imbalance() const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+
+    // [ADVANCED] For directly filling the local source and target buffers,
+    // which must then be sorted before calling ForceConsistency
+    void ForceNumLocalEdges( Int numLocalEdges );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertLocallyConsistent() const;
+
+    // Return (and cache) the plan for multiplying against a multivector
+    // distributed with the same convention over NumTargets() rows
+    const DistGraphMultMeta& MultMeta() const;
+
+private:
+    Int numSources_=0, numTargets_=0;
+    const El::Grid* grid_;
+
+    Int blocksize_=1;
+    Int numLocalSources_=0;
+
+    bool locallyConsistent_=true;
+
+    vector<Int> sources_, targets_;
+    vector<std::pair<Int,Int>> markedForRemoval_;
+
+    vector<Int> remoteSources_, remoteTargets_;
+    vector<std::pair<Int,Int>> remoteRemovals_;
+
+    // localSourceOffsets_[sLoc] is the index of the first local edge of the
+    // local source sLoc, with one more entry holding the number of edges
+    vector<Int> localSourceOffsets_;
+
+    mutable DistGraphMultMeta multMeta_;
+
+    void InitializeLocalData();
+    void ComputeSourceOffsets();
+    void ForwardRemoteRemovals();
+
+    friend class Graph;
+    template<typename T> friend class DistSparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTGRAPH_HPP
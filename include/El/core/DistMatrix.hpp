@@ -56,6 +56,24 @@ inline void AssertSameDist( const DistTypeA& distA, const DistTypeB& distB )
 
 namespace El {
 
+// Whether the local buffer of A, together with FillDesc(A), already forms a
+// valid ScaLAPACK array, i.e., whether A may be handed to PBLAS/ScaLAPACK
+// in place. Most ScaLAPACK drivers additionally require square blocks.
+template<typename scalarType>
+inline bool ScaLAPACKCompatible
+( const AbstractDistMatrix<scalarType>& A, bool squareBlocks=true )
+{
+    if( A.ColDist() != MC || A.RowDist() != MR || A.Wrap() != BLOCK )
+        return false;
+    if( A.GetLocalDevice() != Device::CPU )
+        return false;
+    if( A.ColCut() != 0 || A.RowCut() != 0 )
+        return false;
+    if( squareBlocks && A.BlockHeight() != A.BlockWidth() )
+        return false;
+    return true;
+}
+
 #ifdef EL_HAVE_SCALAPACK
 
 namespace blacs {
@@ -84,6 +102,41 @@ FillDesc( const AbstractDistMatrix<scalarType>& A )
           A.ColAlign(), A.RowAlign(), int(A.LDim()) };
     return desc;
 }
+
+// Views of an array owned by ScaLAPACK code, e.g., so that Elemental routines
+// may be applied to it without a copy. The descriptor must have been created
+// within the BLACS context of g's [MC,MR] process grid.
+template<typename scalarType>
+inline void AttachToDesc
+( DistMatrix<scalarType,MC,MR,BLOCK>& A,
+  const Grid& g,
+  const typename blacs::Desc& desc,
+  scalarType* buffer )
+{
+    if( desc[0] != 1 )
+        LogicError("Only dense ScaLAPACK descriptors are supported");
+    if( desc[1] != g.BlacsMCMRContext() )
+        LogicError("The descriptor's context did not match the grid");
+    A.Attach
+    ( desc[2], desc[3], g, desc[4], desc[5], desc[6], desc[7], 0, 0,
+      buffer, desc[8] );
+}
+
+template<typename scalarType>
+inline void LockedAttachToDesc
+( DistMatrix<scalarType,MC,MR,BLOCK>& A,
+  const Grid& g,
+  const typename blacs::Desc& desc,
+  const scalarType* buffer )
+{
+    if( desc[0] != 1 )
+        LogicError("Only dense ScaLAPACK descriptors are supported");
+    if( desc[1] != g.BlacsMCMRContext() )
+        LogicError("The descriptor's context did not match the grid");
+    A.LockedAttach
+    ( desc[2], desc[3], g, desc[4], desc[5], desc[6], desc[7], 0, 0,
+      buffer, desc[8] );
+}
 #endif
 
 template<typename scalarType>
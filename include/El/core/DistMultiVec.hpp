@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTMULTIVEC_HPP
+#define EL_CORE_DISTMULTIVEC_HPP
+
+namespace El {
+
+// A set of dense column vectors whose rows are distributed over the processes
+// of a grid in contiguous blocks, matching the row distribution of
+// DistSparseMatrix (and the source distribution of DistGraph and DistMap).
+template<typename T>
+class DistMultiVec
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistMultiVec( const El::Grid& grid=El::Grid::Default() );
+    DistMultiVec
+    ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
+    DistMultiVec( const DistMultiVec<T>& A );
+    ~DistMultiVec();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const DistMultiVec<T>& operator=( const DistMultiVec<T>& A );
+
+    void Empty();
+    void Resize( Int height, Int width );
+    void SetGrid( const El::Grid& grid );
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int FirstLocalRow() const EL_NO_EXCEPT;
+    Int LocalHeight() const EL_NO_EXCEPT;
+
+    El::Matrix<T>& Matrix() EL_NO_EXCEPT;
+    const El::Matrix<T>& LockedMatrix() const EL_NO_EXCEPT;
+
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    int RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT;
+    Int GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT;
+    Int LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+    bool IsLocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+
+    // Entry manipulation
+    // ==================
+
+    // Broadcast the entry from its owner (collective)
+    T Get( Int i, Int j ) const;
+    // Only the owner of the row performs the modification
+    void Set( Int i, Int j, const T& value ) EL_NO_RELEASE_EXCEPT;
+    void Set( const Entry<T>& entry ) EL_NO_RELEASE_EXCEPT;
+    void Update( Int i, Int j, const T& value ) EL_NO_RELEASE_EXCEPT;
+    void Update( const Entry<T>& entry ) EL_NO_RELEASE_EXCEPT;
+
+    T GetLocal( Int iLoc, Int j ) const EL_NO_RELEASE_EXCEPT;
+    void SetLocal( Int iLoc, Int j, const T& value ) EL_NO_RELEASE_EXCEPT;
+    void UpdateLocal( Int iLoc, Int j, const T& value ) EL_NO_RELEASE_EXCEPT;
+
+    // Queue updates of (possibly) remote entries and then collectively apply
+    // them with ProcessQueues. If 'passive' is true, remote updates are
+    // dropped.
+    void Reserve( Int numRemoteUpdates );
+    void QueueUpdate
+    ( Int i, Int j, const T& value, bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void QueueUpdate
+    ( const Entry<T>& entry, bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+private:
+    Int height_=0, width_=0;
+    const El::Grid* grid_;
+
+    Int blocksize_=1;
+
+    El::Matrix<T> matrix_;
+
+    vector<Entry<T>> remoteUpdates_;
+
+    void InitializeLocalData();
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTMULTIVEC_HPP
@@ -16,7 +16,7 @@ namespace El {
 struct PermutationMeta
 {
     Int align;
-    mpi::Comm comm;
+    const mpi::Comm* comm;
 
     // Will treat vector lengths as one
     vector<int> sendCounts, sendDispls,
@@ -52,7 +52,7 @@ struct PermutationMeta
     }
 
     PermutationMeta()
-        : align(0), /*comm(mpi::COMM_SELF), FIXME (trb)*/
+        : align(0), comm(nullptr),
           sendCounts(1,0), sendDispls(1,0),
           recvCounts(1,0), recvDispls(1,0)
     { }
@@ -61,13 +61,22 @@ struct PermutationMeta
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
             Int permAlign,
-            mpi::Comm permComm );
+      const mpi::Comm& permComm );
+
+    // Form the metadata for an explicit list of row movements, where the
+    // row with index origins[k]+offset is sent to index dests[k]+offset
+    PermutationMeta
+    ( const vector<Int>& origins,
+      const vector<Int>& dests,
+            Int offset,
+            Int permAlign,
+      const mpi::Comm& permComm );
 
     void Update
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
             Int permAlign,
-            mpi::Comm permComm );
+      const mpi::Comm& permComm );
 };
 
 // TODO(poulson): Convert to accepting Grid rather than mpi::Comm
@@ -142,6 +151,28 @@ public:
     ( AbstractDistMatrix<T>& A,
       Int offset=0 ) const;
 
+    // Apply the permutation to several matrices at once. All of the matrices
+    // which share a distribution communicator and alignment are exchanged
+    // together so that, for example, a block of pivots can be applied to both
+    // the trailing matrix and the right-hand sides with a single AllToAll.
+    template<typename T>
+    void PermuteCols
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset=0 ) const;
+    template<typename T>
+    void InversePermuteCols
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset=0 ) const;
+
+    template<typename T>
+    void PermuteRows
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset=0 ) const;
+    template<typename T>
+    void InversePermuteRows
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset=0 ) const;
+
     template<typename T>
     void PermuteSymmetrically
     ( UpperOrLower uplo,
@@ -179,16 +210,40 @@ private:
     mutable bool implicitSwapOrigins_=true;
     mutable DistMatrix<Int,VC,STAR> swapDests_, swapOrigins_;
 
+    // The net effect of the swap sequence is a product of disjoint cycles
+    // over the indices it touches. Rather than applying the swaps one at a
+    // time, the (redundantly stored) list of rows which actually move is
+    // formed once and then used to build a single exchange per communicator.
+    mutable bool staleMoves_=true;
+    mutable vector<Int> moveOrigins_, moveDests_;
+    void FormMoves() const;
+
     // Only used if swapSequence_=false
     // --------------------------------
     mutable DistMatrix<Int,VC,STAR> perm_;
     mutable DistMatrix<Int,VC,STAR> invPerm_;
     mutable bool staleInverse_=true;
 
-    // Use the alignment and communicator as a key
-    typedef std::pair<Int,mpi::Comm> keyType_;
+    // Only the metadata for matrices over the permutation's own grid is
+    // cached, keyed by the alignment and distribution, so that a key never
+    // refers to the communicator of a grid which may since have been freed
+    typedef std::pair<Int,Dist> keyType_;
     mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
     mutable bool staleMeta_=false;
+
+    PermutationMeta ExplicitMeta( Int align, const mpi::Comm& comm ) const;
+    const PermutationMeta& ExplicitMeta
+    ( std::map<keyType_,PermutationMeta>& metaMap,
+      Int align, Dist dist, const mpi::Comm& comm ) const;
+
+    template<typename T>
+    void ApplyToCols
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset, bool inverse ) const;
+    template<typename T>
+    void ApplyToRows
+    ( const vector<AbstractDistMatrix<T>*>& As,
+      Int offset, bool inverse ) const;
 };
 
 } // namespace El
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTSPARSEMATRIX_HPP
+#define EL_CORE_DISTSPARSEMATRIX_HPP
+
+namespace El {
+
+// A sparse matrix whose rows are distributed over the processes of a grid in
+// contiguous blocks (as with DistMap and DistMultiVec), with each process
+// storing its rows in CSR form on top of a DistGraph.
+template<typename T>
+class DistSparseMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistSparseMatrix( const El::Grid& grid=El::Grid::Default() );
+    DistSparseMatrix
+    ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
+    DistSparseMatrix( const DistSparseMatrix<T>& A );
+    ~DistSparseMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const DistSparseMatrix<T>& operator=( const DistSparseMatrix<T>& A );
+
+    void Empty( bool clearMemory=true );
+    void Resize( Int height, Int width );
+    void SetGrid( const El::Grid& grid );
+
+    // Entry manipulation
+    // ------------------
+    void Reserve( Int numLocalEntries, Int numRemoteEntries=0 );
+
+    // Queued entry manipulation; ProcessQueues must be called afterwards.
+    // If 'passive' is true, updates of non-local rows are dropped.
+    void QueueUpdate
+    ( Int row, Int col, const T& value,
+      bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void QueueUpdate
+    ( const Entry<T>& entry, bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void QueueLocalUpdate
+    ( Int localRow, Int col, const T& value ) EL_NO_RELEASE_EXCEPT;
+    void QueueZero
+    ( Int row, Int col, bool passive=false ) EL_NO_RELEASE_EXCEPT;
+    void QueueLocalZero( Int localRow, Int col ) EL_NO_RELEASE_EXCEPT;
+    // Collectively forward remote updates and process the local queues
+    void ProcessQueues();
+    // Only process the local queues (which requires no communication)
+    void ProcessLocalQueues();
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int FirstLocalRow() const EL_NO_EXCEPT;
+    Int LocalHeight() const EL_NO_EXCEPT;
+    Int NumLocalEntries() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool LocallyConsistent() const EL_NO_EXCEPT;
+
+    El::DistGraph& DistGraph() EL_NO_EXCEPT;
+    const El::DistGraph& LockedDistGraph() const EL_NO_EXCEPT;
+
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    int RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT;
+    Int GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT;
+    Int LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT;
+
+    Int Row( Int localInd ) const EL_NO_RELEASE_EXCEPT;
+    Int Col( Int localInd ) const EL_NO_RELEASE_EXCEPT;
+    T Value( Int localInd ) const EL_NO_RELEASE_EXCEPT;
+    Int RowOffset( Int localRow ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int localRow, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int localRow ) const EL_NO_RELEASE_EXCEPT;
+
+    // Return the ratio of the maximum number of local entries to the
+    // average (collective)
+    double Imbalance() const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    T* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const T* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    // [ADVANCED] For directly filling the local row, column, and value buffers
+    void ForceNumLocalEntries( Int numLocalEntries );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertLocallyConsistent() const;
+
+    // Return (and cache) the halo-exchange plan for products with a
+    // DistMultiVec of height Width()
+    const DistGraphMultMeta& MultMeta() const;
+
+private:
+    El::DistGraph distGraph_;
+    vector<T> vals_;
+    vector<T> remoteVals_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTSPARSEMATRIX_HPP
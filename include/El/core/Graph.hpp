@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_GRAPH_HPP
+#define EL_CORE_GRAPH_HPP
+
+namespace El {
+
+class DistGraph;
+template<typename T> class SparseMatrix;
+
+// A directed graph stored in Compressed Sparse Row (CSR) form: the edges are
+// kept sorted by (source,target) with an offset array marking the first edge
+// of each source. The source of each edge is also stored so that the edge list
+// can double as a coordinate representation.
+//
+// Edges may either be inserted one at a time via Connect, which maintains the
+// sorted structure after each call, or queued with QueueConnection and then
+// sorted and compressed in bulk via ProcessQueues.
+class Graph
+{
+public:
+    // Constructors and destructors
+    // ============================
+    Graph();
+    Graph( Int numSources );
+    Graph( Int numSources, Int numTargets );
+    Graph( const Graph& graph );
+    // NOTE: This requires the distributed graph to be over a single process
+    Graph( const DistGraph& graph );
+    ~Graph();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const Graph& operator=( const Graph& graph );
+    // NOTE: This requires the distributed graph to be over a single process
+    const Graph& operator=( const DistGraph& graph );
+
+    // Return the subgraph with sources in I and targets in J
+    Graph operator()( Range<Int> I, Range<Int> J ) const;
+
+    void Empty( bool clearMemory=true );
+    void Resize( Int numVertices );
+    void Resize( Int numSources, Int numTargets );
+
+    // Edge manipulation
+    // -----------------
+    void Reserve( Int numEdges );
+
+    // Safe edge manipulation; the graph is kept consistent after each call
+    void Connect( Int source, Int target );
+    void Disconnect( Int source, Int target );
+
+    // Queued edge manipulation; ProcessQueues must be called afterwards
+    void QueueConnection( Int source, Int target ) EL_NO_RELEASE_EXCEPT;
+    void QueueDisconnection( Int source, Int target ) EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+    // Queries
+    // =======
+    Int NumSources() const EL_NO_EXCEPT;
+    Int NumTargets() const EL_NO_EXCEPT;
+    Int NumEdges() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool Consistent() const EL_NO_EXCEPT;
+
+    Int Source( Int edge ) const EL_NO_RELEASE_EXCEPT;
+    Int Target( Int edge ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the first edge with the given source
+    Int SourceOffset( Int source ) const EL_NO_RELEASE_EXCEPT;
+    // The index of the (source,target) edge, or of where it would be inserted
+    Int Offset( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int source ) const EL_NO_RELEASE_EXCEPT;
+    bool EdgeExists( Int source, Int target ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+
+    // [ADVANCED] For directly filling the source and target buffers, which
+    // must then be sorted by (source,target) before calling ForceConsistency
+    void ForceNumEdges( Int numEdges );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    Int numSources_=0, numTargets_=0;
+    bool consistent_=true;
+
+    vector<Int> sources_, targets_;
+    vector<std::pair<Int,Int>> markedForRemoval_;
+
+    // sourceOffsets_[s] is the index of the first edge with source s and
+    // sourceOffsets_[numSources_] is the number of edges
+    vector<Int> sourceOffsets_;
+
+    void ComputeSourceOffsets();
+
+    friend class DistGraph;
+    template<typename T> friend class SparseMatrix;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_GRAPH_HPP
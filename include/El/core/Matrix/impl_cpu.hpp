@@ -56,7 +56,7 @@ Matrix<Ring, Device::CPU>::Matrix
 
 template<typename Ring>
 Matrix<Ring, Device::CPU>::Matrix(Matrix<Ring, Device::CPU> const& A)
-  : AbstractMatrix<Ring>(A)
+  : AbstractMatrix<Ring>{A.Height(),A.Width(),A.Height()}
 {
     EL_DEBUG_CSE
     if (&A != this)
@@ -15,6 +15,11 @@ namespace El
 template <Device D>
 constexpr unsigned DefaultMemoryMode();
 
+// The CPU memory modes are: 0 for operator new, 1 for CUDA pinned memory, and
+// LimbArenaMemoryMode, which (for BigFloat only) stores the limbs of all of
+// the entries within one contiguous allocation of fixed precision
+constexpr unsigned LimbArenaMemoryMode = 2;
+
 template <>
 constexpr unsigned DefaultMemoryMode<Device::CPU>()
 {
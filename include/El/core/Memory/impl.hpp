@@ -25,12 +25,34 @@ namespace El
 namespace
 {
 
+template <typename G>
+G* NewLimbArena(size_t)
+{
+    RuntimeError("Only BigFloat supports the limb arena memory mode");
+    return nullptr;
+}
+
+template <typename G>
+void DeleteLimbArena(G*)
+{ }
+
+#ifdef HYDROGEN_HAVE_MPC
+template <>
+inline BigFloat* NewLimbArena<BigFloat>(size_t size)
+{ return mpfr::NewLimbArena(size); }
+
+template <>
+inline void DeleteLimbArena<BigFloat>(BigFloat* ptr)
+{ mpfr::DeleteLimbArena(ptr); }
+#endif // HYDROGEN_HAVE_MPC
+
 template <typename G>
 G* New(size_t size, unsigned int mode, SyncInfo<Device::CPU> const&)
 {
     G* ptr = nullptr;
     switch (mode) {
     case 0: ptr = new G[size]; break;
+    case LimbArenaMemoryMode: ptr = NewLimbArena<G>(size); break;
 #ifdef HYDROGEN_HAVE_CUDA
     case 1:
     {
@@ -54,6 +76,7 @@ void Delete( G*& ptr, unsigned int mode, SyncInfo<Device::CPU> const& )
 {
     switch (mode) {
     case 0: delete[] ptr; break;
+    case LimbArenaMemoryMode: DeleteLimbArena(ptr); break;
 #ifdef HYDROGEN_HAVE_CUDA
     case 1:
     {
@@ -216,12 +239,16 @@ G* Memory<G,D>::Require(size_t size)
             throw e;
         }
 #endif
+        // The entries of a limb arena are constructed as zeros
+        if(mode_ != LimbArenaMemoryMode)
+        {
 #ifdef EL_ZERO_INIT
-        MemZero(buffer_, size_, mode_, syncInfo_);
-#elif defined(EL_HAVE_VALGRIND)
-        if(EL_RUNNING_ON_VALGRIND)
             MemZero(buffer_, size_, mode_, syncInfo_);
+#elif defined(EL_HAVE_VALGRIND)
+            if(EL_RUNNING_ON_VALGRIND)
+                MemZero(buffer_, size_, mode_, syncInfo_);
 #endif
+        }
     }
     return buffer_;
 }
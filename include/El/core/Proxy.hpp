@@ -157,6 +157,36 @@ struct ProxyCtrl
     { }
 };
 
+// Request an uncut block-cyclic [MC,MR] proxy which ScaLAPACK can consume
+// directly. Compatible matrices keep their own blocksizes and alignments so
+// that no redistribution is performed; anything else is redistributed into
+// square blocks of the given size.
+template<typename T>
+inline ProxyCtrl ScaLAPACKProxyCtrl
+( const AbstractDistMatrix<T>& A, Int blocksize=DefaultBlockHeight() )
+{
+    ProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    ctrl.colCut = 0;
+    ctrl.rowCut = 0;
+    if( ScaLAPACKCompatible( A ) )
+    {
+        ctrl.blockHeight = A.BlockHeight();
+        ctrl.blockWidth = A.BlockWidth();
+        ctrl.colAlign = A.ColAlign();
+        ctrl.rowAlign = A.RowAlign();
+    }
+    else
+    {
+        ctrl.blockHeight = blocksize;
+        ctrl.blockWidth = blocksize;
+        ctrl.colAlign = 0;
+        ctrl.rowAlign = 0;
+    }
+    return ctrl;
+}
+
 struct ElementalProxyCtrl
 {
     bool colConstrain, rowConstrain, rootConstrain;
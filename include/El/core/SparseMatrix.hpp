@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEMATRIX_HPP
+#define EL_CORE_SPARSEMATRIX_HPP
+
+namespace El {
+
+// A sparse matrix stored in Compressed Sparse Row (CSR) form on top of a
+// Graph of its nonzero pattern, with the values stored in the same
+// (row,column)-sorted order as the edges. Queued updates of the same entry are
+// summed when the queues are processed.
+template<typename T>
+class SparseMatrix
+{
+public:
+    // Constructors and destructors
+    // ============================
+    SparseMatrix();
+    SparseMatrix( Int height, Int width );
+    SparseMatrix( const SparseMatrix<T>& A );
+    ~SparseMatrix();
+
+    // Assignment and reconfiguration
+    // ==============================
+    const SparseMatrix<T>& operator=( const SparseMatrix<T>& A );
+
+    // Return the submatrix with rows in I and columns in J
+    SparseMatrix<T> operator()( Range<Int> I, Range<Int> J ) const;
+
+    void Empty( bool clearMemory=true );
+    void Resize( Int height, Int width );
+
+    // Entry manipulation
+    // ------------------
+    void Reserve( Int numEntries );
+
+    // Safe entry manipulation; the matrix is kept consistent after each call
+    void Update( Int row, Int col, const T& value );
+    void Update( const Entry<T>& entry );
+    void Zero( Int row, Int col );
+
+    // Queued entry manipulation; ProcessQueues must be called afterwards
+    void QueueUpdate
+    ( Int row, Int col, const T& value ) EL_NO_RELEASE_EXCEPT;
+    void QueueUpdate( const Entry<T>& entry ) EL_NO_RELEASE_EXCEPT;
+    void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
+    void ProcessQueues();
+
+    // Queries
+    // =======
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumEntries() const EL_NO_EXCEPT;
+    Int Capacity() const EL_NO_EXCEPT;
+    bool Consistent() const EL_NO_EXCEPT;
+
+    El::Graph& Graph() EL_NO_EXCEPT;
+    const El::Graph& LockedGraph() const EL_NO_EXCEPT;
+
+    // Return zero if the entry is not in the sparsity pattern
+    T Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+    // The entry must already be in the sparsity pattern
+    void Set( Int row, Int col, const T& value ) EL_NO_RELEASE_EXCEPT;
+
+    Int Row( Int index ) const EL_NO_RELEASE_EXCEPT;
+    Int Col( Int index ) const EL_NO_RELEASE_EXCEPT;
+    T Value( Int index ) const EL_NO_RELEASE_EXCEPT;
+    Int RowOffset( Int row ) const EL_NO_RELEASE_EXCEPT;
+    Int Offset( Int row, Int col ) const EL_NO_RELEASE_EXCEPT;
+    Int NumConnections( Int row ) const EL_NO_RELEASE_EXCEPT;
+
+    Int* SourceBuffer() EL_NO_EXCEPT;
+    Int* TargetBuffer() EL_NO_EXCEPT;
+    Int* OffsetBuffer() EL_NO_EXCEPT;
+    T* ValueBuffer() EL_NO_EXCEPT;
+    const Int* LockedSourceBuffer() const EL_NO_EXCEPT;
+    const Int* LockedTargetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedOffsetBuffer() const EL_NO_EXCEPT;
+    const T* LockedValueBuffer() const EL_NO_EXCEPT;
+
+    // [ADVANCED] For directly filling the row, column, and value buffers
+    void ForceNumEntries( Int numEntries );
+    void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
+
+    void AssertConsistent() const;
+
+private:
+    El::Graph graph_;
+    vector<T> vals_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEMATRIX_HPP
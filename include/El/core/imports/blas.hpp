@@ -63,6 +63,15 @@ void Axpy
   const dcomplex& alpha,
   const dcomplex* x, BlasInt incx,
         dcomplex* y, BlasInt incy );
+#ifdef HYDROGEN_HAVE_QD
+// The double-double routines use vectorized error-free transformations
+// rather than QD's (out-of-line) arithmetic
+void Axpy
+( BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Copy
@@ -96,6 +105,12 @@ double Dot
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef HYDROGEN_HAVE_QD
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 T Dotc
@@ -121,6 +136,9 @@ template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx );
 double Nrm2( BlasInt n, const double  * x, BlasInt incx );
 double Nrm2( BlasInt n, const dcomplex* x, BlasInt incx );
+#ifdef HYDROGEN_HAVE_QD
+DoubleDouble Nrm2( BlasInt n, const DoubleDouble* x, BlasInt incx );
+#endif
 
 template<typename F>
 BlasInt MaxInd( BlasInt n, const F* x, BlasInt incx );
@@ -235,6 +253,15 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
+#ifdef HYDROGEN_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Ger
@@ -585,6 +612,15 @@ void Gemm
   const dcomplex* B, BlasInt BLDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef HYDROGEN_HAVE_QD
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Hemm
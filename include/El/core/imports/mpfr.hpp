@@ -321,6 +321,11 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    // Whether the limbs were allocated by MPFR (rather than an arena)
+    bool ownsLimbs_ = true;
+    // The number of limbs reserved for this entry by its arena, which bounds
+    // its precision (and is unaffected by lowering it)
+    size_t arenaLimbs_ = 0;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
@@ -333,6 +338,7 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        OwnsLimbs() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
@@ -360,6 +366,11 @@ public:
     BigFloat
     ( const std::string& str, int base, mpfr_prec_t prec=mpfr::Precision() );
     BigFloat( BigFloat&& a );
+    // Construct a zero whose limbs are provided (and later freed) by the
+    // caller, e.g., a contiguous arena shared by the entries of a matrix.
+    // There must be room for mpfr_custom_get_size(prec) bytes. The precision
+    // of such a BigFloat can not be increased, and moving from it copies.
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec );
     ~BigFloat();
 
     void Zero();
@@ -649,6 +660,16 @@ bool operator!=( const BigFloat& a, const BigFloat& b );
 std::ostream& operator<<( std::ostream& os, const BigFloat& alpha );
 std::istream& operator>>( std::istream& is,       BigFloat& alpha );
 
+namespace mpfr {
+
+// Allocate 'size' zeros of the current precision whose limbs all lie within a
+// single allocation (so that no per-entry allocation is performed) and free
+// such an array. These implement LimbArenaMemoryMode.
+BigFloat* NewLimbArena( size_t size );
+void DeleteLimbArena( BigFloat* entries );
+
+} // namespace mpfr
+
 } // namespace El
 #endif // ifdef HYDROGEN_HAVE_MPC
 
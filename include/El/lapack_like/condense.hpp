@@ -107,6 +107,13 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Whether ExplicitCondensed and the distributed HermitianEig should use
+    // the two-stage reduction of herm_tridiag::TwoStage, with an intermediate
+    // band matrix of the given bandwidth. HermitianTridiag itself always
+    // performs a one-stage reduction since it packs its reflectors into A.
+    bool twoStage=false;
+    Int bandwidth=64;
 };
 
 template<typename Field>
@@ -141,6 +148,54 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// The two-stage reduction first reduces A to a Hermitian band matrix (with
+// level 3 operations) and then reduces the band to tridiagonal form by
+// chasing bulges. Regardless of 'uplo', the reflectors of the first stage are
+// stored below the band of the lower triangle of A, and the tridiagonal
+// matrix is returned in the main diagonal and the subdiagonal (as well as
+// the superdiagonal if uplo=UPPER). The reflectors of the second stage are
+// returned as the columns of 'bulgeReflectors'.
+//
+// In the distributed case, only the band reduction and the application of Q
+// are parallelized: the band is gathered onto every process, each of which
+// redundantly chases all of the bulges. The O(n^2 b) work of the second stage
+// therefore does not decrease as processes are added.
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Field>& bulgeReflectors,
+  Matrix<Field>& bulgeScalars,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Field>& bulgeReflectors,
+  AbstractDistMatrix<Field>& bulgeScalars,
+  const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
+
+// Apply the unitary matrix from a two-stage reduction, where 'bandwidth' is
+// the value of ctrl.bandwidth that was passed to TwoStage
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, Orientation orientation, Int bandwidth,
+  const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Field>& bulgeReflectors,
+  const Matrix<Field>& bulgeScalars,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, Orientation orientation, Int bandwidth,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Field>& bulgeReflectors,
+  const AbstractDistMatrix<Field>& bulgeScalars,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -87,6 +87,17 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+// Factor a local matrix via a DAG of tile kernels scheduled with OpenMP tasks
+// (when EL_HYBRID is defined) rather than relying upon a multithreaded BLAS
+// for all of the parallelism
+template<typename Field>
+void Tiled( UpperOrLower uplo, Matrix<Field>& A, Int tileSize=Blocksize() );
+
+// Factor a local matrix by recursively halving it (this is the default for
+// scalar types without BLAS support)
+template<typename Field>
+void Recursive( UpperOrLower uplo, Matrix<Field>& A, Int leafSize=32 );
+
 } // namespace cholesky
 
 // LDL
@@ -336,6 +347,18 @@ void LUMod
 
 namespace lu {
 
+// Factor a local matrix without pivoting via a DAG of tile kernels scheduled
+// with OpenMP tasks (when EL_HYBRID is defined)
+// -------------------------------------------------------------------------
+template<typename Field>
+void Tiled( Matrix<Field>& A, Int tileSize=Blocksize() );
+
+// Factor a local matrix with partial pivoting via Toledo's recursive
+// algorithm (this is the default for scalar types without BLAS support)
+// -----------------------------------------------------------------------
+template<typename Field>
+void Recursive( Matrix<Field>& A, Permutation& P, Int leafSize=32 );
+
 // Solve linear systems using an implicit unpivoted LU factorization
 // -----------------------------------------------------------------
 template<typename Field>
@@ -517,6 +540,17 @@ void QR
 
 namespace qr {
 
+// Householder QR of a local matrix with the panel factorizations and the
+// trailing column-tile updates scheduled as OpenMP tasks (when EL_HYBRID is
+// defined); the result is in the same format as that of QR
+// -------------------------------------------------------------------------
+template<typename Field>
+void Tiled
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  Int tileSize=Blocksize() );
+
 // Apply Q using its implicit representation
 // -----------------------------------------
 template<typename Field>
@@ -563,6 +597,27 @@ void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
 template<typename Field>
 void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
 
+// CholeskyQR2, which is accurate for cond(A) up to about eps^{-1/2}
+template<typename Field>
+void Cholesky2( Matrix<Field>& A, Matrix<Field>& R );
+template<typename Field>
+void Cholesky2( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+
+// Shifted CholeskyQR3, which is accurate for cond(A) up to about eps^{-1}
+template<typename Field>
+void ShiftedCholesky3( Matrix<Field>& A, Matrix<Field>& R );
+template<typename Field>
+void ShiftedCholesky3
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+
+// Choose between the above based upon the conditioning of A, falling back to
+// Householder QR for numerically rank-deficient matrices
+template<typename Field>
+void AdaptiveCholesky( Matrix<Field>& A, Matrix<Field>& R );
+template<typename Field>
+void AdaptiveCholesky
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
 template<typename Field>
@@ -871,5 +926,6 @@ void Skeleton
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
+#include <El/lapack_like/factor/OutOfCore.hpp>
 
 #endif // ifndef EL_FACTOR_HPP
@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_OUTOFCORE_HPP
+#define EL_FACTOR_OUTOFCORE_HPP
+
+#include <future>
+#include <map>
+
+namespace El {
+
+struct OutOfCoreCtrl
+{
+    // The directory holding the per-process panel files; this should
+    // typically be node-local scratch space
+    string directory=".";
+
+    // The number of bytes each process may devote to in-core panels. The
+    // factorizations keep at most four panels resident at once (the active
+    // panel, the panel being consumed, one read-ahead buffer and one
+    // write-behind buffer).
+    size_t memoryBudget=size_t(1)<<30;
+
+    // If positive, this overrides the panel width implied by the budget
+    Int panelWidth=0;
+
+    // Asynchronously read the next panel while the current one is in use
+    bool readAhead=true;
+    // Return from panel writes as soon as the data has been staged
+    bool writeBehind=true;
+
+    bool progress=false;
+};
+
+// A matrix which is stored on disk as a sequence of [MC,MR] column panels.
+// Each process owns a single file containing the local portions of each of
+// the panels, so that only a handful of panels ever need to be resident.
+template<typename T>
+class OutOfCoreMatrix
+{
+public:
+    OutOfCoreMatrix
+    ( const El::Grid& grid,
+      Int height,
+      Int width,
+      const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+    ~OutOfCoreMatrix();
+
+    OutOfCoreMatrix( const OutOfCoreMatrix<T>& A ) = delete;
+    const OutOfCoreMatrix<T>& operator=( const OutOfCoreMatrix<T>& A ) = delete;
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    const OutOfCoreCtrl& Ctrl() const EL_NO_EXCEPT;
+
+    // The columns [PanelOffset(j),PanelOffset(j)+PanelWidth(j)) form panel j
+    Int NumPanels() const EL_NO_EXCEPT;
+    Int PanelOffset( Int j ) const EL_NO_EXCEPT;
+    Int PanelWidth( Int j ) const EL_NO_EXCEPT;
+
+    // Stream an in-core matrix to disk (or back) one panel at a time
+    void Import( const AbstractDistMatrix<T>& A );
+    void Export( AbstractDistMatrix<T>& A ) const;
+
+    // Fill 'panel' with the contents of panel j. If the panel was previously
+    // prefetched, the read-ahead buffer is consumed rather than the disk.
+    void ReadPanel( Int j, DistMatrix<T>& panel ) const;
+
+    // Store the contents of 'panel' as panel j. With write-behind enabled,
+    // the data is staged and this routine returns before it reaches disk.
+    void WritePanel( Int j, const DistMatrix<T>& panel );
+
+    // Begin asynchronously reading panel j (a no-op without read-ahead)
+    void Prefetch( Int j ) const;
+
+    // Wait for all outstanding reads and writes to complete
+    void Flush() const;
+
+private:
+    const El::Grid* grid_;
+    Int height_, width_;
+    OutOfCoreCtrl ctrl_;
+    string filename_;
+
+    vector<Int> panelOffsets_;
+    // The offset (in entries) of each panel's local data within our file
+    vector<Int> fileOffsets_;
+
+    mutable std::map<Int,std::shared_future<void>> pendingWrites_;
+    mutable std::map<Int,std::pair<std::future<void>,vector<T>>> prefetches_;
+
+    Int PanelLocalSize( Int j ) const;
+    void WaitForWrite( Int j ) const;
+};
+
+// Left-looking Cholesky; only the lower-triangular variant is supported
+template<typename Field>
+void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<Field>& A );
+
+// Left-looking LU with partial pivoting such that P A = L U
+template<typename Field>
+void LU( OutOfCoreMatrix<Field>& A, DistPermutation& P );
+
+namespace cholesky {
+
+template<typename Field>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const OutOfCoreMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B );
+
+} // namespace cholesky
+
+namespace lu {
+
+template<typename Field>
+void SolveAfter
+( Orientation orientation,
+  const OutOfCoreMatrix<Field>& A,
+  const DistPermutation& P,
+        AbstractDistMatrix<Field>& B );
+
+} // namespace lu
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_OUTOFCORE_HPP
@@ -405,6 +405,10 @@ struct HermitianSDCCtrl
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
     bool progress=false;
+    // Split each subproblem with QDWH-eig, which computes the bases for the
+    // two invariant subspaces via subspace iteration and CholeskyQR, rather
+    // than with a randomized URV decomposition of the spectral projector
+    bool qdwhEig=false;
 };
 
 template<typename Field>
@@ -482,6 +486,94 @@ void TwoByTwo
 
 } // namespace herm_eig
 
+// Block Krylov-Schur for extremal Hermitian eigenpairs
+// ====================================================
+
+enum KrylovSchurTarget
+{
+  KS_LARGEST,
+  KS_SMALLEST,
+  KS_LARGEST_MAGNITUDE
+};
+
+template<typename Real>
+struct HermitianKrylovSchurCtrl
+{
+    // The number of requested eigenpairs
+    Int numEigs=6;
+    KrylovSchurTarget target=KS_LARGEST;
+
+    // The number of vectors each application of the operator acts upon
+    Int blocksize=4;
+
+    // The maximum number of basis vectors; if zero, the smallest multiple of
+    // the blocksize which is at least
+    // Max(2 numEigs,numEigs+2 blocksize) + 2 blocksize
+    Int basisSize=0;
+
+    Int maxRestarts=100;
+
+    // A Ritz pair (theta,x) is locked once || A x - x theta ||_2 <= tol ||A||,
+    // where ||A|| is estimated from the Ritz values. If zero, sqrt(eps) is
+    // used.
+    Real tol=Real(0);
+
+    bool progress=false;
+};
+
+struct HermitianKrylovSchurInfo
+{
+    Int numRestarts=0;
+    Int numOperatorApps=0;
+    Int numConverged=0;
+    Int numDeflations=0;
+};
+
+// Compute the 'numEigs' extremal eigenpairs of a Hermitian matrix, with the
+// eigenvalues ordered from the most to the least desired and the distributed
+// eigenvectors returned in a [VC,STAR] distribution (by default)
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl=
+        HermitianKrylovSchurCtrl<Base<Field>>() );
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl=
+        HermitianKrylovSchurCtrl<Base<Field>>() );
+
+// The same, but for an n x n Hermitian operator which overwrites Y with A X
+// for each block of vectors X (in the distributed case, Y is aligned with X)
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( Int n,
+  function<void(const Matrix<Field>&,Matrix<Field>&)> applyA,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl=
+        HermitianKrylovSchurCtrl<Base<Field>>() );
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( const Grid& grid,
+  Int n,
+  function<void(const DistMatrix<Field,VC,STAR>&,
+                      DistMatrix<Field,VC,STAR>&)> applyA,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl=
+        HermitianKrylovSchurCtrl<Base<Field>>() );
+
 // Skew-Hermitian eigenvalue solvers
 // =================================
 // Compute the full set of eigenvalues
@@ -763,6 +855,9 @@ struct HessenbergSchurCtrl
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
       function<Int(Int)>(hess_schur::multibulge::NumBulgesPerBlock);
+    // Distributed AED windows of at least this size are reduced (and their
+    // spikes deflated) over a square subgrid rather than by a single process
+    Int minDistAEDSize = 1000;
 };
 
 template<typename Field>
@@ -1357,6 +1452,73 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized low-rank SVD
+// -----------------------
+
+enum SketchType
+{
+  // Dense sketches with independent standard normal entries
+  GAUSSIAN_SKETCH,
+
+  // Subsampled randomized Hadamard transforms, which can be applied to each
+  // row of A in O(n log n) work
+  HADAMARD_SKETCH
+};
+
+template<typename Real>
+struct RandomizedSVDCtrl
+{
+    // The number of singular triplets to compute
+    Int rank=10;
+
+    // The number of samples drawn beyond 'rank'
+    Int oversampling=10;
+
+    // The number of (re-orthonormalized) subspace iterations with A A^H,
+    // which should be increased when the singular values decay slowly
+    Int numPowerIts=1;
+
+    SketchType sketch=GAUSSIAN_SKETCH;
+
+    // Used for the SVD of the small projected matrix
+    SVDCtrl<Real> svdCtrl;
+};
+
+// Return a matrix Q with min(rank+oversampling,min(m,n)) orthonormal columns
+// whose range approximates the dominant left singular subspace of A
+template<typename Field>
+void RandomizedRangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+    RandomizedSVDCtrl<Base<Field>>() );
+template<typename Field>
+void RandomizedRangeFinder
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& Q,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+    RandomizedSVDCtrl<Base<Field>>() );
+
+// Approximate the leading 'rank' singular triplets of A. The distributed
+// variant returns U and V in [VC,STAR] and s in [STAR,STAR] distributions
+// unless the caller provides other ones.
+template<typename Field>
+SVDInfo RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+    RandomizedSVDCtrl<Base<Field>>() );
+template<typename Field>
+SVDInfo RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl=
+    RandomizedSVDCtrl<Base<Field>>() );
+
 // Hermitian SVD
 // =============
 
@@ -1515,6 +1677,17 @@ struct PseudospecCtrl
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
+    // Adaptive refinement of windows (and portraits): if refineSteps > 0, the
+    // shifts are first evaluated on a grid which is 2^refineSteps times
+    // coarser in each direction, and a cell is only bisected while the
+    // estimates at its corners straddle one of the 'contours' (values of
+    // || inv(A - z I) ||) or, if none are given, vary by more than a factor
+    // of ten. Cells containing an eigenvalue of a (quasi-)triangular form are
+    // always bisected. The remaining pixels are interpolated and are reported
+    // with iteration counts of zero.
+    Int refineSteps=0;
+    vector<Real> contours;
+
     SnapshotCtrl snapCtrl;
 
     mutable Complex<Real> center = Complex<Real>(0);
@@ -20,8 +20,41 @@ template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
 ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
+// NthElement
+// ==========
+// Return the entry of the given (zero-based) rank in ascending order along
+// with its original index, with ties broken by the original index.
+// Distributed vectors are handled by a selection with O(n/p) local work per
+// process and rounds of small collectives rather than by gathering.
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> NthElement( const Matrix<Real>& x, Int rank );
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> NthElement( const AbstractDistMatrix<Real>& x, Int rank );
+
+// QuantileSelect
+// ==============
+// Return the entries at each of the given quantiles in [0,1], where the
+// quantile q of a vector of length n is its entry of rank min(floor(q n),n-1).
+// All of the quantiles are selected together.
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+vector<ValueInt<Real>>
+QuantileSelect( const Matrix<Real>& x, const vector<double>& quantiles );
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+vector<ValueInt<Real>>
+QuantileSelect
+( const AbstractDistMatrix<Real>& x, const vector<double>& quantiles );
+
 // Sort
 // ====
+// Distributed matrices (other than [STAR,STAR] and [CIRC,CIRC]) are sorted
+// with a parallel sample sort rather than on a single process, and ties are
+// then always broken by the original index. The distributed TaggedSort
+// returns the full sorted vector (with the original indices) on every
+// process.
 template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
 void Sort
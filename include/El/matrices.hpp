@@ -121,6 +121,10 @@ template<typename T>
 void Identity( Matrix<T>& I, Int m, Int n );
 template<typename T>
 void Identity( AbstractDistMatrix<T>& I, Int m, Int n );
+template<typename T>
+void Identity( SparseMatrix<T>& I, Int m, Int n );
+template<typename T>
+void Identity( DistSparseMatrix<T>& I, Int m, Int n );
 
 // Jordan
 // ------
@@ -163,6 +167,12 @@ void Zeros( AbstractMatrix<T>& A, Int m, Int n );
 template<typename T>
 void Zeros( AbstractDistMatrix<T>& A, Int m, Int n );
 template<typename T>
+void Zeros( SparseMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Zeros( DistSparseMatrix<T>& A, Int m, Int n );
+template<typename T>
+void Zeros( DistMultiVec<T>& A, Int m, Int n );
+template<typename T>
 void Zeros_seq( Matrix<T>& A, Int m, Int n );
 template<typename T>
 void Zeros_seq( AbstractMatrix<T>& A, Int m, Int n );
@@ -30,6 +30,12 @@ struct LocalTrr2kBlocksizeHelper { static Int value; };
 template<typename T>
 Int LocalTrr2kBlocksizeHelper<T>::value = 64;
 
+// Extended-precision flops are expensive enough to recurse much further
+template<typename T>
+struct StrassenCutoffHelper { static Int value; };
+template<typename T>
+Int StrassenCutoffHelper<T>::value = IsBlasScalar<T>::value ? 512 : 64;
+
 }
 
 namespace El {
@@ -94,13 +100,23 @@ template<typename T>
 Int LocalTrr2kBlocksize()
 { return LocalTrr2kBlocksizeHelper<T>::value; }
 
+template<typename T>
+void SetStrassenCutoff( Int cutoff )
+{ StrassenCutoffHelper<T>::value = cutoff; }
+
+template<typename T>
+Int StrassenCutoff()
+{ return StrassenCutoffHelper<T>::value; }
+
 #define PROTO(T) \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
   template Int LocalTrrkBlocksize<T>(); \
   template void SetLocalTrr2kBlocksize<T>( Int blocksize ); \
-  template Int LocalTrr2kBlocksize<T>();
+  template Int LocalTrr2kBlocksize<T>(); \
+  template void SetStrassenCutoff<T>( Int cutoff ); \
+  template Int StrassenCutoff<T>();
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -8,6 +8,7 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include "./NormKernels.hpp"
 
 namespace El {
 
@@ -16,16 +17,9 @@ void ColumnMinAbs( const Matrix<Ring>& X, Matrix<Base<Ring>>& mins )
 {
     EL_DEBUG_CSE
     typedef Base<Ring> RealRing;
-    const Int m = X.Height();
-    const Int n = X.Width();
-    mins.Resize( n, 1 );
-    for( Int j=0; j<n; ++j )
-    {
-        RealRing colMin = limits::Max<RealRing>();
-        for( Int i=0; i<m; ++i )
-            colMin = Min(colMin,Abs(X(i,j)));
-        mins(j) = colMin;
-    }
+    mins.Resize( X.Width(), 1 );
+    Fill( mins, limits::Max<RealRing>() );
+    ColumnAbsReduce( X, mins.Buffer(), MinAbsOp() );
 }
 
 template<typename Ring>
@@ -35,21 +29,11 @@ void ColumnMinAbsNonzero
         Matrix<Base<Ring>>& mins )
 {
     EL_DEBUG_CSE
-    typedef Base<Ring> RealRing;
-    const Int m = X.Height();
     const Int n = X.Width();
     mins.Resize( n, 1 );
     for( Int j=0; j<n; ++j )
-    {
-        RealRing colMin = upperBounds(j);
-        for( Int i=0; i<m; ++i )
-        {
-            RealRing absVal = Abs(X(i,j));
-            if( absVal > RealRing(0) )
-                colMin = Min(colMin,absVal);
-        }
-        mins(j) = colMin;
-    }
+        mins(j) = upperBounds(j);
+    ColumnAbsReduce( X, mins.Buffer(), MinAbsNonzeroOp() );
 }
 
 template<typename Ring,Dist U,Dist V>
@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include "./NormsFromScaledSquares.hpp"
+#include "./NormKernels.hpp"
 
 namespace El {
 
@@ -17,24 +18,19 @@ void ColumnTwoNormsHelper
 ( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc, mpi::Comm const& comm )
 {
     EL_DEBUG_CSE
+    if( IsBlasScalar<Field>::value && ReproducibleReductions() )
+    {
+        ReproducibleColumnTwoNorms( ALoc, normsLoc, comm );
+        return;
+    }
     typedef Base<Field> Real;
-    const Int mLocal = ALoc.Height();
     const Int nLocal = ALoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
+    // TODO(poulson): Ensure that NaN's propagate for non-BLAS scalars
     Matrix<Real> localScales( nLocal, 1 ),
                  localScaledSquares( nLocal, 1 );
-    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-    {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
-    }
+    ColumnScaledSquares
+    ( ALoc, localScales.Buffer(), localScaledSquares.Buffer() );
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
 }
@@ -46,25 +42,12 @@ void ColumnTwoNormsHelper
         Matrix<Real>& normsLoc, mpi::Comm const& comm )
 {
     EL_DEBUG_CSE
-    const Int mLocal = ARealLoc.Height();
     const Int nLocal = ARealLoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
+    // TODO(poulson): Ensure that NaN's propagate for non-BLAS scalars
     Matrix<Real> localScales( nLocal, 1 ), localScaledSquares( nLocal, 1 );
-    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-    {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ARealLoc(iLoc,jLoc), localScale, localScaledSquare );
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( AImagLoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
-    }
+    ColumnScaledSquares
+    ( ARealLoc, AImagLoc, localScales.Buffer(), localScaledSquares.Buffer() );
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
 }
@@ -81,6 +64,11 @@ void ColumnTwoNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    if( IsBlasScalar<Field>::value && ReproducibleReductions() )
+    {
+        ReproducibleColumnTwoNorms( X, norms, mpi::COMM_SELF );
+        return;
+    }
     for( Int j=0; j<n; ++j )
         norms(j) = blas::Nrm2( m, &X(0,j), 1 );
 }
@@ -89,18 +77,10 @@ template<typename Field>
 void ColumnMaxNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int m = X.Height();
-    const Int n = X.Width();
-    norms.Resize( n, 1 );
-    for( Int j=0; j<n; ++j )
-    {
-        // TODO(poulson): Ensure that NaN's propagate
-        Real colMax = 0;
-        for( Int i=0; i<m; ++i )
-            colMax = Max(colMax,Abs(X(i,j)));
-        norms(j) = colMax;
-    }
+    // TODO(poulson): Ensure that NaN's propagate
+    norms.Resize( X.Width(), 1 );
+    Zero( norms );
+    ColumnAbsReduce( X, norms.Buffer(), MaxAbsOp() );
 }
 
 template<typename Field,Dist U,Dist V,DistWrap W>
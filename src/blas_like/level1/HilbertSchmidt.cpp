@@ -22,6 +22,10 @@ Ring HilbertSchmidt(
         LogicError("Matrices must be the same size");
     if (A.GetDevice() != Device::CPU || A.GetDevice() != B.GetDevice())
         LogicError("HilbertSchmidt not supported for this device.");
+    if( IsBlasScalar<Ring>::value && ReproducibleReductions() )
+        return ReproducibleHilbertSchmidt
+        ( static_cast<const Matrix<Ring,Device::CPU>&>(A),
+          static_cast<const Matrix<Ring,Device::CPU>&>(B), mpi::COMM_SELF );
 
     Ring innerProd(0);
     const Int width = A.Width();
@@ -70,7 +74,15 @@ Ring HilbertSchmidt
                 A.LockedMatrix()));
 
     Ring innerProd;
-    if( A.Participating() )
+    if( A.Participating() &&
+        IsBlasScalar<Ring>::value && ReproducibleReductions() )
+    {
+        innerProd = ReproducibleHilbertSchmidt
+        ( static_cast<const Matrix<Ring,Device::CPU>&>(A.LockedMatrix()),
+          static_cast<const Matrix<Ring,Device::CPU>&>(B.LockedMatrix()),
+          A.DistComm() );
+    }
+    else if( A.Participating() )
     {
         Ring localInnerProd(0);
         const Int localHeight = A.LocalHeight();
@@ -8,6 +8,7 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include "./NormKernels.hpp"
 
 namespace El {
 
@@ -152,23 +153,7 @@ Entry<Base<Ring>> MaxAbsLoc( const Matrix<Ring>& A )
         return pivot;
     }
 
-    pivot.i = 0;
-    pivot.j = 0;
-    pivot.value = 0;
-    for( Int j=0; j<n; ++j )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            const RealRing absVal = Abs(A(i,j));
-            if( absVal > pivot.value )
-            {
-                pivot.i = i;
-                pivot.j = j;
-                pivot.value = absVal;
-            }
-        }
-    }
-    return pivot;
+    return LocalMaxAbsLoc( A );
 }
 
 template<typename Ring>
@@ -202,26 +187,13 @@ Entry<Base<Ring>> MaxAbsLoc( const AbstractDistMatrix<Ring>& A )
     if( A.Participating() )
     {
         // Store the index/value of the local pivot candidate
-        Entry<RealRing> localPivot;
-        localPivot.i = 0;
-        localPivot.j = 0;
-        localPivot.value = 0;
-        const Int mLocal = A.LocalHeight();
-        const Int nLocal = A.LocalWidth();
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        Entry<RealRing> localPivot =
+          LocalMaxAbsLoc
+          ( static_cast<const Matrix<Ring,Device::CPU>&>(A.LockedMatrix()) );
+        if( localPivot.value > RealRing(0) )
         {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            {
-                const RealRing value = Abs(A.GetLocal(iLoc,jLoc));
-                if( value > localPivot.value )
-                {
-                    const Int i = A.GlobalRow(iLoc);
-                    localPivot.i = i;
-                    localPivot.j = j;
-                    localPivot.value = value;
-                }
-            }
+            localPivot.i = A.GlobalRow(localPivot.i);
+            localPivot.j = A.GlobalCol(localPivot.j);
         }
 
         // Compute and store the location of the new pivot
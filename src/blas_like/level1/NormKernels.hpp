@@ -0,0 +1,561 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_NORM_KERNELS_HPP
+#define EL_BLAS_NORM_KERNELS_HPP
+
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+// Single-pass kernels for the column/row two-norms and the column/row
+// minimum and maximum absolute values of local matrices.
+//
+// For the BLAS scalars, each column is processed by 'normLaneWidth'
+// independent accumulators whose updates are free of branches and
+// divisions, so that the compiler can map the lanes onto SIMD registers
+// without having to reassociate floating-point sums; row reductions instead
+// sweep the matrix a column at a time and update one accumulator per row,
+// which keeps the memory accesses contiguous. The columns (or blocks of
+// rows) are distributed over the OpenMP threads. All other scalar types
+// fall back to the straightforward scalar loops.
+
+namespace El {
+
+const Int normLaneWidth = 8;
+const Int minParallelNormSize = 4096;
+const Int normRowBlockSize = 512;
+
+// Blue's algorithm
+// ================
+// The thresholds and scalings of Blue's two-norm algorithm (as chosen by
+// LAPACK's la_constants): squares of entries in [small,big] can neither
+// underflow nor overflow, while the entries below 'small' (above 'big') are
+// multiplied by 'smallScale' ('bigScale') before being squared.
+template<typename Real>
+struct BlueConstants
+{
+    Real small, big, smallScale, bigScale;
+
+    BlueConstants()
+    {
+        typedef std::numeric_limits<Real> Limits;
+        const Real minExp = Limits::min_exponent;
+        const Real maxExp = Limits::max_exponent;
+        const Real digits = Limits::digits;
+        small = std::ldexp( Real(1), int(std::ceil((minExp-1)/2)) );
+        big = std::ldexp( Real(1), int(std::floor((maxExp-digits+1)/2)) );
+        smallScale = std::ldexp( Real(1), -int(std::floor((minExp-digits)/2)) );
+        bigScale = std::ldexp( Real(1), -int(std::ceil((maxExp+digits-1)/2)) );
+    }
+};
+
+template<typename Real>
+const BlueConstants<Real>& GetBlueConstants()
+{
+    static const BlueConstants<Real> constants;
+    return constants;
+}
+
+// Add the (scaled) square of alpha into the accumulator for its range. A NaN
+// fails both threshold tests and therefore lands in (and poisons) 'medium'.
+template<typename Real>
+inline void BlueUpdate
+( const Real& alpha, const BlueConstants<Real>& c,
+  Real& small, Real& medium, Real& big ) EL_NO_EXCEPT
+{
+    const Real alphaAbs = std::abs(alpha);
+    const Real smallTerm = alphaAbs*c.smallScale;
+    const Real bigTerm = alphaAbs*c.bigScale;
+    const bool isSmall = alphaAbs < c.small;
+    const bool isBig = alphaAbs > c.big;
+    small += ( isSmall ? smallTerm*smallTerm : Real(0) );
+    big += ( isBig ? bigTerm*bigTerm : Real(0) );
+    medium += ( isSmall || isBig ? Real(0) : alphaAbs*alphaAbs );
+}
+
+// Convert Blue's three sums into the (scale,scaledSquare) representation
+// used by UpdateScaledSquare and NormsFromScaledSquares, so that the two-norm
+// is scale*sqrt(scaledSquare)
+template<typename Real>
+void BlueScaledSquare
+( Real small, Real medium, Real big, Real& scale, Real& scaledSquare )
+{
+    const BlueConstants<Real>& c = GetBlueConstants<Real>();
+    if( big != Real(0) )
+    {
+        // The small entries are negligible relative to the big ones
+        scale = 1/c.bigScale;
+        scaledSquare = big + (medium*c.bigScale)*c.bigScale;
+    }
+    else if( small != Real(0) )
+    {
+        if( medium != Real(0) )
+        {
+            // This branch is also taken if 'medium' is a NaN
+            const Real mediumNorm = Sqrt(medium);
+            const Real smallNorm = Sqrt(small)/c.smallScale;
+            const bool smallIsMax = smallNorm > mediumNorm;
+            const Real maxNorm = ( smallIsMax ? smallNorm : mediumNorm );
+            const Real minNorm = ( smallIsMax ? mediumNorm : smallNorm );
+            const Real ratio = minNorm/maxNorm;
+            scale = 1;
+            scaledSquare = (maxNorm*maxNorm)*(1+ratio*ratio);
+        }
+        else
+        {
+            scale = 1/c.smallScale;
+            scaledSquare = small;
+        }
+    }
+    else if( medium != Real(0) )
+    {
+        scale = 1;
+        scaledSquare = medium;
+    }
+    else
+    {
+        // The starting values of UpdateScaledSquare
+        scale = 0;
+        scaledSquare = 1;
+    }
+}
+
+// Blue's sums of the squares of the n contiguous entries of x
+template<typename Real>
+void BlueSums( Int n, const Real* x, Real& small, Real& medium, Real& big )
+{
+    const BlueConstants<Real>& c = GetBlueConstants<Real>();
+    const Int w = normLaneWidth;
+    Real smalls[w], mediums[w], bigs[w];
+    for( Int l=0; l<w; ++l )
+    {
+        smalls[l] = 0;
+        mediums[l] = 0;
+        bigs[l] = 0;
+    }
+    Int i=0;
+    for( ; i+w<=n; i+=w )
+        for( Int l=0; l<w; ++l )
+            BlueUpdate( x[i+l], c, smalls[l], mediums[l], bigs[l] );
+    for( ; i<n; ++i )
+        BlueUpdate( x[i], c, smalls[0], mediums[0], bigs[0] );
+
+    small = medium = big = 0;
+    for( Int l=0; l<w; ++l )
+    {
+        small += smalls[l];
+        medium += mediums[l];
+        big += bigs[l];
+    }
+}
+
+// Entrywise absolute values
+// =========================
+template<typename Real>
+inline Real BranchFreeAbs( const Real& alpha ) EL_NO_EXCEPT
+{ return std::abs(alpha); }
+
+// |alpha| = maxAbs sqrt(1+(minAbs/maxAbs)^2), which neither overflows nor
+// underflows and agrees with the (branchy) hypot to within a few ulps. Equal
+// parts are special-cased so that zeros and pairs of infinities avoid 0/0
+// and inf/inf.
+template<typename Real>
+inline Real BranchFreeAbs( const Complex<Real>& alpha ) EL_NO_EXCEPT
+{
+    const Real realAbs = std::abs(alpha.real());
+    const Real imagAbs = std::abs(alpha.imag());
+    const Real maxAbs = std::max( realAbs, imagAbs );
+    const Real minAbs = std::min( realAbs, imagAbs );
+    const Real ratio = ( minAbs == maxAbs ? Real(1) : minAbs/maxAbs );
+    return maxAbs*std::sqrt(1+ratio*ratio);
+}
+
+// The reductions of absolute values. As with std::max and std::min, NaN's
+// are ignored.
+struct MaxAbsOp
+{
+    template<typename Real>
+    Real operator()( const Real& value, const Real& alphaAbs ) const
+    { return value < alphaAbs ? alphaAbs : value; }
+};
+
+struct MinAbsOp
+{
+    template<typename Real>
+    Real operator()( const Real& value, const Real& alphaAbs ) const
+    { return alphaAbs < value ? alphaAbs : value; }
+};
+
+// Zero entries are ignored
+struct MinAbsNonzeroOp
+{
+    template<typename Real>
+    Real operator()( const Real& value, const Real& alphaAbs ) const
+    { return alphaAbs > Real(0) && alphaAbs < value ? alphaAbs : value; }
+};
+
+// Column and row reductions
+// =========================
+// values(j) := op(values(j),|A(0,j)|,...,|A(m-1,j)|)
+template<typename T,class Op,typename=EnableIf<IsBlasScalar<T>>>
+void ColumnAbsReduce( const Matrix<T>& A, Base<T>* values, Op op )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int w = normLaneWidth;
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelNormSize && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int j=0; j<n; ++j )
+    {
+        const T* a = &ABuf[j*ALDim];
+        Real lanes[w];
+        for( Int l=0; l<w; ++l )
+            lanes[l] = values[j];
+        Int i=0;
+        for( ; i+w<=m; i+=w )
+            for( Int l=0; l<w; ++l )
+                lanes[l] = op( lanes[l], BranchFreeAbs(a[i+l]) );
+        for( ; i<m; ++i )
+            lanes[0] = op( lanes[0], BranchFreeAbs(a[i]) );
+        Real value = lanes[0];
+        for( Int l=1; l<w; ++l )
+            value = op( value, lanes[l] );
+        values[j] = value;
+    }
+}
+
+template<typename T,class Op,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void ColumnAbsReduce( const Matrix<T>& A, Base<T>* values, Op op )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            values[j] = op( values[j], Abs(A(i,j)) );
+}
+
+// values(i) := op(values(i),|A(i,0)|,...,|A(i,n-1)|)
+template<typename T,class Op,typename=EnableIf<IsBlasScalar<T>>>
+void RowAbsReduce( const Matrix<T>& A, Base<T>* values, Op op )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int numBlocks = (m+normRowBlockSize-1)/normRowBlockSize;
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelNormSize && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int iBeg = block*normRowBlockSize;
+        const Int iEnd = Min( iBeg+normRowBlockSize, m );
+        for( Int j=0; j<n; ++j )
+        {
+            const T* a = &ABuf[j*ALDim];
+            for( Int i=iBeg; i<iEnd; ++i )
+                values[i] = op( values[i], BranchFreeAbs(a[i]) );
+        }
+    }
+}
+
+template<typename T,class Op,
+         typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void RowAbsReduce( const Matrix<T>& A, Base<T>* values, Op op )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            values[i] = op( values[i], Abs(A(i,j)) );
+}
+
+// Compute the local (scale,scaledSquare) pair of each column of A. Complex
+// columns are treated as real columns of twice the height.
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void ColumnScaledSquares
+( const Matrix<T>& A, Base<T>* scales, Base<T>* scaledSquares )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int numParts = IsComplex<T>::value ? 2 : 1;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real* ABuf = reinterpret_cast<const Real*>(A.LockedBuffer());
+    const Int ALDim = A.LDim();
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelNormSize && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int j=0; j<n; ++j )
+    {
+        Real small, medium, big;
+        BlueSums( numParts*m, &ABuf[numParts*j*ALDim], small, medium, big );
+        BlueScaledSquare( small, medium, big, scales[j], scaledSquares[j] );
+    }
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void ColumnScaledSquares
+( const Matrix<T>& A, Base<T>* scales, Base<T>* scaledSquares )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int j=0; j<n; ++j )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        for( Int i=0; i<m; ++i )
+            UpdateScaledSquare( A(i,j), scale, scaledSquare );
+        scales[j] = scale;
+        scaledSquares[j] = scaledSquare;
+    }
+}
+
+// The same for explicitly-separated real and imaginary parts
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
+void ColumnScaledSquares
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  Real* scales, Real* scaledSquares )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelNormSize && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int j=0; j<n; ++j )
+    {
+        Real small, medium, big, smallImag, mediumImag, bigImag;
+        BlueSums( m, AReal.LockedBuffer(0,j), small, medium, big );
+        BlueSums( m, AImag.LockedBuffer(0,j), smallImag, mediumImag, bigImag );
+        BlueScaledSquare
+        ( small+smallImag, medium+mediumImag, big+bigImag,
+          scales[j], scaledSquares[j] );
+    }
+}
+
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+void ColumnScaledSquares
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  Real* scales, Real* scaledSquares )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+    for( Int j=0; j<n; ++j )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        for( Int i=0; i<m; ++i )
+            UpdateScaledSquare( AReal(i,j), scale, scaledSquare );
+        for( Int i=0; i<m; ++i )
+            UpdateScaledSquare( AImag(i,j), scale, scaledSquare );
+        scales[j] = scale;
+        scaledSquares[j] = scaledSquare;
+    }
+}
+
+// Compute the local (scale,scaledSquare) pair of each row of A
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void RowScaledSquares
+( const Matrix<T>& A, Base<T>* scales, Base<T>* scaledSquares )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int numParts = IsComplex<T>::value ? 2 : 1;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real* ABuf = reinterpret_cast<const Real*>(A.LockedBuffer());
+    const Int ALDim = A.LDim();
+    const BlueConstants<Real>& c = GetBlueConstants<Real>();
+    const Int numBlocks = (m+normRowBlockSize-1)/normRowBlockSize;
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelNormSize && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int iBeg = block*normRowBlockSize;
+        const Int blockHeight = Min( normRowBlockSize, m-iBeg );
+        Real small[normRowBlockSize], medium[normRowBlockSize],
+             big[normRowBlockSize];
+        for( Int i=0; i<blockHeight; ++i )
+        {
+            small[i] = 0;
+            medium[i] = 0;
+            big[i] = 0;
+        }
+        for( Int j=0; j<n; ++j )
+        {
+            const Real* a = &ABuf[numParts*(iBeg+j*ALDim)];
+            for( Int i=0; i<blockHeight; ++i )
+                for( Int part=0; part<numParts; ++part )
+                    BlueUpdate
+                    ( a[numParts*i+part], c, small[i], medium[i], big[i] );
+        }
+        for( Int i=0; i<blockHeight; ++i )
+            BlueScaledSquare
+            ( small[i], medium[i], big[i],
+              scales[iBeg+i], scaledSquares[iBeg+i] );
+    }
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void RowScaledSquares
+( const Matrix<T>& A, Base<T>* scales, Base<T>* scaledSquares )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    for( Int i=0; i<m; ++i )
+    {
+        Real scale = 0;
+        Real scaledSquare = 1;
+        for( Int j=0; j<n; ++j )
+            UpdateScaledSquare( A(i,j), scale, scaledSquare );
+        scales[i] = scale;
+        scaledSquares[i] = scaledSquare;
+    }
+}
+
+// Pivot search
+// ============
+// Return the first entry (in column-major order) of maximal absolute value,
+// or the entry (0,0) with value zero if every entry is zero; NaN's are
+// ignored. Each lane records the first maximum among its rows, and the
+// lanes are merged by value and then by row.
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+Entry<Base<T>> LocalMaxAbsLoc( const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int w = normLaneWidth;
+
+    Int numChunks = 1;
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelNormSize && !omp_in_parallel();
+    if( parallel )
+        numChunks = Min( Int(omp_get_max_threads()), n );
+#endif
+    vector<Entry<Real>> pivots( numChunks );
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(numChunks > 1)
+#endif
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        Entry<Real> pivot;
+        pivot.i = 0;
+        pivot.j = 0;
+        pivot.value = 0;
+        const Int jBeg = (chunk*n)/numChunks;
+        const Int jEnd = ((chunk+1)*n)/numChunks;
+        for( Int j=jBeg; j<jEnd; ++j )
+        {
+            const T* a = &ABuf[j*ALDim];
+            Real values[w];
+            Int rows[w];
+            for( Int l=0; l<w; ++l )
+            {
+                values[l] = pivot.value;
+                rows[l] = -1;
+            }
+            Int i=0;
+            for( ; i+w<=m; i+=w )
+            {
+                for( Int l=0; l<w; ++l )
+                {
+                    const Real alphaAbs = BranchFreeAbs(a[i+l]);
+                    const bool larger = alphaAbs > values[l];
+                    values[l] = ( larger ? alphaAbs : values[l] );
+                    rows[l] = ( larger ? i+l : rows[l] );
+                }
+            }
+            for( ; i<m; ++i )
+            {
+                const Real alphaAbs = BranchFreeAbs(a[i]);
+                if( alphaAbs > values[0] )
+                {
+                    values[0] = alphaAbs;
+                    rows[0] = i;
+                }
+            }
+            for( Int l=0; l<w; ++l )
+            {
+                if( rows[l] < 0 )
+                    continue;
+                if( values[l] > pivot.value ||
+                    (pivot.j == j && values[l] == pivot.value &&
+                     rows[l] < pivot.i) )
+                {
+                    pivot.i = rows[l];
+                    pivot.j = j;
+                    pivot.value = values[l];
+                }
+            }
+        }
+        pivots[chunk] = pivot;
+    }
+
+    // The chunks are in column order, so only strictly larger values win
+    Entry<Real> pivot = pivots[0];
+    for( Int chunk=1; chunk<numChunks; ++chunk )
+        if( pivots[chunk].value > pivot.value )
+            pivot = pivots[chunk];
+    return pivot;
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+Entry<Base<T>> LocalMaxAbsLoc( const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Entry<Real> pivot;
+    pivot.i = 0;
+    pivot.j = 0;
+    pivot.value = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Real absVal = Abs(A(i,j));
+            if( absVal > pivot.value )
+            {
+                pivot.i = i;
+                pivot.j = j;
+                pivot.value = absVal;
+            }
+        }
+    }
+    return pivot;
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_NORM_KERNELS_HPP
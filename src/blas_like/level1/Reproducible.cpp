@@ -0,0 +1,425 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+
+namespace {
+
+bool reproducibleReductions = false;
+
+} // anonymous namespace
+
+namespace El {
+
+bool ReproducibleReductions() { return ::reproducibleReductions; }
+
+void SetReproducibleReductions( bool reproducible )
+{ ::reproducibleReductions = reproducible; }
+
+void Superaccumulator::Zero()
+{
+    for( Int i=0; i<size; ++i )
+        digits_[i] = 0;
+    numUpdates_ = 0;
+}
+
+void Superaccumulator::Update( const Superaccumulator& other )
+{
+    Superaccumulator normalizedOther( other );
+    normalizedOther.Normalize();
+    Normalize();
+    for( Int i=0; i<size; ++i )
+        digits_[i] += normalizedOther.digits_[i];
+    numUpdates_ = 1;
+}
+
+void Superaccumulator::Normalize()
+{
+    const std::uint64_t digitMask = (std::uint64_t(1)<<32)-1;
+    const long long radix = 1LL<<32;
+    for( Int i=0; i<numDigits-1; ++i )
+    {
+        // Split the word into a digit in [0,2^32) and an (exact) carry
+        const long long digit = std::uint64_t(digits_[i]) & digitMask;
+        digits_[i+1] += (digits_[i]-digit) / radix;
+        digits_[i] = digit;
+    }
+    numUpdates_ = 0;
+}
+
+double Superaccumulator::Round() const
+{
+    const long long* counts = &digits_[numDigits];
+    if( counts[0] > 0 || (counts[1] > 0 && counts[2] > 0) )
+        return std::numeric_limits<double>::quiet_NaN();
+    if( counts[1] > 0 )
+        return limits::Infinity<double>();
+    if( counts[2] > 0 )
+        return -limits::Infinity<double>();
+
+    Superaccumulator sum( *this );
+    sum.Normalize();
+    long long* digits = sum.digits_;
+    const bool negative = digits[numDigits-1] < 0;
+    if( negative )
+    {
+        for( Int i=0; i<numDigits; ++i )
+            digits[i] = -digits[i];
+        sum.Normalize();
+    }
+
+    Int top = numDigits-1;
+    while( top >= 0 && digits[top] == 0 )
+        --top;
+    if( top < 0 )
+        return 0;
+    // The last digit has weight 2^1006, so any sum whose last word does not
+    // fit within a digit is far beyond the range of the doubles
+    if( digits[top] >= (1LL<<32) )
+        return negative ? -limits::Infinity<double>()
+                        :  limits::Infinity<double>();
+
+    // Gather the leading 64 bits of the sum into 'window', whose least
+    // significant bit has weight 2^(windowShift-1074), and note whether any
+    // of the bits below the window are nonzero
+    const std::uint64_t topDigit = digits[top];
+    int topLength = 0;
+    while( (topDigit >> topLength) != 0 )
+        ++topLength;
+    const std::uint64_t secondDigit = top >= 1 ? digits[top-1] : 0;
+    const std::uint64_t thirdDigit = top >= 2 ? digits[top-2] : 0;
+    const std::uint64_t window =
+      (topDigit << (64-topLength)) |
+      (secondDigit << (32-topLength)) |
+      (thirdDigit >> topLength);
+    bool sticky = (thirdDigit & ((std::uint64_t(1)<<topLength)-1)) != 0;
+    for( Int i=0; i<top-2; ++i )
+        sticky = sticky || digits[i] != 0;
+    const int windowShift = int(32*top) + topLength - 64;
+
+    // Round the window to 53 bits with ties to even. If the sum fits within
+    // 53 bits, then it is exactly representable (perhaps as a subnormal).
+    std::uint64_t mantissa = window >> 11;
+    const std::uint64_t remainder = window & 0x7FF;
+    const std::uint64_t half = 0x400;
+    if( remainder > half ||
+        (remainder == half && (sticky || (mantissa & 1) != 0)) )
+        ++mantissa;
+    const double magnitude =
+      std::ldexp( double(mantissa), windowShift + 11 - 1074 );
+    return negative ? -magnitude : magnitude;
+}
+
+void AllReduce( Superaccumulator* sums, Int n, mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    const Int size = Superaccumulator::size;
+    // Normalized digits are below 2^32 in magnitude, so their sum over the
+    // processes cannot overflow, and, since integer addition is associative,
+    // the result does not depend upon the order of the reduction
+    vector<long long> buffer( n*size );
+    for( Int k=0; k<n; ++k )
+    {
+        sums[k].Normalize();
+        MemCopy( &buffer[k*size], sums[k].LockedBuffer(), size );
+    }
+    mpi::AllReduce
+    ( buffer.data(), n*size, mpi::SUM, comm, SyncInfo<Device::CPU>() );
+    for( Int k=0; k<n; ++k )
+    {
+        MemCopy( sums[k].Buffer(), &buffer[k*size], size );
+        sums[k].Normalize();
+    }
+}
+
+namespace {
+
+// The minimum number of entries for which the accumulation over a matrix is
+// split between threads
+const Int minParallelSize = 4096;
+
+template<typename Real>
+double MaxAbsPart( const Real& alpha )
+{ return Abs(double(alpha)); }
+
+template<typename Real>
+double MaxAbsPart( const Complex<Real>& alpha )
+{ return std::max( Abs(double(alpha.real())), Abs(double(alpha.imag())) ); }
+
+// The exponent of the power of two which brings 'maxAbs' into [1/2,1). It is
+// bounded below so that the reciprocal power of two does not overflow.
+int ScaleExponent( double maxAbs )
+{
+    if( maxAbs == 0 || !std::isfinite(maxAbs) )
+        return 0;
+    int exponent;
+    std::frexp( maxAbs, &exponent );
+    return std::max( exponent, -1020 );
+}
+
+// sum := sum + |scale alpha|^2
+template<typename Real>
+void UpdateScaledSquare
+( const Real& alpha, double scale, Superaccumulator& sum )
+{
+    const double scaledAlpha = scale*double(alpha);
+    sum.UpdateProduct( scaledAlpha, scaledAlpha );
+}
+
+template<typename Real>
+void UpdateScaledSquare
+( const Complex<Real>& alpha, double scale, Superaccumulator& sum )
+{
+    UpdateScaledSquare( alpha.real(), scale, sum );
+    UpdateScaledSquare( alpha.imag(), scale, sum );
+}
+
+// sums := sums + Conj(alpha) beta, where 'sums' holds the real part and, for
+// complex data, the imaginary part
+template<typename Real>
+void UpdateInnerProduct
+( const Real& alpha, const Real& beta, Superaccumulator* sums )
+{ sums[0].UpdateProduct( double(alpha), double(beta) ); }
+
+template<typename Real>
+void UpdateInnerProduct
+( const Complex<Real>& alpha, const Complex<Real>& beta,
+  Superaccumulator* sums )
+{
+    const double alphaReal = alpha.real(), alphaImag = alpha.imag(),
+                 betaReal = beta.real(), betaImag = beta.imag();
+    sums[0].UpdateProduct( alphaReal, betaReal );
+    sums[0].UpdateProduct( alphaImag, betaImag );
+    sums[1].UpdateProduct( alphaReal, betaImag );
+    sums[1].UpdateProduct( -alphaImag, betaReal );
+}
+
+template<typename Real>
+void RoundInnerProduct( const Superaccumulator* sums, Real& alpha )
+{ alpha = Real(sums[0].Round()); }
+
+template<typename Real>
+void RoundInnerProduct( const Superaccumulator* sums, Complex<Real>& alpha )
+{ alpha = Complex<Real>( Real(sums[0].Round()), Real(sums[1].Round()) ); }
+
+// sums := sums + sum_{i,j} update(i,j), where 'update' adds to 'numSums'
+// accumulators. Each thread accumulates into its own copies, which are then
+// added together, so the result is independent of the number of threads.
+template<typename UpdateFunction>
+void ParallelAccumulate
+( Int m, Int n, Int numSums, Superaccumulator* sums,
+  const UpdateFunction& update )
+{
+#ifdef EL_HYBRID
+    const bool parallel = m*n >= minParallelSize && !omp_in_parallel();
+    #pragma omp parallel if(parallel)
+#endif
+    {
+        Superaccumulator threadSums[2];
+        for( Int j=0; j<n; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp for schedule(static) nowait
+#endif
+            for( Int i=0; i<m; ++i )
+                update( i, j, threadSums );
+        }
+#ifdef EL_HYBRID
+        #pragma omp critical
+#endif
+        for( Int k=0; k<numSums; ++k )
+            sums[k].Update( threadSums[k] );
+    }
+}
+
+template<typename Ring,typename=EnableIf<IsBlasScalar<Ring>>>
+Ring HilbertSchmidtHelper
+( const Matrix<Ring>& ALoc, const Matrix<Ring>& BLoc,
+  mpi::Comm const& comm )
+{
+    const Int numSums = IsComplex<Ring>::value ? 2 : 1;
+    const Ring* ABuf = ALoc.LockedBuffer();
+    const Ring* BBuf = BLoc.LockedBuffer();
+    const Int ALDim = ALoc.LDim();
+    const Int BLDim = BLoc.LDim();
+
+    Superaccumulator sums[2];
+    ParallelAccumulate
+    ( ALoc.Height(), ALoc.Width(), numSums, sums,
+      [&]( Int i, Int j, Superaccumulator* threadSums )
+      { UpdateInnerProduct( ABuf[i+j*ALDim], BBuf[i+j*BLDim], threadSums ); } );
+    AllReduce( sums, numSums, comm );
+
+    Ring innerProd;
+    RoundInnerProduct( sums, innerProd );
+    return innerProd;
+}
+
+template<typename Ring,typename=DisableIf<IsBlasScalar<Ring>>,typename=void>
+Ring HilbertSchmidtHelper
+( const Matrix<Ring>& ALoc, const Matrix<Ring>& BLoc,
+  mpi::Comm const& comm )
+{
+    LogicError("Reproducible reductions require single or double precision");
+    return Ring(0);
+}
+
+template<typename Field,typename=EnableIf<IsBlasScalar<Field>>>
+Base<Field> FrobeniusNormHelper
+( const Matrix<Field>& ALoc, mpi::Comm const& comm )
+{
+    const Int mLocal = ALoc.Height();
+    const Int nLocal = ALoc.Width();
+    const Field* ABuf = ALoc.LockedBuffer();
+    const Int ALDim = ALoc.LDim();
+
+    // Scale by the power of two determined by the largest entry so that the
+    // squares can neither overflow nor (for the larger entries) underflow
+    double localMaxAbs = 0;
+    for( Int j=0; j<nLocal; ++j )
+        for( Int i=0; i<mLocal; ++i )
+            localMaxAbs = std::max( localMaxAbs, MaxAbsPart(ABuf[i+j*ALDim]) );
+    const double maxAbs =
+      mpi::AllReduce( localMaxAbs, mpi::MAX, comm, SyncInfo<Device::CPU>() );
+    const int exponent = ScaleExponent( maxAbs );
+    const double scale = std::ldexp( 1., -exponent );
+
+    Superaccumulator sum;
+    ParallelAccumulate
+    ( mLocal, nLocal, 1, &sum,
+      [&]( Int i, Int j, Superaccumulator* threadSums )
+      { UpdateScaledSquare( ABuf[i+j*ALDim], scale, threadSums[0] ); } );
+    AllReduce( &sum, 1, comm );
+
+    return Base<Field>(std::ldexp( std::sqrt(sum.Round()), exponent ));
+}
+
+template<typename Field,typename=DisableIf<IsBlasScalar<Field>>,
+         typename=void>
+Base<Field> FrobeniusNormHelper
+( const Matrix<Field>& ALoc, mpi::Comm const& comm )
+{
+    LogicError("Reproducible reductions require single or double precision");
+    return Base<Field>(0);
+}
+
+// normsLoc(k) := || A(k) ||_2 for the 'numNorms' vectors A(k) of length 'n'
+// whose entries are ABuf[k*kStride+l*lStride], for l=0,...,n-1
+template<typename Field,typename=EnableIf<IsBlasScalar<Field>>>
+void TwoNormsHelper
+( Int numNorms, Int n, const Field* ABuf, Int kStride, Int lStride,
+  Matrix<Base<Field>>& normsLoc, mpi::Comm const& comm )
+{
+    vector<double> maxAbs( numNorms, 0 );
+    for( Int k=0; k<numNorms; ++k )
+        for( Int l=0; l<n; ++l )
+            maxAbs[k] =
+              std::max( maxAbs[k], MaxAbsPart(ABuf[k*kStride+l*lStride]) );
+    mpi::AllReduce
+    ( maxAbs.data(), numNorms, mpi::MAX, comm, SyncInfo<Device::CPU>() );
+
+    vector<Superaccumulator> sums( numNorms );
+#ifdef EL_HYBRID
+    const bool parallel = numNorms*n >= minParallelSize && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int k=0; k<numNorms; ++k )
+    {
+        const double scale = std::ldexp( 1., -ScaleExponent(maxAbs[k]) );
+        for( Int l=0; l<n; ++l )
+            UpdateScaledSquare( ABuf[k*kStride+l*lStride], scale, sums[k] );
+    }
+    AllReduce( sums.data(), numNorms, comm );
+
+    for( Int k=0; k<numNorms; ++k )
+        normsLoc(k) =
+          Base<Field>(std::ldexp
+          ( std::sqrt(sums[k].Round()), ScaleExponent(maxAbs[k]) ));
+}
+
+template<typename Field,typename=DisableIf<IsBlasScalar<Field>>,
+         typename=void>
+void TwoNormsHelper
+( Int numNorms, Int n, const Field* ABuf, Int kStride, Int lStride,
+  Matrix<Base<Field>>& normsLoc, mpi::Comm const& comm )
+{
+    LogicError("Reproducible reductions require single or double precision");
+}
+
+} // anonymous namespace
+
+template<typename Ring>
+Ring ReproducibleHilbertSchmidt
+( const Matrix<Ring>& ALoc, const Matrix<Ring>& BLoc,
+  mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    return HilbertSchmidtHelper( ALoc, BLoc, comm );
+}
+
+template<typename Field>
+Base<Field> ReproducibleFrobeniusNorm
+( const Matrix<Field>& ALoc, mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    return FrobeniusNormHelper( ALoc, comm );
+}
+
+template<typename Field>
+void ReproducibleColumnTwoNorms
+( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc,
+  mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    TwoNormsHelper
+    ( ALoc.Width(), ALoc.Height(), ALoc.LockedBuffer(), ALoc.LDim(), Int(1),
+      normsLoc, comm );
+}
+
+template<typename Field>
+void ReproducibleRowTwoNorms
+( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc,
+  mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    TwoNormsHelper
+    ( ALoc.Height(), ALoc.Width(), ALoc.LockedBuffer(), Int(1), ALoc.LDim(),
+      normsLoc, comm );
+}
+
+#define PROTO(Ring) \
+  template Ring ReproducibleHilbertSchmidt \
+  ( const Matrix<Ring>& ALoc, const Matrix<Ring>& BLoc, \
+    mpi::Comm const& comm );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#define PROTO(Field) \
+  template Base<Field> ReproducibleFrobeniusNorm \
+  ( const Matrix<Field>& ALoc, mpi::Comm const& comm ); \
+  template void ReproducibleColumnTwoNorms \
+  ( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc, \
+    mpi::Comm const& comm ); \
+  template void ReproducibleRowTwoNorms \
+  ( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc, \
+    mpi::Comm const& comm );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
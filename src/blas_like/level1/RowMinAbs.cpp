@@ -8,6 +8,7 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include "./NormKernels.hpp"
 
 namespace El {
 
@@ -16,17 +17,9 @@ void RowMinAbs( const Matrix<Ring>& A, Matrix<Base<Ring>>& mins )
 {
     EL_DEBUG_CSE
     typedef Base<Ring> RealRing;
-    const Int m = A.Height();
-    const Int n = A.Width();
-    mins.Resize( m, 1 );
-    Zero( mins );
-    for( Int i=0; i<m; ++i )
-    {
-        RealRing rowMin = limits::Max<RealRing>();
-        for( Int j=0; j<n; ++j )
-            rowMin = Min(rowMin,Abs(A(i,j)));
-        mins(i) = rowMin;
-    }
+    mins.Resize( A.Height(), 1 );
+    Fill( mins, limits::Max<RealRing>() );
+    RowAbsReduce( A, mins.Buffer(), MinAbsOp() );
 }
 
 template<typename Ring>
@@ -36,22 +29,11 @@ void RowMinAbsNonzero
         Matrix<Base<Ring>>& mins )
 {
     EL_DEBUG_CSE
-    typedef Base<Ring> RealRing;
     const Int m = A.Height();
-    const Int n = A.Width();
     mins.Resize( m, 1 );
-    Zero( mins );
     for( Int i=0; i<m; ++i )
-    {
-        RealRing rowMin = upperBounds(i);
-        for( Int j=0; j<n; ++j )
-        {
-            const RealRing absVal = Abs(A(i,j));
-            if( absVal > RealRing(0) )
-                rowMin = Min(rowMin,absVal);
-        }
-        mins(i) = rowMin;
-    }
+        mins(i) = upperBounds(i);
+    RowAbsReduce( A, mins.Buffer(), MinAbsNonzeroOp() );
 }
 
 template<typename Ring,Dist U,Dist V>
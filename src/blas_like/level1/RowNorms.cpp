@@ -9,6 +9,7 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include "./NormsFromScaledSquares.hpp"
+#include "./NormKernels.hpp"
 
 namespace El {
 
@@ -17,23 +18,17 @@ void RowTwoNormsHelper
 ( const Matrix<Field>& ALoc, Matrix<Base<Field>>& normsLoc, mpi::Comm const& comm )
 {
     EL_DEBUG_CSE
+    if( IsBlasScalar<Field>::value && ReproducibleReductions() )
+    {
+        ReproducibleRowTwoNorms( ALoc, normsLoc, comm );
+        return;
+    }
     typedef Base<Field> Real;
     const Int mLocal = ALoc.Height();
-    const Int nLocal = ALoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
+    // TODO(poulson): Ensure that NaN's propagate for non-BLAS scalars
     Matrix<Real> localScales(mLocal,1 ), localScaledSquares(mLocal,1);
-    for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-    {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(iLoc) = localScale;
-        localScaledSquares(iLoc) = localScaledSquare;
-    }
+    RowScaledSquares( ALoc, localScales.Buffer(), localScaledSquares.Buffer() );
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
 }
@@ -50,6 +45,21 @@ void RowTwoNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    if( IsBlasScalar<Field>::value && ReproducibleReductions() )
+    {
+        ReproducibleRowTwoNorms( A, norms, mpi::COMM_SELF );
+        return;
+    }
+    if( IsBlasScalar<Field>::value )
+    {
+        // Sweeping down the columns avoids a strided Nrm2 per row
+        typedef Base<Field> Real;
+        Matrix<Real> scales( m, 1 ), scaledSquares( m, 1 );
+        RowScaledSquares( A, scales.Buffer(), scaledSquares.Buffer() );
+        for( Int i=0; i<m; ++i )
+            norms(i) = scales(i)*Sqrt(scaledSquares(i));
+        return;
+    }
     for( Int i=0; i<m; ++i )
         norms(i) = blas::Nrm2( n, &A(i,0), A.LDim() );
 }
@@ -58,17 +68,9 @@ template<typename Field>
 void RowMaxNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int m = A.Height();
-    const Int n = A.Width();
-    norms.Resize( m, 1 );
-    for( Int i=0; i<m; ++i )
-    {
-        Real rowMax = 0;
-        for( Int j=0; j<n; ++j )
-            rowMax = Max(rowMax,Abs(A(i,j)));
-        norms(i) = rowMax;
-    }
+    norms.Resize( A.Height(), 1 );
+    Zero( norms );
+    RowAbsReduce( A, norms.Buffer(), MaxAbsOp() );
 }
 
 template<typename Field,Dist U,Dist V>
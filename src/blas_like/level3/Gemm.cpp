@@ -14,6 +14,7 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Strassen.hpp"
 
 namespace El
 {
@@ -205,6 +206,19 @@ void Gemm (
     Gemm(orientA, orientB, alpha, A, B, T(0), C);
 }
 
+template<typename T>
+void Gemm
+(Orientation orientA, Orientation orientB,
+  T alpha, Matrix<T> const& A, Matrix<T> const& B,
+  T beta, Matrix<T>& C, GemmAlgorithm alg)
+{
+    EL_DEBUG_CSE
+    if (alg == GEMM_STRASSEN)
+        gemm::Strassen(orientA, orientB, alpha, A, B, beta, C);
+    else
+        Gemm(orientA, orientB, alpha, A, B, beta, C);
+}
+
 template<typename T>
 void Gemm
 (Orientation orientA, Orientation orientB,
@@ -214,6 +228,11 @@ void Gemm
   GemmAlgorithm alg)
 {
     EL_DEBUG_CSE
+    if (alg == GEMM_STRASSEN)
+    {
+        gemm::Strassen(orientA, orientB, alpha, A, B, beta, C);
+        return;
+    }
     C *= beta;
     if(orientA == NORMAL && orientB == NORMAL)
     {
@@ -407,6 +426,11 @@ template void Gemm(Orientation orientA, Orientation orientB,
              const Matrix<T,Device::CPU>& B, \
                    Matrix<T,Device::CPU>& C); \
   template void Gemm \
+  (Orientation orientA, Orientation orientB, \
+    T alpha, const Matrix<T>& A, \
+             const Matrix<T>& B, \
+    T beta,        Matrix<T>& C, GemmAlgorithm alg); \
+  template void Gemm \
   (Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
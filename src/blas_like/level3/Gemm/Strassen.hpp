@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Strassen-Winograd multiplication (7 half-size products and 15 additions per
+// level of recursion). The same recursion drives both the sequential and the
+// distributed variants: in the latter, every quadrant is still distributed
+// over the entire grid (i.e., each level is a depth-first step of CAPS) and
+// the products at the cutoff are formed with SUMMA.
+//
+// The temporaries for each level are allocated once per call and reused by
+// every subproblem at that depth, so the total workspace is bounded by
+// roughly (2/3)(mk+kn+2mn) entries.
+
+namespace strassen {
+
+// Every quadrant offset must be a multiple of 'unit' so that the quadrants of
+// a distributed matrix share the alignment of the original
+inline Int Unit(const Grid& g) { return g.LCM(); }
+
+template<typename T>
+void AddWorkspace(vector<Matrix<T>>& work, const Matrix<T>&)
+{ work.emplace_back(); }
+
+template<typename T>
+void AddWorkspace(vector<DistMatrix<T>>& work, const DistMatrix<T>& A)
+{ work.emplace_back(A.Grid()); }
+
+template<typename T>
+void Prepare(Matrix<T>& W, const Matrix<T>&, Int height, Int width)
+{ W.Resize(height, width); }
+
+template<typename T>
+void Prepare
+(DistMatrix<T>& W, const DistMatrix<T>& like, Int height, Int width)
+{
+    W.AlignWith(like.DistData());
+    W.Resize(height, width);
+}
+
+// op(A)(I,J) for a stored matrix A
+template<typename Mat>
+const Mat Block(Orientation orient, const Mat& A, Range<Int> I, Range<Int> J)
+{ return orient == NORMAL ? A(I, J) : A(J, I); }
+
+// C += alpha op(A) op(B)
+template<typename T, typename Mat>
+void Recursion
+(Orientation orientA, Orientation orientB,
+ T alpha, const Mat& A, const Mat& B, Mat& C,
+ Int cutoff, Int unit, vector<Mat>& work, Int depth)
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const Int step = 2*unit;
+    if (Min(Min(m,n),k) <= cutoff || Min(Min(m,n),k) < step ||
+        Int(work.size()) < 4*(depth+1))
+    {
+        Gemm(orientA, orientB, alpha, A, B, T(1), C);
+        return;
+    }
+
+    // Peel off the trailing rows/columns which do not fit the even split
+    const Int mEven = m - m % step;
+    const Int nEven = n - n % step;
+    const Int kEven = k - k % step;
+    const Int mHalf = mEven/2, nHalf = nEven/2, kHalf = kEven/2;
+    const Range<Int> iInd1(0,mHalf), iInd2(mHalf,mEven),
+                     jInd1(0,nHalf), jInd2(nHalf,nEven),
+                     kInd1(0,kHalf), kInd2(kHalf,kEven);
+
+    auto A11 = Block(orientA, A, iInd1, kInd1);
+    auto A12 = Block(orientA, A, iInd1, kInd2);
+    auto A21 = Block(orientA, A, iInd2, kInd1);
+    auto A22 = Block(orientA, A, iInd2, kInd2);
+    auto B11 = Block(orientB, B, kInd1, jInd1);
+    auto B12 = Block(orientB, B, kInd1, jInd2);
+    auto B21 = Block(orientB, B, kInd2, jInd1);
+    auto B22 = Block(orientB, B, kInd2, jInd2);
+    auto C11 = C(iInd1, jInd1);
+    auto C12 = C(iInd1, jInd2);
+    auto C21 = C(iInd2, jInd1);
+    auto C22 = C(iInd2, jInd2);
+
+    // The sums of the quadrants of A and B are formed in their stored
+    // orientations since op(X)+op(Y) = op(X+Y)
+    Mat& S = work[4*depth+0];
+    Mat& R = work[4*depth+1];
+    Mat& W1 = work[4*depth+2];
+    Mat& W2 = work[4*depth+3];
+    Prepare(S, A11, A11.Height(), A11.Width());
+    Prepare(R, B11, B11.Height(), B11.Width());
+    Prepare(W1, C11, mHalf, nHalf);
+    Prepare(W2, C11, mHalf, nHalf);
+
+    // P1 = A11 B11 and C11 += P1 + P2, where P2 = A12 B21
+    Zero(W1);
+    Recursion
+    (orientA, orientB, alpha, A11, B11, W1, cutoff, unit, work, depth+1);
+    Axpy(T(1), W1, C11);
+    Recursion
+    (orientA, orientB, alpha, A12, B21, C11, cutoff, unit, work, depth+1);
+
+    // P5 = S1 T1, with S1 = A21 + A22 and T1 = B12 - B11
+    S = A21;
+    Axpy(T(1), A22, S);
+    R = B12;
+    Axpy(T(-1), B11, R);
+    Zero(W2);
+    Recursion
+    (orientA, orientB, alpha, S, R, W2, cutoff, unit, work, depth+1);
+
+    // U2 = P1 + P6, with P6 = S2 T2, S2 = S1 - A11 and T2 = B22 - T1
+    Axpy(T(-1), A11, S);
+    Scale(T(-1), R);
+    Axpy(T(1), B22, R);
+    Recursion
+    (orientA, orientB, alpha, S, R, W1, cutoff, unit, work, depth+1);
+
+    // C12 += P3 = S4 B22, with S4 = A12 - S2
+    Scale(T(-1), S);
+    Axpy(T(1), A12, S);
+    Recursion
+    (orientA, orientB, alpha, S, B22, C12, cutoff, unit, work, depth+1);
+
+    // C21 -= P4 = A22 T4, with T4 = T2 - B21
+    Axpy(T(-1), B21, R);
+    Recursion
+    (orientA, orientB, -alpha, A22, R, C21, cutoff, unit, work, depth+1);
+
+    // C12 += U2 + P5, C21 += U2, and C22 += U2 + P5
+    Axpy(T(1), W1, C12);
+    Axpy(T(1), W2, C12);
+    Axpy(T(1), W1, C21);
+    Axpy(T(1), W1, C22);
+    Axpy(T(1), W2, C22);
+
+    // P7 = S3 T3, with S3 = A11 - A21 and T3 = B22 - B12, is added to both
+    // C21 and C22
+    S = A11;
+    Axpy(T(-1), A21, S);
+    R = B22;
+    Axpy(T(-1), B12, R);
+    Zero(W1);
+    Recursion
+    (orientA, orientB, alpha, S, R, W1, cutoff, unit, work, depth+1);
+    Axpy(T(1), W1, C21);
+    Axpy(T(1), W1, C22);
+
+    // Fix up the peeled rows and columns with classical products
+    if (kEven != k)
+    {
+        const Range<Int> kInd(kEven,k);
+        auto AEdge = Block(orientA, A, IR(0,mEven), kInd);
+        auto BEdge = Block(orientB, B, kInd, IR(0,nEven));
+        auto CEven = C(IR(0,mEven), IR(0,nEven));
+        Gemm(orientA, orientB, alpha, AEdge, BEdge, T(1), CEven);
+    }
+    if (nEven != n)
+    {
+        const Range<Int> jInd(nEven,n);
+        auto BEdge = Block(orientB, B, IR(0,k), jInd);
+        auto CEdge = C(IR(0,m), jInd);
+        Gemm(orientA, orientB, alpha, A, BEdge, T(1), CEdge);
+    }
+    if (mEven != m)
+    {
+        const Range<Int> iInd(mEven,m);
+        auto AEdge = Block(orientA, A, iInd, IR(0,k));
+        auto BEven = Block(orientB, B, IR(0,k), IR(0,nEven));
+        auto CEdge = C(iInd, IR(0,nEven));
+        Gemm(orientA, orientB, alpha, AEdge, BEven, T(1), CEdge);
+    }
+}
+
+// The number of levels of recursion which will be performed
+inline Int NumLevels(Int m, Int n, Int k, Int cutoff, Int unit)
+{
+    Int numLevels = 0;
+    Int minDim = Min(Min(m,n),k);
+    while (minDim > cutoff && minDim >= 2*unit)
+    {
+        ++numLevels;
+        minDim /= 2;
+    }
+    return numLevels;
+}
+
+} // namespace strassen
+
+template<typename T>
+void Strassen
+(Orientation orientA, Orientation orientB,
+ T alpha, const Matrix<T>& A, const Matrix<T>& B,
+ T beta, Matrix<T>& C)
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const Int cutoff = Max(StrassenCutoff<T>(), Int(1));
+
+    Scale(beta, C);
+    const Int numLevels = strassen::NumLevels(m, n, k, cutoff, 1);
+    vector<Matrix<T>> work;
+    work.reserve(4*numLevels);
+    for (Int level=0; level<4*numLevels; ++level)
+        strassen::AddWorkspace(work, C);
+    strassen::Recursion
+    (orientA, orientB, alpha, A, B, C, cutoff, 1, work, 0);
+}
+
+template<typename T>
+void Strassen
+(Orientation orientA, Orientation orientB,
+ T alpha, const AbstractDistMatrix<T>& APre, const AbstractDistMatrix<T>& BPre,
+ T beta, AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    if (APre.GetLocalDevice() != Device::CPU)
+        LogicError("Strassen not implemented for device!");
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre), BProx(BPre);
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const Int cutoff = Max(StrassenCutoff<T>(), Int(1));
+    const Int unit = strassen::Unit(C.Grid());
+
+    Scale(beta, C);
+    const Int numLevels = strassen::NumLevels(m, n, k, cutoff, unit);
+    vector<DistMatrix<T>> work;
+    work.reserve(4*numLevels);
+    for (Int level=0; level<4*numLevels; ++level)
+        strassen::AddWorkspace(work, C);
+    strassen::Recursion
+    (orientA, orientB, alpha, A, B, C, cutoff, unit, work, 0);
+}
+
+} // namespace gemm
+} // namespace El
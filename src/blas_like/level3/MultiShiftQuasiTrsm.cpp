@@ -365,7 +365,9 @@ void LocalMultiShiftQuasiTrsm
     )
     MultiShiftQuasiTrsm
     ( side, uplo, orientation,
-      alpha, A.LockedMatrix(), shifts.LockedMatrix(), X.Matrix() );
+      alpha, A.LockedMatrix(),
+      static_cast<const Matrix<Field>&>(shifts.LockedMatrix()),
+      static_cast<Matrix<Field>&>(X.Matrix()) );
 }
 
 template<typename Real>
@@ -395,8 +397,10 @@ void LocalMultiShiftQuasiTrsm
     )
     MultiShiftQuasiTrsm
     ( side, uplo, orientation,
-      alpha, A.LockedMatrix(), shifts.LockedMatrix(),
-             XReal.Matrix(), XImag.Matrix() );
+      alpha, A.LockedMatrix(),
+      static_cast<const Matrix<Complex<Real>>&>(shifts.LockedMatrix()),
+      static_cast<Matrix<Real>&>(XReal.Matrix()),
+      static_cast<Matrix<Real>&>(XImag.Matrix()) );
 }
 
 #define PROTO(Field) \
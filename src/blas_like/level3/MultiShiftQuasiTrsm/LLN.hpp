@@ -94,11 +94,12 @@ void LLN( const Matrix<F>& L, const Matrix<F>& shifts, Matrix<F>& X )
     const Int m = X.Height();
     const Int bsize = Blocksize();
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -138,11 +139,12 @@ void LLNLarge
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -198,11 +200,12 @@ void LLNMedium
     DistMatrix<F,MR,  STAR> shifts_MR_STAR( shifts ),
                             shifts_MR_STAR_Align(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -254,11 +257,12 @@ void LLNSmall
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g),
                             shifts_STAR_STAR(shifts);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && L.Get(k+nbProp-1,k+nbProp) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
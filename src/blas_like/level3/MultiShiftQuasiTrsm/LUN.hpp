@@ -10,6 +10,11 @@
 namespace El {
 namespace msquasitrsm {
 
+// The shifted systems are swept through simultaneously in a
+// structure-of-arrays layout: the right-hand sides are transposed so that the
+// entries of all of the solutions associated with a given row of U are
+// contiguous, and every update from a (quasi-)diagonal block is then a unit-
+// stride loop over the shifts which reuses a single entry of U.
 template<typename F>
 void LUNUnb( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
 {
@@ -25,10 +30,14 @@ void LUNUnb( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
     const Int n = X.Width();
     typedef Base<F> Real;
 
+    Matrix<F> XTrans;
+    Transpose( X, XTrans );
+
     const F* UBuf = U.LockedBuffer();
-          F* XBuf = X.Buffer();
+    const F* shiftBuf = shifts.LockedBuffer();
+          F* XTBuf = XTrans.Buffer();
     const Int ldu = U.LDim();
-    const Int ldX = X.LDim();
+    const Int ldXT = XTrans.LDim();
 
     Int k=m-1;
     while( k >= 0 )
@@ -48,47 +57,61 @@ void LUNUnb( const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
             // Extract the constant part of the 2x2 diagonal block, D
             const F delta12 = UBuf[ k   +(k+1)*ldu];
             const F delta21 = UBuf[(k+1)+ k   *ldu];
+            F* x1 = &XTBuf[ k   *ldXT];
+            F* x2 = &XTBuf[(k+1)*ldXT];
             for( Int j=0; j<n; ++j )
             {
-                const F delta11 = UBuf[ k   + k   *ldu] - shifts.Get(j,0);
-                const F delta22 = UBuf[(k+1)+(k+1)*ldu] - shifts.Get(j,0);
+                const F delta11 = UBuf[ k   + k   *ldu] - shiftBuf[j];
+                const F delta22 = UBuf[(k+1)+(k+1)*ldu] - shiftBuf[j];
                 // Decompose D = Q R
                 Real c; F s;
                 const F gamma11 = Givens( delta11, delta21, c, s );
                 const F gamma12 =        c*delta12 + s*delta22;
                 const F gamma22 = -Conj(s)*delta12 + c*delta22;
 
-                F* xBuf = &XBuf[j*ldX];
                 // Solve against Q
-                const F chi1 = xBuf[k  ];
-                const F chi2 = xBuf[k+1];
-                xBuf[k  ] =        c*chi1 + s*chi2;
-                xBuf[k+1] = -Conj(s)*chi1 + c*chi2;
+                const F chi1 = x1[j];
+                const F chi2 = x2[j];
+                x1[j] =        c*chi1 + s*chi2;
+                x2[j] = -Conj(s)*chi1 + c*chi2;
 
                 // Solve against R
-                xBuf[k+1] /= gamma22;
-                xBuf[k  ] -= gamma12*xBuf[k+1];
-                xBuf[k  ] /= gamma11;
+                x2[j] /= gamma22;
+                x1[j] -= gamma12*x2[j];
+                x1[j] /= gamma11;
+            }
 
-                // Update x0 := x0 - U01 x1
-                blas::Axpy( k, -xBuf[k  ], &UBuf[ k   *ldu], 1, xBuf, 1 );
-                blas::Axpy( k, -xBuf[k+1], &UBuf[(k+1)*ldu], 1, xBuf, 1 );
+            // Update x0 := x0 - U01 x1
+            for( Int i=0; i<k; ++i )
+            {
+                const F upsilon1 = UBuf[i+ k   *ldu];
+                const F upsilon2 = UBuf[i+(k+1)*ldu];
+                F* x0 = &XTBuf[i*ldXT];
+                for( Int j=0; j<n; ++j )
+                    x0[j] -= upsilon1*x1[j] + upsilon2*x2[j];
             }
         }
         else
         {
+            // Solve the 1x1 linear systems
+            const F upsilon11 = UBuf[k+k*ldu];
+            F* x1 = &XTBuf[k*ldXT];
             for( Int j=0; j<n; ++j )
-            {
-                F* xBuf = &XBuf[j*ldX];
-                // Solve the 1x1 linear system
-                xBuf[k] /= UBuf[k+k*ldu] - shifts.Get(j,0);
+                x1[j] /= upsilon11 - shiftBuf[j];
 
-                // Update x0 := x0 - u01 chi_1
-                blas::Axpy( k, -xBuf[k], &UBuf[k*ldu], 1, xBuf, 1 );
+            // Update x0 := x0 - u01 chi_1
+            for( Int i=0; i<k; ++i )
+            {
+                const F upsilon = UBuf[i+k*ldu];
+                F* x0 = &XTBuf[i*ldXT];
+                for( Int j=0; j<n; ++j )
+                    x0[j] -= upsilon*x1[j];
             }
         }
         --k;
     }
+
+    Transpose( XTrans, X );
 }
 
 template<typename Real>
@@ -111,12 +134,17 @@ void LUNUnb
     const Int n = XReal.Width();
     typedef Complex<Real> C;
 
+    Matrix<Real> XRealTrans, XImagTrans;
+    Transpose( XReal, XRealTrans );
+    Transpose( XImag, XImagTrans );
+
     const Real* UBuf = U.LockedBuffer();
-          Real* XRealBuf = XReal.Buffer();
-          Real* XImagBuf = XImag.Buffer();
+    const C* shiftBuf = shifts.LockedBuffer();
+          Real* XRealTBuf = XRealTrans.Buffer();
+          Real* XImagTBuf = XImagTrans.Buffer();
     const Int ldu = U.LDim();
-    const Int ldXReal = XReal.LDim();
-    const Int ldXImag = XImag.LDim();
+    const Int ldXRealT = XRealTrans.LDim();
+    const Int ldXImagT = XImagTrans.LDim();
 
     Int k=m-1;
     while( k >= 0 )
@@ -136,21 +164,23 @@ void LUNUnb
             // Extract the constant part of the 2x2 diagonal block, D
             const Real delta12 = UBuf[ k   +(k+1)*ldu];
             const Real delta21 = UBuf[(k+1)+ k   *ldu];
+            Real* x1Real = &XRealTBuf[ k   *ldXRealT];
+            Real* x1Imag = &XImagTBuf[ k   *ldXImagT];
+            Real* x2Real = &XRealTBuf[(k+1)*ldXRealT];
+            Real* x2Imag = &XImagTBuf[(k+1)*ldXImagT];
             for( Int j=0; j<n; ++j )
             {
-                const C delta11 = UBuf[ k   + k   *ldu] - shifts.Get(j,0);
-                const C delta22 = UBuf[(k+1)+(k+1)*ldu] - shifts.Get(j,0);
+                const C delta11 = UBuf[ k   + k   *ldu] - shiftBuf[j];
+                const C delta22 = UBuf[(k+1)+(k+1)*ldu] - shiftBuf[j];
                 // Decompose D = Q R
                 Real c; C s;
                 const C gamma11 = Givens( delta11, C(delta21), c, s );
                 const C gamma12 =        c*delta12 + s*delta22;
                 const C gamma22 = -Conj(s)*delta12 + c*delta22;
 
-                Real* xRealBuf = &XRealBuf[j*ldXReal];
-                Real* xImagBuf = &XImagBuf[j*ldXImag];
                 // Solve against Q
-                const C chi1 = C(xRealBuf[k  ],xImagBuf[k  ]);
-                const C chi2 = C(xRealBuf[k+1],xImagBuf[k+1]);
+                const C chi1 = C(x1Real[j],x1Imag[j]);
+                const C chi2 = C(x2Real[j],x2Imag[j]);
                 C eta1 =        c*chi1 + s*chi2;
                 C eta2 = -Conj(s)*chi1 + c*chi2;
 
@@ -160,41 +190,58 @@ void LUNUnb
                 eta1 /= gamma11;
 
                 // Store the separated real and imaginary comp's of eta{1,2}
-                xRealBuf[k+0] = eta1.real();
-                xImagBuf[k+0] = eta1.imag();
-                xRealBuf[k+1] = eta2.real();
-                xImagBuf[k+1] = eta2.imag();
-
-                // Update x0 := x0 - U01 x1
-                blas::Axpy
-                ( k, -xRealBuf[k  ], &UBuf[ k   *ldu], 1, xRealBuf, 1 );
-                blas::Axpy
-                ( k, -xImagBuf[k  ], &UBuf[ k   *ldu], 1, xImagBuf, 1 );
-                blas::Axpy
-                ( k, -xRealBuf[k+1], &UBuf[(k+1)*ldu], 1, xRealBuf, 1 );
-                blas::Axpy
-                ( k, -xImagBuf[k+1], &UBuf[(k+1)*ldu], 1, xImagBuf, 1 );
+                x1Real[j] = eta1.real();
+                x1Imag[j] = eta1.imag();
+                x2Real[j] = eta2.real();
+                x2Imag[j] = eta2.imag();
+            }
+
+            // Update x0 := x0 - U01 x1
+            for( Int i=0; i<k; ++i )
+            {
+                const Real upsilon1 = UBuf[i+ k   *ldu];
+                const Real upsilon2 = UBuf[i+(k+1)*ldu];
+                Real* x0Real = &XRealTBuf[i*ldXRealT];
+                Real* x0Imag = &XImagTBuf[i*ldXImagT];
+                for( Int j=0; j<n; ++j )
+                {
+                    x0Real[j] -= upsilon1*x1Real[j] + upsilon2*x2Real[j];
+                    x0Imag[j] -= upsilon1*x1Imag[j] + upsilon2*x2Imag[j];
+                }
             }
         }
         else
         {
+            // Solve the 1x1 linear systems
+            const Real upsilon11 = UBuf[k+k*ldu];
+            Real* x1Real = &XRealTBuf[k*ldXRealT];
+            Real* x1Imag = &XImagTBuf[k*ldXImagT];
             for( Int j=0; j<n; ++j )
             {
-                Real* xRealBuf = &XRealBuf[j*ldXReal];
-                Real* xImagBuf = &XImagBuf[j*ldXImag];
-                // Solve the 1x1 linear system
-                C eta1(xRealBuf[k],xImagBuf[k]);
-                eta1 /= UBuf[k+k*ldu] - shifts.Get(j,0);
-                xRealBuf[k] = eta1.real();
-                xImagBuf[k] = eta1.imag();
-
-                // Update x0 := x0 - u01 chi_1
-                blas::Axpy( k, -xRealBuf[k], &UBuf[k*ldu], 1, xRealBuf, 1 );
-                blas::Axpy( k, -xImagBuf[k], &UBuf[k*ldu], 1, xImagBuf, 1 );
+                C eta1(x1Real[j],x1Imag[j]);
+                eta1 /= upsilon11 - shiftBuf[j];
+                x1Real[j] = eta1.real();
+                x1Imag[j] = eta1.imag();
+            }
+
+            // Update x0 := x0 - u01 chi_1
+            for( Int i=0; i<k; ++i )
+            {
+                const Real upsilon = UBuf[i+k*ldu];
+                Real* x0Real = &XRealTBuf[i*ldXRealT];
+                Real* x0Imag = &XImagTBuf[i*ldXImagT];
+                for( Int j=0; j<n; ++j )
+                {
+                    x0Real[j] -= upsilon*x1Real[j];
+                    x0Imag[j] -= upsilon*x1Imag[j];
+                }
             }
         }
         --k;
     }
+
+    Transpose( XRealTrans, XReal );
+    Transpose( XImagTrans, XImag );
 }
 
 template<typename F>
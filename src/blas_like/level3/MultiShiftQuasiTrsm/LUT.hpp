@@ -10,6 +10,8 @@
 namespace El {
 namespace msquasitrsm {
 
+// As in LUNUnb, the shifted systems are swept through simultaneously with
+// the right-hand sides transposed so that the updates run over the shifts
 template<typename F>
 void LUTUnb
 ( bool conjugate, const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
@@ -19,13 +21,14 @@ void LUTUnb
     const Int m = X.Height();
     const Int n = X.Width();
 
-    if( conjugate )
-        Conjugate( X );
+    Matrix<F> XTrans;
+    Transpose( X, XTrans, conjugate );
 
     const F* UBuf = U.LockedBuffer();
-          F* XBuf = X.Buffer();
+    const F* shiftBuf = shifts.LockedBuffer();
+          F* XTBuf = XTrans.Buffer();
     const Int ldU = U.LDim();
-    const Int ldX = X.LDim();
+    const Int ldXT = XTrans.LDim();
 
     Int k=0;
     while( k < m )
@@ -44,53 +47,60 @@ void LUTUnb
             // Extract the constant part of the 2x2 diagonal block, D
             const F delta12 = UBuf[ k   +(k+1)*ldU];
             const F delta21 = UBuf[(k+1)+ k   *ldU];
+            F* x1 = &XTBuf[ k   *ldXT];
+            F* x2 = &XTBuf[(k+1)*ldXT];
             for( Int j=0; j<n; ++j )
             {
-                const F delta11 = UBuf[ k   + k   *ldU] - shifts.Get(j,0);
-                const F delta22 = UBuf[(k+1)+(k+1)*ldU] - shifts.Get(j,0);
+                const F delta11 = UBuf[ k   + k   *ldU] - shiftBuf[j];
+                const F delta22 = UBuf[(k+1)+(k+1)*ldU] - shiftBuf[j];
                 // Decompose D = Q R
                 Real c; F s;
                 const F gamma11 = Givens( delta11, delta21, c, s );
                 const F gamma12 =        c*delta12 + s*delta22;
                 const F gamma22 = -Conj(s)*delta12 + c*delta22;
 
-                F* xBuf = &XBuf[j*ldX];
-
                 // Solve against R^T
-                F chi1 = xBuf[k  ];
-                F chi2 = xBuf[k+1];
+                F chi1 = x1[j];
+                F chi2 = x2[j];
                 chi1 /= gamma11;
                 chi2 -= gamma12*chi1;
                 chi2 /= gamma22;
 
                 // Solve against Q^T
-                xBuf[k  ] = c*chi1 - Conj(s)*chi2;
-                xBuf[k+1] = s*chi1 +       c*chi2;
-
-                // Update x2 := x2 - U12^T x1
-                blas::Axpy
-                ( m-(k+2), -xBuf[k  ],
-                  &UBuf[ k   +(k+2)*ldU], ldU, &xBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xBuf[k+1],
-                  &UBuf[(k+1)+(k+2)*ldU], ldU, &xBuf[k+2], 1 );
+                x1[j] = c*chi1 - Conj(s)*chi2;
+                x2[j] = s*chi1 +       c*chi2;
+            }
+
+            // Update x2 := x2 - U12^T x1
+            for( Int i=k+2; i<m; ++i )
+            {
+                const F upsilon1 = UBuf[ k   +i*ldU];
+                const F upsilon2 = UBuf[(k+1)+i*ldU];
+                F* x3 = &XTBuf[i*ldXT];
+                for( Int j=0; j<n; ++j )
+                    x3[j] -= upsilon1*x1[j] + upsilon2*x2[j];
             }
             k += 2;
         }
         else
         {
+            const F upsilon11 = UBuf[k+k*ldU];
+            F* x1 = &XTBuf[k*ldXT];
             for( Int j=0; j<n; ++j )
+                x1[j] /= upsilon11 - shiftBuf[j];
+
+            for( Int i=k+1; i<m; ++i )
             {
-                F* xBuf = &XBuf[j*ldX];
-                xBuf[k] /= UBuf[k+k*ldU] - shifts.Get(j,0);
-                blas::Axpy
-                ( m-(k+1), -xBuf[k], &UBuf[k+(k+1)*ldU], ldU, &xBuf[k+1], 1 );
+                const F upsilon = UBuf[k+i*ldU];
+                F* x2 = &XTBuf[i*ldXT];
+                for( Int j=0; j<n; ++j )
+                    x2[j] -= upsilon*x1[j];
             }
             k += 1;
         }
     }
-    if( conjugate )
-        Conjugate( X );
+
+    Transpose( XTrans, X, conjugate );
 }
 
 template<typename Real>
@@ -105,16 +115,20 @@ void LUTUnb
     typedef Complex<Real> C;
     const Int m = XReal.Height();
     const Int n = XReal.Width();
-  
+
+    Matrix<Real> XRealTrans, XImagTrans;
+    Transpose( XReal, XRealTrans );
+    Transpose( XImag, XImagTrans );
     if( conjugate )
-        XImag *= -1;
+        XImagTrans *= -1;
 
     const Real* UBuf = U.LockedBuffer();
-          Real* XRealBuf = XReal.Buffer();
-          Real* XImagBuf = XImag.Buffer();
+    const C* shiftBuf = shifts.LockedBuffer();
+          Real* XRealTBuf = XRealTrans.Buffer();
+          Real* XImagTBuf = XImagTrans.Buffer();
     const Int ldU = U.LDim();
-    const Int ldXReal = XReal.LDim();
-    const Int ldXImag = XImag.LDim();
+    const Int ldXRealT = XRealTrans.LDim();
+    const Int ldXImagT = XImagTrans.LDim();
 
     Int k=0;
     while( k < m )
@@ -133,22 +147,23 @@ void LUTUnb
             // Extract the constant part of the 2x2 diagonal block, D
             const Real delta12 = UBuf[ k   +(k+1)*ldU];
             const Real delta21 = UBuf[(k+1)+ k   *ldU];
+            Real* x1Real = &XRealTBuf[ k   *ldXRealT];
+            Real* x1Imag = &XImagTBuf[ k   *ldXImagT];
+            Real* x2Real = &XRealTBuf[(k+1)*ldXRealT];
+            Real* x2Imag = &XImagTBuf[(k+1)*ldXImagT];
             for( Int j=0; j<n; ++j )
             {
-                const C delta11 = UBuf[ k   + k   *ldU] - shifts.Get(j,0);
-                const C delta22 = UBuf[(k+1)+(k+1)*ldU] - shifts.Get(j,0);
+                const C delta11 = UBuf[ k   + k   *ldU] - shiftBuf[j];
+                const C delta22 = UBuf[(k+1)+(k+1)*ldU] - shiftBuf[j];
                 // Decompose D = Q R
                 Real c; C s;
                 const C gamma11 = Givens( delta11, C(delta21), c, s );
                 const C gamma12 =        c*delta12 + s*delta22;
                 const C gamma22 = -Conj(s)*delta12 + c*delta22;
 
-                Real* xRealBuf = &XRealBuf[j*ldXReal];
-                Real* xImagBuf = &XImagBuf[j*ldXImag]; 
-
                 // Solve against R^T
-                C chi1(xRealBuf[k  ],xImagBuf[k  ]);
-                C chi2(xRealBuf[k+1],xImagBuf[k+1]);
+                C chi1(x1Real[j],x1Imag[j]);
+                C chi2(x2Real[j],x2Imag[j]);
                 chi1 /= gamma11;
                 chi2 -= gamma12*chi1;
                 chi2 /= gamma22;
@@ -156,49 +171,59 @@ void LUTUnb
                 // Solve against Q^T
                 const C eta1 = c*chi1 - Conj(s)*chi2;
                 const C eta2 = s*chi1 +       c*chi2;
-                xRealBuf[k  ] = eta1.real();
-                xImagBuf[k  ] = eta1.imag();
-                xRealBuf[k+1] = eta2.real();
-                xImagBuf[k+1] = eta2.imag();
-
-                // Update x2 := x2 - U12^T x1
-                blas::Axpy
-                ( m-(k+2), -xRealBuf[k  ],
-                  &UBuf[ k   +(k+2)*ldU], ldU, &xRealBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xImagBuf[k  ],
-                  &UBuf[ k   +(k+2)*ldU], ldU, &xImagBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xRealBuf[k+1],
-                  &UBuf[(k+1)+(k+2)*ldU], ldU, &xRealBuf[k+2], 1 );
-                blas::Axpy
-                ( m-(k+2), -xImagBuf[k+1],
-                  &UBuf[(k+1)+(k+2)*ldU], ldU, &xImagBuf[k+2], 1 );
+                x1Real[j] = eta1.real();
+                x1Imag[j] = eta1.imag();
+                x2Real[j] = eta2.real();
+                x2Imag[j] = eta2.imag();
+            }
+
+            // Update x2 := x2 - U12^T x1
+            for( Int i=k+2; i<m; ++i )
+            {
+                const Real upsilon1 = UBuf[ k   +i*ldU];
+                const Real upsilon2 = UBuf[(k+1)+i*ldU];
+                Real* x3Real = &XRealTBuf[i*ldXRealT];
+                Real* x3Imag = &XImagTBuf[i*ldXImagT];
+                for( Int j=0; j<n; ++j )
+                {
+                    x3Real[j] -= upsilon1*x1Real[j] + upsilon2*x2Real[j];
+                    x3Imag[j] -= upsilon1*x1Imag[j] + upsilon2*x2Imag[j];
+                }
             }
             k += 2;
         }
         else
         {
+            const Real upsilon11 = UBuf[k+k*ldU];
+            Real* x1Real = &XRealTBuf[k*ldXRealT];
+            Real* x1Imag = &XImagTBuf[k*ldXImagT];
             for( Int j=0; j<n; ++j )
             {
-                Real* xRealBuf = &XRealBuf[j*ldXReal];
-                Real* xImagBuf = &XImagBuf[j*ldXImag];
-                C eta1( xRealBuf[k], xImagBuf[k] );
-                eta1 /= UBuf[k+k*ldU] - shifts.Get(j,0);
-                xRealBuf[k] = eta1.real();
-                xImagBuf[k] = eta1.imag();
-                blas::Axpy
-                ( m-(k+1), -xRealBuf[k], 
-                  &UBuf[k+(k+1)*ldU], ldU, &xRealBuf[k+1], 1 );
-                blas::Axpy
-                ( m-(k+1), -xImagBuf[k], 
-                  &UBuf[k+(k+1)*ldU], ldU, &xImagBuf[k+1], 1 );
+                C eta1( x1Real[j], x1Imag[j] );
+                eta1 /= upsilon11 - shiftBuf[j];
+                x1Real[j] = eta1.real();
+                x1Imag[j] = eta1.imag();
+            }
+
+            for( Int i=k+1; i<m; ++i )
+            {
+                const Real upsilon = UBuf[k+i*ldU];
+                Real* x2Real = &XRealTBuf[i*ldXRealT];
+                Real* x2Imag = &XImagTBuf[i*ldXImagT];
+                for( Int j=0; j<n; ++j )
+                {
+                    x2Real[j] -= upsilon*x1Real[j];
+                    x2Imag[j] -= upsilon*x1Imag[j];
+                }
             }
             k += 1;
         }
     }
+
     if( conjugate )
-        XImag *= -1;
+        XImagTrans *= -1;
+    Transpose( XRealTrans, XReal );
+    Transpose( XImagTrans, XImag );
 }
 
 template<typename F>
@@ -218,11 +243,12 @@ void LUT
     if( conjugate )
         Conjugate( X );
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -260,12 +286,13 @@ void LUT
     if( conjugate )
         XImag *= -1;
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = 
             ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != Real(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -315,11 +342,12 @@ void LUTLarge
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -384,12 +412,13 @@ void LUTLarge
     DistMatrix<Real,STAR,MR  > X1Real_STAR_MR(g), X1Imag_STAR_MR(g);
     DistMatrix<Real,STAR,VR  > X1Real_STAR_VR(g), X1Imag_STAR_VR(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = 
             ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != Real(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -464,11 +493,12 @@ void LUTMedium
     DistMatrix<F,MR,  STAR> shifts_MR_STAR(shifts),
                             shifts_MR_STAR_Align(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -539,12 +569,13 @@ void LUTMedium
     DistMatrix<Complex<Real>,MR,STAR> shifts_MR_STAR(shifts),
                                       shifts_MR_STAR_Align(g);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = 
             ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != Real(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -616,11 +647,12 @@ void LUTSmall
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g),
                             shifts_STAR_STAR(shifts);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != F(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -677,12 +709,13 @@ void LUTSmall
                                                  X1Imag_STAR_STAR(g);
     DistMatrix<C,STAR,STAR> shifts_STAR_STAR(shifts);
 
-    for( Int k=0; k<m; k+=bsize )
+    Int nb;
+    for( Int k=0; k<m; k+=nb )
     {
         const Int nbProp = Min(bsize,m-k);
         const bool in2x2 = 
             ( k+nbProp<m && U.Get(k+nbProp,k+nbProp-1) != Real(0) );
-        const Int nb = ( in2x2 ? nbProp+1 : nbProp );
+        nb = ( in2x2 ? nbProp+1 : nbProp );
 
         const Range<Int> ind1( k,    k+nb ),
                          ind2( k+nb, m    );
@@ -10,39 +10,72 @@
 namespace El {
 namespace mstrsm {
 
+// Rather than shifting the diagonal of T and calling TRSV once per shift, all
+// of the shifted systems are swept through simultaneously in a
+// structure-of-arrays layout: the right-hand sides are transposed so that
+// the entries of every shifted solution associated with a single row of T are
+// contiguous. Each entry of T is then loaded once per sweep, and the
+// innermost loops run over independent shifts with unit stride so that they
+// can be vectorized.
 template<typename F>
 void LeftUnb
 ( UpperOrLower uplo,
   Orientation orientation,
-        Matrix<F>& T,
+  const Matrix<F>& T,
   const Matrix<F>& shifts,
-        Matrix<F>& X ) 
+        Matrix<F>& X )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( shifts.Height() != X.Width() )
           LogicError("Incompatible number of shifts");
     )
-    const char uploChar = ( uplo==LOWER ? 'L' : 'U' );
-    char orientChar; 
-    switch( orientation )
-    {
-    case NORMAL:    orientChar = 'N'; break;
-    case TRANSPOSE: orientChar = 'T'; break;
-    default:        orientChar = 'C';
-    }
-    auto diag = GetDiagonal(T);
     const Int n = T.Height();
-    const Int ldim = T.LDim();
     const Int numShifts = shifts.Height();
-    for( Int j=0; j<numShifts; ++j )
+    if( n == 0 || numShifts == 0 )
+        return;
+
+    // Since (T - shift I)^H = (conj(T) - conj(shift) I)^T, adjoint solves are
+    // performed as transposed solves against the conjugated right-hand sides
+    const bool conjugate = ( orientation == ADJOINT );
+    const bool normal = ( orientation == NORMAL );
+    Matrix<F> XTrans;
+    Transpose( X, XTrans, conjugate );
+
+    // op(T) is upper-triangular, and must be solved against from the bottom
+    // up, iff (uplo == UPPER) == (orientation == NORMAL)
+    const bool backward = ( (uplo == UPPER) == normal );
+
+    const F* TBuf = T.LockedBuffer();
+    const F* shiftBuf = shifts.LockedBuffer();
+          F* XTBuf = XTrans.Buffer();
+    const Int ldT = T.LDim();
+    const Int ldXT = XTrans.LDim();
+    auto opT = [&]( Int i, Int k )
+      { return normal ? TBuf[i+k*ldT] : TBuf[k+i*ldT]; };
+
+    for( Int step=0; step<n; ++step )
     {
-        ShiftDiagonal( T, -shifts.Get(j,0) );
-        blas::Trsv
-        ( uploChar, orientChar, 'N', n, 
-          T.LockedBuffer(), ldim, X.Buffer(0,j), 1 );
-        SetDiagonal( T, diag );
+        const Int i = ( backward ? n-1-step : step );
+        const F tau = opT( i, i );
+        F* xi = &XTBuf[i*ldXT];
+        for( Int j=0; j<numShifts; ++j )
+            xi[j] /= tau - shiftBuf[j];
+
+        const Int lBeg = ( backward ? 0 : i+1 );
+        const Int lEnd = ( backward ? i : n );
+        for( Int l=lBeg; l<lEnd; ++l )
+        {
+            const F upsilon = opT( l, i );
+            if( upsilon == F(0) )
+                continue;
+            F* xl = &XTBuf[l*ldXT];
+            for( Int j=0; j<numShifts; ++j )
+                xl[j] -= upsilon*xi[j];
+        }
     }
+
+    Transpose( XTrans, X, conjugate );
 }
 
 template<typename F>
@@ -0,0 +1,264 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace {
+
+// Y := alpha A X + beta Y for a CSR matrix A whose entries in row i are stored
+// in [offsets[i],offsets[i+1]), with the column of entry e in colInds[e] and
+// its value in values[e] (or one if 'values' is null). The rows of X are
+// found at X[colInds[e]*XRowStride+j*XColStride] so that the same kernel can
+// be applied to a column-major matrix and to a row-major halo buffer.
+//
+// Each row of Y is owned by exactly one thread, so the row loop can be run
+// in parallel without any synchronization.
+template<typename T>
+void CSRMultiplyNormal
+( Int height, Int numRHS,
+  const Int* offsets, const Int* colInds, const T* values,
+  T alpha, const T* X, Int XRowStride, Int XColStride,
+  T beta,        T* Y, Int YLDim )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const bool parallel = IsPacked<T>::value && !omp_in_parallel();
+    #pragma omp parallel for if(parallel)
+#endif
+    for( Int i=0; i<height; ++i )
+    {
+        const Int offsetBeg = offsets[i];
+        const Int offsetEnd = offsets[i+1];
+        for( Int j=0; j<numRHS; ++j )
+        {
+            T sum = 0;
+            if( values == nullptr )
+            {
+                for( Int e=offsetBeg; e<offsetEnd; ++e )
+                    sum += X[colInds[e]*XRowStride+j*XColStride];
+            }
+            else
+            {
+                for( Int e=offsetBeg; e<offsetEnd; ++e )
+                    sum += values[e]*X[colInds[e]*XRowStride+j*XColStride];
+            }
+            T& eta = Y[i+j*YLDim];
+            if( beta == T(0) )
+                eta = alpha*sum;
+            else
+                eta = beta*eta + alpha*sum;
+        }
+    }
+}
+
+// Z := Z + alpha op(A) X, where op(A) is A^T or A^H. Since multiple rows of A
+// scatter into the same row of Z, this update is performed sequentially.
+template<typename T>
+void CSRMultiplyAdjointAdd
+( Orientation orientation, Int height, Int numRHS,
+  const Int* offsets, const Int* colInds, const T* values,
+  T alpha, const T* X, Int XLDim,
+                 T* Z, Int ZRowStride, Int ZColStride )
+{
+    EL_DEBUG_CSE
+    const bool conjugate = ( orientation == ADJOINT );
+    for( Int i=0; i<height; ++i )
+    {
+        const Int offsetEnd = offsets[i+1];
+        for( Int e=offsets[i]; e<offsetEnd; ++e )
+        {
+            T value = ( values == nullptr ? T(1) : values[e] );
+            if( conjugate )
+                value = Conj(value);
+            const T scale = alpha*value;
+            T* z = &Z[colInds[e]*ZRowStride];
+            for( Int j=0; j<numRHS; ++j )
+                z[j*ZColStride] += scale*X[i+j*XLDim];
+        }
+    }
+}
+
+template<typename T>
+void LocalMultiply
+( Orientation orientation, Int height, Int width,
+  const Int* offsets, const Int* colInds, const T* values,
+  T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    const Int numRHS = X.Width();
+    if( orientation == NORMAL )
+    {
+        if( X.Height() != width || Y.Height() != height || Y.Width() != numRHS )
+            LogicError("Nonconformal sparse Multiply");
+        CSRMultiplyNormal
+        ( height, numRHS, offsets, colInds, values,
+          alpha, X.LockedBuffer(), Int(1), X.LDim(),
+          beta, Y.Buffer(), Y.LDim() );
+    }
+    else
+    {
+        if( X.Height() != height || Y.Height() != width || Y.Width() != numRHS )
+            LogicError("Nonconformal sparse Multiply");
+        // As with the NORMAL kernel, Y is overwritten when beta is zero so
+        // that any NaN or Inf in its original contents is discarded
+        if( beta == T(0) )
+            Zero( Y );
+        else
+            Scale( beta, Y );
+        CSRMultiplyAdjointAdd
+        ( orientation, height, numRHS, offsets, colInds, values,
+          alpha, X.LockedBuffer(), X.LDim(), Y.Buffer(), Int(1), Y.LDim() );
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    LocalMultiply
+    ( orientation, A.Height(), A.Width(),
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), A.LockedValueBuffer(),
+      alpha, X, beta, Y );
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const Graph& A, const Matrix<T>& X,
+  T beta,                        Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    A.AssertConsistent();
+    LocalMultiply
+    ( orientation, A.NumSources(), A.NumTargets(),
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      static_cast<const T*>(nullptr),
+      alpha, X, beta, Y );
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
+  T beta,                                      DistMultiVec<T>& Y )
+{
+    EL_DEBUG_CSE
+    A.AssertLocallyConsistent();
+    if( X.Grid() != A.Grid() || Y.Grid() != A.Grid() )
+        LogicError("Grids did not match");
+    const Int numRHS = X.Width();
+    if( Y.Width() != numRHS )
+        LogicError("X and Y must have the same width");
+    const bool normal = ( orientation == NORMAL );
+    if( X.Height() != (normal ? A.Width() : A.Height()) ||
+        Y.Height() != (normal ? A.Height() : A.Width()) )
+        LogicError("Nonconformal sparse Multiply");
+
+    // The halo-exchange plan is cached by the sparse matrix and only rebuilt
+    // when its sparsity pattern changes
+    const DistGraphMultMeta& meta = A.MultMeta();
+    mpi::Comm const& comm = A.Grid().Comm();
+    const int commSize = A.Grid().Size();
+    vector<int> sendSizes( commSize ), sendOffs( commSize ),
+                recvSizes( commSize ), recvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] = meta.sendSizes[q]*numRHS;
+        sendOffs[q] = meta.sendOffs[q]*numRHS;
+        recvSizes[q] = meta.recvSizes[q]*numRHS;
+        recvOffs[q] = meta.recvOffs[q]*numRHS;
+    }
+    const Int numSendInds = meta.sendInds.size();
+    const Int localHeight = A.LocalHeight();
+    const Matrix<T>& XLoc = X.LockedMatrix();
+    Matrix<T>& YLoc = Y.Matrix();
+
+    if( normal )
+    {
+        // Pack the rows of X needed by the other processes in row-major order
+        // so that each row is contiguous in the halo buffer
+        vector<T> sendBuf( numSendInds*numRHS );
+        for( Int s=0; s<numSendInds; ++s )
+        {
+            const Int iLoc = meta.sendInds[s];
+            for( Int j=0; j<numRHS; ++j )
+                sendBuf[s*numRHS+j] = XLoc.Get( iLoc, j );
+        }
+        vector<T> haloBuf( meta.numRecvInds*numRHS );
+        mpi::AllToAll
+        ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
+          haloBuf.data(), recvSizes.data(), recvOffs.data(),
+          comm, SyncInfo<Device::CPU>() );
+
+        CSRMultiplyNormal
+        ( localHeight, numRHS,
+          A.LockedOffsetBuffer(), meta.colOffs.data(), A.LockedValueBuffer(),
+          alpha, haloBuf.data(), numRHS, Int(1),
+          beta, YLoc.Buffer(), YLoc.LDim() );
+    }
+    else
+    {
+        // Accumulate the contributions to each halo row and then return them
+        // to their owners by reversing the roles of the exchange
+        vector<T> haloBuf( meta.numRecvInds*numRHS, T(0) );
+        CSRMultiplyAdjointAdd
+        ( orientation, localHeight, numRHS,
+          A.LockedOffsetBuffer(), meta.colOffs.data(), A.LockedValueBuffer(),
+          alpha, XLoc.LockedBuffer(), XLoc.LDim(),
+          haloBuf.data(), numRHS, Int(1) );
+        vector<T> recvBuf( numSendInds*numRHS );
+        mpi::AllToAll
+        ( haloBuf.data(), recvSizes.data(), recvOffs.data(),
+          recvBuf.data(), sendSizes.data(), sendOffs.data(),
+          comm, SyncInfo<Device::CPU>() );
+
+        if( beta == T(0) )
+            Zero( YLoc );
+        else
+            Scale( beta, YLoc );
+        for( Int s=0; s<numSendInds; ++s )
+        {
+            const Int iLoc = meta.sendInds[s];
+            for( Int j=0; j<numRHS; ++j )
+                YLoc.Update( iLoc, j, recvBuf[s*numRHS+j] );
+        }
+    }
+}
+
+#define PROTO(T) \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const SparseMatrix<T>& A, const Matrix<T>& X, \
+    T beta,                                  Matrix<T>& Y ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const Graph& A, const Matrix<T>& X, \
+    T beta,                        Matrix<T>& Y ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X, \
+    T beta,                                      DistMultiVec<T>& Y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -132,7 +132,8 @@ void LocalQuasiTrsm
     )
     QuasiTrsm
     ( side, uplo, orientation,
-      alpha, A.LockedMatrix(), X.Matrix(), checkIfSingular );
+      alpha, A.LockedMatrix(), static_cast<Matrix<F>&>(X.Matrix()),
+      checkIfSingular );
 }
 
 template<typename F>
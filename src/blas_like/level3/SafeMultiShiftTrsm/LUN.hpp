@@ -66,14 +66,18 @@ void LUNBlock
             cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
     }
 
-    // Iterate through RHS's
+    // Scale the RHS's and estimate the growth of their triangular solves in
+    // bulk, so that every shift whose growth is benign can be handed to the
+    // vectorized multi-shift kernel at once, leaving only the remaining shifts
+    // to the careful backward substitution.
+    //   Note: See "Robust Triangular Solves for Use in Condition
+    //   Estimation" by Edward Anderson for explanation of bounds.
+    vector<Int> safeInds, carefulInds;
+    Matrix<Real> XMax( numShifts, 1 );
     for( Int j=0; j<numShifts; ++j )
     {
-        // Initialize triangular system
-        SetDiagonal( U, diag );
-        ShiftDiagonal( U, -shifts.Get(j,0) );
         auto xj = X( ALL, IR(j) );
-        Real scales_j = Real(1);
+        const F shift = shifts(j);
 
         // Determine largest entry of RHS
         Real xjMax = MaxNorm( xj );
@@ -82,21 +86,20 @@ void LUNBlock
             const Real s = oneHalf*bigNum/xjMax;
             xj *= s;
             xjMax *= s;
-            scales_j *= s;
+            scales(j) = s;
         }
+        XMax(j) = xjMax;
         if( xjMax <= smallNum )
         {
             continue;
         }
 
         // Estimate growth of entries in triangular solve
-        //   Note: See "Robust Triangular Solves for Use in Condition
-        //   Estimation" by Edward Anderson for explanation of bounds.
         Real invGi = 1/xjMax;
         Real invMi = invGi;
         for( Int i=n-1; i>=0; --i )
         {
-            const Real absUii = SafeAbs( U(i,i) );
+            const Real absUii = SafeAbs( diag(i)-shift );
             if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
             {
                 invGi = 0;
@@ -111,92 +114,118 @@ void LUNBlock
         invGi = Min( invGi, invMi );
 
         if( invGi > smallNum )
+            safeInds.push_back( j );
+        else
+            carefulInds.push_back( j );
+    }
+
+    // Solve against all of the shifts with small estimated growth at once
+    const Int numSafe = safeInds.size();
+    if( numSafe > 0 )
+    {
+        Matrix<F> safeShifts( numSafe, 1 ), XSafe( n, numSafe );
+        for( Int t=0; t<numSafe; ++t )
         {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv( 'U', 'N', 'N', n, &U(0,0), U.LDim(), &xj(0), 1 );
+            safeShifts(t) = shifts(safeInds[t]);
+            auto xSafe = XSafe( ALL, IR(t) );
+            xSafe = X( ALL, IR(safeInds[t]) );
         }
-        else
+        MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), U, safeShifts, XSafe );
+        for( Int t=0; t<numSafe; ++t )
+        {
+            auto xj = X( ALL, IR(safeInds[t]) );
+            xj = XSafe( ALL, IR(t) );
+        }
+    }
+
+    // Perform backward substitution for the shifts with large estimated growth
+    for( const Int& j : carefulInds )
+    {
+        // Initialize triangular system
+        SetDiagonal( U, diag );
+        ShiftDiagonal( U, -shifts.Get(j,0) );
+        auto xj = X( ALL, IR(j) );
+        Real scales_j = scales.GetRealPart(j,0);
+        Real xjMax = XMax(j);
+
+        for( Int i=n-1; i>=0; --i )
         {
-            // Perform backward substitution since estimated growth is large
-            for( Int i=n-1; i>=0; --i )
+            // Perform division and check for overflow
+            const F Uii = U(i,i);
+            const Real absUii = SafeAbs( Uii );
+            F Xij = xj(i);
+            Real absXij = SafeAbs( Xij );
+            if( absUii > smallNum )
             {
-                // Perform division and check for overflow
-                const F Uii = U(i,i);
-                const Real absUii = SafeAbs( Uii );
-                F Xij = xj(i);
-                Real absXij = SafeAbs( Xij );
-                if( absUii > smallNum )
+                if( absUii<=1 && absXij>=absUii*bigNum )
                 {
-                    if( absUii<=1 && absXij>=absUii*bigNum )
-                    {
-                        // Set overflowing entry to 0.5/U[i,i]
-                        const Real s = oneHalf/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
+                    // Set overflowing entry to 0.5/U[i,i]
+                    const Real s = oneHalf/absXij;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    scales_j *= s;
                 }
-                else if( absUii > 0 )
+                Xij /= Uii;
+            }
+            else if( absUii > 0 )
+            {
+                if( absXij >= absUii*bigNum )
                 {
-                    if( absXij >= absUii*bigNum )
-                    {
-                        // Set overflowing entry to bigNum/2
-                        const Real s = oneHalf*absUii*bigNum/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
+                    // Set overflowing entry to bigNum/2
+                    const Real s = oneHalf*absUii*bigNum/absXij;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    scales_j *= s;
                 }
-                else
+                Xij /= Uii;
+            }
+            else
+            {
+                // TODO: maybe this tolerance should be loosened to
+                //   | Xij | >= || A || * eps
+                if( absXij >= smallNum )
                 {
-                    // TODO: maybe this tolerance should be loosened to
-                    //   | Xij | >= || A || * eps
-                    if( absXij >= smallNum )
-                    {
-                        Xij = F(1);
-                        Zero( xj );
-                        xjMax = Real(0);
-                        scales_j = Real(0);
-                    }
+                    Xij = F(1);
+                    Zero( xj );
+                    xjMax = Real(0);
+                    scales_j = Real(0);
                 }
-                xj(i) = Xij;
-                
-                if( i > 0 )
-                {
+            }
+            xj(i) = Xij;
+            
+            if( i > 0 )
+            {
 
-                    // Check for possible overflows in AXPY
-                    // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
-                    absXij = SafeAbs( Xij );
-                    const Real cNorm_i = cNorm(i);
-                    if( absXij >= Real(1) &&
-                        cNorm_i >= (bigNum-xjMax)/absXij )
-                    {
-                        const Real s = oneQuarter/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    else if( absXij < Real(1) &&
-                             absXij*cNorm_i >= bigNum-xjMax )
-                    {
-                        const Real s = oneQuarter;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    xjMax += absXij*cNorm_i;
-
-                    // AXPY X(0:i,j) -= Xij*U(0:i,i)
-                    blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
+                // Check for possible overflows in AXPY
+                // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
+                absXij = SafeAbs( Xij );
+                const Real cNorm_i = cNorm(i);
+                if( absXij >= Real(1) &&
+                    cNorm_i >= (bigNum-xjMax)/absXij )
+                {
+                    const Real s = oneQuarter/absXij;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    absXij *= s;
+                    scales_j *= s;
                 }
+                else if( absXij < Real(1) &&
+                         absXij*cNorm_i >= bigNum-xjMax )
+                {
+                    const Real s = oneQuarter;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    absXij *= s;
+                    scales_j *= s;
+                }
+                xjMax += absXij*cNorm_i;
+
+                // AXPY X(0:i,j) -= Xij*U(0:i,i)
+                blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
             }
         }
         scales(j) = scales_j;
@@ -102,7 +102,8 @@ void LocalTrmm
           ("Dist of RHS must conform with that of triangle");
     )
     Trmm
-    ( side, uplo, orientation, diag, alpha, A.LockedMatrix(), B.Matrix() );
+    ( side, uplo, orientation, diag,
+      alpha, A.LockedMatrix(), static_cast<Matrix<T>&>(B.Matrix()) );
 }
 
 #define PROTO(T) \
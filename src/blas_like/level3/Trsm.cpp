@@ -395,7 +395,8 @@ void LocalTrsm
     )
     Trsm
     ( side, uplo, orientation, diag,
-      alpha, A.LockedMatrix(), X.Matrix(), checkIfSingular );
+      alpha, A.LockedMatrix(), static_cast<Matrix<F>&>(X.Matrix()),
+      checkIfSingular );
 }
 
 #define PROTO(F) \
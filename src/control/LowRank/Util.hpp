@@ -0,0 +1,339 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CONTROL_LOWRANK_UTIL_HPP
+#define EL_CONTROL_LOWRANK_UTIL_HPP
+
+namespace El {
+namespace low_rank {
+
+// Reduce A to upper Hessenberg form, A = Q H Q^H, where Q is stored
+// implicitly in (QFact,householderScalars) and H is explicitly formed
+template<typename F>
+void HessenbergForm
+( const Matrix<F>& A,
+        Matrix<F>& QFact,
+        Matrix<F>& householderScalars,
+        Matrix<F>& H )
+{
+    EL_DEBUG_CSE
+    QFact = A;
+    Hessenberg( UPPER, QFact, householderScalars );
+    H = QFact;
+    MakeTrapezoidal( UPPER, H, -1 );
+}
+
+template<typename F>
+void HessenbergForm
+( const ElementalMatrix<F>& A,
+        DistMatrix<F>& QFact,
+        DistMatrix<F,STAR,STAR>& householderScalars,
+        DistMatrix<F>& H )
+{
+    EL_DEBUG_CSE
+    QFact = A;
+    Hessenberg( UPPER, QFact, householderScalars );
+    H = QFact;
+    MakeTrapezoidal( UPPER, H, -1 );
+}
+
+// X := alpha inv(H + shift I) X, where H is upper or lower Hessenberg
+template<typename F>
+void ShiftedHessSolve
+( UpperOrLower uplo, const Matrix<F>& H, F shift, Matrix<F>& X,
+  F alpha=F(1) )
+{
+    EL_DEBUG_CSE
+    Matrix<F> shifts( X.Width(), 1 );
+    Fill( shifts, -shift );
+    MultiShiftHessSolve( uplo, NORMAL, alpha, H, shifts, X );
+}
+
+template<typename F>
+void ShiftedHessSolve
+( UpperOrLower uplo, const DistMatrix<F>& H, F shift,
+  DistMatrix<F,STAR,VR>& X, F alpha=F(1) )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,VR,STAR> shifts(X.Grid());
+    shifts.AlignCols( X.RowAlign() );
+    shifts.Resize( X.Width(), 1 );
+    Fill( shifts, -shift );
+    MultiShiftHessSolve( uplo, NORMAL, alpha, H, shifts, X );
+}
+
+// Return the Ritz values of numSteps steps of the Arnoldi process, with
+// reorthogonalized classical Gram-Schmidt, for the operator applied in-place
+// by 'apply', starting from the vector v0
+template<typename F,class VectorType,class ApplyType>
+void RitzValues
+( const VectorType& v0,
+  Int numSteps,
+  const ApplyType& apply,
+  Matrix<Complex<Base<F>>>& ritz )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = v0.Height();
+    const Real eps = limits::Epsilon<Real>();
+    numSteps = Min( numSteps, n );
+
+    VectorType V(v0), w(v0), h(v0);
+    Zeros( V, n, numSteps+1 );
+    Matrix<F> HProj;
+    Zeros( HProj, numSteps+1, numSteps );
+
+    auto v = V( ALL, IR(0) );
+    v = v0;
+    v *= F(1)/FrobeniusNorm( v0 );
+    Int numFormed = 0;
+    while( numFormed < numSteps )
+    {
+        const Int j = numFormed;
+        auto vj = V( ALL, IR(j) );
+        w = vj;
+        apply( w );
+
+        auto VPrev = V( ALL, IR(0,j+1) );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), VPrev, w, h );
+            Gemm( NORMAL, NORMAL, F(-1), VPrev, h, F(1), w );
+            for( Int i=0; i<=j; ++i )
+                HProj(i,j) += h.Get(i,0);
+        }
+        ++numFormed;
+
+        const Real beta = FrobeniusNorm( w );
+        HProj(j+1,j) = beta;
+        if( beta <= 10*eps*FrobeniusNorm(HProj) )
+            break;
+        auto vNext = V( ALL, IR(j+1) );
+        vNext = w;
+        vNext *= F(1)/beta;
+    }
+
+    Matrix<F> T( HProj(IR(0,numFormed),IR(0,numFormed)) );
+    HessenbergSchur( T, ritz );
+}
+
+template<typename Real>
+void ShiftFromRitz( const Complex<Real>& t, Real& shift )
+{ shift = RealPart(t); }
+
+template<typename Real>
+void ShiftFromRitz( const Complex<Real>& t, Complex<Real>& shift )
+{ shift = t; }
+
+// Penzl's heuristic: choose shifts p_j from the Ritz values of a matrix whose
+// eigenvalues lie in the open right-half plane so that the magnitude of the
+// ADI rational function
+//
+//   rho(t) = prod_j |(t - p_j) / (t + conj(p_j))|
+//
+// is small over the Ritz values. The first shift minimizes the maximum of the
+// single-shift rational function and each subsequent shift is the Ritz value
+// at which the current rational function is largest. For real fields, the
+// real parts of the Ritz values are used so that the iterates stay real.
+template<typename F>
+void PenzlShifts
+( const Matrix<Complex<Base<F>>>& ritz, Int numShifts, Matrix<F>& shifts )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    vector<C> candidates;
+    for( Int i=0; i<ritz.Height(); ++i )
+        if( RealPart(ritz(i)) > Real(0) )
+            candidates.push_back( ritz(i) );
+    if( candidates.empty() )
+        RuntimeError("No Ritz values were in the open right-half plane");
+    const Int numCandidates = candidates.size();
+
+    vector<F> chosen;
+    auto rho = [&]( const C& t )
+    {
+        Real value = 1;
+        for( const F& p : chosen )
+            value *= Abs(t-C(p)) / Abs(t+Conj(C(p)));
+        return value;
+    };
+
+    // The first shift minimizes the single-shift rational function
+    Real minMax = limits::Max<Real>();
+    F firstShift;
+    for( Int i=0; i<numCandidates; ++i )
+    {
+        F p;
+        ShiftFromRitz( candidates[i], p );
+        Real maxValue = 0;
+        for( const C& t : candidates )
+            maxValue = Max( maxValue, Abs(t-C(p))/Abs(t+Conj(C(p))) );
+        if( maxValue < minMax )
+        {
+            minMax = maxValue;
+            firstShift = p;
+        }
+    }
+    chosen.push_back( firstShift );
+
+    // Each subsequent shift damps the current worst-case Ritz value
+    while( Int(chosen.size()) < numShifts )
+    {
+        Int iMax = 0;
+        Real maxValue = 0;
+        for( Int i=0; i<numCandidates; ++i )
+        {
+            const Real value = rho( candidates[i] );
+            if( value > maxValue )
+            {
+                maxValue = value;
+                iMax = i;
+            }
+        }
+        if( maxValue <= limits::Epsilon<Real>() )
+            break;
+        F p;
+        ShiftFromRitz( candidates[iMax], p );
+        // For real fields, the worst-case Ritz value can be complex with the
+        // real part of an existing shift, which would then be repeated
+        if( std::find( chosen.begin(), chosen.end(), p ) != chosen.end() )
+            break;
+        chosen.push_back( p );
+    }
+
+    const Int numChosen = chosen.size();
+    shifts.Resize( numChosen, 1 );
+    for( Int j=0; j<numChosen; ++j )
+        shifts(j) = chosen[j];
+}
+
+// Shifts for ADI iterations with the upper Hessenberg matrix H, which are
+// drawn from Ritz values of Arnoldi processes with H and inv(H) started from
+// the sum of the columns of the right-hand side factor W
+template<typename F,class VectorType,class ForwardType,class InverseType>
+void ADIShifts
+( const VectorType& W,
+  const ForwardType& applyForward,
+  const InverseType& applyInverse,
+  const LowRankCtrl<Base<F>>& ctrl,
+        Matrix<F>& shifts )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    VectorType ones(W), v0(W);
+    Ones( ones, W.Width(), 1 );
+    Zeros( v0, W.Height(), 1 );
+    Gemm( NORMAL, NORMAL, F(1), W, ones, F(0), v0 );
+    if( FrobeniusNorm(v0) == Real(0) )
+        Ones( v0, W.Height(), 1 );
+
+    Matrix<Complex<Real>> ritzForward, ritzInverse;
+    RitzValues<F>( v0, ctrl.numRitzSteps, applyForward, ritzForward );
+    RitzValues<F>( v0, ctrl.numRitzSteps, applyInverse, ritzInverse );
+
+    const Int numForward = ritzForward.Height();
+    const Int numInverse = ritzInverse.Height();
+    Matrix<Complex<Real>> ritz( numForward+numInverse, 1 );
+    for( Int i=0; i<numForward; ++i )
+        ritz(i) = ritzForward(i);
+    for( Int i=0; i<numInverse; ++i )
+        ritz(numForward+i) = Complex<Real>(1) / ritzInverse(i);
+    PenzlShifts( ritz, ctrl.numShifts, shifts );
+}
+
+// || W W^H ||_F, which is computed from the small Gram matrix W^H W
+template<typename F>
+Base<F> FactoredFrobeniusNorm( const Matrix<F>& W )
+{
+    EL_DEBUG_CSE
+    Matrix<F> C;
+    Herk( LOWER, ADJOINT, Base<F>(1), W, C );
+    return HermitianFrobeniusNorm( LOWER, C );
+}
+
+template<typename F>
+Base<F> FactoredFrobeniusNorm( const ElementalMatrix<F>& W )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> C(W.Grid());
+    Herk( LOWER, ADJOINT, Base<F>(1), W, C );
+    return HermitianFrobeniusNorm( LOWER, C );
+}
+
+// Low-rank ADI for M X + X M^H = W W^H, where solve(q,X) overwrites X with
+// inv(M + q I) X. The columns of the factor Z of X = Z Z^H are appended in
+// blocks and W is overwritten with the factor of the residual W W^H.
+template<typename F,class BlockType,class SolveType>
+LowRankInfo<Base<F>>
+FactoredADI
+( BlockType& W,
+  const Matrix<F>& shifts,
+  const SolveType& solve,
+        vector<BlockType>& ZBlocks,
+  const LowRankCtrl<Base<F>>& ctrl,
+  bool print )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    LowRankInfo<Real> info;
+    // The residual of the ADI iterate is exactly W W^H
+    const Real normRHS = FactoredFrobeniusNorm( W );
+    if( normRHS == Real(0) )
+        return info;
+
+    const Int numShifts = shifts.Height();
+    while( info.numIts < ctrl.maxIts )
+    {
+        const F p = shifts(info.numIts % numShifts);
+        const Real twoRealP = 2*RealPart(p);
+
+        // V := inv(M + conj(p) I) W,
+        // W := W - 2 Re(p) V,
+        // Z := [Z, sqrt(2 Re(p)) V]
+        ZBlocks.emplace_back( W );
+        auto& V = ZBlocks.back();
+        solve( Conj(p), V );
+        Axpy( F(-twoRealP), V, W );
+        V *= Sqrt(twoRealP);
+
+        ++info.numIts;
+        info.relResidual = FactoredFrobeniusNorm( W ) / normRHS;
+        if( ctrl.progress && print )
+            Output
+            ("ADI iteration ",info.numIts,": shift=",p,
+             ", relative residual=",info.relResidual);
+        if( info.relResidual <= ctrl.tol )
+            break;
+    }
+    return info;
+}
+
+// Copy the column blocks into Z = [ZBlocks[0], ZBlocks[1], ...]
+template<typename F,class BlockType,class MatrixType>
+void Concatenate( Int height, const vector<BlockType>& ZBlocks, MatrixType& Z )
+{
+    EL_DEBUG_CSE
+    Int width = 0;
+    for( const auto& block : ZBlocks )
+        width += block.Width();
+    Zeros( Z, height, width );
+    Int offset = 0;
+    for( const auto& block : ZBlocks )
+    {
+        auto ZBlock = Z( ALL, IR(offset,offset+block.Width()) );
+        ZBlock = block;
+        offset += block.Width();
+    }
+}
+
+} // namespace low_rank
+} // namespace El
+
+#endif // ifndef EL_CONTROL_LOWRANK_UTIL_HPP
@@ -0,0 +1,421 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/lapack_like/condense.hpp>
+#include <El/lapack_like/factor.hpp>
+#include <El/lapack_like/solve.hpp>
+#include <El/lapack_like/spectral.hpp>
+#include <El/lapack_like/props.hpp>
+#include <El/matrices.hpp>
+#include <El/control.hpp>
+
+#include "./LowRank/Util.hpp"
+
+namespace El {
+
+// Low-rank solvers for
+//    A X + X A^H = G G^H,
+// where A has all of its eigenvalues in the open right-half plane and G has
+// only a few columns. The ADI variant follows the low-rank formulation of
+// Li and White, "Low rank solution of Lyapunov equations", SIAM J. Matrix
+// Anal. Appl., 2002, with shifts from Penzl's heuristic, while the Krylov
+// variant is the block Arnoldi (Galerkin) method of Jaimoukha and Kasenally,
+// "Krylov subspace methods for solving large Lyapunov equations", SIAM J.
+// Numer. Anal., 1994.
+
+namespace low_rank {
+
+template<typename F>
+LowRankInfo<Base<F>>
+LyapunovADI
+( const Matrix<F>& A,
+  const Matrix<F>& G,
+        Matrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> QFact, householderScalars, H;
+    HessenbergForm( A, QFact, householderScalars, H );
+    Matrix<F> W( G );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFact, householderScalars, W );
+
+    auto applyForward = [&]( Matrix<F>& x )
+      { Matrix<F> y; Gemm( NORMAL, NORMAL, F(1), H, x, y ); x = y; };
+    auto applyInverse = [&]( Matrix<F>& x )
+      { ShiftedHessSolve( UPPER, H, F(0), x ); };
+    Matrix<F> shifts;
+    ADIShifts( W, applyForward, applyInverse, ctrl, shifts );
+
+    auto solve = [&]( F shift, Matrix<F>& X )
+      { ShiftedHessSolve( UPPER, H, shift, X ); };
+    vector<Matrix<F>> ZBlocks;
+    auto info = FactoredADI( W, shifts, solve, ZBlocks, ctrl, true );
+
+    Concatenate<F>( A.Height(), ZBlocks, Z );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFact, householderScalars, Z );
+    return info;
+}
+
+template<typename F>
+LowRankInfo<Base<F>>
+LyapunovADI
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& G,
+        ElementalMatrix<F>& ZPre,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    DistMatrix<F> QFact(grid), H(grid);
+    DistMatrix<F,STAR,STAR> householderScalars(grid);
+    HessenbergForm( A, QFact, householderScalars, H );
+    DistMatrix<F,STAR,VR> W( G );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFact, householderScalars, W );
+
+    auto applyForward = [&]( DistMatrix<F,STAR,VR>& x )
+      { DistMatrix<F> y(grid); Gemm( NORMAL, NORMAL, F(1), H, x, y ); x = y; };
+    auto applyInverse = [&]( DistMatrix<F,STAR,VR>& x )
+      { ShiftedHessSolve( UPPER, H, F(0), x ); };
+    Matrix<F> shifts;
+    ADIShifts( W, applyForward, applyInverse, ctrl, shifts );
+
+    auto solve = [&]( F shift, DistMatrix<F,STAR,VR>& X )
+      { ShiftedHessSolve( UPPER, H, shift, X ); };
+    vector<DistMatrix<F,STAR,VR>> ZBlocks;
+    auto info =
+      FactoredADI( W, shifts, solve, ZBlocks, ctrl, grid.Rank() == 0 );
+
+    DistMatrixWriteProxy<F,F,MC,MR> ZProx( ZPre );
+    auto& Z = ZProx.Get();
+    Concatenate<F>( A.Height(), ZBlocks, Z );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFact, householderScalars, Z );
+    return info;
+}
+
+// Given the Galerkin solution Y of the projected equation, form Z such that
+// Z Z^H = V Y V^H, dropping the numerically negligible eigenvalues of Y
+template<typename F>
+void GalerkinFactor( Matrix<F>& Y, Matrix<F>& U )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<Real> w;
+    HermitianEig( LOWER, Y, w, U );
+    const Int m = w.Height();
+    Real maxEig = 0;
+    for( Int i=0; i<m; ++i )
+        maxEig = Max( maxEig, Abs(w(i)) );
+    const Real thresh = m*limits::Epsilon<Real>()*maxEig;
+    Int numKept = 0;
+    for( Int i=0; i<m; ++i )
+    {
+        if( w(i) > thresh )
+        {
+            auto uSource = U( ALL, IR(i) );
+            auto uTarget = U( ALL, IR(numKept) );
+            uTarget = uSource;
+            uTarget *= Sqrt(w(i));
+            ++numKept;
+        }
+    }
+    U.Resize( m, numKept );
+}
+
+// One step of block Arnoldi, with reorthogonalized block classical
+// Gram-Schmidt, which fills the j'th block column of the projection T and
+// returns the triangular factor RNext of the new block
+template<typename F>
+void BlockArnoldiStep
+( const Matrix<F>& A,
+  Int j, Int k,
+  Matrix<F>& V,
+  Matrix<F>& T,
+  Matrix<F>& RNext )
+{
+    EL_DEBUG_CSE
+    auto Vj = V( ALL, IR(j*k,(j+1)*k) );
+    auto VPrev = V( ALL, IR(0,(j+1)*k) );
+    auto VNext = V( ALL, IR((j+1)*k,(j+2)*k) );
+    auto TCol = T( IR(0,(j+1)*k), IR(j*k,(j+1)*k) );
+    auto TNext = T( IR((j+1)*k,(j+2)*k), IR(j*k,(j+1)*k) );
+
+    Matrix<F> W, HCol;
+    Gemm( NORMAL, NORMAL, F(1), A, Vj, W );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), VPrev, W, HCol );
+        Gemm( NORMAL, NORMAL, F(-1), VPrev, HCol, F(1), W );
+        TCol += HCol;
+    }
+    VNext = W;
+    qr::AdaptiveCholesky( VNext, RNext );
+    TNext = RNext;
+}
+
+template<typename F>
+void BlockArnoldiStep
+( const DistMatrix<F>& A,
+  Int j, Int k,
+  DistMatrix<F,VC,STAR>& V,
+  Matrix<F>& T,
+  Matrix<F>& RNext )
+{
+    EL_DEBUG_CSE
+    auto Vj = V( ALL, IR(j*k,(j+1)*k) );
+    auto VPrev = V( ALL, IR(0,(j+1)*k) );
+    auto VNext = V( ALL, IR((j+1)*k,(j+2)*k) );
+    auto TCol = T( IR(0,(j+1)*k), IR(j*k,(j+1)*k) );
+    auto TNext = T( IR((j+1)*k,(j+2)*k), IR(j*k,(j+1)*k) );
+
+    DistMatrix<F> AVj(A.Grid());
+    Gemm( NORMAL, NORMAL, F(1), A, Vj, AVj );
+    DistMatrix<F,VC,STAR> W( AVj );
+    Matrix<F> HCol;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( HCol, (j+1)*k, k );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), VPrev.LockedMatrix(), W.LockedMatrix(), F(0), HCol );
+        El::AllReduce( HCol, V.ColComm() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1), VPrev.LockedMatrix(), HCol, F(1), W.Matrix() );
+        TCol += HCol;
+    }
+    VNext = W;
+    DistMatrix<F,STAR,STAR> RNext_STAR_STAR(A.Grid());
+    qr::AdaptiveCholesky( VNext, RNext_STAR_STAR );
+    RNext = RNext_STAR_STAR.Matrix();
+    TNext = RNext;
+}
+
+// Solve the projected equation T Y + Y T^H = E1 R0 R0^H E1^H and return the
+// residual norm, sqrt(2) || RNext E_j^H Y ||_F, of the full equation
+template<typename F>
+Base<F> GalerkinSolve
+( const Matrix<F>& T,
+  const Matrix<F>& R0,
+  const Matrix<F>& RNext,
+        Matrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = T.Height();
+    const Int k = R0.Height();
+    Matrix<F> C;
+    Zeros( C, m, m );
+    auto CTL = C( IR(0,k), IR(0,k) );
+    Gemm( NORMAL, ADJOINT, F(1), R0, R0, F(0), CTL );
+    Lyapunov( T, C, Y );
+
+    Matrix<F> S;
+    auto YB = Y( IR(m-k,m), ALL );
+    Gemm( NORMAL, NORMAL, F(1), RNext, YB, S );
+    return Sqrt(Real(2))*FrobeniusNorm( S );
+}
+
+template<typename F>
+LowRankInfo<Base<F>>
+LyapunovKrylov
+( const Matrix<F>& A,
+  const Matrix<F>& G,
+        Matrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int k = G.Width();
+    LowRankInfo<Real> info;
+    if( FrobeniusNorm(G) == Real(0) )
+    {
+        Zeros( Z, n, 0 );
+        return info;
+    }
+    // The basis must have room for at least two blocks of k columns
+    if( n < 2*k )
+        return LyapunovADI( A, G, Z, ctrl );
+    const Int maxIts = Min( ctrl.maxIts, n/k-1 );
+
+    Matrix<F> V, T, R0, RNext, Y;
+    Zeros( V, n, (maxIts+1)*k );
+    Zeros( T, (maxIts+1)*k, maxIts*k );
+    auto V0 = V( ALL, IR(0,k) );
+    V0 = G;
+    qr::AdaptiveCholesky( V0, R0 );
+    Matrix<F> CHat;
+    Gemm( ADJOINT, NORMAL, F(1), R0, R0, CHat );
+    const Real normC = FrobeniusNorm( CHat );
+
+    while( info.numIts < maxIts )
+    {
+        const Int j = info.numIts;
+        BlockArnoldiStep( A, j, k, V, T, RNext );
+        ++info.numIts;
+
+        auto Tj = T( IR(0,(j+1)*k), IR(0,(j+1)*k) );
+        info.relResidual = GalerkinSolve( Tj, R0, RNext, Y ) / normC;
+        if( ctrl.progress )
+            Output
+            ("Krylov iteration ",info.numIts,": relative residual=",
+             info.relResidual);
+        if( info.relResidual <= ctrl.tol )
+            break;
+    }
+
+    Matrix<F> U;
+    GalerkinFactor( Y, U );
+    auto VActive = V( ALL, IR(0,info.numIts*k) );
+    Gemm( NORMAL, NORMAL, F(1), VActive, U, Z );
+    return info;
+}
+
+template<typename F>
+LowRankInfo<Base<F>>
+LyapunovKrylov
+( const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& G,
+        ElementalMatrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& grid = A.Grid();
+    const Int n = A.Height();
+    const Int k = G.Width();
+    LowRankInfo<Real> info;
+    if( FrobeniusNorm(G) == Real(0) )
+    {
+        Zeros( Z, n, 0 );
+        return info;
+    }
+    // The basis must have room for at least two blocks of k columns
+    if( n < 2*k )
+        return LyapunovADI( APre, G, Z, ctrl );
+    const Int maxIts = Min( ctrl.maxIts, n/k-1 );
+
+    DistMatrix<F,VC,STAR> V(grid);
+    Matrix<F> T, R0, RNext, Y;
+    Zeros( V, n, (maxIts+1)*k );
+    Zeros( T, (maxIts+1)*k, maxIts*k );
+    auto V0 = V( ALL, IR(0,k) );
+    V0 = G;
+    {
+        DistMatrix<F,STAR,STAR> R0_STAR_STAR(grid);
+        qr::AdaptiveCholesky( V0, R0_STAR_STAR );
+        R0 = R0_STAR_STAR.Matrix();
+    }
+    Matrix<F> CHat;
+    Gemm( ADJOINT, NORMAL, F(1), R0, R0, CHat );
+    const Real normC = FrobeniusNorm( CHat );
+
+    while( info.numIts < maxIts )
+    {
+        const Int j = info.numIts;
+        BlockArnoldiStep( A, j, k, V, T, RNext );
+        ++info.numIts;
+
+        // The projected equation is small and solved redundantly
+        auto Tj = T( IR(0,(j+1)*k), IR(0,(j+1)*k) );
+        info.relResidual = GalerkinSolve( Tj, R0, RNext, Y ) / normC;
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("Krylov iteration ",info.numIts,": relative residual=",
+             info.relResidual);
+        if( info.relResidual <= ctrl.tol )
+            break;
+    }
+
+    Matrix<F> U;
+    GalerkinFactor( Y, U );
+    auto VActive = V( ALL, IR(0,info.numIts*k) );
+    DistMatrix<F,VC,STAR> ZLoc(grid);
+    ZLoc.AlignWith( V );
+    ZLoc.Resize( n, U.Width() );
+    Gemm
+    ( NORMAL, NORMAL,
+      F(1), VActive.LockedMatrix(), U, F(0), ZLoc.Matrix() );
+    Copy( ZLoc, Z );
+    return info;
+}
+
+} // namespace low_rank
+
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankLyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& G,
+        Matrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( G.Height() != A.Height() )
+          LogicError("G must conform with A");
+    )
+    if( ctrl.krylov )
+        return low_rank::LyapunovKrylov( A, G, Z, ctrl );
+    else
+        return low_rank::LyapunovADI( A, G, Z, ctrl );
+}
+
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankLyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& G,
+        ElementalMatrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( G.Height() != A.Height() )
+          LogicError("G must conform with A");
+      AssertSameGrids( A, G, Z );
+    )
+    if( ctrl.krylov )
+        return low_rank::LyapunovKrylov( A, G, Z, ctrl );
+    else
+        return low_rank::LyapunovADI( A, G, Z, ctrl );
+}
+
+#define PROTO(F) \
+  template LowRankInfo<Base<F>> LowRankLyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& G, \
+          Matrix<F>& Z, \
+    const LowRankCtrl<Base<F>>& ctrl ); \
+  template LowRankInfo<Base<F>> LowRankLyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& G, \
+          ElementalMatrix<F>& Z, \
+    const LowRankCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,368 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/lapack_like/condense.hpp>
+#include <El/lapack_like/factor.hpp>
+#include <El/lapack_like/solve.hpp>
+#include <El/lapack_like/spectral.hpp>
+#include <El/lapack_like/props.hpp>
+#include <El/matrices.hpp>
+#include <El/control.hpp>
+
+#include "./LowRank/Util.hpp"
+
+namespace El {
+
+// A low-rank Newton-Kleinman solver for the continuous-time algebraic
+// Riccati equation
+//    X (B B^H) X - A^H X - X A = C^H C,
+// where A has all of its eigenvalues in the open left-half plane and B and C
+// have only a few columns and rows, respectively. Given X_k = Z_k Z_k^H and
+// the feedback K_k = B^H X_k, the next iterate solves the Lyapunov equation
+//    M_k X + X M_k^H = [C^H, K_k^H] [C^H, K_k^H]^H,
+// with M_k = -(A - B K_k)^H, via low-rank ADI. See Benner, Li, and Penzl,
+// "Numerical solution of large-scale Lyapunov equations, Riccati equations,
+// and linear-quadratic optimal control problems", Numer. Linear Algebra
+// Appl., 2008.
+//
+// All of the work is performed in the coordinates of the Hessenberg form
+// A = Q H Q^H, so that each shifted solve with M_k is a lower Hessenberg
+// solve with -(H^H - q I) followed by a Sherman-Morrison-Woodbury correction
+// for the rank-m feedback term.
+
+namespace low_rank {
+
+// P := X^H Y, redundantly stored on every process
+template<typename F>
+void InnerProducts( const Matrix<F>& X, const Matrix<F>& Y, Matrix<F>& P )
+{
+    EL_DEBUG_CSE
+    Zeros( P, X.Width(), Y.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), X, Y, F(0), P );
+}
+
+template<typename F>
+void InnerProducts
+( const DistMatrix<F,STAR,VR>& X,
+  const DistMatrix<F,STAR,VR>& Y,
+        Matrix<F>& P )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> P_STAR_STAR(X.Grid());
+    Zeros( P_STAR_STAR, X.Width(), Y.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), X, Y, F(0), P_STAR_STAR );
+    P = P_STAR_STAR.Matrix();
+}
+
+// Y := alpha X P + beta Y, where P is redundantly stored on every process
+template<typename F>
+void UpdateBlock
+( F alpha, const Matrix<F>& X, const Matrix<F>& P, F beta, Matrix<F>& Y )
+{
+    EL_DEBUG_CSE
+    Gemm( NORMAL, NORMAL, alpha, X, P, beta, Y );
+}
+
+template<typename F>
+void UpdateBlock
+( F alpha,
+  const DistMatrix<F,STAR,VR>& X,
+  const Matrix<F>& P,
+  F beta,
+        DistMatrix<F,STAR,VR>& Y )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> P_STAR_STAR(X.Grid());
+    P_STAR_STAR.Resize( P.Height(), P.Width() );
+    P_STAR_STAR.Matrix() = P;
+    Gemm( NORMAL, NORMAL, alpha, X, P_STAR_STAR, beta, Y );
+}
+
+// Overwrite U with its Householder QR factorization and return the upper
+// trapezoidal factor, redundantly stored on every process
+template<typename F>
+void TriangularFactor( Matrix<F>& U, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    QR( U, householderScalars, signature );
+    const Int minDim = Min( U.Height(), U.Width() );
+    R = U( IR(0,minDim), ALL );
+    MakeTrapezoidal( UPPER, R );
+}
+
+template<typename F>
+void TriangularFactor( DistMatrix<F,STAR,VR>& UPre, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = UPre.Grid();
+    DistMatrix<F> U( UPre );
+    DistMatrix<F,MD,STAR> householderScalars(grid);
+    DistMatrix<Base<F>,MD,STAR> signature(grid);
+    QR( U, householderScalars, signature );
+    const Int minDim = Min( U.Height(), U.Width() );
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( U( IR(0,minDim), ALL ) );
+    R = R_STAR_STAR.Matrix();
+    MakeTrapezoidal( UPPER, R );
+}
+
+// Returns || X S X^H - H^H X - X H - CT CT^H ||_F for X = Z Z^H and
+// S = BT BT^H. Since the residual is U T U^H, with U = [CT, Z, H^H Z] and T
+// a small Hermitian matrix, its norm is that of R T R^H, where R is the
+// triangular factor from a QR factorization of U. Unlike an approach based
+// upon the Gramian U^H U, this does not square the condition number of U.
+template<typename F,class HessType,class BlockType>
+Base<F> RiccatiResidual
+( const HessType& HAdj,
+  const BlockType& BT,
+  const BlockType& CT,
+  const BlockType& Z )
+{
+    EL_DEBUG_CSE
+    const Int n = Z.Height();
+    const Int p = CT.Width();
+    const Int r = Z.Width();
+
+    BlockType U(Z);
+    Zeros( U, n, p+2*r );
+    auto UC = U( ALL, IR(0,p) );
+    auto UZ = U( ALL, IR(p,p+r) );
+    auto UHZ = U( ALL, IR(p+r,p+2*r) );
+    UC = CT;
+    UZ = Z;
+    Gemm( NORMAL, NORMAL, F(1), HAdj, Z, F(0), UHZ );
+
+    Matrix<F> ZB, T;
+    InnerProducts( Z, BT, ZB );
+    Zeros( T, p+2*r, p+2*r );
+    auto TC = T( IR(0,p), IR(0,p) );
+    auto TZZ = T( IR(p,p+r), IR(p,p+r) );
+    auto TZH = T( IR(p,p+r), IR(p+r,p+2*r) );
+    auto THZ = T( IR(p+r,p+2*r), IR(p,p+r) );
+    FillDiagonal( TC, F(1) );
+    Gemm( NORMAL, ADJOINT, F(-1), ZB, ZB, F(0), TZZ );
+    FillDiagonal( TZH, F(1) );
+    FillDiagonal( THZ, F(1) );
+
+    Matrix<F> R, TRAdj, RTRAdj;
+    TriangularFactor( U, R );
+    Gemm( NORMAL, ADJOINT, F(1), T, R, TRAdj );
+    Gemm( NORMAL, NORMAL, F(1), R, TRAdj, RTRAdj );
+    return FrobeniusNorm( RTRAdj );
+}
+
+template<typename F,class HessType,class BlockType>
+LowRankInfo<Base<F>>
+RiccatiNewton
+( const HessType& H,
+  const HessType& HAdj,
+  const BlockType& BT,
+  const BlockType& CT,
+        BlockType& Z,
+  const LowRankCtrl<Base<F>>& ctrl,
+  bool print )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = H.Height();
+    const Int m = BT.Width();
+    const Int p = CT.Width();
+    LowRankInfo<Real> info;
+    Zeros( Z, n, 0 );
+    Matrix<F> CC;
+    InnerProducts( CT, CT, CC );
+    const Real normRHS = FrobeniusNorm( CC );
+    if( normRHS == Real(0) )
+        return info;
+
+    // The shifts are drawn from the spectrum of -H^H, which lies in the open
+    // right-half plane, and reused for every Newton step
+    Matrix<F> shifts;
+    {
+        auto applyForward = [&]( BlockType& x )
+          { BlockType y(x); Gemm( ADJOINT, NORMAL, F(-1), H, x, F(0), y );
+            x = y; };
+        auto applyInverse = [&]( BlockType& x )
+          { ShiftedHessSolve( LOWER, HAdj, F(0), x, F(-1) ); };
+        ADIShifts( CT, applyForward, applyInverse, ctrl, shifts );
+    }
+
+    BlockType G(CT), KAdj(CT);
+    Real lastResidual = limits::Max<Real>();
+    while( info.numIts < ctrl.maxIts )
+    {
+        // KAdj := K^H = Z (Z^H BT) and G := [CT, K^H]
+        const bool feedback = ( Z.Width() > 0 );
+        if( feedback )
+        {
+            Matrix<F> ZB;
+            InnerProducts( Z, BT, ZB );
+            Zeros( KAdj, n, m );
+            UpdateBlock( F(1), Z, ZB, F(0), KAdj );
+            Zeros( G, n, p+m );
+            auto GC = G( ALL, IR(0,p) );
+            auto GK = G( ALL, IR(p,p+m) );
+            GC = CT;
+            GK = KAdj;
+        }
+        else
+            G = CT;
+
+        // X := inv(-(H^H - q I) + K^H BT^H) X via Sherman-Morrison-Woodbury,
+        // caching inv(-(H^H - q I)) K^H and the capacitance matrix
+        // I + BT^H inv(-(H^H - q I)) K^H for each shift
+        vector<F> cachedShifts;
+        vector<BlockType> cachedSolves;
+        vector<Matrix<F>> cachedCapacitances;
+        auto solve = [&]( F shift, BlockType& X )
+        {
+            ShiftedHessSolve( LOWER, HAdj, -shift, X, F(-1) );
+            if( !feedback )
+                return;
+            Int index = 0;
+            while( index < Int(cachedShifts.size()) &&
+                   cachedShifts[index] != shift )
+                ++index;
+            if( index == Int(cachedShifts.size()) )
+            {
+                cachedShifts.push_back( shift );
+                cachedSolves.emplace_back( KAdj );
+                auto& solveK = cachedSolves.back();
+                ShiftedHessSolve( LOWER, HAdj, -shift, solveK, F(-1) );
+                Matrix<F> capacitance;
+                InnerProducts( BT, solveK, capacitance );
+                ShiftDiagonal( capacitance, F(1) );
+                cachedCapacitances.push_back( capacitance );
+            }
+            Matrix<F> T, capacitance( cachedCapacitances[index] );
+            InnerProducts( BT, X, T );
+            LinearSolve( capacitance, T );
+            UpdateBlock( F(-1), cachedSolves[index], T, F(1), X );
+        };
+        vector<BlockType> ZBlocks;
+        FactoredADI( G, shifts, solve, ZBlocks, ctrl, print );
+        Concatenate<F>( n, ZBlocks, Z );
+
+        ++info.numIts;
+        info.relResidual = RiccatiResidual<F>( HAdj, BT, CT, Z ) / normRHS;
+        if( ctrl.progress && print )
+            Output
+            ("Newton iteration ",info.numIts,": relative residual=",
+             info.relResidual);
+        // Since each Newton step is only solved to within the tolerance,
+        // the iteration eventually stagnates rather than converging further
+        if( info.relResidual <= ctrl.tol || info.relResidual >= lastResidual )
+            break;
+        lastResidual = info.relResidual;
+    }
+    return info;
+}
+
+} // namespace low_rank
+
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankRiccati
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& Z,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != A.Height() || C.Width() != A.Height() )
+          LogicError("B and C must conform with A");
+    )
+    Matrix<F> QFact, householderScalars, H, HAdj;
+    low_rank::HessenbergForm( A, QFact, householderScalars, H );
+    Adjoint( H, HAdj );
+
+    Matrix<F> BT( B ), CT;
+    Adjoint( C, CT );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFact, householderScalars, BT );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFact, householderScalars, CT );
+
+    auto info = low_rank::RiccatiNewton<F>( H, HAdj, BT, CT, Z, ctrl, true );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFact, householderScalars, Z );
+    return info;
+}
+
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankRiccati
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& ZPre,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( B.Height() != A.Height() || C.Width() != A.Height() )
+          LogicError("B and C must conform with A");
+      AssertSameGrids( A, B, C, ZPre );
+    )
+    const Grid& grid = A.Grid();
+    DistMatrix<F> QFact(grid), H(grid), HAdj(grid);
+    DistMatrix<F,STAR,STAR> householderScalars(grid);
+    low_rank::HessenbergForm( A, QFact, householderScalars, H );
+    Adjoint( H, HAdj );
+
+    DistMatrix<F,STAR,VR> BT( B ), CT(grid), ZT(grid);
+    Adjoint( C, CT );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFact, householderScalars, BT );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFact, householderScalars, CT );
+
+    auto info =
+      low_rank::RiccatiNewton<F>
+      ( H, HAdj, BT, CT, ZT, ctrl, grid.Rank() == 0 );
+
+    DistMatrixWriteProxy<F,F,MC,MR> ZProx( ZPre );
+    auto& Z = ZProx.Get();
+    Z = ZT;
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFact, householderScalars, Z );
+    return info;
+}
+
+#define PROTO(F) \
+  template LowRankInfo<Base<F>> LowRankRiccati \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& C, \
+          Matrix<F>& Z, \
+    const LowRankCtrl<Base<F>>& ctrl ); \
+  template LowRankInfo<Base<F>> LowRankRiccati \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& Z, \
+    const LowRankCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
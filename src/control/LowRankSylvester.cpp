@@ -0,0 +1,280 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/lapack_like/condense.hpp>
+#include <El/lapack_like/solve.hpp>
+#include <El/lapack_like/spectral.hpp>
+#include <El/lapack_like/props.hpp>
+#include <El/matrices.hpp>
+#include <El/control.hpp>
+
+#include "./LowRank/Util.hpp"
+
+namespace El {
+
+// A low-rank solver for
+//    A X + X B = U V^H,
+// where A and B have all of their eigenvalues in the open right-half plane
+// and U and V have only a few columns, via the factored ADI iteration of
+// Benner, Li, and Truhar, "On the ADI method for Sylvester equations",
+// J. Comput. Appl. Math., 2009.
+//
+// With p_j approximating eigenvalues of A and q_j approximating eigenvalues
+// of B, each step computes
+//    V_j := inv(A + q_j I) W,          W := W - (p_j + q_j) V_j,
+//    Y_j := inv(B^H + conj(p_j) I) WT, WT := WT - conj(p_j + q_j) Y_j,
+// so that X = sum_j V_j (p_j + q_j) Y_j^H and the residual is W WT^H.
+
+namespace low_rank {
+
+template<typename F,class BlockType,class SolveAType,class SolveBType>
+LowRankInfo<Base<F>>
+SylvesterADI
+( BlockType& W,
+  BlockType& WT,
+  const Matrix<F>& shiftsA,
+  const Matrix<F>& shiftsB,
+  const SolveAType& solveA,
+  const SolveBType& solveB,
+        vector<BlockType>& ZBlocks,
+        vector<BlockType>& YBlocks,
+        vector<F>& d,
+  const LowRankCtrl<Base<F>>& ctrl,
+  bool print )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    LowRankInfo<Real> info;
+    const Real normRHS = FrobeniusNorm( W )*FrobeniusNorm( WT );
+    if( normRHS == Real(0) )
+        return info;
+
+    const Int k = W.Width();
+    const Int numShiftsA = shiftsA.Height();
+    const Int numShiftsB = shiftsB.Height();
+    while( info.numIts < ctrl.maxIts )
+    {
+        const F p = shiftsA(info.numIts % numShiftsA);
+        const F q = shiftsB(info.numIts % numShiftsB);
+
+        ZBlocks.emplace_back( W );
+        auto& V = ZBlocks.back();
+        solveA( q, V );
+        Axpy( -(p+q), V, W );
+
+        YBlocks.emplace_back( WT );
+        auto& Y = YBlocks.back();
+        solveB( Conj(p), Y );
+        Axpy( -Conj(p+q), Y, WT );
+
+        for( Int i=0; i<k; ++i )
+            d.push_back( p+q );
+
+        ++info.numIts;
+        info.relResidual = FrobeniusNorm(W)*FrobeniusNorm(WT) / normRHS;
+        if( ctrl.progress && print )
+            Output
+            ("ADI iteration ",info.numIts,": shifts=(",p,",",q,
+             "), || W ||_F || WT ||_F / (|| U ||_F || V ||_F)=",
+             info.relResidual);
+        if( info.relResidual <= ctrl.tol )
+            break;
+    }
+    return info;
+}
+
+} // namespace low_rank
+
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankSylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& U,
+  const Matrix<F>& V,
+        Matrix<F>& Z,
+        Matrix<F>& d,
+        Matrix<F>& Y,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || B.Height() != B.Width() )
+          LogicError("A and B must be square");
+      if( U.Height() != A.Height() || V.Height() != B.Height() )
+          LogicError("U and V must conform with A and B");
+      if( U.Width() != V.Width() )
+          LogicError("U and V must have the same width");
+    )
+    Matrix<F> QFactA, householderScalarsA, HA;
+    Matrix<F> QFactB, householderScalarsB, HB, HBAdj;
+    low_rank::HessenbergForm( A, QFactA, householderScalarsA, HA );
+    low_rank::HessenbergForm( B, QFactB, householderScalarsB, HB );
+    Adjoint( HB, HBAdj );
+
+    Matrix<F> W( U ), WT( V );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFactA, householderScalarsA, W );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFactB, householderScalarsB, WT );
+
+    Matrix<F> shiftsA, shiftsB;
+    {
+        auto applyA = [&]( Matrix<F>& x )
+          { Matrix<F> y; Gemm( NORMAL, NORMAL, F(1), HA, x, y ); x = y; };
+        auto applyAInv = [&]( Matrix<F>& x )
+          { low_rank::ShiftedHessSolve( UPPER, HA, F(0), x ); };
+        low_rank::ADIShifts( W, applyA, applyAInv, ctrl, shiftsA );
+
+        auto applyB = [&]( Matrix<F>& x )
+          { Matrix<F> y; Gemm( NORMAL, NORMAL, F(1), HB, x, y ); x = y; };
+        auto applyBInv = [&]( Matrix<F>& x )
+          { low_rank::ShiftedHessSolve( UPPER, HB, F(0), x ); };
+        low_rank::ADIShifts( WT, applyB, applyBInv, ctrl, shiftsB );
+    }
+
+    auto solveA = [&]( F shift, Matrix<F>& X )
+      { low_rank::ShiftedHessSolve( UPPER, HA, shift, X ); };
+    auto solveB = [&]( F shift, Matrix<F>& X )
+      { low_rank::ShiftedHessSolve( LOWER, HBAdj, shift, X ); };
+    vector<Matrix<F>> ZBlocks, YBlocks;
+    vector<F> dVec;
+    auto info =
+      low_rank::SylvesterADI
+      ( W, WT, shiftsA, shiftsB, solveA, solveB, ZBlocks, YBlocks, dVec,
+        ctrl, true );
+
+    low_rank::Concatenate<F>( A.Height(), ZBlocks, Z );
+    low_rank::Concatenate<F>( B.Height(), YBlocks, Y );
+    const Int numCols = dVec.size();
+    d.Resize( numCols, 1 );
+    for( Int j=0; j<numCols; ++j )
+        d(j) = dVec[j];
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFactA, householderScalarsA, Z );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFactB, householderScalarsB, Y );
+    return info;
+}
+
+template<typename F>
+LowRankInfo<Base<F>>
+LowRankSylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& U,
+  const ElementalMatrix<F>& V,
+        ElementalMatrix<F>& ZPre,
+        ElementalMatrix<F>& d,
+        ElementalMatrix<F>& YPre,
+  const LowRankCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || B.Height() != B.Width() )
+          LogicError("A and B must be square");
+      if( U.Height() != A.Height() || V.Height() != B.Height() )
+          LogicError("U and V must conform with A and B");
+      if( U.Width() != V.Width() )
+          LogicError("U and V must have the same width");
+      AssertSameGrids( A, B, U, V );
+    )
+    typedef DistMatrix<F,STAR,VR> BlockType;
+    const Grid& grid = A.Grid();
+    DistMatrix<F> QFactA(grid), HA(grid);
+    DistMatrix<F> QFactB(grid), HB(grid), HBAdj(grid);
+    DistMatrix<F,STAR,STAR> householderScalarsA(grid),
+                            householderScalarsB(grid);
+    low_rank::HessenbergForm( A, QFactA, householderScalarsA, HA );
+    low_rank::HessenbergForm( B, QFactB, householderScalarsB, HB );
+    Adjoint( HB, HBAdj );
+
+    BlockType W( U ), WT( V );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFactA, householderScalarsA, W );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, ADJOINT, QFactB, householderScalarsB, WT );
+
+    Matrix<F> shiftsA, shiftsB;
+    {
+        auto applyA = [&]( BlockType& x )
+          { DistMatrix<F> y(grid); Gemm( NORMAL, NORMAL, F(1), HA, x, y );
+            x = y; };
+        auto applyAInv = [&]( BlockType& x )
+          { low_rank::ShiftedHessSolve( UPPER, HA, F(0), x ); };
+        low_rank::ADIShifts( W, applyA, applyAInv, ctrl, shiftsA );
+
+        auto applyB = [&]( BlockType& x )
+          { DistMatrix<F> y(grid); Gemm( NORMAL, NORMAL, F(1), HB, x, y );
+            x = y; };
+        auto applyBInv = [&]( BlockType& x )
+          { low_rank::ShiftedHessSolve( UPPER, HB, F(0), x ); };
+        low_rank::ADIShifts( WT, applyB, applyBInv, ctrl, shiftsB );
+    }
+
+    auto solveA = [&]( F shift, BlockType& X )
+      { low_rank::ShiftedHessSolve( UPPER, HA, shift, X ); };
+    auto solveB = [&]( F shift, BlockType& X )
+      { low_rank::ShiftedHessSolve( LOWER, HBAdj, shift, X ); };
+    vector<BlockType> ZBlocks, YBlocks;
+    vector<F> dVec;
+    auto info =
+      low_rank::SylvesterADI
+      ( W, WT, shiftsA, shiftsB, solveA, solveB, ZBlocks, YBlocks, dVec,
+        ctrl, grid.Rank() == 0 );
+
+    DistMatrixWriteProxy<F,F,MC,MR> ZProx( ZPre ), YProx( YPre );
+    auto& Z = ZProx.Get();
+    auto& Y = YProx.Get();
+    low_rank::Concatenate<F>( A.Height(), ZBlocks, Z );
+    low_rank::Concatenate<F>( B.Height(), YBlocks, Y );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFactA, householderScalarsA, Z );
+    hessenberg::ApplyQ
+    ( LEFT, UPPER, NORMAL, QFactB, householderScalarsB, Y );
+
+    // Every process holds the full list of weights
+    const Int numCols = dVec.size();
+    DistMatrix<F,STAR,STAR> d_STAR_STAR( numCols, 1, grid );
+    for( Int j=0; j<numCols; ++j )
+        d_STAR_STAR.SetLocal( j, 0, dVec[j] );
+    Copy( d_STAR_STAR, d );
+    return info;
+}
+
+#define PROTO(F) \
+  template LowRankInfo<Base<F>> LowRankSylvester \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& U, \
+    const Matrix<F>& V, \
+          Matrix<F>& Z, \
+          Matrix<F>& d, \
+          Matrix<F>& Y, \
+    const LowRankCtrl<Base<F>>& ctrl ); \
+  template LowRankInfo<Base<F>> LowRankSylvester \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& U, \
+    const ElementalMatrix<F>& V, \
+          ElementalMatrix<F>& Z, \
+          ElementalMatrix<F>& d, \
+          ElementalMatrix<F>& Y, \
+    const LowRankCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,594 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+DistGraph::DistGraph( const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+DistGraph::DistGraph( Int numSources, const El::Grid& grid )
+: DistGraph( numSources, numSources, grid )
+{ }
+
+DistGraph::DistGraph( Int numSources, Int numTargets, const El::Grid& grid )
+: numSources_(numSources), numTargets_(numTargets), grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+DistGraph::DistGraph( const DistGraph& graph )
+: grid_(graph.grid_)
+{
+    EL_DEBUG_CSE
+    if( &graph != this )
+        *this = graph;
+    else
+        LogicError("Tried to construct a DistGraph with itself");
+}
+
+DistGraph::~DistGraph() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+const DistGraph& DistGraph::operator=( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    grid_ = graph.grid_;
+    blocksize_ = graph.blocksize_;
+    numLocalSources_ = graph.numLocalSources_;
+    locallyConsistent_ = graph.locallyConsistent_;
+    sources_ = graph.sources_;
+    targets_ = graph.targets_;
+    markedForRemoval_ = graph.markedForRemoval_;
+    remoteSources_ = graph.remoteSources_;
+    remoteTargets_ = graph.remoteTargets_;
+    remoteRemovals_ = graph.remoteRemovals_;
+    localSourceOffsets_ = graph.localSourceOffsets_;
+    multMeta_ = graph.multMeta_;
+    return *this;
+}
+
+void DistGraph::Empty( bool freeMemory )
+{
+    EL_DEBUG_CSE
+    numSources_ = 0;
+    numTargets_ = 0;
+    if( freeMemory )
+    {
+        SwapClear( sources_ );
+        SwapClear( targets_ );
+        SwapClear( markedForRemoval_ );
+        SwapClear( remoteSources_ );
+        SwapClear( remoteTargets_ );
+        SwapClear( remoteRemovals_ );
+    }
+    else
+    {
+        sources_.resize( 0 );
+        targets_.resize( 0 );
+        markedForRemoval_.resize( 0 );
+        remoteSources_.resize( 0 );
+        remoteTargets_.resize( 0 );
+        remoteRemovals_.resize( 0 );
+    }
+    InitializeLocalData();
+}
+
+void DistGraph::Resize( Int numVertices )
+{ Resize( numVertices, numVertices ); }
+
+void DistGraph::Resize( Int numSources, Int numTargets )
+{
+    EL_DEBUG_CSE
+    if( numSources_ == numSources && numTargets_ == numTargets )
+        return;
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    sources_.resize( 0 );
+    targets_.resize( 0 );
+    markedForRemoval_.resize( 0 );
+    remoteSources_.resize( 0 );
+    remoteTargets_.resize( 0 );
+    remoteRemovals_.resize( 0 );
+    InitializeLocalData();
+}
+
+void DistGraph::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    Empty( false );
+}
+
+void DistGraph::InitializeLocalData()
+{
+    EL_DEBUG_CSE
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+
+    blocksize_ = numSources_ / commSize;
+    if( blocksize_*commSize < numSources_ || numSources_ == 0 )
+        ++blocksize_;
+    numLocalSources_ =
+      Min(blocksize_,Max(numSources_-blocksize_*commRank,Int(0)));
+
+    locallyConsistent_ = true;
+    ComputeSourceOffsets();
+}
+
+// Edge manipulation
+// -----------------
+
+void DistGraph::Reserve( Int numLocalEdges, Int numRemoteEdges )
+{
+    EL_DEBUG_CSE
+    sources_.reserve( numLocalEdges );
+    targets_.reserve( numLocalEdges );
+    remoteSources_.reserve( numRemoteEdges );
+    remoteTargets_.reserve( numRemoteEdges );
+}
+
+void DistGraph::Connect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueConnection( source, target );
+    ProcessQueues();
+}
+
+void DistGraph::ConnectLocal( Int localSource, Int target )
+{
+    EL_DEBUG_CSE
+    QueueLocalConnection( localSource, target );
+    ProcessLocalQueues();
+}
+
+void DistGraph::Disconnect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueDisconnection( source, target );
+    ProcessQueues();
+}
+
+void DistGraph::DisconnectLocal( Int localSource, Int target )
+{
+    EL_DEBUG_CSE
+    QueueLocalDisconnection( localSource, target );
+    ProcessLocalQueues();
+}
+
+void DistGraph::QueueConnection( Int source, Int target, bool passive )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int firstLocalSource = FirstLocalSource();
+    if( source >= firstLocalSource &&
+        source < firstLocalSource+numLocalSources_ )
+    {
+        QueueLocalConnection( source-firstLocalSource, target );
+    }
+    else if( !passive )
+    {
+        EL_DEBUG_ONLY(
+          if( source < 0 || source >= numSources_ )
+              LogicError
+              ("Source was out of bounds: ",source," is not in [0,",
+               numSources_,")");
+          if( target < 0 || target >= numTargets_ )
+              LogicError
+              ("Target was out of bounds: ",target," is not in [0,",
+               numTargets_,")");
+        )
+        remoteSources_.push_back( source );
+        remoteTargets_.push_back( target );
+    }
+}
+
+void DistGraph::QueueLocalConnection( Int localSource, Int target )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource >= numLocalSources_ )
+          LogicError
+          ("Local source was out of bounds: ",localSource," is not in [0,",
+           numLocalSources_,")");
+      if( target < 0 || target >= numTargets_ )
+          LogicError
+          ("Target was out of bounds: ",target," is not in [0,",
+           numTargets_,")");
+    )
+    if( sources_.size() == sources_.capacity() )
+    {
+        const Int newCapacity = Max(Int(1),2*Int(sources_.size()));
+        sources_.reserve( newCapacity );
+        targets_.reserve( newCapacity );
+    }
+    sources_.push_back( FirstLocalSource()+localSource );
+    targets_.push_back( target );
+    locallyConsistent_ = false;
+}
+
+void DistGraph::QueueDisconnection( Int source, Int target, bool passive )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int firstLocalSource = FirstLocalSource();
+    if( source >= firstLocalSource &&
+        source < firstLocalSource+numLocalSources_ )
+    {
+        QueueLocalDisconnection( source-firstLocalSource, target );
+    }
+    else if( !passive )
+    {
+        remoteRemovals_.push_back( std::pair<Int,Int>(source,target) );
+    }
+}
+
+void DistGraph::QueueLocalDisconnection( Int localSource, Int target )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    markedForRemoval_.push_back
+    ( std::pair<Int,Int>(FirstLocalSource()+localSource,target) );
+    locallyConsistent_ = false;
+}
+
+void DistGraph::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = grid_->Comm();
+    const int commSize = grid_->Size();
+
+    // Forward the queued remote connections to the owners of their sources,
+    // packing each (source,target) pair contiguously
+    vector<int> sendCounts( commSize, 0 );
+    const Int numRemote = remoteSources_.size();
+    for( Int e=0; e<numRemote; ++e )
+        sendCounts[SourceOwner(remoteSources_[e])] += 2;
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( Int e=0; e<numRemote; ++e )
+    {
+        const int owner = SourceOwner(remoteSources_[e]);
+        sendBuf[offs[owner]++] = remoteSources_[e];
+        sendBuf[offs[owner]++] = remoteTargets_[e];
+    }
+    SwapClear( remoteSources_ );
+    SwapClear( remoteTargets_ );
+
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    const Int numRecv = recvBuf.size() / 2;
+    if( numRecv > 0 )
+        Reserve( NumLocalEdges()+numRecv );
+    for( Int e=0; e<numRecv; ++e )
+    {
+        sources_.push_back( recvBuf[2*e] );
+        targets_.push_back( recvBuf[2*e+1] );
+        locallyConsistent_ = false;
+    }
+
+    ForwardRemoteRemovals();
+    ProcessLocalQueues();
+}
+
+void DistGraph::ForwardRemoteRemovals()
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = grid_->Comm();
+    const int commSize = grid_->Size();
+
+    // Forward the queued remote disconnections to the owners of their
+    // sources, packing each (source,target) pair contiguously
+    vector<int> sendCounts( commSize, 0 );
+    for( const auto& pair : remoteRemovals_ )
+        sendCounts[SourceOwner(pair.first)] += 2;
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( const auto& pair : remoteRemovals_ )
+    {
+        const int owner = SourceOwner(pair.first);
+        sendBuf[offs[owner]++] = pair.first;
+        sendBuf[offs[owner]++] = pair.second;
+    }
+    SwapClear( remoteRemovals_ );
+
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    const Int numRecv = recvBuf.size() / 2;
+    for( Int e=0; e<numRecv; ++e )
+    {
+        markedForRemoval_.push_back
+        ( std::pair<Int,Int>(recvBuf[2*e],recvBuf[2*e+1]) );
+        locallyConsistent_ = false;
+    }
+}
+
+void DistGraph::ProcessLocalQueues()
+{
+    EL_DEBUG_CSE
+    if( locallyConsistent_ )
+        return;
+
+    // Sort the (source,target) pairs, remove duplicates, and then remove any
+    // edges which were marked for removal
+    const Int numQueued = sources_.size();
+    vector<std::pair<Int,Int>> pairs( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        pairs[e] = std::pair<Int,Int>( sources_[e], targets_[e] );
+    std::sort( pairs.begin(), pairs.end() );
+    pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+    if( !markedForRemoval_.empty() )
+    {
+        std::sort( markedForRemoval_.begin(), markedForRemoval_.end() );
+        auto marked =
+          [&]( const std::pair<Int,Int>& pair )
+          { return std::binary_search
+                   ( markedForRemoval_.begin(), markedForRemoval_.end(),
+                     pair ); };
+        pairs.erase
+        ( std::remove_if( pairs.begin(), pairs.end(), marked ), pairs.end() );
+        SwapClear( markedForRemoval_ );
+    }
+
+    const Int numLocalEdges = pairs.size();
+    sources_.resize( numLocalEdges );
+    targets_.resize( numLocalEdges );
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        sources_[e] = pairs[e].first;
+        targets_[e] = pairs[e].second;
+    }
+    ComputeSourceOffsets();
+    locallyConsistent_ = true;
+}
+
+// Queries
+// =======
+
+Int DistGraph::NumSources() const EL_NO_EXCEPT { return numSources_; }
+Int DistGraph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
+
+Int DistGraph::FirstLocalSource() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+
+Int DistGraph::NumLocalSources() const EL_NO_EXCEPT
+{ return numLocalSources_; }
+
+Int DistGraph::NumLocalEdges() const EL_NO_EXCEPT { return sources_.size(); }
+Int DistGraph::Capacity() const EL_NO_EXCEPT { return sources_.capacity(); }
+
+bool DistGraph::LocallyConsistent() const EL_NO_EXCEPT
+{ return locallyConsistent_; }
+
+const El::Grid& DistGraph::Grid() const EL_NO_EXCEPT { return *grid_; }
+Int DistGraph::Blocksize() const EL_NO_EXCEPT { return blocksize_; }
+
+int DistGraph::SourceOwner( Int source ) const EL_NO_RELEASE_EXCEPT
+{ return source / blocksize_; }
+
+Int DistGraph::GlobalSource( Int localSource ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource >= numLocalSources_ )
+          LogicError("Invalid local source index");
+    )
+    return localSource + FirstLocalSource();
+}
+
+Int DistGraph::LocalSource( Int source ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int localSource = source - FirstLocalSource();
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource >= numLocalSources_ )
+          LogicError("Source ",source," was not local");
+    )
+    return localSource;
+}
+
+Int DistGraph::Source( Int localEdge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localEdge < 0 || localEdge >= (Int)sources_.size() )
+          LogicError("Edge number out of bounds");
+    )
+    return sources_[localEdge];
+}
+
+Int DistGraph::Target( Int localEdge ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localEdge < 0 || localEdge >= (Int)targets_.size() )
+          LogicError("Edge number out of bounds");
+    )
+    return targets_[localEdge];
+}
+
+Int DistGraph::SourceOffset( Int localSource ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localSource < 0 || localSource > numLocalSources_ )
+          LogicError
+          ("Local source was out of bounds: ",localSource," is not in [0,",
+           numLocalSources_,"]");
+      AssertLocallyConsistent();
+    )
+    return localSourceOffsets_[localSource];
+}
+
+Int DistGraph::Offset( Int localSource, Int target ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int* begin = targets_.data() + SourceOffset(localSource);
+    const Int* end = targets_.data() + SourceOffset(localSource+1);
+    return std::lower_bound( begin, end, target ) - targets_.data();
+}
+
+Int DistGraph::NumConnections( Int localSource ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    return SourceOffset(localSource+1) - SourceOffset(localSource);
+}
+
+bool DistGraph::EdgeExists( Int source, Int target ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int localSource = LocalSource( source );
+    const Int offset = Offset( localSource, target );
+    return offset < SourceOffset(localSource+1) && targets_[offset] == target;
+}
+
+double DistGraph::Imbalance() const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = grid_->Comm();
+    const Int numLocalEdges = NumLocalEdges();
+    const Int maxLocalEdges =
+      mpi::AllReduce( numLocalEdges, mpi::MAX, comm, SyncInfo<Device::CPU>() );
+    const Int numEdges =
+      mpi::AllReduce( numLocalEdges, mpi::SUM, comm, SyncInfo<Device::CPU>() );
+    if( numEdges == 0 )
+        return 1;
+    return double(maxLocalEdges*grid_->Size()) / double(numEdges);
+}
+
+Int* DistGraph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* DistGraph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
+Int* DistGraph::OffsetBuffer() EL_NO_EXCEPT
+{ return localSourceOffsets_.data(); }
+
+const Int* DistGraph::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return sources_.data(); }
+const Int* DistGraph::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return targets_.data(); }
+const Int* DistGraph::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return localSourceOffsets_.data(); }
+
+void DistGraph::ForceNumLocalEdges( Int numLocalEdges )
+{
+    EL_DEBUG_CSE
+    sources_.resize( numLocalEdges );
+    targets_.resize( numLocalEdges );
+    locallyConsistent_ = false;
+}
+
+void DistGraph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{
+    locallyConsistent_ = consistent;
+    if( consistent )
+        ComputeSourceOffsets();
+}
+
+void DistGraph::AssertLocallyConsistent() const
+{
+    if( !locallyConsistent_ )
+        LogicError("DistGraph was not locally consistent");
+}
+
+const DistGraphMultMeta& DistGraph::MultMeta() const
+{
+    EL_DEBUG_CSE
+    if( multMeta_.ready )
+        return multMeta_;
+    AssertLocallyConsistent();
+    mpi::Comm const& comm = grid_->Comm();
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+
+    // The multivector has NumTargets() rows distributed using the same
+    // blocked convention as the sources
+    Int targetBlocksize = numTargets_ / commSize;
+    if( targetBlocksize*commSize < numTargets_ || numTargets_ == 0 )
+        ++targetBlocksize;
+
+    // Since the owners of the targets are monotonic in the target index, the
+    // sorted unique targets are already packed by owner
+    vector<Int> uniqueTargets( targets_ );
+    std::sort( uniqueTargets.begin(), uniqueTargets.end() );
+    uniqueTargets.erase
+    ( std::unique( uniqueTargets.begin(), uniqueTargets.end() ),
+      uniqueTargets.end() );
+    multMeta_.numRecvInds = uniqueTargets.size();
+
+    multMeta_.recvSizes.assign( commSize, 0 );
+    for( const Int& target : uniqueTargets )
+        ++multMeta_.recvSizes[target/targetBlocksize];
+    Scan( multMeta_.recvSizes, multMeta_.recvOffs );
+
+    // Tell each owner which of its rows we need
+    multMeta_.sendSizes.resize( commSize );
+    mpi::AllToAll
+    ( multMeta_.recvSizes.data(), 1, multMeta_.sendSizes.data(), 1, comm,
+      SyncInfo<Device::CPU>() );
+    const int numSendInds = Scan( multMeta_.sendSizes, multMeta_.sendOffs );
+    multMeta_.sendInds.resize( numSendInds );
+    mpi::AllToAll
+    ( uniqueTargets.data(),
+      multMeta_.recvSizes.data(), multMeta_.recvOffs.data(),
+      multMeta_.sendInds.data(),
+      multMeta_.sendSizes.data(), multMeta_.sendOffs.data(),
+      comm, SyncInfo<Device::CPU>() );
+    const Int firstLocalTarget = targetBlocksize*commRank;
+    for( Int& ind : multMeta_.sendInds )
+        ind -= firstLocalTarget;
+
+    const Int numLocalEdges = targets_.size();
+    multMeta_.colOffs.resize( numLocalEdges );
+    for( Int e=0; e<numLocalEdges; ++e )
+        multMeta_.colOffs[e] =
+          std::lower_bound
+          ( uniqueTargets.begin(), uniqueTargets.end(), targets_[e] ) -
+          uniqueTargets.begin();
+
+    multMeta_.ready = true;
+    return multMeta_;
+}
+
+void DistGraph::ComputeSourceOffsets()
+{
+    EL_DEBUG_CSE
+    multMeta_.Clear();
+    const Int numLocalEdges = sources_.size();
+    const Int firstLocalSource = FirstLocalSource();
+    localSourceOffsets_.resize( numLocalSources_+1 );
+    Int localSource = 0;
+    localSourceOffsets_[0] = 0;
+    for( Int e=0; e<numLocalEdges; ++e )
+    {
+        while( localSource < sources_[e]-firstLocalSource )
+            localSourceOffsets_[++localSource] = e;
+    }
+    while( localSource < numLocalSources_ )
+        localSourceOffsets_[++localSource] = numLocalEdges;
+}
+
+} // namespace El
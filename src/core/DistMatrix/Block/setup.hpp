@@ -555,7 +555,7 @@ template <typename T, Device D>
 void BDM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const Int totalSend = remoteUpdates_.size();
@@ -612,6 +612,9 @@ void BDM::ProcessQueues(bool includeViewers)
     SyncInfo<D> syncInfoA = SyncInfoFromMatrix(matrix_);
 
     auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
+    // Viewers only send; the redundant communicator is not valid for them
+    if (!this->Participating())
+        return;
     Int recvBufSize = recvBuf.size();
     mpi::Broadcast(recvBufSize, redundantRoot, RedundantComm(), syncInfoA);
     recvBuf.resize(recvBufSize);
@@ -640,7 +643,7 @@ template <typename T, Device D>
 void BDM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = this->Root();
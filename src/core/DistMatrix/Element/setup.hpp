@@ -341,14 +341,10 @@ DM& DM::operator=(const DistMatrix<T,U,V,BLOCK,D>& A)
       (A.BlockWidth() == 1 || A.RowStride() == 1);
     if (elemColCompat && elemRowCompat)
     {
-        DistMatrix<T,U,V> AElemView(A.Grid());
-#if 0
+        DistMatrix<T,U,V,ELEMENT,D> AElemView(A.Grid());
         AElemView.LockedAttach
         (A.Height(), A.Width(), A.Grid(),
-          A.ColAlign(), A.RowAlign(), A.LockedBuffer(), A.LDim(), A.Root());
-#else
-        throw std::runtime_error("This don't work yet!");
-#endif
+          A.ColAlign(), A.RowAlign(), A.LockedMatrix(), A.Root());
         *this = AElemView;
     }
     else
@@ -663,11 +659,10 @@ template <typename T, Device D>
 void DM::ProcessQueues(bool includeViewers)
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const Int totalSend = remoteUpdates_.size();
-    LogicError("Test.");
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
@@ -721,6 +716,9 @@ void DM::ProcessQueues(bool includeViewers)
     // Exchange and unpack the data
     // ============================
     auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
+    // Viewers only send; the redundant communicator is not valid for them
+    if (!this->Participating())
+        return;
     Int recvBufSize = recvBuf.size();
     mpi::Broadcast(recvBufSize, redundantRoot, RedundantComm(), syncInfoA);
     recvBuf.resize(recvBufSize);
@@ -750,14 +748,12 @@ template <typename T, Device D>
 void DM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
 {
     EL_DEBUG_CSE
-    const auto& grid = Grid();
+    const auto& grid = this->Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = this->Root();
     const Int totalRecv = remotePulls_.size();
 
-    LogicError("Test.");
-
     // Compute the metadata
     // ====================
     mpi::Comm const& comm
@@ -0,0 +1,276 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+DistMultiVec<T>::DistMultiVec( const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+template<typename T>
+DistMultiVec<T>::DistMultiVec( Int height, Int width, const El::Grid& grid )
+: height_(height), width_(width), grid_(&grid)
+{
+    EL_DEBUG_CSE
+    InitializeLocalData();
+}
+
+template<typename T>
+DistMultiVec<T>::DistMultiVec( const DistMultiVec<T>& A )
+: grid_(&A.Grid())
+{
+    EL_DEBUG_CSE
+    if( &A != this )
+        *this = A;
+    else
+        LogicError("Tried to construct DistMultiVec with itself");
+}
+
+template<typename T>
+DistMultiVec<T>::~DistMultiVec() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const DistMultiVec<T>& DistMultiVec<T>::operator=( const DistMultiVec<T>& A )
+{
+    EL_DEBUG_CSE
+    height_ = A.height_;
+    width_ = A.width_;
+    grid_ = A.grid_;
+    blocksize_ = A.blocksize_;
+    matrix_ = A.matrix_;
+    remoteUpdates_ = A.remoteUpdates_;
+    return *this;
+}
+
+template<typename T>
+void DistMultiVec<T>::Empty()
+{
+    EL_DEBUG_CSE
+    height_ = 0;
+    width_ = 0;
+    matrix_.Empty();
+    SwapClear( remoteUpdates_ );
+    InitializeLocalData();
+}
+
+template<typename T>
+void DistMultiVec<T>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( height_ == height && width_ == width )
+        return;
+    height_ = height;
+    width_ = width;
+    InitializeLocalData();
+}
+
+template<typename T>
+void DistMultiVec<T>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    Empty();
+}
+
+template<typename T>
+void DistMultiVec<T>::InitializeLocalData()
+{
+    EL_DEBUG_CSE
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+
+    blocksize_ = height_ / commSize;
+    if( blocksize_*commSize < height_ || height_ == 0 )
+        ++blocksize_;
+    const Int localHeight =
+      Min(blocksize_,Max(height_-blocksize_*commRank,Int(0)));
+    matrix_.Resize( localHeight, width_ );
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int DistMultiVec<T>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename T>
+Int DistMultiVec<T>::Width() const EL_NO_EXCEPT { return width_; }
+
+template<typename T>
+Int DistMultiVec<T>::FirstLocalRow() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+template<typename T>
+Int DistMultiVec<T>::LocalHeight() const EL_NO_EXCEPT
+{ return matrix_.Height(); }
+
+template<typename T>
+El::Matrix<T>& DistMultiVec<T>::Matrix() EL_NO_EXCEPT { return matrix_; }
+template<typename T>
+const El::Matrix<T>& DistMultiVec<T>::LockedMatrix() const EL_NO_EXCEPT
+{ return matrix_; }
+
+template<typename T>
+const El::Grid& DistMultiVec<T>::Grid() const EL_NO_EXCEPT { return *grid_; }
+template<typename T>
+Int DistMultiVec<T>::Blocksize() const EL_NO_EXCEPT { return blocksize_; }
+
+template<typename T>
+int DistMultiVec<T>::RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return i / blocksize_; }
+
+template<typename T>
+Int DistMultiVec<T>::GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( iLoc < 0 || iLoc >= LocalHeight() )
+          LogicError("Invalid local row index");
+    )
+    return iLoc + FirstLocalRow();
+}
+
+template<typename T>
+Int DistMultiVec<T>::LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !IsLocalRow(i) )
+          LogicError("Row ",i," was not local");
+    )
+    return i - FirstLocalRow();
+}
+
+template<typename T>
+bool DistMultiVec<T>::IsLocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{
+    const Int firstLocalRow = FirstLocalRow();
+    return i >= firstLocalRow && i < firstLocalRow+LocalHeight();
+}
+
+// Entry manipulation
+// ==================
+
+template<typename T>
+T DistMultiVec<T>::Get( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    const int owner = RowOwner( i );
+    T value;
+    if( owner == grid_->Rank() )
+        value = GetLocal( i-FirstLocalRow(), j );
+    mpi::Broadcast( &value, 1, owner, grid_->Comm(), SyncInfo<Device::CPU>() );
+    return value;
+}
+
+template<typename T>
+void DistMultiVec<T>::Set( Int i, Int j, const T& value )
+EL_NO_RELEASE_EXCEPT
+{
+    if( IsLocalRow(i) )
+        SetLocal( i-FirstLocalRow(), j, value );
+}
+
+template<typename T>
+void DistMultiVec<T>::Set( const Entry<T>& entry ) EL_NO_RELEASE_EXCEPT
+{ Set( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+void DistMultiVec<T>::Update( Int i, Int j, const T& value )
+EL_NO_RELEASE_EXCEPT
+{
+    if( IsLocalRow(i) )
+        UpdateLocal( i-FirstLocalRow(), j, value );
+}
+
+template<typename T>
+void DistMultiVec<T>::Update( const Entry<T>& entry ) EL_NO_RELEASE_EXCEPT
+{ Update( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+T DistMultiVec<T>::GetLocal( Int iLoc, Int j ) const EL_NO_RELEASE_EXCEPT
+{ return matrix_.Get( iLoc, j ); }
+
+template<typename T>
+void DistMultiVec<T>::SetLocal( Int iLoc, Int j, const T& value )
+EL_NO_RELEASE_EXCEPT
+{ matrix_.Set( iLoc, j, value ); }
+
+template<typename T>
+void DistMultiVec<T>::UpdateLocal( Int iLoc, Int j, const T& value )
+EL_NO_RELEASE_EXCEPT
+{ matrix_.Update( iLoc, j, value ); }
+
+template<typename T>
+void DistMultiVec<T>::Reserve( Int numRemoteUpdates )
+{
+    EL_DEBUG_CSE
+    remoteUpdates_.reserve( numRemoteUpdates );
+}
+
+template<typename T>
+void DistMultiVec<T>::QueueUpdate( Int i, Int j, const T& value, bool passive )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( IsLocalRow(i) )
+        UpdateLocal( i-FirstLocalRow(), j, value );
+    else if( !passive )
+        remoteUpdates_.push_back( Entry<T>{i,j,value} );
+}
+
+template<typename T>
+void DistMultiVec<T>::QueueUpdate( const Entry<T>& entry, bool passive )
+EL_NO_RELEASE_EXCEPT
+{ QueueUpdate( entry.i, entry.j, entry.value, passive ); }
+
+template<typename T>
+void DistMultiVec<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    const int commSize = grid_->Size();
+
+    vector<int> sendCounts( commSize, 0 );
+    for( const auto& entry : remoteUpdates_ )
+        ++sendCounts[RowOwner(entry.i)];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Entry<T>> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( const auto& entry : remoteUpdates_ )
+        sendBuf[offs[RowOwner(entry.i)]++] = entry;
+    SwapClear( remoteUpdates_ );
+
+    auto recvBuf =
+      mpi::AllToAll( sendBuf, sendCounts, sendOffs, grid_->Comm() );
+    const Int firstLocalRow = FirstLocalRow();
+    for( const auto& entry : recvBuf )
+        UpdateLocal( entry.i-firstLocalRow, entry.j, entry.value );
+}
+
+#define PROTO(T) template class DistMultiVec<T>;
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,402 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix( const El::Grid& grid )
+: distGraph_(grid)
+{ }
+
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix
+( Int height, Int width, const El::Grid& grid )
+: distGraph_(height,width,grid)
+{ }
+
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix( const DistSparseMatrix<T>& A )
+: distGraph_(A.Grid())
+{
+    EL_DEBUG_CSE
+    if( &A != this )
+        *this = A;
+    else
+        LogicError("Tried to construct DistSparseMatrix with itself");
+}
+
+template<typename T>
+DistSparseMatrix<T>::~DistSparseMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const DistSparseMatrix<T>&
+DistSparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    distGraph_ = A.distGraph_;
+    vals_ = A.vals_;
+    remoteVals_ = A.remoteVals_;
+    return *this;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::Empty( bool clearMemory )
+{
+    EL_DEBUG_CSE
+    distGraph_.Empty( clearMemory );
+    if( clearMemory )
+    {
+        SwapClear( vals_ );
+        SwapClear( remoteVals_ );
+    }
+    else
+    {
+        vals_.resize( 0 );
+        remoteVals_.resize( 0 );
+    }
+}
+
+template<typename T>
+void DistSparseMatrix<T>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( Height() == height && Width() == width )
+        return;
+    distGraph_.Resize( height, width );
+    vals_.resize( 0 );
+    remoteVals_.resize( 0 );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( &Grid() == &grid )
+        return;
+    distGraph_.SetGrid( grid );
+    vals_.resize( 0 );
+    remoteVals_.resize( 0 );
+}
+
+// Entry manipulation
+// ------------------
+
+template<typename T>
+void DistSparseMatrix<T>::Reserve( Int numLocalEntries, Int numRemoteEntries )
+{
+    EL_DEBUG_CSE
+    distGraph_.Reserve( numLocalEntries, numRemoteEntries );
+    vals_.reserve( numLocalEntries );
+    remoteVals_.reserve( numRemoteEntries );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueUpdate
+( Int row, Int col, const T& value, bool passive )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int firstLocalRow = FirstLocalRow();
+    if( row >= firstLocalRow && row < firstLocalRow+LocalHeight() )
+    {
+        QueueLocalUpdate( row-firstLocalRow, col, value );
+    }
+    else if( !passive )
+    {
+        distGraph_.QueueConnection( row, col );
+        remoteVals_.push_back( value );
+    }
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueUpdate( const Entry<T>& entry, bool passive )
+EL_NO_RELEASE_EXCEPT
+{ QueueUpdate( entry.i, entry.j, entry.value, passive ); }
+
+template<typename T>
+void DistSparseMatrix<T>::QueueLocalUpdate
+( Int localRow, Int col, const T& value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( NumLocalEntries() == Capacity() )
+        Reserve( Max(Int(1),2*NumLocalEntries()) );
+    distGraph_.QueueLocalConnection( localRow, col );
+    vals_.push_back( value );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueZero( Int row, Int col, bool passive )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    distGraph_.QueueDisconnection( row, col, passive );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::QueueLocalZero( Int localRow, Int col )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    distGraph_.QueueLocalDisconnection( localRow, col );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    mpi::Comm const& comm = Grid().Comm();
+    const int commSize = Grid().Size();
+
+    // Forward the queued remote updates (with their values) to the owners of
+    // their rows
+    const auto& remoteSources = distGraph_.remoteSources_;
+    const auto& remoteTargets = distGraph_.remoteTargets_;
+    const Int numRemote = remoteSources.size();
+    vector<int> sendCounts( commSize, 0 );
+    for( Int e=0; e<numRemote; ++e )
+        ++sendCounts[RowOwner(remoteSources[e])];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Entry<T>> sendBuf( totalSend );
+    auto offs = sendOffs;
+    for( Int e=0; e<numRemote; ++e )
+    {
+        const int owner = RowOwner(remoteSources[e]);
+        sendBuf[offs[owner]++] =
+          Entry<T>{ remoteSources[e], remoteTargets[e], remoteVals_[e] };
+    }
+    SwapClear( distGraph_.remoteSources_ );
+    SwapClear( distGraph_.remoteTargets_ );
+    SwapClear( remoteVals_ );
+
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    const Int numRecv = recvBuf.size();
+    if( numRecv > 0 )
+        Reserve( NumLocalEntries()+numRecv );
+    const Int firstLocalRow = FirstLocalRow();
+    for( const auto& entry : recvBuf )
+        QueueLocalUpdate( entry.i-firstLocalRow, entry.j, entry.value );
+
+    distGraph_.ForwardRemoteRemovals();
+    ProcessLocalQueues();
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ProcessLocalQueues()
+{
+    EL_DEBUG_CSE
+    if( distGraph_.locallyConsistent_ )
+        return;
+
+    // Sort the entries by (row,column) while keeping the queue order of the
+    // duplicates so that their sum is deterministic
+    const Int numQueued = vals_.size();
+    vector<Entry<T>> entries( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+    {
+        entries[e].i = distGraph_.sources_[e];
+        entries[e].j = distGraph_.targets_[e];
+        entries[e].value = vals_[e];
+    }
+    std::stable_sort
+    ( entries.begin(), entries.end(),
+      []( const Entry<T>& a, const Entry<T>& b )
+      { return a.i < b.i || (a.i == b.i && a.j < b.j); } );
+
+    // Sum the duplicates
+    Int numLocalEntries = 0;
+    for( Int e=0; e<numQueued; ++e )
+    {
+        if( numLocalEntries > 0 &&
+            entries[numLocalEntries-1].i == entries[e].i &&
+            entries[numLocalEntries-1].j == entries[e].j )
+            entries[numLocalEntries-1].value += entries[e].value;
+        else
+            entries[numLocalEntries++] = entries[e];
+    }
+    entries.resize( numLocalEntries );
+
+    // Remove the entries which were marked for removal
+    auto& marked = distGraph_.markedForRemoval_;
+    if( !marked.empty() )
+    {
+        std::sort( marked.begin(), marked.end() );
+        entries.erase
+        ( std::remove_if
+          ( entries.begin(), entries.end(),
+            [&]( const Entry<T>& entry )
+            { return std::binary_search
+                     ( marked.begin(), marked.end(),
+                       std::pair<Int,Int>(entry.i,entry.j) ); } ),
+          entries.end() );
+        SwapClear( marked );
+        numLocalEntries = entries.size();
+    }
+
+    distGraph_.sources_.resize( numLocalEntries );
+    distGraph_.targets_.resize( numLocalEntries );
+    vals_.resize( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        distGraph_.sources_[e] = entries[e].i;
+        distGraph_.targets_[e] = entries[e].j;
+        vals_[e] = entries[e].value;
+    }
+    distGraph_.ComputeSourceOffsets();
+    distGraph_.locallyConsistent_ = true;
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int DistSparseMatrix<T>::Height() const EL_NO_EXCEPT
+{ return distGraph_.NumSources(); }
+template<typename T>
+Int DistSparseMatrix<T>::Width() const EL_NO_EXCEPT
+{ return distGraph_.NumTargets(); }
+template<typename T>
+Int DistSparseMatrix<T>::FirstLocalRow() const EL_NO_EXCEPT
+{ return distGraph_.FirstLocalSource(); }
+template<typename T>
+Int DistSparseMatrix<T>::LocalHeight() const EL_NO_EXCEPT
+{ return distGraph_.NumLocalSources(); }
+template<typename T>
+Int DistSparseMatrix<T>::NumLocalEntries() const EL_NO_EXCEPT
+{ return distGraph_.NumLocalEdges(); }
+template<typename T>
+Int DistSparseMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return distGraph_.Capacity(); }
+template<typename T>
+bool DistSparseMatrix<T>::LocallyConsistent() const EL_NO_EXCEPT
+{ return distGraph_.LocallyConsistent(); }
+
+template<typename T>
+El::DistGraph& DistSparseMatrix<T>::DistGraph() EL_NO_EXCEPT
+{ return distGraph_; }
+template<typename T>
+const El::DistGraph& DistSparseMatrix<T>::LockedDistGraph() const EL_NO_EXCEPT
+{ return distGraph_; }
+
+template<typename T>
+const El::Grid& DistSparseMatrix<T>::Grid() const EL_NO_EXCEPT
+{ return distGraph_.Grid(); }
+template<typename T>
+Int DistSparseMatrix<T>::Blocksize() const EL_NO_EXCEPT
+{ return distGraph_.Blocksize(); }
+
+template<typename T>
+int DistSparseMatrix<T>::RowOwner( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.SourceOwner( i ); }
+template<typename T>
+Int DistSparseMatrix<T>::GlobalRow( Int iLoc ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.GlobalSource( iLoc ); }
+template<typename T>
+Int DistSparseMatrix<T>::LocalRow( Int i ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.LocalSource( i ); }
+
+template<typename T>
+Int DistSparseMatrix<T>::Row( Int localInd ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Source( localInd ); }
+template<typename T>
+Int DistSparseMatrix<T>::Col( Int localInd ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Target( localInd ); }
+
+template<typename T>
+T DistSparseMatrix<T>::Value( Int localInd ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( localInd < 0 || localInd >= Int(vals_.size()) )
+          LogicError("Entry number out of bounds");
+    )
+    return vals_[localInd];
+}
+
+template<typename T>
+Int DistSparseMatrix<T>::RowOffset( Int localRow ) const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.SourceOffset( localRow ); }
+template<typename T>
+Int DistSparseMatrix<T>::Offset( Int localRow, Int col ) const
+EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Offset( localRow, col ); }
+template<typename T>
+Int DistSparseMatrix<T>::NumConnections( Int localRow ) const
+EL_NO_RELEASE_EXCEPT
+{ return distGraph_.NumConnections( localRow ); }
+
+template<typename T>
+double DistSparseMatrix<T>::Imbalance() const EL_NO_RELEASE_EXCEPT
+{ return distGraph_.Imbalance(); }
+
+template<typename T>
+Int* DistSparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
+{ return distGraph_.SourceBuffer(); }
+template<typename T>
+Int* DistSparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
+{ return distGraph_.TargetBuffer(); }
+template<typename T>
+Int* DistSparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
+{ return distGraph_.OffsetBuffer(); }
+template<typename T>
+T* DistSparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT { return vals_.data(); }
+
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return distGraph_.LockedSourceBuffer(); }
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return distGraph_.LockedTargetBuffer(); }
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return distGraph_.LockedOffsetBuffer(); }
+template<typename T>
+const T* DistSparseMatrix<T>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename T>
+void DistSparseMatrix<T>::ForceNumLocalEntries( Int numLocalEntries )
+{
+    EL_DEBUG_CSE
+    distGraph_.ForceNumLocalEdges( numLocalEntries );
+    vals_.resize( numLocalEntries );
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ distGraph_.ForceConsistency( consistent ); }
+
+template<typename T>
+void DistSparseMatrix<T>::AssertLocallyConsistent() const
+{
+    if( !distGraph_.LocallyConsistent() )
+        LogicError("DistSparseMatrix was not locally consistent");
+}
+
+template<typename T>
+const DistGraphMultMeta& DistSparseMatrix<T>::MultMeta() const
+{ return distGraph_.MultMeta(); }
+
+#define PROTO(T) template class DistSparseMatrix<T>;
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
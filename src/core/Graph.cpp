@@ -0,0 +1,356 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+Graph::Graph() { ComputeSourceOffsets(); }
+
+Graph::Graph( Int numSources )
+: Graph( numSources, numSources )
+{ }
+
+Graph::Graph( Int numSources, Int numTargets )
+: numSources_(numSources), numTargets_(numTargets)
+{ ComputeSourceOffsets(); }
+
+Graph::Graph( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    if( &graph != this )
+        *this = graph;
+    else
+        LogicError("Tried to construct a graph with itself");
+}
+
+Graph::Graph( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    *this = graph;
+}
+
+Graph::~Graph() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+const Graph& Graph::operator=( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    sources_ = graph.sources_;
+    targets_ = graph.targets_;
+    consistent_ = graph.consistent_;
+    sourceOffsets_ = graph.sourceOffsets_;
+    markedForRemoval_ = graph.markedForRemoval_;
+    return *this;
+}
+
+const Graph& Graph::operator=( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    if( graph.Grid().Size() != 1 )
+        LogicError("Cannot yet construct sequential graph from distributed");
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    sources_ = graph.sources_;
+    targets_ = graph.targets_;
+    consistent_ = graph.locallyConsistent_;
+    sourceOffsets_ = graph.localSourceOffsets_;
+    markedForRemoval_ = graph.markedForRemoval_;
+    return *this;
+}
+
+Graph Graph::operator()( Range<Int> I, Range<Int> J ) const
+{
+    EL_DEBUG_CSE
+    if( I.end == END )
+        I.end = numSources_;
+    if( J.end == END )
+        J.end = numTargets_;
+    EL_DEBUG_ONLY(AssertConsistent())
+    Graph subGraph( I.end-I.beg, J.end-J.beg );
+
+    // The edges of each source are sorted by target, so the subgraph can be
+    // copied directly in CSR order
+    Int numSubEdges = 0;
+    for( Int s=I.beg; s<I.end; ++s )
+    {
+        const Int offset = Offset( s, J.beg );
+        const Int offsetEnd = Offset( s, J.end );
+        numSubEdges += offsetEnd - offset;
+    }
+    subGraph.ForceNumEdges( numSubEdges );
+    Int subEdge = 0;
+    for( Int s=I.beg; s<I.end; ++s )
+    {
+        const Int offsetEnd = Offset( s, J.end );
+        for( Int e=Offset(s,J.beg); e<offsetEnd; ++e )
+        {
+            subGraph.sources_[subEdge] = s - I.beg;
+            subGraph.targets_[subEdge] = targets_[e] - J.beg;
+            ++subEdge;
+        }
+    }
+    subGraph.ForceConsistency();
+    return subGraph;
+}
+
+void Graph::Empty( bool clearMemory )
+{
+    EL_DEBUG_CSE
+    numSources_ = 0;
+    numTargets_ = 0;
+    if( clearMemory )
+    {
+        SwapClear( sources_ );
+        SwapClear( targets_ );
+        SwapClear( markedForRemoval_ );
+    }
+    else
+    {
+        sources_.resize( 0 );
+        targets_.resize( 0 );
+        markedForRemoval_.resize( 0 );
+    }
+    consistent_ = true;
+    ComputeSourceOffsets();
+}
+
+void Graph::Resize( Int numVertices )
+{ Resize( numVertices, numVertices ); }
+
+void Graph::Resize( Int numSources, Int numTargets )
+{
+    EL_DEBUG_CSE
+    if( numSources_ == numSources && numTargets_ == numTargets )
+        return;
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    sources_.resize( 0 );
+    targets_.resize( 0 );
+    markedForRemoval_.resize( 0 );
+    consistent_ = true;
+    ComputeSourceOffsets();
+}
+
+// Edge manipulation
+// -----------------
+
+void Graph::Reserve( Int numEdges )
+{
+    EL_DEBUG_CSE
+    sources_.reserve( numEdges );
+    targets_.reserve( numEdges );
+}
+
+void Graph::Connect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueConnection( source, target );
+    ProcessQueues();
+}
+
+void Graph::Disconnect( Int source, Int target )
+{
+    EL_DEBUG_CSE
+    QueueDisconnection( source, target );
+    ProcessQueues();
+}
+
+void Graph::QueueConnection( Int source, Int target )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source >= numSources_ )
+          LogicError
+          ("Source was out of bounds: ",source," is not in [0,",
+           numSources_,")");
+      if( target < 0 || target >= numTargets_ )
+          LogicError
+          ("Target was out of bounds: ",target," is not in [0,",
+           numTargets_,")");
+    )
+    if( sources_.size() == sources_.capacity() )
+        Reserve( Max(Int(1),2*Int(sources_.size())) );
+    sources_.push_back( source );
+    targets_.push_back( target );
+    consistent_ = false;
+}
+
+void Graph::QueueDisconnection( Int source, Int target )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    markedForRemoval_.push_back( std::pair<Int,Int>(source,target) );
+    consistent_ = false;
+}
+
+void Graph::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( consistent_ )
+        return;
+
+    // Sort the (source,target) pairs, remove duplicates, and then remove any
+    // edges which were marked for removal
+    const Int numQueued = sources_.size();
+    vector<std::pair<Int,Int>> pairs( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+        pairs[e] = std::pair<Int,Int>( sources_[e], targets_[e] );
+    std::sort( pairs.begin(), pairs.end() );
+    pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+    if( !markedForRemoval_.empty() )
+    {
+        std::sort( markedForRemoval_.begin(), markedForRemoval_.end() );
+        auto marked =
+          [&]( const std::pair<Int,Int>& pair )
+          { return std::binary_search
+                   ( markedForRemoval_.begin(), markedForRemoval_.end(),
+                     pair ); };
+        pairs.erase
+        ( std::remove_if( pairs.begin(), pairs.end(), marked ), pairs.end() );
+        SwapClear( markedForRemoval_ );
+    }
+
+    const Int numEdges = pairs.size();
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        sources_[e] = pairs[e].first;
+        targets_[e] = pairs[e].second;
+    }
+    ComputeSourceOffsets();
+    consistent_ = true;
+}
+
+// Queries
+// =======
+
+Int Graph::NumSources() const EL_NO_EXCEPT { return numSources_; }
+Int Graph::NumTargets() const EL_NO_EXCEPT { return numTargets_; }
+Int Graph::NumEdges() const EL_NO_EXCEPT { return sources_.size(); }
+Int Graph::Capacity() const EL_NO_EXCEPT { return sources_.capacity(); }
+bool Graph::Consistent() const EL_NO_EXCEPT { return consistent_; }
+
+Int Graph::Source( Int edge ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( edge < 0 || edge >= (Int)sources_.size() )
+          LogicError("Edge number out of bounds");
+    )
+    return sources_[edge];
+}
+
+Int Graph::Target( Int edge ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( edge < 0 || edge >= (Int)targets_.size() )
+          LogicError("Edge number out of bounds");
+    )
+    return targets_[edge];
+}
+
+Int Graph::SourceOffset( Int source ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( source < 0 || source > numSources_ )
+          LogicError
+          ("Source was out of bounds: ",source," is not in [0,",
+           numSources_,"]");
+      AssertConsistent();
+    )
+    return sourceOffsets_[source];
+}
+
+Int Graph::Offset( Int source, Int target ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int* begin = targets_.data() + SourceOffset(source);
+    const Int* end = targets_.data() + SourceOffset(source+1);
+    return std::lower_bound( begin, end, target ) - targets_.data();
+}
+
+Int Graph::NumConnections( Int source ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    return SourceOffset(source+1) - SourceOffset(source);
+}
+
+bool Graph::EdgeExists( Int source, Int target ) const
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int offset = Offset( source, target );
+    return offset < SourceOffset(source+1) && targets_[offset] == target;
+}
+
+Int* Graph::SourceBuffer() EL_NO_EXCEPT { return sources_.data(); }
+Int* Graph::TargetBuffer() EL_NO_EXCEPT { return targets_.data(); }
+Int* Graph::OffsetBuffer() EL_NO_EXCEPT { return sourceOffsets_.data(); }
+
+const Int* Graph::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return sources_.data(); }
+const Int* Graph::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return targets_.data(); }
+const Int* Graph::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return sourceOffsets_.data(); }
+
+void Graph::ForceNumEdges( Int numEdges )
+{
+    EL_DEBUG_CSE
+    sources_.resize( numEdges );
+    targets_.resize( numEdges );
+    consistent_ = false;
+}
+
+void Graph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{
+    consistent_ = consistent;
+    if( consistent )
+        ComputeSourceOffsets();
+}
+
+void Graph::AssertConsistent() const
+{
+    if( !consistent_ )
+        LogicError("Graph was not consistent; run ProcessQueues()");
+}
+
+void Graph::ComputeSourceOffsets()
+{
+    EL_DEBUG_CSE
+    const Int numEdges = sources_.size();
+    sourceOffsets_.resize( numSources_+1 );
+    Int source = 0;
+    sourceOffsets_[0] = 0;
+    for( Int e=0; e<numEdges; ++e )
+    {
+        while( source < sources_[e] )
+            sourceOffsets_[++source] = e;
+    }
+    while( source < numSources_ )
+        sourceOffsets_[++source] = numEdges;
+}
+
+} // namespace El
@@ -0,0 +1,354 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix() { }
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( Int height, Int width )
+: graph_(height,width)
+{ }
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( &A != this )
+        *this = A;
+    else
+        LogicError("Tried to construct sparse matrix with itself");
+}
+
+template<typename T>
+SparseMatrix<T>::~SparseMatrix() { }
+
+// Assignment and reconfiguration
+// ==============================
+
+template<typename T>
+const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    graph_ = A.graph_;
+    vals_ = A.vals_;
+    return *this;
+}
+
+template<typename T>
+SparseMatrix<T>
+SparseMatrix<T>::operator()( Range<Int> I, Range<Int> J ) const
+{
+    EL_DEBUG_CSE
+    if( I.end == END )
+        I.end = Height();
+    if( J.end == END )
+        J.end = Width();
+    EL_DEBUG_ONLY(AssertConsistent())
+    SparseMatrix<T> ASub( I.end-I.beg, J.end-J.beg );
+
+    // The entries of each row are sorted by column, so the submatrix can be
+    // copied directly in CSR order
+    Int numSubEntries = 0;
+    for( Int i=I.beg; i<I.end; ++i )
+        numSubEntries += Offset(i,J.end) - Offset(i,J.beg);
+    ASub.ForceNumEntries( numSubEntries );
+    Int subEntry = 0;
+    for( Int i=I.beg; i<I.end; ++i )
+    {
+        const Int offsetEnd = Offset( i, J.end );
+        for( Int e=Offset(i,J.beg); e<offsetEnd; ++e )
+        {
+            ASub.graph_.sources_[subEntry] = i - I.beg;
+            ASub.graph_.targets_[subEntry] = graph_.targets_[e] - J.beg;
+            ASub.vals_[subEntry] = vals_[e];
+            ++subEntry;
+        }
+    }
+    ASub.ForceConsistency();
+    return ASub;
+}
+
+template<typename T>
+void SparseMatrix<T>::Empty( bool clearMemory )
+{
+    EL_DEBUG_CSE
+    graph_.Empty( clearMemory );
+    if( clearMemory )
+        SwapClear( vals_ );
+    else
+        vals_.resize( 0 );
+}
+
+template<typename T>
+void SparseMatrix<T>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    if( Height() == height && Width() == width )
+        return;
+    graph_.Resize( height, width );
+    vals_.resize( 0 );
+}
+
+// Entry manipulation
+// ------------------
+
+template<typename T>
+void SparseMatrix<T>::Reserve( Int numEntries )
+{
+    EL_DEBUG_CSE
+    graph_.Reserve( numEntries );
+    vals_.reserve( numEntries );
+}
+
+template<typename T>
+void SparseMatrix<T>::Update( Int row, Int col, const T& value )
+{
+    EL_DEBUG_CSE
+    QueueUpdate( row, col, value );
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::Update( const Entry<T>& entry )
+{ Update( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+void SparseMatrix<T>::Zero( Int row, Int col )
+{
+    EL_DEBUG_CSE
+    QueueZero( row, col );
+    ProcessQueues();
+}
+
+template<typename T>
+void SparseMatrix<T>::QueueUpdate( Int row, Int col, const T& value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    if( NumEntries() == Capacity() )
+        Reserve( Max(Int(1),2*NumEntries()) );
+    graph_.QueueConnection( row, col );
+    vals_.push_back( value );
+}
+
+template<typename T>
+void SparseMatrix<T>::QueueUpdate( const Entry<T>& entry )
+EL_NO_RELEASE_EXCEPT
+{ QueueUpdate( entry.i, entry.j, entry.value ); }
+
+template<typename T>
+void SparseMatrix<T>::QueueZero( Int row, Int col )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    graph_.QueueDisconnection( row, col );
+}
+
+template<typename T>
+void SparseMatrix<T>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    if( graph_.consistent_ )
+        return;
+
+    // Sort the entries by (row,column) while keeping the queue order of the
+    // duplicates so that their sum is deterministic
+    const Int numQueued = vals_.size();
+    vector<Entry<T>> entries( numQueued );
+    for( Int e=0; e<numQueued; ++e )
+    {
+        entries[e].i = graph_.sources_[e];
+        entries[e].j = graph_.targets_[e];
+        entries[e].value = vals_[e];
+    }
+    std::stable_sort
+    ( entries.begin(), entries.end(),
+      []( const Entry<T>& a, const Entry<T>& b )
+      { return a.i < b.i || (a.i == b.i && a.j < b.j); } );
+
+    // Sum the duplicates
+    Int numEntries = 0;
+    for( Int e=0; e<numQueued; ++e )
+    {
+        if( numEntries > 0 &&
+            entries[numEntries-1].i == entries[e].i &&
+            entries[numEntries-1].j == entries[e].j )
+            entries[numEntries-1].value += entries[e].value;
+        else
+            entries[numEntries++] = entries[e];
+    }
+    entries.resize( numEntries );
+
+    // Remove the entries which were marked for removal
+    auto& marked = graph_.markedForRemoval_;
+    if( !marked.empty() )
+    {
+        std::sort( marked.begin(), marked.end() );
+        entries.erase
+        ( std::remove_if
+          ( entries.begin(), entries.end(),
+            [&]( const Entry<T>& entry )
+            { return std::binary_search
+                     ( marked.begin(), marked.end(),
+                       std::pair<Int,Int>(entry.i,entry.j) ); } ),
+          entries.end() );
+        SwapClear( marked );
+        numEntries = entries.size();
+    }
+
+    graph_.sources_.resize( numEntries );
+    graph_.targets_.resize( numEntries );
+    vals_.resize( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        graph_.sources_[e] = entries[e].i;
+        graph_.targets_[e] = entries[e].j;
+        vals_[e] = entries[e].value;
+    }
+    graph_.ComputeSourceOffsets();
+    graph_.consistent_ = true;
+}
+
+// Queries
+// =======
+
+template<typename T>
+Int SparseMatrix<T>::Height() const EL_NO_EXCEPT
+{ return graph_.NumSources(); }
+template<typename T>
+Int SparseMatrix<T>::Width() const EL_NO_EXCEPT
+{ return graph_.NumTargets(); }
+template<typename T>
+Int SparseMatrix<T>::NumEntries() const EL_NO_EXCEPT
+{ return graph_.NumEdges(); }
+template<typename T>
+Int SparseMatrix<T>::Capacity() const EL_NO_EXCEPT
+{ return graph_.Capacity(); }
+template<typename T>
+bool SparseMatrix<T>::Consistent() const EL_NO_EXCEPT
+{ return graph_.Consistent(); }
+
+template<typename T>
+El::Graph& SparseMatrix<T>::Graph() EL_NO_EXCEPT { return graph_; }
+template<typename T>
+const El::Graph& SparseMatrix<T>::LockedGraph() const EL_NO_EXCEPT
+{ return graph_; }
+
+template<typename T>
+T SparseMatrix<T>::Get( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int index = Offset( row, col );
+    if( index == RowOffset(row+1) || Col(index) != col )
+        return T(0);
+    return vals_[index];
+}
+
+template<typename T>
+void SparseMatrix<T>::Set( Int row, Int col, const T& value )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    const Int index = Offset( row, col );
+    if( index == RowOffset(row+1) || Col(index) != col )
+        LogicError
+        ("Entry (",row,",",col,") is not in the sparsity pattern");
+    vals_[index] = value;
+}
+
+template<typename T>
+Int SparseMatrix<T>::Row( Int index ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Source( index ); }
+
+template<typename T>
+Int SparseMatrix<T>::Col( Int index ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Target( index ); }
+
+template<typename T>
+T SparseMatrix<T>::Value( Int index ) const EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( index < 0 || index >= Int(vals_.size()) )
+          LogicError("Entry number out of bounds");
+    )
+    return vals_[index];
+}
+
+template<typename T>
+Int SparseMatrix<T>::RowOffset( Int row ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.SourceOffset( row ); }
+
+template<typename T>
+Int SparseMatrix<T>::Offset( Int row, Int col ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.Offset( row, col ); }
+
+template<typename T>
+Int SparseMatrix<T>::NumConnections( Int row ) const EL_NO_RELEASE_EXCEPT
+{ return graph_.NumConnections( row ); }
+
+template<typename T>
+Int* SparseMatrix<T>::SourceBuffer() EL_NO_EXCEPT
+{ return graph_.SourceBuffer(); }
+template<typename T>
+Int* SparseMatrix<T>::TargetBuffer() EL_NO_EXCEPT
+{ return graph_.TargetBuffer(); }
+template<typename T>
+Int* SparseMatrix<T>::OffsetBuffer() EL_NO_EXCEPT
+{ return graph_.OffsetBuffer(); }
+template<typename T>
+T* SparseMatrix<T>::ValueBuffer() EL_NO_EXCEPT { return vals_.data(); }
+
+template<typename T>
+const Int* SparseMatrix<T>::LockedSourceBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedSourceBuffer(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedTargetBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedTargetBuffer(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedOffsetBuffer() const EL_NO_EXCEPT
+{ return graph_.LockedOffsetBuffer(); }
+template<typename T>
+const T* SparseMatrix<T>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+template<typename T>
+void SparseMatrix<T>::ForceNumEntries( Int numEntries )
+{
+    EL_DEBUG_CSE
+    graph_.ForceNumEdges( numEntries );
+    vals_.resize( numEntries );
+}
+
+template<typename T>
+void SparseMatrix<T>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
+{ graph_.ForceConsistency( consistent ); }
+
+template<typename T>
+void SparseMatrix<T>::AssertConsistent() const
+{
+    if( !graph_.Consistent() )
+        LogicError("Sparse matrix was not consistent; run ProcessQueues()");
+}
+
+#define PROTO(T) template class SparseMatrix<T>;
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -12,6 +12,9 @@ using El::BlasInt;
 using El::scomplex;
 using El::dcomplex;
 
+// Vectorized double-double kernels
+#include "./blas/DoubleDouble.hpp"
+
 // Level 1
 #include "./blas/Axpy.hpp"
 #include "./blas/Copy.hpp"
@@ -32,6 +35,7 @@ using El::dcomplex;
 #include "./blas/Trsv.hpp"
 
 // Level 3
+#include "./blas/Recursion.hpp"
 #include "./blas/Gemm.hpp"
 #include "./blas/Symm.hpp"
 #include "./blas/Syrk.hpp"
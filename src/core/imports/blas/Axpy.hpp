@@ -130,5 +130,18 @@ void Axpy
         dcomplex* y, BlasInt incy )
 { EL_BLAS(zaxpy)( &n, &alpha, x, &incx, y, &incy ); }
 
+#ifdef HYDROGEN_HAVE_QD
+void Axpy
+( BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* x, BlasInt incx,
+        DoubleDouble* y, BlasInt incy )
+{
+    dd::Axpy
+    ( n, dd::Interleaved(&alpha),
+      dd::Interleaved(x), incx, dd::Interleaved(y), incy );
+}
+#endif
+
 } // namespace blas
 } // namespace El
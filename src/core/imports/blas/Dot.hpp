@@ -108,6 +108,19 @@ double Dot
   const double* y, BlasInt incy )
 { return EL_BLAS(ddot)( &n, x, &incx, y, &incy ); }
 
+#ifdef HYDROGEN_HAVE_QD
+DoubleDouble Dot
+( BlasInt n,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble* y, BlasInt incy )
+{
+    double sumHi, sumLo;
+    dd::Dot
+    ( n, dd::Interleaved(x), incx, dd::Interleaved(y), incy, sumHi, sumLo );
+    return dd_real(sumHi,sumLo);
+}
+#endif
+
 template<typename T>
 T Dotu
 ( BlasInt n,
@@ -0,0 +1,716 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Inlineable kernels for double-double arithmetic built from the error-free
+// transformations of Dekker and Knuth. QD's dd_real stores each value as an
+// adjacent (hi,lo) pair and performs every operation through an out-of-line
+// call, so the kernels below instead split the operands into separate 'hi'
+// and 'lo' arrays (a structure-of-arrays layout) so that each step of an
+// addition or multiplication is applied to a full SIMD register.
+//
+// The kernels only depend upon IEEE double-precision arithmetic (they must
+// not be compiled with -ffast-math or any other value-unsafe optimization),
+// and the drivers at the bottom of this file accept arrays of interleaved
+// (hi,lo) pairs, which is the memory layout of QD's dd_real.
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
+
+namespace El {
+namespace blas {
+namespace dd {
+
+// Packs of double-precision values
+// ================================
+// PackTraits<w> describes a SIMD register holding w doubles
+template<BlasInt w> struct PackTraits;
+
+template<>
+struct PackTraits<1>
+{
+    typedef double Type;
+    static const BlasInt width = 1;
+    static double Load( const double* p ) { return *p; }
+    static void Store( double* p, double a ) { *p = a; }
+    static double Broadcast( double a ) { return a; }
+};
+inline double Add( double a, double b ) { return a+b; }
+inline double Sub( double a, double b ) { return a-b; }
+inline double Mul( double a, double b ) { return a*b; }
+// a*b-c with a single rounding
+inline double FusedMultiplySub( double a, double b, double c )
+{ return std::fma(a,b,-c); }
+
+#if defined(__AVX512F__)
+template<>
+struct PackTraits<8>
+{
+    typedef __m512d Type;
+    static const BlasInt width = 8;
+    static __m512d Load( const double* p ) { return _mm512_loadu_pd(p); }
+    static void Store( double* p, __m512d a ) { _mm512_storeu_pd(p,a); }
+    static __m512d Broadcast( double a ) { return _mm512_set1_pd(a); }
+};
+inline __m512d Add( __m512d a, __m512d b ) { return _mm512_add_pd(a,b); }
+inline __m512d Sub( __m512d a, __m512d b ) { return _mm512_sub_pd(a,b); }
+inline __m512d Mul( __m512d a, __m512d b ) { return _mm512_mul_pd(a,b); }
+inline __m512d FusedMultiplySub( __m512d a, __m512d b, __m512d c )
+{ return _mm512_fmsub_pd(a,b,c); }
+
+const BlasInt packWidth = 8;
+#elif defined(__AVX2__) && defined(__FMA__)
+template<>
+struct PackTraits<4>
+{
+    typedef __m256d Type;
+    static const BlasInt width = 4;
+    static __m256d Load( const double* p ) { return _mm256_loadu_pd(p); }
+    static void Store( double* p, __m256d a ) { _mm256_storeu_pd(p,a); }
+    static __m256d Broadcast( double a ) { return _mm256_set1_pd(a); }
+};
+inline __m256d Add( __m256d a, __m256d b ) { return _mm256_add_pd(a,b); }
+inline __m256d Sub( __m256d a, __m256d b ) { return _mm256_sub_pd(a,b); }
+inline __m256d Mul( __m256d a, __m256d b ) { return _mm256_mul_pd(a,b); }
+inline __m256d FusedMultiplySub( __m256d a, __m256d b, __m256d c )
+{ return _mm256_fmsub_pd(a,b,c); }
+
+const BlasInt packWidth = 4;
+#else
+const BlasInt packWidth = 1;
+#endif
+
+// Error-free transformations
+// ==========================
+
+// s + e = a + b exactly, where s = fl(a+b)
+template<typename V>
+inline void TwoSum( V a, V b, V& s, V& e )
+{
+    s = Add(a,b);
+    const V bVirtual = Sub(s,a);
+    e = Add( Sub(a,Sub(s,bVirtual)), Sub(b,bVirtual) );
+}
+
+// s + e = a + b exactly, assuming that |a| >= |b|
+template<typename V>
+inline void QuickTwoSum( V a, V b, V& s, V& e )
+{
+    s = Add(a,b);
+    e = Sub(b,Sub(s,a));
+}
+
+// p + e = a b exactly, where p = fl(a b)
+template<typename V>
+inline void TwoProd( V a, V b, V& p, V& e )
+{
+    p = Mul(a,b);
+    e = FusedMultiplySub(a,b,p);
+}
+
+#ifndef FP_FAST_FMA
+// aHi + aLo = a exactly, where aHi and aLo have at most 26 significant bits.
+// Values above 2^996 are first scaled down by 2^-28 (as in QD) so that the
+// product with the splitter cannot overflow.
+inline void DekkerSplit( double a, double& aHi, double& aLo )
+{
+    const double splitter = 134217729.; // 2^27+1
+    const double threshold = 6.69692879491417e+299; // 2^996
+    if( std::abs(a) > threshold )
+    {
+        a *= 3.7252902984619140625e-09; // 2^-28
+        const double t = splitter*a;
+        aHi = (t - (t-a))*268435456.; // 2^28
+        aLo = (a - (t - (t-a)))*268435456.;
+    }
+    else
+    {
+        const double t = splitter*a;
+        aHi = t - (t-a);
+        aLo = a - aHi;
+    }
+}
+
+// Without a hardware FMA, std::fma is emulated in software, and Dekker's
+// splitting into 26-bit halves is much faster
+inline void TwoProd( double a, double b, double& p, double& e )
+{
+    double aHi, aLo, bHi, bLo;
+    DekkerSplit( a, aHi, aLo );
+    DekkerSplit( b, bHi, bLo );
+    p = a*b;
+    e = ((aHi*bHi-p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+}
+#endif
+
+// Double-double arithmetic
+// ========================
+
+// (zHi,zLo) := (aHi,aLo) + (bHi,bLo) using the accurate ("IEEE") addition,
+// which, unlike the cheaper variant, retains full precision under
+// cancellation
+template<typename V>
+inline void Add( V aHi, V aLo, V bHi, V bLo, V& zHi, V& zLo )
+{
+    V sHi, sLo, tHi, tLo;
+    TwoSum( aHi, bHi, sHi, sLo );
+    TwoSum( aLo, bLo, tHi, tLo );
+    sLo = Add( sLo, tHi );
+    QuickTwoSum( sHi, sLo, sHi, sLo );
+    sLo = Add( sLo, tLo );
+    QuickTwoSum( sHi, sLo, zHi, zLo );
+}
+
+// (zHi,zLo) := (aHi,aLo) (bHi,bLo)
+template<typename V>
+inline void Mul( V aHi, V aLo, V bHi, V bLo, V& zHi, V& zLo )
+{
+    V p, e;
+    TwoProd( aHi, bHi, p, e );
+    e = Add( e, Add( Mul(aHi,bLo), Mul(aLo,bHi) ) );
+    QuickTwoSum( p, e, zHi, zLo );
+}
+
+// (zHi,zLo) := (zHi,zLo) + (aHi,aLo) (bHi,bLo)
+template<typename V>
+inline void MulAdd( V aHi, V aLo, V bHi, V bLo, V& zHi, V& zLo )
+{
+    V pHi, pLo;
+    Mul( aHi, aLo, bHi, bLo, pHi, pLo );
+    Add( zHi, zLo, pHi, pLo, zHi, zLo );
+}
+
+// Structure-of-arrays kernels
+// ===========================
+// Each kernel handles as many entries as fit within whole packs of width w and
+// returns the number of entries handled so that the scalar (w=1) instantiation
+// can finish the remainder.
+
+template<BlasInt w>
+inline BlasInt AxpyPacks
+( BlasInt n, double alphaHi, double alphaLo,
+  const double* EL_RESTRICT xHi, const double* EL_RESTRICT xLo,
+        double* EL_RESTRICT yHi,       double* EL_RESTRICT yLo )
+{
+    typedef PackTraits<w> Traits;
+    typedef typename Traits::Type V;
+    const V aHi = Traits::Broadcast( alphaHi );
+    const V aLo = Traits::Broadcast( alphaLo );
+    BlasInt i=0;
+    for( ; i+w<=n; i+=w )
+    {
+        V zHi = Traits::Load( &yHi[i] );
+        V zLo = Traits::Load( &yLo[i] );
+        MulAdd
+        ( aHi, aLo, Traits::Load(&xHi[i]), Traits::Load(&xLo[i]), zHi, zLo );
+        Traits::Store( &yHi[i], zHi );
+        Traits::Store( &yLo[i], zLo );
+    }
+    return i;
+}
+
+template<BlasInt w>
+inline BlasInt UpdatePacks
+( BlasInt n,
+  const double* EL_RESTRICT xHi, const double* EL_RESTRICT xLo,
+        double* EL_RESTRICT yHi,       double* EL_RESTRICT yLo )
+{
+    typedef PackTraits<w> Traits;
+    typedef typename Traits::Type V;
+    BlasInt i=0;
+    for( ; i+w<=n; i+=w )
+    {
+        V zHi, zLo;
+        Add
+        ( Traits::Load(&yHi[i]), Traits::Load(&yLo[i]),
+          Traits::Load(&xHi[i]), Traits::Load(&xLo[i]), zHi, zLo );
+        Traits::Store( &yHi[i], zHi );
+        Traits::Store( &yLo[i], zLo );
+    }
+    return i;
+}
+
+// Sum the lanes of a pack of double-doubles into (sumHi,sumLo)
+template<BlasInt w>
+inline void AccumulateLanes
+( typename PackTraits<w>::Type aHi, typename PackTraits<w>::Type aLo,
+  double& sumHi, double& sumLo )
+{
+    typedef PackTraits<w> Traits;
+    double hi[w], lo[w];
+    Traits::Store( hi, aHi );
+    Traits::Store( lo, aLo );
+    for( BlasInt l=0; l<w; ++l )
+        Add( sumHi, sumLo, hi[l], lo[l], sumHi, sumLo );
+}
+
+// (sumHi,sumLo) := (sumHi,sumLo) + x^T y
+template<BlasInt w>
+inline BlasInt DotPacks
+( BlasInt n,
+  const double* EL_RESTRICT xHi, const double* EL_RESTRICT xLo,
+  const double* EL_RESTRICT yHi, const double* EL_RESTRICT yLo,
+  double& sumHi, double& sumLo )
+{
+    typedef PackTraits<w> Traits;
+    typedef typename Traits::Type V;
+    // Two independent accumulators hide the latency of the addition chain
+    V zHi0 = Traits::Broadcast(0), zLo0 = Traits::Broadcast(0),
+      zHi1 = Traits::Broadcast(0), zLo1 = Traits::Broadcast(0);
+    BlasInt i=0;
+    for( ; i+2*w<=n; i+=2*w )
+    {
+        MulAdd
+        ( Traits::Load(&xHi[i]), Traits::Load(&xLo[i]),
+          Traits::Load(&yHi[i]), Traits::Load(&yLo[i]), zHi0, zLo0 );
+        MulAdd
+        ( Traits::Load(&xHi[i+w]), Traits::Load(&xLo[i+w]),
+          Traits::Load(&yHi[i+w]), Traits::Load(&yLo[i+w]), zHi1, zLo1 );
+    }
+    for( ; i+w<=n; i+=w )
+        MulAdd
+        ( Traits::Load(&xHi[i]), Traits::Load(&xLo[i]),
+          Traits::Load(&yHi[i]), Traits::Load(&yLo[i]), zHi0, zLo0 );
+    Add( zHi0, zLo0, zHi1, zLo1, zHi0, zLo0 );
+    AccumulateLanes<w>( zHi0, zLo0, sumHi, sumLo );
+    return i;
+}
+
+// (sumHi,sumLo) := (sumHi,sumLo) + || scale x ||_2^2, where 'scale' must be a
+// power of two so that the scaling is exact
+template<BlasInt w>
+inline BlasInt SumOfSquaresPacks
+( BlasInt n, double scale,
+  const double* EL_RESTRICT xHi, const double* EL_RESTRICT xLo,
+  double& sumHi, double& sumLo )
+{
+    typedef PackTraits<w> Traits;
+    typedef typename Traits::Type V;
+    const V s = Traits::Broadcast( scale );
+    V zHi = Traits::Broadcast(0), zLo = Traits::Broadcast(0);
+    BlasInt i=0;
+    for( ; i+w<=n; i+=w )
+    {
+        const V aHi = Mul( s, Traits::Load(&xHi[i]) );
+        const V aLo = Mul( s, Traits::Load(&xLo[i]) );
+        MulAdd( aHi, aLo, aHi, aLo, zHi, zLo );
+    }
+    AccumulateLanes<w>( zHi, zLo, sumHi, sumLo );
+    return i;
+}
+
+// y := y + alpha x
+inline void Axpy
+( BlasInt n, double alphaHi, double alphaLo,
+  const double* xHi, const double* xLo,
+        double* yHi,       double* yLo )
+{
+    const BlasInt i =
+      AxpyPacks<packWidth>( n, alphaHi, alphaLo, xHi, xLo, yHi, yLo );
+    AxpyPacks<1>
+    ( n-i, alphaHi, alphaLo, &xHi[i], &xLo[i], &yHi[i], &yLo[i] );
+}
+
+// y := y + x
+inline void Update
+( BlasInt n,
+  const double* xHi, const double* xLo,
+        double* yHi,       double* yLo )
+{
+    const BlasInt i = UpdatePacks<packWidth>( n, xHi, xLo, yHi, yLo );
+    UpdatePacks<1>( n-i, &xHi[i], &xLo[i], &yHi[i], &yLo[i] );
+}
+
+// (sumHi,sumLo) := (sumHi,sumLo) + x^T y
+inline void Dot
+( BlasInt n,
+  const double* xHi, const double* xLo,
+  const double* yHi, const double* yLo,
+  double& sumHi, double& sumLo )
+{
+    const BlasInt i =
+      DotPacks<packWidth>( n, xHi, xLo, yHi, yLo, sumHi, sumLo );
+    DotPacks<1>
+    ( n-i, &xHi[i], &xLo[i], &yHi[i], &yLo[i], sumHi, sumLo );
+}
+
+// (sumHi,sumLo) := (sumHi,sumLo) + || scale x ||_2^2
+inline void SumOfSquares
+( BlasInt n, double scale,
+  const double* xHi, const double* xLo,
+  double& sumHi, double& sumLo )
+{
+    const BlasInt i =
+      SumOfSquaresPacks<packWidth>( n, scale, xHi, xLo, sumHi, sumLo );
+    SumOfSquaresPacks<1>( n-i, scale, &xHi[i], &xLo[i], sumHi, sumLo );
+}
+
+// GEMM micro-kernel
+// -----------------
+// The register block of C is 'mr' x 'nr', where 'mr' is the width of a pack.
+const BlasInt nr = 4;
+const BlasInt mr = packWidth;
+
+// C := A B, where A is an 'mr' x k row panel stored so that each of its columns
+// is contiguous, B is a k x 'nr' column panel stored so that each of its rows
+// is contiguous, and C is an 'mr' x 'nr' column-major tile
+inline void GemmMicroKernel
+( BlasInt k,
+  const double* EL_RESTRICT AHi, const double* EL_RESTRICT ALo,
+  const double* EL_RESTRICT BHi, const double* EL_RESTRICT BLo,
+        double* EL_RESTRICT CHi,       double* EL_RESTRICT CLo )
+{
+    typedef PackTraits<packWidth> Traits;
+    typedef Traits::Type V;
+    V cHi[nr], cLo[nr];
+    for( BlasInt j=0; j<nr; ++j )
+    {
+        cHi[j] = Traits::Broadcast(0);
+        cLo[j] = Traits::Broadcast(0);
+    }
+    for( BlasInt l=0; l<k; ++l )
+    {
+        const V aHi = Traits::Load( &AHi[l*mr] );
+        const V aLo = Traits::Load( &ALo[l*mr] );
+        for( BlasInt j=0; j<nr; ++j )
+            MulAdd
+            ( aHi, aLo,
+              Traits::Broadcast(BHi[l*nr+j]), Traits::Broadcast(BLo[l*nr+j]),
+              cHi[j], cLo[j] );
+    }
+    for( BlasInt j=0; j<nr; ++j )
+    {
+        Traits::Store( &CHi[j*mr], cHi[j] );
+        Traits::Store( &CLo[j*mr], cLo[j] );
+    }
+}
+
+// Drivers for interleaved (hi,lo) pairs
+// =====================================
+// The vectors and matrices below are arrays of double-doubles stored as
+// adjacent (hi,lo) pairs, and all strides are in units of double-doubles.
+// Vector operands are split into structure-of-arrays form one block at a time.
+// As in the BLAS, a vector with a negative stride is traversed backwards from
+// the last of its entries in memory.
+
+const BlasInt blockSize = 256;
+
+// Return the address of the first entry of a vector of length n with the
+// given stride, which is the lowest address unless the stride is negative
+inline const double* VectorStart( BlasInt n, const double* x, BlasInt incx )
+{ return ( incx < 0 && n > 0 ) ? x - 2*(n-1)*incx : x; }
+inline double* VectorStart( BlasInt n, double* x, BlasInt incx )
+{ return ( incx < 0 && n > 0 ) ? x - 2*(n-1)*incx : x; }
+
+inline void Split
+( BlasInt n, const double* x, BlasInt incx, double* xHi, double* xLo )
+{
+    for( BlasInt i=0; i<n; ++i )
+    {
+        xHi[i] = x[2*i*incx];
+        xLo[i] = x[2*i*incx+1];
+    }
+}
+
+inline void Merge
+( BlasInt n, const double* xHi, const double* xLo, double* x, BlasInt incx )
+{
+    for( BlasInt i=0; i<n; ++i )
+    {
+        x[2*i*incx] = xHi[i];
+        x[2*i*incx+1] = xLo[i];
+    }
+}
+
+// y := beta y, with y set to zero when beta is zero (as in the BLAS); y must
+// already point to the first entry of the vector
+inline void Scale( BlasInt n, const double* beta, double* y, BlasInt incy )
+{
+    if( beta[0] == 1 && beta[1] == 0 )
+        return;
+    for( BlasInt i=0; i<n; ++i )
+    {
+        double* eta = &y[2*i*incy];
+        if( beta[0] == 0 && beta[1] == 0 )
+            eta[0] = eta[1] = 0;
+        else
+            Mul( beta[0], beta[1], eta[0], eta[1], eta[0], eta[1] );
+    }
+}
+
+// y := y + alpha x
+inline void Axpy
+( BlasInt n, const double* alpha,
+  const double* x, BlasInt incx,
+        double* y, BlasInt incy )
+{
+    x = VectorStart( n, x, incx );
+    y = VectorStart( n, y, incy );
+    double xHi[blockSize], xLo[blockSize], yHi[blockSize], yLo[blockSize];
+    for( BlasInt i=0; i<n; i+=blockSize )
+    {
+        const BlasInt b = Min(blockSize,n-i);
+        Split( b, &x[2*i*incx], incx, xHi, xLo );
+        Split( b, &y[2*i*incy], incy, yHi, yLo );
+        Axpy( b, alpha[0], alpha[1], xHi, xLo, yHi, yLo );
+        Merge( b, yHi, yLo, &y[2*i*incy], incy );
+    }
+}
+
+// y := y + x
+inline void Update
+( BlasInt n, const double* x, BlasInt incx, double* y, BlasInt incy )
+{
+    x = VectorStart( n, x, incx );
+    y = VectorStart( n, y, incy );
+    double xHi[blockSize], xLo[blockSize], yHi[blockSize], yLo[blockSize];
+    for( BlasInt i=0; i<n; i+=blockSize )
+    {
+        const BlasInt b = Min(blockSize,n-i);
+        Split( b, &x[2*i*incx], incx, xHi, xLo );
+        Split( b, &y[2*i*incy], incy, yHi, yLo );
+        Update( b, xHi, xLo, yHi, yLo );
+        Merge( b, yHi, yLo, &y[2*i*incy], incy );
+    }
+}
+
+// (sumHi,sumLo) := x^T y
+inline void Dot
+( BlasInt n,
+  const double* x, BlasInt incx,
+  const double* y, BlasInt incy,
+  double& sumHi, double& sumLo )
+{
+    x = VectorStart( n, x, incx );
+    y = VectorStart( n, y, incy );
+    double xHi[blockSize], xLo[blockSize], yHi[blockSize], yLo[blockSize];
+    sumHi = sumLo = 0;
+    for( BlasInt i=0; i<n; i+=blockSize )
+    {
+        const BlasInt b = Min(blockSize,n-i);
+        Split( b, &x[2*i*incx], incx, xHi, xLo );
+        Split( b, &y[2*i*incy], incy, yHi, yLo );
+        Dot( b, xHi, xLo, yHi, yLo, sumHi, sumLo );
+    }
+}
+
+// || x ||_2^2 = 2^(2 exponent) (sumHi,sumLo), where the scaling by a power of
+// two avoids overflow and underflow without introducing any rounding error.
+// If x is zero or contains an infinity or NaN, then 'exponent' is zero and
+// (sumHi,sumLo) = (max_i |x_i|^2,0).
+inline void ScaledSumOfSquares
+( BlasInt n, const double* x, BlasInt incx,
+  double& sumHi, double& sumLo, int& exponent )
+{
+    x = VectorStart( n, x, incx );
+    double maxAbs = 0;
+    for( BlasInt i=0; i<n; ++i )
+    {
+        const double alphaAbs = std::abs(x[2*i*incx]);
+        if( !(alphaAbs <= maxAbs) )
+            maxAbs = alphaAbs;
+    }
+    exponent = 0;
+    sumLo = 0;
+    if( maxAbs == 0 || !std::isfinite(maxAbs) )
+    {
+        sumHi = maxAbs*maxAbs;
+        return;
+    }
+    std::frexp( maxAbs, &exponent );
+    const double scale = std::ldexp( 1., -exponent );
+
+    double xHi[blockSize], xLo[blockSize];
+    sumHi = 0;
+    for( BlasInt i=0; i<n; i+=blockSize )
+    {
+        const BlasInt b = Min(blockSize,n-i);
+        Split( b, &x[2*i*incx], incx, xHi, xLo );
+        SumOfSquares( b, scale, xHi, xLo, sumHi, sumLo );
+    }
+}
+
+// y := alpha op(A) x + beta y, where op(A) is either A or A^T
+inline void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const double* alpha,
+  const double* A, BlasInt ALDim,
+  const double* x, BlasInt incx,
+  const double* beta,
+        double* y, BlasInt incy )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    x = VectorStart( normal ? n : m, x, incx );
+    y = VectorStart( normal ? m : n, y, incy );
+    double AHi[blockSize], ALo[blockSize], yHi[blockSize], yLo[blockSize];
+    if( normal )
+    {
+        Scale( m, beta, y, incy );
+        // Each block of y is kept in SoA form while the corresponding rows of
+        // A are swept from left to right
+        for( BlasInt i=0; i<m; i+=blockSize )
+        {
+            const BlasInt b = Min(blockSize,m-i);
+            Split( b, &y[2*i*incy], incy, yHi, yLo );
+            for( BlasInt j=0; j<n; ++j )
+            {
+                double gammaHi, gammaLo;
+                Mul
+                ( alpha[0], alpha[1], x[2*j*incx], x[2*j*incx+1],
+                  gammaHi, gammaLo );
+                Split( b, &A[2*(i+j*ALDim)], 1, AHi, ALo );
+                Axpy( b, gammaHi, gammaLo, AHi, ALo, yHi, yLo );
+            }
+            Merge( b, yHi, yLo, &y[2*i*incy], incy );
+        }
+    }
+    else
+    {
+        Scale( n, beta, y, incy );
+        // Split x once so that each column of A is only split once
+        vector<double> xHi(m), xLo(m);
+        Split( m, x, incx, xHi.data(), xLo.data() );
+        for( BlasInt j=0; j<n; ++j )
+        {
+            double sumHi=0, sumLo=0;
+            for( BlasInt i=0; i<m; i+=blockSize )
+            {
+                const BlasInt b = Min(blockSize,m-i);
+                Split( b, &A[2*(i+j*ALDim)], 1, AHi, ALo );
+                Dot( b, AHi, ALo, &xHi[i], &xLo[i], sumHi, sumLo );
+            }
+            double* eta = &y[2*j*incy];
+            MulAdd( alpha[0], alpha[1], sumHi, sumLo, eta[0], eta[1] );
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + beta C, where op(A) and op(B) are either the
+// original matrices or their transposes. The operands are packed into
+// structure-of-arrays panels for the micro-kernel, with alpha absorbed into
+// the packed copy of op(B), and, with EL_HYBRID, the row blocks of C are
+// distributed over the threads.
+const BlasInt gemmMC = 64;
+const BlasInt gemmKC = 128;
+const BlasInt gemmNC = 512;
+
+inline void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const double* alpha,
+  const double* A, BlasInt ALDim,
+  const double* B, BlasInt BLDim,
+  const double* beta,
+        double* C, BlasInt CLDim )
+{
+    for( BlasInt j=0; j<n; ++j )
+        Scale( m, beta, &C[2*j*CLDim], 1 );
+    if( k == 0 || (alpha[0] == 0 && alpha[1] == 0) )
+        return;
+
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const BlasInt numRowBlocks = (m+gemmMC-1)/gemmMC;
+    vector<double> BPackHi, BPackLo;
+    for( BlasInt jc=0; jc<n; jc+=gemmNC )
+    {
+        const BlasInt nc = Min(gemmNC,n-jc);
+        const BlasInt numColPanels = (nc+nr-1)/nr;
+        for( BlasInt pc=0; pc<k; pc+=gemmKC )
+        {
+            const BlasInt kc = Min(gemmKC,k-pc);
+
+            // Pack alpha op(B)(pc:pc+kc-1,jc:jc+nc-1) into 'nr'-wide panels
+            BPackHi.assign( numColPanels*kc*nr, 0 );
+            BPackLo.assign( numColPanels*kc*nr, 0 );
+            for( BlasInt jj=0; jj<nc; ++jj )
+            {
+                double* bHi = &BPackHi[(jj/nr)*kc*nr+jj%nr];
+                double* bLo = &BPackLo[(jj/nr)*kc*nr+jj%nr];
+                for( BlasInt l=0; l<kc; ++l )
+                {
+                    const double* entry = ( normalB ?
+                      &B[2*((pc+l)+(jc+jj)*BLDim)] :
+                      &B[2*((jc+jj)+(pc+l)*BLDim)] );
+                    Mul
+                    ( alpha[0], alpha[1], entry[0], entry[1],
+                      bHi[l*nr], bLo[l*nr] );
+                }
+            }
+
+#ifdef EL_HYBRID
+            const bool parallel = numRowBlocks > 1 && !omp_in_parallel();
+            #pragma omp parallel for if(parallel)
+#endif
+            for( BlasInt rowBlock=0; rowBlock<numRowBlocks; ++rowBlock )
+            {
+                const BlasInt ic = rowBlock*gemmMC;
+                const BlasInt mc = Min(gemmMC,m-ic);
+                const BlasInt numRowPanels = (mc+mr-1)/mr;
+
+                // Pack op(A)(ic:ic+mc-1,pc:pc+kc-1) into 'mr'-tall panels
+                vector<double> APackHi( numRowPanels*kc*mr, 0 ),
+                               APackLo( numRowPanels*kc*mr, 0 );
+                for( BlasInt l=0; l<kc; ++l )
+                {
+                    for( BlasInt ii=0; ii<mc; ++ii )
+                    {
+                        const double* entry = ( normalA ?
+                          &A[2*((ic+ii)+(pc+l)*ALDim)] :
+                          &A[2*((pc+l)+(ic+ii)*ALDim)] );
+                        const BlasInt offset = (ii/mr)*kc*mr + l*mr + ii%mr;
+                        APackHi[offset] = entry[0];
+                        APackLo[offset] = entry[1];
+                    }
+                }
+
+                double tileHi[mr*nr], tileLo[mr*nr];
+                for( BlasInt q=0; q<numColPanels; ++q )
+                {
+                    const BlasInt nTile = Min(nr,nc-q*nr);
+                    for( BlasInt p=0; p<numRowPanels; ++p )
+                    {
+                        const BlasInt mTile = Min(mr,mc-p*mr);
+                        GemmMicroKernel
+                        ( kc,
+                          &APackHi[p*kc*mr], &APackLo[p*kc*mr],
+                          &BPackHi[q*kc*nr], &BPackLo[q*kc*nr],
+                          tileHi, tileLo );
+                        for( BlasInt jj=0; jj<nTile; ++jj )
+                        {
+                            double* c =
+                              &C[2*((ic+p*mr)+(jc+q*nr+jj)*CLDim)];
+                            for( BlasInt ii=0; ii<mTile; ++ii )
+                                Add
+                                ( c[2*ii], c[2*ii+1],
+                                  tileHi[ii+jj*mr], tileLo[ii+jj*mr],
+                                  c[2*ii], c[2*ii+1] );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+#ifdef HYDROGEN_HAVE_QD
+// DoubleDouble adds no members to dd_real, whose (hi,lo) pair is the array 'x'
+static_assert
+( sizeof(DoubleDouble) == 2*sizeof(double),
+  "DoubleDouble must consist of exactly two doubles" );
+
+inline const double* Interleaved( const DoubleDouble* x )
+{ return reinterpret_cast<const double*>(x); }
+inline double* Interleaved( DoubleDouble* x )
+{ return reinterpret_cast<double*>(x); }
+#endif
+
+} // namespace dd
+} // namespace blas
+} // namespace El
@@ -43,6 +43,7 @@ void EL_BLAS(zgemm)
 
 namespace El {
 namespace blas {
+namespace unblocked {
 
 template<typename T>
 void Gemm
@@ -80,59 +81,68 @@ void Gemm
 
     // Naive implementation
     T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
+    if( std::toupper(transA) == 'N' )
     {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
+        // C := alpha A op(B) + C, where four columns of C are updated during
+        // each sweep over a column of A so that A is streamed n/4 times
+        const bool normalB = ( std::toupper(transB) == 'N' );
+        const bool conjB = ( std::toupper(transB) == 'C' );
+        auto loadB = [&]( BlasInt l, BlasInt j, T& entry )
         {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
-            }
-        }
-    }
-    else if( std::toupper(transA) == 'N' )
-    {
-        if( std::toupper(transB) == 'T' )
+            if( normalB )
+                entry = B[l+j*BLDim];
+            else if( conjB )
+                Conj( B[j+l*BLDim], entry );
+            else
+                entry = B[j+l*BLDim];
+            entry *= alpha;
+        };
+
+        BlasInt j=0;
+        if( n >= 4 )
         {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
+            T gamma1, gamma2, gamma3;
+            for( ; j+4<=n; j+=4 )
             {
+                T* EL_RESTRICT c0 = &C[ j   *CLDim];
+                T* EL_RESTRICT c1 = &C[(j+1)*CLDim];
+                T* EL_RESTRICT c2 = &C[(j+2)*CLDim];
+                T* EL_RESTRICT c3 = &C[(j+3)*CLDim];
                 for( BlasInt l=0; l<k; ++l )
                 {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
+                    loadB( l, j,   gamma  );
+                    loadB( l, j+1, gamma1 );
+                    loadB( l, j+2, gamma2 );
+                    loadB( l, j+3, gamma3 );
+                    const T* EL_RESTRICT a = &A[l*ALDim];
                     for( BlasInt i=0; i<m; ++i )
                     {
-                        delta = A[i+l*ALDim];
+                        delta = a[i];
                         delta *= gamma;
-                        C[i+j*CLDim] += delta;
+                        c0[i] += delta;
+                        delta = a[i];
+                        delta *= gamma1;
+                        c1[i] += delta;
+                        delta = a[i];
+                        delta *= gamma2;
+                        c2[i] += delta;
+                        delta = a[i];
+                        delta *= gamma3;
+                        c3[i] += delta;
                     }
                 }
             }
         }
-        else
+        for( ; j<n; ++j )
         {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
+            for( BlasInt l=0; l<k; ++l )
             {
-                for( BlasInt l=0; l<k; ++l )
+                loadB( l, j, gamma );
+                for( BlasInt i=0; i<m; ++i )
                 {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
+                    delta = A[i+l*ALDim];
+                    delta *= gamma;
+                    C[i+j*CLDim] += delta;
                 }
             }
         }
@@ -260,6 +270,123 @@ void Gemm
         }
     }
 }
+
+} // namespace unblocked
+
+namespace recursion {
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    if( m <= leafSize && n <= leafSize && k <= leafSize )
+    {
+        unblocked::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, T(1), C, CLDim );
+        return;
+    }
+
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const bool spawn = SpawnTask<T>( double(m)*n*k );
+    if( m >= n && m >= k )
+    {
+        // Split the rows of op(A) and C
+        const BlasInt m1 = m/2;
+        const T* A2 = ( normalA ? &A[m1] : &A[m1*ALDim] );
+#ifdef EL_HYBRID
+        #pragma omp task if(spawn) default(shared)
+#endif
+        Gemm( transA, transB, m1, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+        Gemm
+        ( transA, transB, m-m1, n, k,
+          alpha, A2, ALDim, B, BLDim, &C[m1], CLDim );
+#ifdef EL_HYBRID
+        #pragma omp taskwait
+#endif
+    }
+    else if( n >= k )
+    {
+        // Split the columns of op(B) and C
+        const BlasInt n1 = n/2;
+        const T* B2 = ( normalB ? &B[n1*BLDim] : &B[n1] );
+#ifdef EL_HYBRID
+        #pragma omp task if(spawn) default(shared)
+#endif
+        Gemm( transA, transB, m, n1, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+        Gemm
+        ( transA, transB, m, n-n1, k,
+          alpha, A, ALDim, B2, BLDim, &C[n1*CLDim], CLDim );
+#ifdef EL_HYBRID
+        #pragma omp taskwait
+#endif
+    }
+    else
+    {
+        // Split the inner dimension; both halves update all of C
+        const BlasInt k1 = k/2;
+        const T* A2 = ( normalA ? &A[k1*ALDim] : &A[k1] );
+        const T* B2 = ( normalB ? &B[k1] : &B[k1*BLDim] );
+        Gemm( transA, transB, m, n, k1, alpha, A, ALDim, B, BLDim, C, CLDim );
+        Gemm
+        ( transA, transB, m, n, k-k1, alpha, A2, ALDim, B2, BLDim, C, CLDim );
+    }
+}
+
+} // namespace recursion
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    if( m <= recursion::leafSize && n <= recursion::leafSize &&
+        k <= recursion::leafSize )
+    {
+        unblocked::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+        return;
+    }
+
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    if( k == 0 )
+        return;
+
+    recursion::Run<T>
+    ( double(m)*n*k,
+      [&]()
+      {
+          recursion::Gemm
+          ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+      } );
+}
+
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -513,5 +640,25 @@ void Gemm
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+#ifdef HYDROGEN_HAVE_QD
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    dd::Gemm
+    ( transA, transB, m, n, k,
+      dd::Interleaved(&alpha),
+      dd::Interleaved(A), ALDim,
+      dd::Interleaved(B), BLDim,
+      dd::Interleaved(&beta),
+      dd::Interleaved(C), CLDim );
+}
+#endif
+
 } // namespace blas
 } // namespace El
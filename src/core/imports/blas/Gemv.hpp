@@ -257,5 +257,24 @@ void Gemv
 { EL_BLAS(zgemv)
   ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
 
+#ifdef HYDROGEN_HAVE_QD
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy )
+{
+    dd::Gemv
+    ( trans, m, n,
+      dd::Interleaved(&alpha),
+      dd::Interleaved(A), ALDim,
+      dd::Interleaved(x), incx,
+      dd::Interleaved(&beta),
+      dd::Interleaved(y), incy );
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -71,6 +71,19 @@ double Nrm2( BlasInt n, const double* x, BlasInt incx )
 double Nrm2( BlasInt n, const dcomplex* x, BlasInt incx )
 { return EL_BLAS(dznrm2)( &n, x, &incx ); }
 
+#ifdef HYDROGEN_HAVE_QD
+DoubleDouble Nrm2( BlasInt n, const DoubleDouble* x, BlasInt incx )
+{
+    double sumHi, sumLo;
+    int exponent;
+    dd::ScaledSumOfSquares
+    ( n, dd::Interleaved(x), incx, sumHi, sumLo, exponent );
+    DoubleDouble norm = Sqrt( DoubleDouble(dd_real(sumHi,sumLo)) );
+    norm *= std::ldexp( 1., exponent );
+    return norm;
+}
+#endif
+
 // NOTE: 'nrm1' is not the official name but is consistent with 'nrm2'
 template<typename F>
 Base<F> Nrm1( BlasInt n, const F* x, BlasInt incx )
@@ -0,0 +1,56 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// The generic (i.e., non-BLAS) level 3 routines recursively halve their
+// largest dimension until the operands fit within cache, at which point the
+// element-wise kernels in the 'unblocked' namespace take over. The products
+// with the triangular and Hermitian/symmetric matrices are thereby reduced to
+// GEMM, and, with EL_HYBRID, the independent halves of large enough
+// subproblems are executed as OpenMP tasks.
+
+namespace El {
+namespace blas {
+namespace recursion {
+
+// The largest dimension which is handed to an element-wise kernel
+const BlasInt leafSize = 64;
+
+// The minimum number of multiply-adds in a subproblem spawned as a task
+const double minTaskWork = 64.*64.*64.;
+
+// Arithmetic on the MPFR-backed types allocates, so they remain sequential
+template<typename T>
+inline bool SpawnTask( double work )
+{
+#ifdef EL_HYBRID
+    return IsPacked<T>::value && work >= minTaskWork;
+#else
+    return false;
+#endif
+}
+
+// Open a parallel region for the recursion (if one is not already active)
+template<typename T,typename Recursion>
+inline void Run( double work, Recursion recursion )
+{
+#ifdef EL_HYBRID
+    if( SpawnTask<T>(work) && !omp_in_parallel() && omp_get_max_threads() > 1 )
+    {
+        #pragma omp parallel
+        #pragma omp single
+        recursion();
+        return;
+    }
+#endif
+    recursion();
+}
+
+} // namespace recursion
+} // namespace blas
+} // namespace El
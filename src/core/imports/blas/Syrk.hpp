@@ -53,6 +53,7 @@ void EL_BLAS(zsyrk)
 
 namespace El {
 namespace blas {
+namespace unblocked {
 
 template<typename T>
 void Herk
@@ -163,6 +164,149 @@ void Herk
         }
     }
 }
+
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim );
+
+} // namespace unblocked
+
+namespace recursion {
+
+// C := alpha op(A) op(A)^H + C (or the transpose analogue), where only the
+// 'uplo' triangle of C is updated. The diagonal blocks are recursed upon and
+// the off-diagonal block is formed with GEMM.
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+        T* C, BlasInt CLDim,
+  bool conjugate )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    if( n <= leafSize && k <= leafSize )
+    {
+        if( conjugate )
+            unblocked::Herk
+            ( uplo, trans, n, k,
+              RealPart(alpha), A, ALDim, Base<T>(1), C, CLDim );
+        else
+            unblocked::Syrk
+            ( uplo, trans, n, k, alpha, A, ALDim, T(1), C, CLDim );
+        return;
+    }
+    if( n <= leafSize )
+    {
+        // Split the inner dimension
+        const BlasInt k1 = k/2;
+        const T* A2 = ( normal ? &A[k1*ALDim] : &A[k1] );
+        Syrk( uplo, trans, n, k1, alpha, A, ALDim, C, CLDim, conjugate );
+        Syrk( uplo, trans, n, k-k1, alpha, A2, ALDim, C, CLDim, conjugate );
+        return;
+    }
+
+    const char opChar = ( conjugate ? 'C' : 'T' );
+    const BlasInt n1 = n/2;
+    const BlasInt n2 = n-n1;
+    const T* A2 = ( normal ? &A[n1] : &A[n1*ALDim] );
+    const bool spawn = SpawnTask<T>( double(n)*n*k/2 );
+#ifdef EL_HYBRID
+    #pragma omp task if(spawn) default(shared)
+#endif
+    Syrk( uplo, trans, n1, k, alpha, A, ALDim, C, CLDim, conjugate );
+#ifdef EL_HYBRID
+    #pragma omp task if(spawn) default(shared)
+#endif
+    Syrk
+    ( uplo, trans, n2, k, alpha, A2, ALDim, &C[n1+n1*CLDim], CLDim,
+      conjugate );
+    if( lower )
+    {
+        // C21 += alpha op(A2) op(A1)^H
+        if( normal )
+            Gemm
+            ( 'N', opChar, n2, n1, k,
+              alpha, A2, ALDim, A, ALDim, &C[n1], CLDim );
+        else
+            Gemm
+            ( opChar, 'N', n2, n1, k,
+              alpha, A2, ALDim, A, ALDim, &C[n1], CLDim );
+    }
+    else
+    {
+        // C12 += alpha op(A1) op(A2)^H
+        if( normal )
+            Gemm
+            ( 'N', opChar, n1, n2, k,
+              alpha, A, ALDim, A2, ALDim, &C[n1*CLDim], CLDim );
+        else
+            Gemm
+            ( opChar, 'N', n1, n2, k,
+              alpha, A, ALDim, A2, ALDim, &C[n1*CLDim], CLDim );
+    }
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
+}
+
+template<typename T>
+void ScaleTriangle
+( char uplo, BlasInt n, const T& beta, T* C, BlasInt CLDim )
+{
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
+                C[i+j*CLDim] *= beta;
+    }
+}
+
+} // namespace recursion
+
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    if( n <= recursion::leafSize && k <= recursion::leafSize )
+    {
+        unblocked::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+    recursion::ScaleTriangle( uplo, n, T(beta), C, CLDim );
+    if( k == 0 )
+        return;
+    const T alphaT( alpha );
+    recursion::Run<T>
+    ( double(n)*n*k/2,
+      [&]()
+      {
+          recursion::Syrk
+          ( uplo, trans, n, k, alphaT, A, ALDim, C, CLDim, true );
+      } );
+}
+
 template void Herk
 ( char uplo, char trans,
   BlasInt n, BlasInt k,
@@ -290,6 +434,8 @@ void Herk
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
 
+namespace unblocked {
+
 template<typename T>
 void Syrk
 ( char uplo, char trans,
@@ -399,6 +545,35 @@ void Syrk
         }
     }
 }
+
+} // namespace unblocked
+
+template<typename T>
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    if( n <= recursion::leafSize && k <= recursion::leafSize )
+    {
+        unblocked::Syrk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+    recursion::ScaleTriangle( uplo, n, beta, C, CLDim );
+    if( k == 0 )
+        return;
+    recursion::Run<T>
+    ( double(n)*n*k/2,
+      [&]()
+      {
+          recursion::Syrk
+          ( uplo, trans, n, k, alpha, A, ALDim, C, CLDim, false );
+      } );
+}
+
 template void Syrk
 ( char uplo, char trans,
   BlasInt n, BlasInt k, 
@@ -36,6 +36,7 @@ void EL_BLAS(ztrsm)
 
 namespace El {
 namespace blas {
+namespace unblocked {
 
 template<typename F>
 void Trsm
@@ -53,9 +54,12 @@ void Trsm
     const bool unitDiag = ( std::toupper(unit) == 'U' );
 
     // Scale B
-    for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
+    if( alpha != F(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+    }
 
     F alpha11, alpha11Conj;
     if( onLeft )
@@ -293,6 +297,142 @@ void Trsm
         }
     }
 }
+
+} // namespace unblocked
+
+namespace recursion {
+
+// Solve op(A) X = B or X op(A) = B, overwriting B with X. The right-hand
+// sides are split into independent halves until they are no larger than the
+// triangle, which is then split so that the coupling between its halves is
+// applied with GEMM.
+template<typename F>
+void Trsm
+( bool onLeft, bool lower, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const BlasInt triSize = ( onLeft ? m : n );
+    const BlasInt rhsSize = ( onLeft ? n : m );
+    if( triSize <= leafSize && rhsSize <= leafSize )
+    {
+        unblocked::Trsm
+        ( onLeft ? 'L' : 'R', lower ? 'L' : 'U', trans, unit, m, n,
+          F(1), A, ALDim, B, BLDim );
+        return;
+    }
+
+    if( rhsSize > leafSize && rhsSize >= triSize )
+    {
+        const BlasInt r1 = rhsSize/2;
+        const bool spawn = SpawnTask<F>( double(triSize)*triSize*rhsSize/2 );
+        F* B2 = ( onLeft ? &B[r1*BLDim] : &B[r1] );
+#ifdef EL_HYBRID
+        #pragma omp task if(spawn) default(shared)
+#endif
+        Trsm
+        ( onLeft, lower, trans, unit,
+          onLeft ? m : r1, onLeft ? r1 : n, A, ALDim, B, BLDim );
+        Trsm
+        ( onLeft, lower, trans, unit,
+          onLeft ? m : m-r1, onLeft ? n-r1 : n, A, ALDim, B2, BLDim );
+#ifdef EL_HYBRID
+        #pragma omp taskwait
+#endif
+        return;
+    }
+
+    // Partition op(A) into 2x2 blocks. The off-diagonal blocks of op(A) are
+    // op applied to the stored blocks, so that, e.g., the bottom-left block
+    // of op(A) is stored in the top-right of A if op is a (conjugate)
+    // transpose.
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt k1 = triSize/2;
+    const BlasInt k2 = triSize-k1;
+    const F* A22 = &A[k1+k1*ALDim];
+    const F* ABelow = ( normal ? &A[k1] : &A[k1*ALDim] );
+    const F* AAbove = ( normal ? &A[k1*ALDim] : &A[k1] );
+    const bool opLower = ( lower == normal );
+    if( onLeft )
+    {
+        F* B2 = &B[k1];
+        if( opLower )
+        {
+            Trsm( true, lower, trans, unit, k1, n, A, ALDim, B, BLDim );
+            Gemm
+            ( trans, 'N', k2, n, k1,
+              F(-1), ABelow, ALDim, B, BLDim, B2, BLDim );
+            Trsm( true, lower, trans, unit, k2, n, A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            Trsm( true, lower, trans, unit, k2, n, A22, ALDim, B2, BLDim );
+            Gemm
+            ( trans, 'N', k1, n, k2,
+              F(-1), AAbove, ALDim, B2, BLDim, B, BLDim );
+            Trsm( true, lower, trans, unit, k1, n, A, ALDim, B, BLDim );
+        }
+    }
+    else
+    {
+        F* B2 = &B[k1*BLDim];
+        if( opLower )
+        {
+            Trsm( false, lower, trans, unit, m, k2, A22, ALDim, B2, BLDim );
+            Gemm
+            ( 'N', trans, m, k1, k2,
+              F(-1), B2, BLDim, ABelow, ALDim, B, BLDim );
+            Trsm( false, lower, trans, unit, m, k1, A, ALDim, B, BLDim );
+        }
+        else
+        {
+            Trsm( false, lower, trans, unit, m, k1, A, ALDim, B, BLDim );
+            Gemm
+            ( 'N', trans, m, k2, k1,
+              F(-1), B, BLDim, AAbove, ALDim, B2, BLDim );
+            Trsm( false, lower, trans, unit, m, k2, A22, ALDim, B2, BLDim );
+        }
+    }
+}
+
+} // namespace recursion
+
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const BlasInt triSize = ( onLeft ? m : n );
+    const BlasInt rhsSize = ( onLeft ? n : m );
+    if( triSize <= recursion::leafSize && rhsSize <= recursion::leafSize )
+    {
+        unblocked::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+    if( alpha != F(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+    }
+    recursion::Run<F>
+    ( double(triSize)*triSize*rhsSize/2,
+      [&]()
+      {
+          recursion::Trsm
+          ( onLeft, lower, trans, unit, m, n, A, ALDim, B, BLDim );
+      } );
+}
 #ifdef HYDROGEN_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
@@ -39,13 +39,31 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
+    if( ownsLimbs_ )
+    {
+        mpfr_set_prec( mpfrFloat_, prec ); 
+    }
+    else
+    {
+        // Like mpfr_set_prec, the value is reset to NaN. The precision may
+        // return to (but not exceed) that of the arena after being lowered.
+        if( mpfr_custom_get_size(prec) > arenaLimbs_*sizeof(mp_limb_t) )
+            LogicError
+            ("Cannot raise the precision of a BigFloat in a limb arena above ",
+             "that of the arena");
+        mpfr_custom_init_set
+        ( mpfrFloat_, MPFR_NAN_KIND, 0, prec,
+          mpfr_custom_get_significand(mpfrFloat_) );
+    }
     SetNumLimbs( prec );
 }
 
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::OwnsLimbs() const
+{ return ownsLimbs_; }
+
 BigFloat::BigFloat()
 {
     EL_DEBUG_CSE
@@ -223,15 +241,34 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.ownsLimbs_ )
+    {
+        Pointer()->_mpfr_d = 0;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // The limbs of 'a' are owned by an arena which might not outlive us
+        Init( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
+}
+
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec )
+: ownsLimbs_(false)
+{
+    EL_DEBUG_CSE
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( mpfrFloat_, MPFR_ZERO_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+    arenaLimbs_ = numLimbs_;
 }
 
 BigFloat::~BigFloat()
 {
     EL_DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( ownsLimbs_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -395,8 +432,16 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( ownsLimbs_ && a.ownsLimbs_ )
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // Limbs are never exchanged with an arena
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
     return *this;
 }
 
@@ -1405,6 +1450,52 @@ std::istream& operator>>( std::istream& is, BigFloat& alpha )
     return is;
 }
 
+namespace mpfr {
+
+namespace {
+
+// The number of entries precedes the array of BigFloat's within an arena
+const size_t limbArenaHeaderSize =
+  ((sizeof(size_t)+alignof(BigFloat)-1)/alignof(BigFloat))*alignof(BigFloat);
+
+} // anonymous namespace
+
+BigFloat* NewLimbArena( size_t size )
+{
+    EL_DEBUG_CSE
+    const mpfr_prec_t prec = mpfr::Precision();
+    const size_t numLimbs =
+      (mpfr_custom_get_size(prec)+sizeof(mp_limb_t)-1) / sizeof(mp_limb_t);
+
+    // [size | BigFloat's | limbs], where the limbs of entry i are contiguous
+    // with those of entry i+1
+    byte* block = static_cast<byte*>
+      (::operator new
+       (limbArenaHeaderSize + size*sizeof(BigFloat) +
+        size*numLimbs*sizeof(mp_limb_t)));
+    std::memcpy( block, &size, sizeof(size_t) );
+    BigFloat* entries = reinterpret_cast<BigFloat*>(block+limbArenaHeaderSize);
+    mp_limb_t* limbs = reinterpret_cast<mp_limb_t*>(entries+size);
+    for( size_t i=0; i<size; ++i )
+        new(&entries[i]) BigFloat( &limbs[i*numLimbs], prec );
+    return entries;
+}
+
+void DeleteLimbArena( BigFloat* entries )
+{
+    EL_DEBUG_CSE
+    if( entries == nullptr )
+        return;
+    byte* block = reinterpret_cast<byte*>(entries) - limbArenaHeaderSize;
+    size_t size;
+    std::memcpy( &size, block, sizeof(size_t) );
+    for( size_t i=0; i<size; ++i )
+        entries[i].~BigFloat();
+    ::operator delete( block );
+}
+
+} // namespace mpfr
+
 } // namespace El
 
 #endif // ifdef HYDROGEN_HAVE_MPC
@@ -1831,8 +1831,6 @@ std::vector<T> AllToAll(
     Comm const& comm )
 EL_NO_RELEASE_EXCEPT
 {
-    LogicError("AllToAll: Is this used? Tell Tom if so.");
-
     SyncInfo<Device::CPU> syncInfo;
     const int commSize = Size( comm );
     std::vector<int> recvCounts(commSize);
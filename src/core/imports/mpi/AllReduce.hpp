@@ -3,6 +3,35 @@ namespace El
 namespace mpi
 {
 
+namespace
+{
+
+// The serialized (BigInt and BigFloat) reductions pack into per-thread
+// buffers, so that repeated reductions of the same size do not allocate.
+// Buffers which grew beyond maxPooledSerializedBytes are released after use so
+// that one large reduction does not pin its memory for the life of the thread.
+const size_t maxPooledSerializedBytes = size_t(1) << 20;
+
+std::vector<byte>& SerializedSendBuffer()
+{
+    static thread_local std::vector<byte> buffer;
+    return buffer;
+}
+
+std::vector<byte>& SerializedRecvBuffer()
+{
+    static thread_local std::vector<byte> buffer;
+    return buffer;
+}
+
+void ReleaseIfOversized(std::vector<byte>& buffer)
+{
+    if (buffer.capacity() > maxPooledSerializedBytes)
+        std::vector<byte>().swap(buffer);
+}
+
+} // namespace <anon>
+
 //
 // The "normal" allreduce (not "IN_PLACE").
 //
@@ -93,7 +122,8 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
         return;
 
     MPI_Op opC = NativeOp<T>(op);
-    std::vector<byte> packedSend, packedRecv;
+    std::vector<byte>& packedSend = SerializedSendBuffer();
+    std::vector<byte>& packedRecv = SerializedRecvBuffer();
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, count, syncInfo);
@@ -108,6 +138,8 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
             packedSend.data(), packedRecv.data(),
             count, TypeMap<T>(), opC, comm.GetMPIComm()));
     Deserialize(count, packedRecv, rbuf);
+    ReleaseIfOversized(packedSend);
+    ReleaseIfOversized(packedRecv);
 }
 
 template <typename T, Device D, typename, typename>
@@ -211,15 +243,15 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
     Synchronize(syncInfo);
 
     MPI_Op opC = NativeOp<T>(op);
-    std::vector<byte> packedSend, packedRecv;
-    Serialize(count, buf, packedSend);
+    std::vector<byte>& packed = SerializedSendBuffer();
+    Serialize(count, buf, packed);
 
-    ReserveSerialized(count, buf, packedRecv);
     EL_CHECK_MPI_CALL(
         MPI_Allreduce(
-            packedSend.data(), packedRecv.data(),
+            MPI_IN_PLACE, packed.data(),
             count, TypeMap<T>(), opC, comm.GetMPIComm()));
-    Deserialize(count, packedRecv, buf);
+    Deserialize(count, packed, buf);
+    ReleaseIfOversized(packed);
 }
 
 template <typename T, Device D, typename, typename>
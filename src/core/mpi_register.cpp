@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include "./imports/blas/DoubleDouble.hpp"
 using std::function;
 
 namespace El {
@@ -325,7 +326,7 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const T*>(inVoid);
     auto outData = static_cast<      T*>(outVoid);
     const int length = *lengthPtr;
-    auto func = Types<T>::userFunc;
+    const auto& func = Types<T>::userFunc;
     for( int j=0; j<length; ++j )
         outData[j] = func(inData[j],outData[j]);
 }
@@ -339,7 +340,7 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const byte*>(inVoid);
     auto outData = static_cast<      byte*>(outVoid);
     const int length = *lengthPtr;
-    auto func = Types<T>::userFunc;
+    const auto& func = Types<T>::userFunc;
     for( int j=0; j<length; ++j )
     {
         inData = a.Deserialize(inData);
@@ -359,7 +360,7 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const T*>(inVoid);
     auto outData = static_cast<      T*>(outVoid);
     const int length = *lengthPtr;
-    auto func = Types<T>::userCommFunc;
+    const auto& func = Types<T>::userCommFunc;
     for( int j=0; j<length; ++j )
         outData[j] = func(inData[j],outData[j]);
 }
@@ -373,7 +374,7 @@ EL_NO_EXCEPT
     auto inData  = static_cast<const byte*>(inVoid);
     auto outData = static_cast<      byte*>(outVoid);
     const int length = *lengthPtr;
-    auto func = Types<T>::userCommFunc;
+    const auto& func = Types<T>::userCommFunc;
     for( int j=0; j<length; ++j )
     {
         inData = a.Deserialize(inData);
@@ -482,6 +483,26 @@ EL_NO_EXCEPT
     }
 }
 
+#ifdef HYDROGEN_HAVE_QD
+// Sums of (complex) double-doubles are formed by the vectorized kernels over
+// the interleaved (hi,lo) pairs rather than by one dd_real addition at a time
+static_assert
+( sizeof(Complex<DoubleDouble>) == 2*sizeof(DoubleDouble),
+  "Complex<DoubleDouble> must consist of exactly two DoubleDoubles" );
+
+template<typename T>
+static void
+DoubleDoubleSumFunc
+( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
+EL_NO_EXCEPT
+{
+    const BlasInt n = BlasInt(sizeof(T)/sizeof(DoubleDouble))*(*lengthPtr);
+    blas::dd::Update
+    ( n, static_cast<const double*>(inVoid), 1,
+         static_cast<      double*>(outVoid), 1 );
+}
+#endif
+
 template<typename T,typename=EnableIf<IsPacked<T>>>
 static void
 ProdFunc( void* inVoid, void* outVoid, int* lengthPtr, Datatype* datatype )
@@ -834,6 +855,24 @@ void CreateSumOp()
     Create( (UserFunction*)SumFunc<T>, true, SumOp<T>() );
     Types<T>::createdSumOp = true;
 }
+#ifdef HYDROGEN_HAVE_QD
+template<>
+void CreateSumOp<DoubleDouble>()
+{
+    Create
+    ( (UserFunction*)DoubleDoubleSumFunc<DoubleDouble>, true,
+      SumOp<DoubleDouble>() );
+    Types<DoubleDouble>::createdSumOp = true;
+}
+template<>
+void CreateSumOp<Complex<DoubleDouble>>()
+{
+    Create
+    ( (UserFunction*)DoubleDoubleSumFunc<Complex<DoubleDouble>>, true,
+      SumOp<Complex<DoubleDouble>>() );
+    Types<Complex<DoubleDouble>>::createdSumOp = true;
+}
+#endif
 template<typename T>
 void CreateProdOp()
 {
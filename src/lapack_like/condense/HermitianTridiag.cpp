@@ -45,6 +45,7 @@ void Ger2Sub
 #include "./HermitianTridiag/LowerBlockedSquare.hpp"
 #include "./HermitianTridiag/UpperBlocked.hpp"
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
 
@@ -110,8 +111,9 @@ void HermitianTridiag
         mpi::Incl
         ( owningGroup, squareRanks.size(), squareRanks.data(), squareGroup );
 
-        mpi::Comm viewingComm = grid.ViewingComm();
-        const Grid squareGrid( viewingComm, squareGroup, pSqrt );
+        mpi::Comm viewingComm;
+        mpi::Dup( grid.ViewingComm(), viewingComm );
+        const Grid squareGrid( std::move(viewingComm), squareGroup, pSqrt );
         DistMatrix<F> ASquare(squareGrid);
         DistMatrix<F,STAR,STAR> householderScalarsSquare(squareGrid);
 
@@ -180,6 +182,21 @@ void ExplicitCondensed
 {
     EL_DEBUG_CSE
     DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+    if( ctrl.twoStage )
+    {
+        // The reflectors of the bulge chase need not be stored
+        DistMatrixReadWriteProxy<F,F,MC,MR> AProx( A );
+        auto& AProxy = AProx.Get();
+        const Int b = TwoStageBandwidth( AProxy.Height(), ctrl.bandwidth );
+        TwoStageHelper
+        ( uplo, AProxy, householderScalars, b,
+          []( Int, const F*, Int, const F& ) { } );
+        if( uplo == UPPER )
+            MakeTrapezoidal( LOWER, AProxy, 1 );
+        else
+            MakeTrapezoidal( UPPER, AProxy, -1 );
+        return;
+    }
     HermitianTridiag( uplo, A, householderScalars, ctrl );
     if( uplo == UPPER )
         MakeTrapezoidal( LOWER, A, 1 );
@@ -218,6 +235,38 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<F>& bulgeReflectors, \
+    Matrix<F>& bulgeScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<F>& bulgeReflectors, \
+    AbstractDistMatrix<F>& bulgeScalars, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    Int bandwidth, \
+    const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<F>& bulgeReflectors, \
+    const Matrix<F>& bulgeScalars, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    Orientation orientation, \
+    Int bandwidth, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<F>& bulgeReflectors, \
+    const AbstractDistMatrix<F>& bulgeScalars, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -55,6 +55,74 @@ void ApplyQ
       A, householderScalars, B );
 }
 
+// The unitary matrix of the two-stage reduction is the product of the (dense)
+// reflectors of the band reduction and the reflectors of the bulge chase
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  Int bandwidth,
+  const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<F>& bulgeReflectors,
+  const Matrix<F>& bulgeScalars,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int b = TwoStageBandwidth( A.Height(), bandwidth );
+    EL_DEBUG_ONLY(
+      if( bulgeReflectors.Height() != b )
+          LogicError
+          ("The bulge reflectors were not generated with bandwidth ",b);
+    )
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    if( normal == onLeft )
+        ApplyBulgeReflectors
+        ( side, orientation, b, bulgeReflectors, bulgeScalars, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -b,
+      A, householderScalars, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors
+        ( side, orientation, b, bulgeReflectors, bulgeScalars, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  Orientation orientation,
+  Int bandwidth,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& householderScalars,
+  const AbstractDistMatrix<F>& bulgeReflectors,
+  const AbstractDistMatrix<F>& bulgeScalars,
+        AbstractDistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int b = TwoStageBandwidth( A.Height(), bandwidth );
+    EL_DEBUG_ONLY(
+      if( bulgeReflectors.Height() != b )
+          LogicError
+          ("The bulge reflectors were not generated with bandwidth ",b);
+    )
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    if( normal == onLeft )
+        ApplyBulgeReflectors
+        ( side, orientation, b, bulgeReflectors, bulgeScalars, B );
+    ApplyPackedReflectors
+    ( side, LOWER, VERTICAL, direction, conjugation, -b,
+      A, householderScalars, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors
+        ( side, orientation, b, bulgeReflectors, bulgeScalars, B );
+}
+
 } // namespace herm_tridiag
 } // namespace El
 
@@ -163,7 +163,8 @@ void LowerPanelSquare
             // Broadcast a21 and tau across the process row
             mpi::Broadcast
             ( rowBcastBuf.data(), 
-              a21LocalHeight+1, a21.RowAlign(), g.RowComm() );
+              a21LocalHeight+1, a21.RowAlign(), g.RowComm(),
+              SyncInfo<Device::CPU>() );
             // Store a21[MC] into its DistMatrix class and also store a copy
             // for the next iteration
             MemCopy( a21_MC.Buffer(), rowBcastBuf.data(), a21LocalHeight );
@@ -184,7 +185,7 @@ void LowerPanelSquare
                 mpi::SendRecv
                 ( a21_MC.Buffer(), A22.LocalHeight(), transposeRank,
                   a21_MR.Buffer(), A22.LocalWidth(),  transposeRank, 
-                  g.VCComm() );
+                  g.VCComm(), SyncInfo<Device::CPU>() );
 
             // Store a21[MR]
             const Int B_MR_STAR_Off = 
@@ -214,7 +215,7 @@ void LowerPanelSquare
             mpi::Broadcast
             ( rowBcastBuf.data(), 
               a21LocalHeight+w21LastLocalHeight+1, 
-              a21.RowAlign(), g.RowComm() );
+              a21.RowAlign(), g.RowComm(), SyncInfo<Device::CPU>() );
             // Store a21[MC] into its DistMatrix class 
             MemCopy( a21_MC.Buffer(), rowBcastBuf.data(), a21LocalHeight );
             // Store a21[MC] into B[MC,* ]
@@ -274,7 +275,8 @@ void LowerPanelSquare
                 // Pairwise exchange
                 mpi::SendRecv
                 ( sendBuf.data(), sendSize, transposeRank,
-                  recvBuf.data(), recvSize, transposeRank, g.VCComm() );
+                  recvBuf.data(), recvSize, transposeRank, g.VCComm(),
+                  SyncInfo<Device::CPU>() );
 
                 // Unpack the recv buffer
                 MemCopy
@@ -345,7 +347,8 @@ void LowerPanelSquare
               y01_MR.Buffer(), x01LocalHeight );
             mpi::AllReduce
             ( colSumSendBuf.data(), 
-              colSumRecvBuf.data(), 2*x01LocalHeight, g.ColComm() );
+              colSumRecvBuf.data(), 2*x01LocalHeight, g.ColComm(),
+              SyncInfo<Device::CPU>() );
             MemCopy
             ( x01_MR.Buffer(), 
               colSumRecvBuf.data(), x01LocalHeight );
@@ -379,7 +382,7 @@ void LowerPanelSquare
             mpi::SendRecv
             ( q21_MR.Buffer(), sendSize, transposeRank, 
               recvBuf.data(),  recvSize, transposeRank, 
-              g.VCComm() );
+              g.VCComm(), SyncInfo<Device::CPU>() );
 
             // Unpack the recv buffer directly onto p21[MC]
             blas::Axpy( recvSize, F(1), recvBuf.data(), 1, p21_MC.Buffer(), 1 );
@@ -399,7 +402,8 @@ void LowerPanelSquare
             FastResize( reduceToOneRecvBuf, a21LocalHeight );
             mpi::Reduce
             ( p21_MC.Buffer(), reduceToOneRecvBuf.data(),
-              a21LocalHeight, nextProcessCol, g.RowComm() );
+              a21LocalHeight, nextProcessCol, g.RowComm(),
+              SyncInfo<Device::CPU>() );
             if( g.Col() == nextProcessCol )
             {
                 // Finish computing w21. During its computation, ensure that 
@@ -413,7 +417,8 @@ void LowerPanelSquare
                 sendBuf[0] = myDotProduct;
                 sendBuf[1] = ( g.Row()==nextProcessRow ?
                                   reduceToOneRecvBuf[0] : 0 );
-                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm() );
+                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm(),
+                                SyncInfo<Device::CPU>() );
                 F dotProduct = recvBuf[0];
 
                 // Set up for the next iteration by filling in the values for:
@@ -437,14 +442,15 @@ void LowerPanelSquare
             FastResize( allReduceRecvBuf, a21LocalHeight );
             mpi::AllReduce
             ( p21_MC.Buffer(), allReduceRecvBuf.data(),
-              a21LocalHeight, g.RowComm() );
+              a21LocalHeight, g.RowComm(), SyncInfo<Device::CPU>() );
 
             // Finish computing w21.
             const F* a21_MC_Buf = a21_MC.Buffer();
             F myDotProduct = blas::Dot
                 ( a21LocalHeight, allReduceRecvBuf.data(), 1,
                                   a21_MC_Buf,              1 );
-            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm() );
+            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm(),
+                                                 SyncInfo<Device::CPU>() );
 
             // Grab views into W[MC,* ] and W[MR,* ]
             auto w21_MC = W_MC_STAR( ind2, ind1 );
@@ -470,7 +476,7 @@ void LowerPanelSquare
                 mpi::SendRecv
                 ( w21_MC.Buffer(), A22.LocalHeight(), transposeRank, 
                   w21_MR.Buffer(), A22.LocalWidth(),  transposeRank, 
-                  g.VCComm() );
+                  g.VCComm(), SyncInfo<Device::CPU>() );
             }
         }
     }
@@ -0,0 +1,612 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+#include <atomic>
+#include <thread>
+
+namespace El {
+namespace herm_tridiag {
+
+// The first stage reduces A to a Hermitian band matrix of bandwidth b one
+// panel of b columns at a time: the portion of the panel below the band is
+// factored as H R, and the trailing matrix is then updated as H A22 H' via
+// a Hermitian rank-2b update. The reflectors are left below the band in the
+// format expected by ApplyPackedReflectors with an offset of -b.
+//
+// The second stage reduces the band to real symmetric tridiagonal form by
+// chasing bulges (cf. Lang's successive band reduction). Sweep i annihilates
+// column i of the band with a reflector of length at most b, which creates a
+// bulge below the band; each further step of the sweep annihilates the first
+// column of the bulge and thereby pushes the remainder of the bulge b rows
+// further down. Step j of sweep i only touches rows and columns within b of
+// row i+1+j*b, so sweep i+1 may proceed with step j as soon as sweep i has
+// finished its step j+2. With EL_HYBRID, the sweeps are pipelined across
+// threads on this basis.
+
+inline Int TwoStageBandwidth( Int n, Int bandwidth )
+{ return Max( Min(bandwidth,n-1), Int(1) ); }
+
+// The index of the first reflector generated by each sweep of the bulge chase
+// (with a trailing entry for the total number of reflectors)
+inline vector<Int> SweepOffsets( Int n, Int b )
+{
+    const Int numSweeps = Max( n-1, Int(0) );
+    vector<Int> offsets( numSweeps+1 );
+    offsets[0] = 0;
+    for( Int i=0; i<numSweeps; ++i )
+        offsets[i+1] = offsets[i] + (n-1-i+b-1)/b;
+    return offsets;
+}
+
+template<typename F>
+void LowerBand( Matrix<F>& A, Matrix<F>& householderScalars, Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    Matrix<F> panelScalars, V, SInv, X, Z;
+    Matrix<Base<F>> signature;
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int numReflectors = Min( b, n-(k+b) );
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+
+        auto P = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto householderScalars1 =
+          householderScalars( IR(k,k+numReflectors), ALL );
+
+        // Factor the panel below the band and undo the normalization of the
+        // diagonal of R so that P = H R (with H a product of reflectors)
+        QR( P, panelScalars, signature );
+        auto R = P( IR(0,numReflectors), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        householderScalars1 = panelScalars;
+
+        // Form the UT transform, inv(H) = I - V inv(SInv) V'
+        V = P( ALL, IR(0,numReflectors) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        Herk( LOWER, ADJOINT, Base<F>(1), V, SInv );
+        for( Int j=0; j<numReflectors; ++j )
+            SInv(j,j) = F(1) / panelScalars(j);
+
+        // A22 := inv(H) A22 inv(H)' = A22 - V X' - X V', where
+        //   X := A22 V inv(SInv)' - V (inv(SInv) V' A22 V inv(SInv)') / 2
+        Zeros( X, A22.Height(), numReflectors );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, X );
+        Gemm( ADJOINT, NORMAL, F(1), V, X, Z );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, Z, F(1), X );
+        Her2k( LOWER, NORMAL, F(-1), V, X, Base<F>(1), A22 );
+    }
+}
+
+template<typename F>
+void LowerBand( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& householderScalars,
+  Int b )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    DistMatrix<F,STAR,STAR> panelScalars(g), SInv(g), Z(g);
+    DistMatrix<Base<F>,STAR,STAR> signature(g);
+    DistMatrix<F> V(g);
+    DistMatrix<F,VC,STAR> V_VC_STAR(g), X_VC_STAR(g);
+    DistMatrix<F> X(g);
+    for( Int k=0; k+b<n; k+=b )
+    {
+        const Int numReflectors = Min( b, n-(k+b) );
+        const Range<Int> ind1( k, k+b ), ind2( k+b, n );
+
+        auto P = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto householderScalars1 =
+          householderScalars( IR(k,k+numReflectors), ALL );
+
+        // Factor the panel below the band and undo the normalization of the
+        // diagonal of R so that P = H R (with H a product of reflectors)
+        QR( P, panelScalars, signature );
+        auto R = P( IR(0,numReflectors), ALL );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, signature, R );
+        householderScalars1 = panelScalars;
+
+        // Form the UT transform, inv(H) = I - V inv(SInv) V'
+        V.AlignWith( A22 );
+        V = P( ALL, IR(0,numReflectors) );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        V_VC_STAR = V;
+        Zeros( SInv, numReflectors, numReflectors );
+        Herk
+        ( LOWER, ADJOINT,
+          Base<F>(1), V_VC_STAR.LockedMatrix(),
+          Base<F>(0), SInv.Matrix() );
+        El::AllReduce( SInv, V_VC_STAR.ColComm() );
+        for( Int j=0; j<numReflectors; ++j )
+            SInv.SetLocal( j, j, F(1)/panelScalars.GetLocal(j,0) );
+
+        // A22 := inv(H) A22 inv(H)' = A22 - V X' - X V', where
+        //   X := A22 V inv(SInv)' - V (inv(SInv) V' A22 V inv(SInv)') / 2
+        X.AlignWith( A22 );
+        Zeros( X, A22.Height(), numReflectors );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        X_VC_STAR.AlignWith( V_VC_STAR );
+        X_VC_STAR = X;
+        Trsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+          F(1), SInv.LockedMatrix(), X_VC_STAR.Matrix() );
+        Zeros( Z, numReflectors, numReflectors );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), V_VC_STAR.LockedMatrix(), X_VC_STAR.LockedMatrix(),
+          F(0), Z.Matrix() );
+        El::AllReduce( Z, V_VC_STAR.ColComm() );
+        Trsm
+        ( LEFT, LOWER, NORMAL, NON_UNIT,
+          F(1), SInv.LockedMatrix(), Z.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1)/F(2), V_VC_STAR.LockedMatrix(), Z.LockedMatrix(),
+          F(1), X_VC_STAR.Matrix() );
+        Her2k( LOWER, NORMAL, F(-1), V_VC_STAR, X_VC_STAR, Base<F>(1), A22 );
+    }
+}
+
+// Reduce the Hermitian band matrix of bandwidth b, which is stored in the
+// leading b+1 rows of the (at least) 2b x n matrix 'ABand' such that
+// ABand(i-j,j) = A(i,j) for 0 <= i-j <= b (the remaining rows hold the
+// bulges), to the real symmetric tridiagonal matrix with diagonal 'd' and
+// subdiagonal 'e'. Reflector number 'index' (in the order given by
+// SweepOffsets) is handed to store(index,v,length,tau).
+template<typename F,typename StoreFunctor>
+void ChaseBulges
+( Int b,
+  Matrix<F>& ABand,
+  Matrix<Base<F>>& d,
+  Matrix<Base<F>>& e,
+  StoreFunctor store )
+{
+    EL_DEBUG_CSE
+    const Int n = ABand.Width();
+    EL_DEBUG_ONLY(
+      if( ABand.Height() < 2*b )
+          LogicError("The band storage must have room for the bulges");
+    )
+    // Since A(i,j) is stored at ABuf[(i-j)+j*ABand.LDim()], the band can be
+    // addressed as a column-major matrix with a leading dimension one less
+    F* ABuf = ABand.Buffer();
+    const Int ALDim = ABand.LDim()-1;
+    const vector<Int> offsets = SweepOffsets( n, b );
+    const Int numSweeps = offsets.size()-1;
+    auto numSteps = [&]( Int i ) { return offsets[i+1]-offsets[i]; };
+
+    auto step = [&]( Int i, Int j, F* v, F* y, F* work )
+    {
+        const Int q = ( j == 0 ? i : i+1+(j-1)*b );
+        const Int p = i+1+j*b;
+        const Int len = Min( b, n-p );
+
+        // Annihilate A(p+1:p+len-1,q) with a reflector acting on rows p:p+len
+        F* a = &ABuf[p+q*ALDim];
+        const F tau = lapack::Reflector( len, a[0], &a[1], 1 );
+        v[0] = F(1);
+        for( Int l=1; l<len; ++l )
+        {
+            v[l] = a[l];
+            a[l] = F(0);
+        }
+        store( offsets[i]+j, v, len, tau );
+
+        // Apply the reflector to the remainder of the bulge
+        if( p > q+1 )
+            lapack::ApplyReflector
+            ( true, len, p-(q+1), v, 1, tau,
+              &ABuf[p+(q+1)*ALDim], ALDim, work );
+
+        // Apply the reflector from both sides of the diagonal block
+        F* D = &ABuf[p+p*ALDim];
+        for( Int l=0; l<len; ++l )
+            y[l] = F(0);
+        blas::Hemv( 'L', len, Conj(tau), D, ALDim, v, 1, F(0), y, 1 );
+        const F alpha = -Conj(tau)*blas::Dot( len, y, 1, v, 1 )/F(2);
+        blas::Axpy( len, alpha, v, 1, y, 1 );
+        blas::Her2( 'L', len, F(-1), v, 1, y, 1, D, ALDim );
+
+        // Apply the reflector from the right to the block below, which forms
+        // the bulge for the next step
+        const Int pNext = p+len;
+        const Int lenNext = Min( b, n-pNext );
+        if( lenNext > 0 )
+            lapack::ApplyReflector
+            ( false, lenNext, len, v, 1, Conj(tau),
+              &ABuf[pNext+p*ALDim], ALDim, work );
+    };
+
+#ifdef EL_HYBRID
+    const Int numThreads =
+      ( IsPacked<F>::value && !omp_in_parallel() ? omp_get_max_threads() : 1 );
+    if( numThreads > 1 && numSweeps > 1 )
+    {
+        // The number of completed steps of each sweep
+        unique_ptr<std::atomic<Int>[]> progress
+        ( new std::atomic<Int>[numSweeps] );
+        for( Int i=0; i<numSweeps; ++i )
+            progress[i] = 0;
+
+        #pragma omp parallel num_threads(numThreads)
+        {
+            vector<F> v(b), y(b), work(b);
+            const Int thread = omp_get_thread_num();
+            const Int stride = omp_get_num_threads();
+            for( Int i=thread; i<numSweeps; i+=stride )
+            {
+                for( Int j=0; j<numSteps(i); ++j )
+                {
+                    if( i > 0 )
+                    {
+                        const Int ready = Min( j+3, numSteps(i-1) );
+                        while( progress[i-1].load(std::memory_order_acquire)
+                               < ready )
+                            std::this_thread::yield();
+                    }
+                    step( i, j, v.data(), y.data(), work.data() );
+                    progress[i].store( j+1, std::memory_order_release );
+                }
+            }
+        }
+    }
+    else
+#endif
+    {
+        vector<F> v(b), y(b), work(b);
+        for( Int i=0; i<numSweeps; ++i )
+            for( Int j=0; j<numSteps(i); ++j )
+                step( i, j, v.data(), y.data(), work.data() );
+    }
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        d(j) = RealPart(ABuf[j+j*ALDim]);
+        if( j < n-1 )
+            e(j) = RealPart(ABuf[(j+1)+j*ALDim]);
+    }
+}
+
+// Apply the reflectors from sweeps [sweepBeg,sweepEnd) of the bulge chase,
+// which are stored as the consecutive columns of V (starting with the first
+// reflector of sweep 'sweepBeg'), to the rows (from the left) or the columns
+// (from the right) of B. Since the reflectors within a sweep act on disjoint
+// rows, only the order of the sweeps matters.
+template<typename F>
+void ApplyBulgeSweeps
+( LeftOrRight side,
+  Orientation orientation,
+  Int b,
+  const vector<Int>& offsets,
+  Int sweepBeg,
+  Int sweepEnd,
+  const Matrix<F>& V,
+  const Matrix<F>& bulgeScalars,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool onLeft = (side==LEFT);
+    const bool normal = (orientation==NORMAL);
+    const bool ascending = (normal != onLeft);
+    const Int n = ( onLeft ? B.Height() : B.Width() );
+    const Int numVectors = ( onLeft ? B.Width() : B.Height() );
+    const Int first = offsets[sweepBeg];
+
+    // Each block of columns (or rows) of B is independently subjected to
+    // every reflector so that the block remains in cache between reflectors
+    const Int blocksize = 32;
+    const Int numBlocks = (numVectors+blocksize-1)/blocksize;
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int vecBeg = block*blocksize;
+        const Int width = Min(blocksize,numVectors-vecBeg);
+        vector<F> work(width);
+        for( Int s=0; s<sweepEnd-sweepBeg; ++s )
+        {
+            const Int i = ( ascending ? sweepBeg+s : sweepEnd-1-s );
+            for( Int j=0; j<offsets[i+1]-offsets[i]; ++j )
+            {
+                const Int p = i+1+j*b;
+                const Int len = Min( b, n-p );
+                const Int index = offsets[i]+j-first;
+                const F* v = V.LockedBuffer(0,index);
+                const F tau = bulgeScalars(index);
+                const F gamma = ( normal ? Conj(tau) : tau );
+                if( onLeft )
+                    lapack::ApplyReflector
+                    ( true, len, width, v, 1, gamma,
+                      B.Buffer(p,vecBeg), B.LDim(), work.data() );
+                else
+                    lapack::ApplyReflector
+                    ( false, width, len, v, 1, gamma,
+                      B.Buffer(vecBeg,p), B.LDim(), work.data() );
+            }
+        }
+    }
+}
+
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  Int b,
+  const Matrix<F>& bulgeReflectors,
+  const Matrix<F>& bulgeScalars,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = ( side==LEFT ? B.Height() : B.Width() );
+    const vector<Int> offsets = SweepOffsets( n, b );
+    ApplyBulgeSweeps
+    ( side, orientation, b, offsets, 0, offsets.size()-1,
+      bulgeReflectors, bulgeScalars, B );
+}
+
+// Every process receives the reflectors of a group of sweeps at a time and
+// applies them to its entire columns (from the left) or rows (from the
+// right) of B
+template<typename F>
+void ApplyBulgeReflectors
+( LeftOrRight side,
+  Orientation orientation,
+  Int b,
+  const AbstractDistMatrix<F>& bulgeReflectorsPre,
+  const AbstractDistMatrix<F>& bulgeScalarsPre,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    const Grid& g = BPre.Grid();
+    const bool onLeft = (side==LEFT);
+    const bool ascending = ((orientation==NORMAL) != onLeft);
+
+    DistMatrixReadProxy<F,F,STAR,VR> bulgeReflectorsProx( bulgeReflectorsPre );
+    DistMatrixReadProxy<F,F,VR,STAR> bulgeScalarsProx( bulgeScalarsPre );
+    auto& bulgeReflectors = bulgeReflectorsProx.GetLocked();
+    auto& bulgeScalars = bulgeScalarsProx.GetLocked();
+    const Int n = ( onLeft ? BPre.Height() : BPre.Width() );
+    const vector<Int> offsets = SweepOffsets( n, b );
+    const Int numSweeps = offsets.size()-1;
+
+    DistMatrix<F,STAR,STAR> V(g), bulgeScalars1(g);
+    auto applyGroups = [&]( Matrix<F>& BLoc )
+    {
+        // Groups of b sweeps hold roughly as many entries as the band
+        const Int numGroups = (numSweeps+b-1)/b;
+        for( Int group=0; group<numGroups; ++group )
+        {
+            const Int groupIndex =
+              ( ascending ? group : numGroups-1-group );
+            const Int sweepBeg = groupIndex*b;
+            const Int sweepEnd = Min( sweepBeg+b, numSweeps );
+            const Range<Int> ind( offsets[sweepBeg], offsets[sweepEnd] );
+            V = bulgeReflectors( ALL, ind );
+            bulgeScalars1 = bulgeScalars( ind, ALL );
+            ApplyBulgeSweeps
+            ( side, orientation, b, offsets, sweepBeg, sweepEnd,
+              V.LockedMatrix(), bulgeScalars1.LockedMatrix(), BLoc );
+        }
+    };
+    if( onLeft )
+    {
+        DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( BPre );
+        applyGroups( BProx.Get().Matrix() );
+    }
+    else
+    {
+        DistMatrixReadWriteProxy<F,F,VR,STAR> BProx( BPre );
+        applyGroups( BProx.Get().Matrix() );
+    }
+}
+
+// Overwrite the band of A with the tridiagonal matrix (in both triangles if
+// uplo=UPPER)
+template<typename F>
+void StoreTridiagonal
+( UpperOrLower uplo, Int b,
+  const Matrix<Base<F>>& d, const Matrix<Base<F>>& e, Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = d(j);
+        for( Int i=j+1; i<Min(j+b+1,n); ++i )
+            A(i,j) = ( i == j+1 ? F(e(j)) : F(0) );
+        if( uplo == UPPER && j > 0 )
+            A(j-1,j) = e(j-1);
+    }
+}
+
+template<typename F>
+void StoreTridiagonal
+( UpperOrLower uplo, Int b,
+  const Matrix<Base<F>>& d, const Matrix<Base<F>>& e, DistMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        const Int iLocBeg = A.LocalRowOffset(j);
+        const Int iLocEnd = A.LocalRowOffset(Min(j+b+1,n));
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( i == j )
+                A.SetLocal( iLoc, jLoc, d(j) );
+            else if( i == j+1 )
+                A.SetLocal( iLoc, jLoc, e(j) );
+            else
+                A.SetLocal( iLoc, jLoc, F(0) );
+        }
+        if( uplo == UPPER && j > 0 && A.IsLocalRow(j-1) )
+            A.SetLocal( A.LocalRow(j-1), jLoc, e(j-1) );
+    }
+}
+
+template<typename F,typename StoreFunctor>
+void TwoStageHelper
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Int b,
+  StoreFunctor store )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    LowerBand( A, householderScalars, b );
+
+    Matrix<F> ABand;
+    Zeros( ABand, 2*b, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+b+1,n); ++i )
+            ABand(i-j,j) = A(i,j);
+
+    Matrix<Base<F>> d, e;
+    ChaseBulges( b, ABand, d, e, store );
+    StoreTridiagonal( uplo, b, d, e, A );
+}
+
+// Since the band only requires O(n b) storage, it is gathered onto every
+// process, each of which chases the bulges independently (which avoids any
+// communication within the second stage) and keeps only the reflectors that
+// it owns in the [STAR,VR] distribution
+template<typename F,typename StoreFunctor>
+void TwoStageHelper
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  Int b,
+  StoreFunctor store )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    LowerBand( A, householderScalars, b );
+
+    Matrix<F> ABand;
+    Zeros( ABand, 2*b, n );
+    DistMatrix<F,STAR,STAR> diag(A.Grid());
+    for( Int offset=0; offset<=Min(b,n-1); ++offset )
+    {
+        diag = GetDiagonal( A, -offset );
+        for( Int j=0; j<n-offset; ++j )
+            ABand(offset,j) = diag.GetLocal(j,0);
+    }
+
+    Matrix<Base<F>> d, e;
+    ChaseBulges( b, ABand, d, e, store );
+    StoreTridiagonal( uplo, b, d, e, A );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<F>& bulgeReflectors,
+  Matrix<F>& bulgeScalars,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, ctrl.bandwidth );
+    const vector<Int> offsets = SweepOffsets( n, b );
+    Zeros( bulgeReflectors, b, offsets.back() );
+    Zeros( bulgeScalars, offsets.back(), 1 );
+
+    auto store = [&]( Int index, const F* v, Int length, const F& tau )
+    {
+        MemCopy( bulgeReflectors.Buffer(0,index), v, length );
+        bulgeScalars(index) = tau;
+    };
+    TwoStageHelper( uplo, A, householderScalars, b, store );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<F>& bulgeReflectorsPre,
+  AbstractDistMatrix<F>& bulgeScalarsPre,
+  const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids
+      ( APre, householderScalarsPre, bulgeReflectorsPre, bulgeScalarsPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+
+    // The i'th reflector and its scalar must be owned by the same process
+    ElementalProxyCtrl proxCtrl;
+    proxCtrl.colConstrain = true;
+    proxCtrl.rowConstrain = true;
+    proxCtrl.colAlign = 0;
+    proxCtrl.rowAlign = 0;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<F,F,STAR,VR>
+      bulgeReflectorsProx( bulgeReflectorsPre, proxCtrl );
+    DistMatrixWriteProxy<F,F,VR,STAR>
+      bulgeScalarsProx( bulgeScalarsPre, proxCtrl );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& bulgeReflectors = bulgeReflectorsProx.Get();
+    auto& bulgeScalars = bulgeScalarsProx.Get();
+
+    const Int n = A.Height();
+    const Int b = TwoStageBandwidth( n, ctrl.bandwidth );
+    const vector<Int> offsets = SweepOffsets( n, b );
+    Zeros( bulgeReflectors, b, offsets.back() );
+    Zeros( bulgeScalars, offsets.back(), 1 );
+
+    auto& bulgeReflectorsLoc = bulgeReflectors.Matrix();
+    auto& bulgeScalarsLoc = bulgeScalars.Matrix();
+    auto store = [&]( Int index, const F* v, Int length, const F& tau )
+    {
+        if( !bulgeReflectors.IsLocalCol(index) )
+            return;
+        const Int indexLoc = bulgeReflectors.LocalCol(index);
+        MemCopy( bulgeReflectorsLoc.Buffer(0,indexLoc), v, length );
+        bulgeScalarsLoc(indexLoc) = tau;
+    };
+    TwoStageHelper( uplo, A, householderScalars, b, store );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -152,7 +152,8 @@ void UpperPanel
             // Broadcast a01 and tau across the process row
             mpi::Broadcast
             ( rowBcastBuf.data(), 
-              a01LocalHeight+1, a01.RowAlign(), g.RowComm() );
+              a01LocalHeight+1, a01.RowAlign(), g.RowComm(),
+              SyncInfo<Device::CPU>() );
             // Store a01[MC] into its DistMatrix class and also store a copy
             // for the next iteration
             MemCopy
@@ -192,7 +193,7 @@ void UpperPanel
             mpi::Broadcast
             ( rowBcastBuf.data(), 
               a01LocalHeight+w01LastLocalHeight+1, 
-              a01.RowAlign(), g.RowComm() );
+              a01.RowAlign(), g.RowComm(), SyncInfo<Device::CPU>() );
             // Store a01[MC] into its DistMatrix class 
             MemCopy
             ( a01_MC.Buffer(), rowBcastBuf.data(), a01LocalHeight );
@@ -271,12 +272,13 @@ void UpperPanel
             // [VR,* ] <- [VC,* ]
             mpi::SendRecv
             ( sendBuf, portionSize, sendRankRM, 
-              recvBuf, portionSize, recvRankRM, g.VRComm() );
+              recvBuf, portionSize, recvRankRM, g.VRComm(),
+              SyncInfo<Device::CPU>() );
 
             // [MR,* ] <- [VR,* ]
             mpi::AllGather
             ( recvBuf, portionSize,
-              sendBuf, portionSize, g.ColComm() );
+              sendBuf, portionSize, g.ColComm(), SyncInfo<Device::CPU>() );
 
             // Unpack
             w01Last_MR.AlignWith( A00 );
@@ -363,7 +365,7 @@ void UpperPanel
               q01_MR.Buffer(), q01LocalHeight );
             mpi::AllReduce
             ( colSumSendBuf.data(), colSumRecvBuf.data(),
-              reduceSize, g.ColComm() );
+              reduceSize, g.ColComm(), SyncInfo<Device::CPU>() );
             MemCopy
             ( x21_MR.Buffer(), colSumRecvBuf.data(), x21LocalHeight );
             MemCopy
@@ -448,7 +450,8 @@ void UpperPanel
             const Int nextProcessCol = (alpha11.RowAlign()+c-1) % c;
             mpi::Reduce
             ( reduceToOneSendBuf.data(), reduceToOneRecvBuf.data(),
-              2*localHeight, nextProcessCol, g.RowComm() );
+              2*localHeight, nextProcessCol, g.RowComm(),
+              SyncInfo<Device::CPU>() );
             if( g.Col() == nextProcessCol )
             {
                 // Combine the second half into the first half        
@@ -468,7 +471,8 @@ void UpperPanel
                 sendBuf[0] = myDotProduct;
                 sendBuf[1] = ( g.Row()==nextProcessRow ? 
                                reduceToOneRecvBuf[localHeight-1] : 0 );
-                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm() );
+                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm(),
+                                SyncInfo<Device::CPU>() );
                 F dotProduct = recvBuf[0];
 
                 // Set up for the next iteration by filling in the values for:
@@ -550,7 +554,7 @@ void UpperPanel
 
             mpi::AllReduce
             ( allReduceSendBuf.data(), allReduceRecvBuf.data(),
-              2*localHeight, g.RowComm() );
+              2*localHeight, g.RowComm(), SyncInfo<Device::CPU>() );
 
             // Combine the second half into the first half        
             blas::Axpy
@@ -565,7 +569,8 @@ void UpperPanel
             F myDotProduct = blas::Dot
                 ( localHeight, allReduceRecvBuf.data(), 1, 
                                a01_MC_Buf,              1 );
-            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm() );
+            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm(),
+                                                 SyncInfo<Device::CPU>() );
 
             // Grab views into W[MC,* ] and W[MR,* ]
             auto w01_MC = W_MC_STAR( ind0, ALL );
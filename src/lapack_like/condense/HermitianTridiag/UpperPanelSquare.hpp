@@ -169,7 +169,8 @@ void UpperPanelSquare
             // Broadcast a01 and tau across the process row
             mpi::Broadcast
             ( rowBcastBuf.data(), 
-              a01LocalHeight+1, a01.RowAlign(), g.RowComm() );
+              a01LocalHeight+1, a01.RowAlign(), g.RowComm(),
+              SyncInfo<Device::CPU>() );
             // Store a01[MC] into its DistMatrix class and also store a copy
             // for the next iteration
             MemCopy
@@ -196,7 +197,8 @@ void UpperPanelSquare
                 const Int recvSize = A00.LocalWidth();
                 mpi::SendRecv
                 ( a01_MC.Buffer(), sendSize, transposeRank,
-                  a01_MR.Buffer(), recvSize, transposeRank, g.VCComm() );
+                  a01_MR.Buffer(), recvSize, transposeRank, g.VCComm(),
+                  SyncInfo<Device::CPU>() );
             }
             // Store a01[MR]
             MemCopy
@@ -223,7 +225,7 @@ void UpperPanelSquare
             mpi::Broadcast
             ( rowBcastBuf.data(), 
               a01LocalHeight+w01LastLocalHeight+1, 
-              a01.RowAlign(), g.RowComm() );
+              a01.RowAlign(), g.RowComm(), SyncInfo<Device::CPU>() );
             // Store a01[MC] into its DistMatrix class 
             MemCopy
             ( a01_MC.Buffer(), rowBcastBuf.data(), a01LocalHeight );
@@ -283,7 +285,8 @@ void UpperPanelSquare
                 // Pairwise exchange
                 mpi::SendRecv
                 ( sendBuf.data(), sendSize, transposeRank,
-                  recvBuf.data(), recvSize, transposeRank, g.VCComm() );
+                  recvBuf.data(), recvSize, transposeRank, g.VCComm(),
+                  SyncInfo<Device::CPU>() );
 
                 // Unpack the recv buffer
                 MemCopy
@@ -349,7 +352,7 @@ void UpperPanelSquare
               y21_MR.Buffer(), y21LocalHeight );
             mpi::AllReduce
             ( colSumSendBuf.data(), colSumRecvBuf.data(),
-              reduceSize, g.ColComm() );
+              reduceSize, g.ColComm(), SyncInfo<Device::CPU>() );
             MemCopy
             ( x21_MR.Buffer(), colSumRecvBuf.data(), x21LocalHeight );
             MemCopy
@@ -382,7 +385,8 @@ void UpperPanelSquare
 
             mpi::SendRecv
             ( q01_MR.Buffer(), sendSize, transposeRank,
-              recvBuf.data(),  recvSize, transposeRank, g.VCComm() );
+              recvBuf.data(),  recvSize, transposeRank, g.VCComm(),
+              SyncInfo<Device::CPU>() );
 
             // Unpack the recv buffer directly onto p01[MC]
             F* p01_MC_Buf = p01_MC.Buffer();
@@ -404,7 +408,8 @@ void UpperPanelSquare
 
             mpi::Reduce
             ( p01_MC.Buffer(), reduceToOneRecvBuf.data(),
-              a01LocalHeight, nextProcCol, g.RowComm() );
+              a01LocalHeight, nextProcCol, g.RowComm(),
+              SyncInfo<Device::CPU>() );
             if( g.Col() == nextProcCol )
             {
                 // Finish computing w01. During its computation, ensure that 
@@ -418,7 +423,8 @@ void UpperPanelSquare
                 sendBuf[0] = myDotProduct;
                 sendBuf[1] = ( g.Row()==nextProcRow ? 
                                reduceToOneRecvBuf[a01LocalHeight-1] : 0 );
-                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm() );
+                mpi::AllReduce( sendBuf, recvBuf, 2, g.ColComm(),
+                                SyncInfo<Device::CPU>() );
                 F dotProduct = recvBuf[0];
 
                 // Set up for the next iteration by filling in the values for:
@@ -443,7 +449,7 @@ void UpperPanelSquare
 
             mpi::AllReduce
             ( p01_MC.Buffer(), allReduceRecvBuf.data(), 
-              a01LocalHeight, g.RowComm() );
+              a01LocalHeight, g.RowComm(), SyncInfo<Device::CPU>() );
 
             // Finish computing w01. During its computation, ensure that 
             // every process has a copy of the last element of the w01.
@@ -452,7 +458,8 @@ void UpperPanelSquare
             F myDotProduct = blas::Dot
                 ( a01LocalHeight, allReduceRecvBuf.data(), 1, 
                                   a01_MC_Buf,              1 );
-            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm() );
+            const F dotProduct = mpi::AllReduce( myDotProduct, g.ColComm(),
+                                                 SyncInfo<Device::CPU>() );
 
             // Grab views into W[MC,* ] and W[MR,* ]
             auto w01_MC = W_MC_STAR( ind0, ind1-off );
@@ -478,7 +485,8 @@ void UpperPanelSquare
                 const Int recvSize = A00.LocalWidth();
                 mpi::SendRecv
                 ( w01_MC.Buffer(), sendSize, transposeRank,
-                  w01_MR.Buffer(), recvSize, transposeRank, g.VCComm() );
+                  w01_MR.Buffer(), recvSize, transposeRank, g.VCComm(),
+                  SyncInfo<Device::CPU>() );
             }
         }
     }
@@ -206,7 +206,8 @@ void SymmetricGeomEquil
             const Real scale = Sqrt(maxAbs);
             scalesLoc(jLoc) = scale;
         }
-        mpi::AllReduce( scales.Buffer(), nLocal, mpi::MAX, A.ColComm() );
+        mpi::AllReduce( scales.Buffer(), nLocal, mpi::MAX, A.ColComm(),
+                        SyncInfo<Device::CPU>() );
         DiagonalScale( LEFT, NORMAL, scales, d );
         // TODO(poulson): SymmetricDiagonalSolve
         DiagonalSolve( RIGHT, NORMAL, scales, A );
@@ -40,10 +40,13 @@ Base<Field> MinAbsNonzero
     Real minAbs;
     if( A.Participating() )
     {
-        const Real minLocAbs = MinAbsNonzero( A.LockedMatrix(), upperBound );
-        minAbs = mpi::AllReduce( minLocAbs, mpi::MIN, A.DistComm() );
+        const Real minLocAbs =
+          MinAbsNonzero
+          ( static_cast<const Matrix<Field>&>(A.LockedMatrix()), upperBound );
+        minAbs = mpi::AllReduce( minLocAbs, mpi::MIN, A.DistComm(),
+                                 SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( minAbs, A.Root(), A.CrossComm() );
+    mpi::Broadcast( minAbs, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return minAbs;
 }
 
@@ -156,7 +159,8 @@ void StackedGeometricColumnScaling
         }
         geomScalingLoc(jLoc) = minAbs;
     }
-    mpi::AllReduce( geomScaling.Buffer(), nLocal, mpi::MIN, A.ColComm() );
+    mpi::AllReduce( geomScaling.Buffer(), nLocal, mpi::MIN, A.ColComm(),
+                    SyncInfo<Device::CPU>() );
 
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
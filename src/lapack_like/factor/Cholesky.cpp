@@ -14,6 +14,9 @@
 #include "./Cholesky/ReverseUpperVariant3.hpp"
 #include "./Cholesky/PivotedLowerVariant3.hpp"
 #include "./Cholesky/PivotedUpperVariant3.hpp"
+#include "./Cholesky/Tiled.hpp"
+#include "./Cholesky/Recursive.hpp"
+#include "./Cholesky/OutOfCore.hpp"
 #include "./Cholesky/SolveAfter.hpp"
 
 #include "./Cholesky/LowerMod.hpp"
@@ -31,7 +34,10 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A )
       if( A.Height() != A.Width() )
           LogicError("A must be square");
     )
-    if( uplo == LOWER )
+    // Without BLAS support, the recursive variants make better use of cache
+    if( !IsBlasScalar<F>::value )
+        cholesky::Recursive( uplo, A );
+    else if( uplo == LOWER )
         cholesky::LowerVariant3Blocked( A );
     else
         cholesky::UpperVariant3Blocked( A );
@@ -67,13 +73,39 @@ void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A )
 
 namespace cholesky {
 
+template<typename F>
+void Tiled( UpperOrLower uplo, Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( uplo == LOWER )
+        cholesky::LowerTiled( A, tileSize );
+    else
+        cholesky::UpperTiled( A, tileSize );
+}
+
+template<typename F>
+void Recursive( UpperOrLower uplo, Matrix<F>& A, Int leafSize )
+{
+    EL_DEBUG_CSE
+    if( uplo == LOWER )
+        cholesky::LowerRecursive( A, leafSize );
+    else
+        cholesky::UpperRecursive( A, leafSize );
+}
+
 template<typename F,typename=EnableIf<IsBlasScalar<F>>>
 void ScaLAPACKHelper( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
     AssertScaLAPACKSupport();
 #ifdef EL_HAVE_SCALAPACK
     // TODO: Add support for optionally timing the proxy redistribution
-    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> ABlockProx( A );
+    // (which is skipped if A is already ScaLAPACK-compatible)
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK>
+      ABlockProx( A, ScaLAPACKProxyCtrl(A) );
     auto& ABlock = ABlockProx.Get();
 
     const Int n = ABlock.Height();
@@ -173,34 +205,13 @@ void CholeskyMod
 }
 
 template<typename F>
-void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A )
+void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<F>& A )
 {
     EL_DEBUG_CSE
-    HPSDSquareRoot( uplo, A );
-    MakeHermitian( uplo, A );
-
     if( uplo == LOWER )
-        lq::ExplicitTriang( A );
+        cholesky::LowerOutOfCore( A );
     else
-        qr::ExplicitTriang( A );
-}
-
-template<typename F>
-void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
-{
-    EL_DEBUG_CSE
-
-    // NOTE: This should be removed once HPSD, LQ, and QR have been generalized
-    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
-    auto& A = AProx.Get();
-
-    HPSDSquareRoot( uplo, A );
-    MakeHermitian( uplo, A );
-
-    if( uplo == LOWER )
-        lq::ExplicitTriang( A );
-    else
-        qr::ExplicitTriang( A );
+        LogicError("Out-of-core Cholesky is only supported for LOWER");
 }
 
 #define PROTO_BASE(F) \
@@ -214,6 +225,10 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void ReverseCholesky \
   ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A, Permutation& p ); \
+  template void cholesky::Tiled \
+  ( UpperOrLower uplo, Matrix<F>& A, Int tileSize ); \
+  template void cholesky::Recursive \
+  ( UpperOrLower uplo, Matrix<F>& A, Int leafSize ); \
   template void Cholesky \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<F>& A, \
@@ -244,17 +259,36 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
     const DistPermutation& p, \
           AbstractDistMatrix<F>& B ); 
 
+// The out-of-core panels are stored as raw bytes, which excludes BigFloat
+#define PROTO_OUT_OF_CORE(F) \
+  template void Cholesky( UpperOrLower uplo, OutOfCoreMatrix<F>& A ); \
+  template void cholesky::SolveAfter \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const OutOfCoreMatrix<F>& A, \
+          AbstractDistMatrix<F>& B );
+
 #define PROTO(F) \
   PROTO_BASE(F) \
-  template void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A ); \
-  template void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
-
-#define PROTO_DOUBLEDOUBLE PROTO_BASE(DoubleDouble)
-#define PROTO_QUADDOUBLE PROTO_BASE(QuadDouble)
-#define PROTO_COMPLEX_DOUBLEDOUBLE PROTO_BASE(Complex<DoubleDouble>)
-#define PROTO_COMPLEX_QUADDOUBLE PROTO_BASE(Complex<QuadDouble>)
-#define PROTO_QUAD PROTO_BASE(Quad)
-#define PROTO_COMPLEX_QUAD PROTO_BASE(Complex<Quad>)
+  PROTO_OUT_OF_CORE(F)
+
+#define PROTO_DOUBLEDOUBLE \
+  PROTO_BASE(DoubleDouble) \
+  PROTO_OUT_OF_CORE(DoubleDouble)
+#define PROTO_QUADDOUBLE \
+  PROTO_BASE(QuadDouble) \
+  PROTO_OUT_OF_CORE(QuadDouble)
+#define PROTO_COMPLEX_DOUBLEDOUBLE \
+  PROTO_BASE(Complex<DoubleDouble>) \
+  PROTO_OUT_OF_CORE(Complex<DoubleDouble>)
+#define PROTO_COMPLEX_QUADDOUBLE \
+  PROTO_BASE(Complex<QuadDouble>) \
+  PROTO_OUT_OF_CORE(Complex<QuadDouble>)
+#define PROTO_QUAD \
+  PROTO_BASE(Quad) \
+  PROTO_OUT_OF_CORE(Quad)
+#define PROTO_COMPLEX_QUAD \
+  PROTO_BASE(Complex<Quad>) \
+  PROTO_OUT_OF_CORE(Complex<Quad>)
 #define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
 #define PROTO_COMPLEX_BIGFLOAT PROTO_BASE(Complex<BigFloat>)
 
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_OUTOFCORE_HPP
+#define EL_CHOLESKY_OUTOFCORE_HPP
+
+namespace El {
+namespace cholesky {
+
+// A left-looking Cholesky factorization which only ever holds the panel being
+// factored, the previously-factored panel being applied to it, and the
+// read-ahead/write-behind buffers in memory. Each previously-factored panel
+// is therefore read once per subsequent panel, and so the panels should be
+// made as wide as the memory budget allows.
+
+template<typename F>
+void LowerOutOfCore( OutOfCoreMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = A.Grid();
+    const Int numPanels = A.NumPanels();
+    const bool progress = A.Ctrl().progress;
+
+    DistMatrix<F> AK(g), AJ(g);
+    for( Int k=0; k<numPanels; ++k )
+    {
+        if( progress )
+            OutputFromRoot
+            (g.Comm(),"Factoring panel ",k," of ",numPanels);
+        const Int offK = A.PanelOffset(k);
+        const Int nbK = A.PanelWidth(k);
+        const Range<Int> ind1( offK, offK+nbK ), indB( offK, END );
+
+        A.ReadPanel( k, AK );
+        auto AKB = AK( indB, ALL );
+        for( Int j=0; j<k; ++j )
+        {
+            const Int next = ( j+1 < k ? j+1 : k+1 );
+            if( next < numPanels )
+                A.Prefetch( next );
+            A.ReadPanel( j, AJ );
+            auto AJ1 = AJ( ind1, ALL );
+            auto AJB = AJ( indB, ALL );
+            Gemm( NORMAL, ADJOINT, F(-1), AJB, AJ1, F(1), AKB );
+        }
+        if( k == 0 && numPanels > 1 )
+            A.Prefetch( 1 );
+
+        auto AK11 = AK( ind1, ALL );
+        auto AK21 = AK( IR(offK+nbK,END), ALL );
+        Cholesky( LOWER, AK11 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), AK11, AK21 );
+        A.WritePanel( k, AK );
+    }
+    A.Flush();
+}
+
+template<typename F>
+void SolveAfter
+( UpperOrLower uplo,
+  Orientation orientation,
+  const OutOfCoreMatrix<F>& A,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    if( uplo != LOWER )
+        LogicError("Out-of-core Cholesky factors are always lower");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+
+    const Int numPanels = A.NumPanels();
+    DistMatrix<F> L(A.Grid());
+
+    // Solve against L, streaming the panels forward
+    for( Int j=0; j<numPanels; ++j )
+    {
+        if( j+1 < numPanels )
+            A.Prefetch( j+1 );
+        A.ReadPanel( j, L );
+        const Int off = A.PanelOffset(j);
+        const Range<Int> ind1( off, off+A.PanelWidth(j) ),
+                         ind2( off+A.PanelWidth(j), END );
+        auto L11 = L( ind1, ALL );
+        auto L21 = L( ind2, ALL );
+        auto B1 = B( ind1, ALL );
+        auto B2 = B( ind2, ALL );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L11, B1 );
+        Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+    }
+
+    // Solve against L^H, streaming the panels backward (the last panel is
+    // still resident)
+    for( Int j=numPanels-1; j>=0; --j )
+    {
+        if( j > 0 )
+            A.Prefetch( j-1 );
+        if( j != numPanels-1 )
+            A.ReadPanel( j, L );
+        const Int off = A.PanelOffset(j);
+        const Range<Int> ind1( off, off+A.PanelWidth(j) ),
+                         ind2( off+A.PanelWidth(j), END );
+        auto L11 = L( ind1, ALL );
+        auto L21 = L( ind2, ALL );
+        auto B1 = B( ind1, ALL );
+        auto B2 = B( ind2, ALL );
+        Gemm( ADJOINT, NORMAL, F(-1), L21, B2, F(1), B1 );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), L11, B1 );
+    }
+
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_OUTOFCORE_HPP
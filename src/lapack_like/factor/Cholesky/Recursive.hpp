@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_RECURSIVE_HPP
+#define EL_CHOLESKY_RECURSIVE_HPP
+
+#include "./LowerVariant3.hpp"
+#include "./UpperVariant3.hpp"
+
+// Cache-oblivious variants which halve the matrix rather than sweeping over
+// it in blocks of a fixed width, so that all but O(n^2 leafSize) of the work
+// is performed by Trsm and Herk on submatrices of every size (which, for the
+// scalar types without BLAS support, themselves recurse down to GEMM).
+
+namespace El {
+namespace cholesky {
+
+template<typename F>
+void LowerRecursive( Matrix<F>& A, Int leafSize=32 )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    if( n <= leafSize )
+    {
+        cholesky::LowerVariant3Unblocked( A );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    LowerRecursive( A11, leafSize );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Herk( LOWER, NORMAL, Base<F>(-1), A21, Base<F>(1), A22 );
+    LowerRecursive( A22, leafSize );
+}
+
+template<typename F>
+void UpperRecursive( Matrix<F>& A, Int leafSize=32 )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    if( n <= leafSize )
+    {
+        cholesky::UpperVariant3Unblocked( A );
+        return;
+    }
+    const Int n1 = n/2;
+    const Range<Int> ind1( 0, n1 ), ind2( n1, n );
+
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A22 = A( ind2, ind2 );
+
+    UpperRecursive( A11, leafSize );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+    Herk( UPPER, ADJOINT, Base<F>(-1), A12, Base<F>(1), A22 );
+    UpperRecursive( A22, leafSize );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_RECURSIVE_HPP
@@ -0,0 +1,199 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_TILED_HPP
+#define EL_CHOLESKY_TILED_HPP
+
+#include "../TileDAG.hpp"
+#include "./LowerVariant3.hpp"
+#include "./UpperVariant3.hpp"
+
+// The tiled variants express right-looking Cholesky as a DAG of tile kernels
+// (the diagonal factorization, the panel triangular solves, and the
+// Herk/Gemm trailing updates) whose dependencies are tracked by the OpenMP
+// runtime. The trailing update of step k therefore overlaps with the
+// factorization of the panel of step k+1. Without EL_HYBRID the tasks execute
+// in program order, which is itself a valid topological ordering of the DAG.
+
+namespace El {
+namespace cholesky {
+
+template<typename F>
+void LowerTiled( Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    const vector<Int> offsets = tile_dag::Offsets( n, n, tileSize );
+    const Int numTiles = offsets.size()-1;
+    auto tile = [&]( Int i, Int j )
+    {
+        return A( IR(offsets[i],offsets[i+1]), IR(offsets[j],offsets[j+1]) );
+    };
+
+#ifdef EL_HYBRID
+    // One sentinel per tile for the OpenMP runtime to track dependencies on
+    vector<char> sentinels( numTiles*numTiles );
+    char* deps = sentinels.data();
+#endif
+    tile_dag::ExceptionTrap trap;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( Int k=0; k<numTiles; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task depend(inout:deps[k+k*numTiles])
+#endif
+        trap.Run( [&,k]()
+        {
+            auto Akk = tile( k, k );
+            cholesky::LowerVariant3Blocked( Akk );
+        });
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[k+k*numTiles]) \
+                             depend(inout:deps[i+k*numTiles])
+#endif
+            trap.Run( [&,i,k]()
+            {
+                auto Akk = tile( k, k );
+                auto Aik = tile( i, k );
+                Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), Akk, Aik );
+            });
+        }
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[i+k*numTiles]) \
+                             depend(inout:deps[i+i*numTiles])
+#endif
+            trap.Run( [&,i,k]()
+            {
+                auto Aik = tile( i, k );
+                auto Aii = tile( i, i );
+                Herk( LOWER, NORMAL, Base<F>(-1), Aik, Base<F>(1), Aii );
+            });
+
+            for( Int j=k+1; j<i; ++j )
+            {
+#ifdef EL_HYBRID
+                #pragma omp task depend(in:deps[i+k*numTiles]) \
+                                 depend(in:deps[j+k*numTiles]) \
+                                 depend(inout:deps[i+j*numTiles])
+#endif
+                trap.Run( [&,i,j,k]()
+                {
+                    auto Aik = tile( i, k );
+                    auto Ajk = tile( j, k );
+                    auto Aij = tile( i, j );
+                    Gemm( NORMAL, ADJOINT, F(-1), Aik, Ajk, F(1), Aij );
+                });
+            }
+        }
+    }
+    trap.Rethrow();
+}
+
+template<typename F>
+void UpperTiled( Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Int n = A.Height();
+    const vector<Int> offsets = tile_dag::Offsets( n, n, tileSize );
+    const Int numTiles = offsets.size()-1;
+    auto tile = [&]( Int i, Int j )
+    {
+        return A( IR(offsets[i],offsets[i+1]), IR(offsets[j],offsets[j+1]) );
+    };
+
+#ifdef EL_HYBRID
+    // One sentinel per tile for the OpenMP runtime to track dependencies on
+    vector<char> sentinels( numTiles*numTiles );
+    char* deps = sentinels.data();
+#endif
+    tile_dag::ExceptionTrap trap;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( Int k=0; k<numTiles; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task depend(inout:deps[k+k*numTiles])
+#endif
+        trap.Run( [&,k]()
+        {
+            auto Akk = tile( k, k );
+            cholesky::UpperVariant3Blocked( Akk );
+        });
+
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[k+k*numTiles]) \
+                             depend(inout:deps[k+j*numTiles])
+#endif
+            trap.Run( [&,j,k]()
+            {
+                auto Akk = tile( k, k );
+                auto Akj = tile( k, j );
+                Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), Akk, Akj );
+            });
+        }
+
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[k+j*numTiles]) \
+                             depend(inout:deps[j+j*numTiles])
+#endif
+            trap.Run( [&,j,k]()
+            {
+                auto Akj = tile( k, j );
+                auto Ajj = tile( j, j );
+                Herk( UPPER, ADJOINT, Base<F>(-1), Akj, Base<F>(1), Ajj );
+            });
+
+            for( Int i=k+1; i<j; ++i )
+            {
+#ifdef EL_HYBRID
+                #pragma omp task depend(in:deps[k+i*numTiles]) \
+                                 depend(in:deps[k+j*numTiles]) \
+                                 depend(inout:deps[i+j*numTiles])
+#endif
+                trap.Run( [&,i,j,k]()
+                {
+                    auto Aki = tile( k, i );
+                    auto Akj = tile( k, j );
+                    auto Aij = tile( i, j );
+                    Gemm( ADJOINT, NORMAL, F(-1), Aki, Akj, F(1), Aij );
+                });
+            }
+        }
+    }
+    trap.Rethrow();
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_TILED_HPP
@@ -0,0 +1,54 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// HPSDCholesky is kept apart from the other Cholesky factorizations since it
+// is built upon HPSDSquareRoot, and hence the Hermitian eigensolver
+
+namespace El {
+
+template<typename F>
+void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    HPSDSquareRoot( uplo, A );
+    MakeHermitian( uplo, A );
+
+    if( uplo == LOWER )
+        lq::ExplicitTriang( A );
+    else
+        qr::ExplicitTriang( A );
+}
+
+template<typename F>
+void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+
+    // NOTE: This should be removed once HPSD, LQ, and QR have been generalized
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    HPSDSquareRoot( uplo, A );
+    MakeHermitian( uplo, A );
+
+    if( uplo == LOWER )
+        lq::ExplicitTriang( A );
+    else
+        qr::ExplicitTriang( A );
+}
+
+#define PROTO(F) \
+  template void HPSDCholesky( UpperOrLower uplo, Matrix<F>& A ); \
+  template void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -134,9 +134,12 @@ Inertia
 
     // TODO: Combine into single communication
     InertiaType inertia;
-    inertia.numPositive = mpi::AllReduce( locInert.numPositive, d.ColComm() );
-    inertia.numNegative = mpi::AllReduce( locInert.numNegative, d.ColComm() );
-    inertia.numZero     = mpi::AllReduce( locInert.numZero,     d.ColComm() );
+    inertia.numPositive = mpi::AllReduce( locInert.numPositive, d.ColComm(),
+                                          SyncInfo<Device::CPU>() );
+    inertia.numNegative = mpi::AllReduce( locInert.numNegative, d.ColComm(),
+                                          SyncInfo<Device::CPU>() );
+    inertia.numZero     = mpi::AllReduce( locInert.numZero,     d.ColComm(),
+                                          SyncInfo<Device::CPU>() );
 
     return inertia;
 }
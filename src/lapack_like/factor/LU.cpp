@@ -13,6 +13,9 @@
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
+#include "./LU/Tiled.hpp"
+#include "./LU/OutOfCore.hpp"
+#include "./LU/Recursive.hpp"
 
 namespace El {
 
@@ -105,6 +108,12 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P )
 {
     EL_DEBUG_CSE
+    // Without BLAS support, the recursive variant makes better use of cache
+    if( !IsBlasScalar<F>::value )
+    {
+        lu::Recursive( A, P );
+        return;
+    }
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -230,10 +239,20 @@ void LU
     lu::Full( A, P, Q );
 }
 
-#define PROTO(F) \
+template<typename F>
+void LU( OutOfCoreMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    lu::OutOfCore( A, P );
+}
+
+#define PROTO_BASE(F) \
   template void LU( Matrix<F>& A ); \
   template void LU( AbstractDistMatrix<F>& A ); \
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
+  template void lu::Tiled( Matrix<F>& A, Int tileSize ); \
+  template void lu::Recursive \
+  ( Matrix<F>& A, Permutation& P, Int leafSize ); \
   template void LU \
   ( Matrix<F>& A, \
     Permutation& P ); \
@@ -305,6 +324,18 @@ void LU
     const DistPermutation& Q, \
           AbstractDistMatrix<F>& B );
 
+// The out-of-core panels are stored as raw bytes, which excludes BigFloat
+#define PROTO(F) \
+  PROTO_BASE(F) \
+  template void LU( OutOfCoreMatrix<F>& A, DistPermutation& P ); \
+  template void lu::SolveAfter \
+  ( Orientation orientation, \
+    const OutOfCoreMatrix<F>& A, \
+    const DistPermutation& P, \
+          AbstractDistMatrix<F>& B );
+#define PROTO_BIGFLOAT PROTO_BASE(BigFloat)
+#define PROTO_COMPLEX_BIGFLOAT PROTO_BASE(Complex<BigFloat>)
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
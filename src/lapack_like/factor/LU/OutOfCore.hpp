@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_OUTOFCORE_HPP
+#define EL_LU_OUTOFCORE_HPP
+
+namespace El {
+namespace lu {
+
+// A left-looking LU factorization with partial pivoting over the column
+// panels of an out-of-core matrix. Before panel k is factored, it is updated
+// by each of the previously-factored panels in turn. The row swaps chosen by
+// later panels are applied to the L factors of earlier panels lazily, i.e.,
+// the next time that the earlier panel is read (and once more at the end for
+// the swaps which no later panel caused to be applied).
+
+template<typename F>
+void OutOfCore( OutOfCoreMatrix<F>& A, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int numPanels = A.NumPanels();
+    const bool progress = A.Ctrl().progress;
+
+    P.SetGrid( g );
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    // The row swaps from each of the panels which contained pivots, as well
+    // as the number of such panels whose swaps have been applied to each
+    // stored panel
+    vector<unique_ptr<DistPermutation>> panelPerms;
+    vector<Int> numApplied( numPanels, 0 );
+
+    DistMatrix<F> AK(g), AJ(g);
+    auto applyPendingSwaps = [&]( Int j, Int numSwapPanels )
+    {
+        if( numApplied[j] >= numSwapPanels )
+            return false;
+        for( Int i=numApplied[j]; i<numSwapPanels; ++i )
+        {
+            auto AJB = AJ( IR(A.PanelOffset(i),END), ALL );
+            panelPerms[i]->PermuteRows( AJB );
+        }
+        numApplied[j] = numSwapPanels;
+        return true;
+    };
+
+    for( Int k=0; k<numPanels; ++k )
+    {
+        if( progress )
+            OutputFromRoot
+            (g.Comm(),"Factoring panel ",k," of ",numPanels);
+        const Int offK = A.PanelOffset(k);
+        const Int numSwapPanels = panelPerms.size();
+
+        A.ReadPanel( k, AK );
+        P.PermuteRows( AK );
+        for( Int j=0; j<numSwapPanels; ++j )
+        {
+            const Int next = ( j+1 < numSwapPanels ? j+1 : k+1 );
+            if( next < numPanels )
+                A.Prefetch( next );
+            A.ReadPanel( j, AJ );
+            if( applyPendingSwaps( j, numSwapPanels ) )
+                A.WritePanel( j, AJ );
+
+            const Int offJ = A.PanelOffset(j);
+            const Int nbJ = Min( A.PanelWidth(j), minDim-offJ );
+            const Range<Int> ind1( offJ, offJ+nbJ ), ind2( offJ+nbJ, END );
+            auto L11 = AJ( ind1, IR(0,nbJ) );
+            auto L21 = AJ( ind2, IR(0,nbJ) );
+            auto AK1 = AK( ind1, ALL );
+            auto AK2 = AK( ind2, ALL );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, AK1 );
+            Gemm( NORMAL, NORMAL, F(-1), L21, AK1, F(1), AK2 );
+        }
+        if( numSwapPanels == 0 && k+1 < numPanels )
+            A.Prefetch( k+1 );
+
+        if( offK < minDim )
+        {
+            auto AKB = AK( IR(offK,END), ALL );
+            panelPerms.emplace_back( new DistPermutation(g) );
+            LU( AKB, *panelPerms.back() );
+            P.SwapSequence( *panelPerms.back(), offK );
+            numApplied[k] = panelPerms.size();
+        }
+        A.WritePanel( k, AK );
+    }
+
+    // Apply the swaps from the trailing panels to the earlier L factors
+    const Int numSwapPanels = panelPerms.size();
+    for( Int j=0; j<numSwapPanels; ++j )
+    {
+        if( numApplied[j] == numSwapPanels )
+            continue;
+        A.ReadPanel( j, AJ );
+        applyPendingSwaps( j, numSwapPanels );
+        A.WritePanel( j, AJ );
+    }
+    A.Flush();
+}
+
+template<typename F>
+void SolveAfter
+( Orientation orientation,
+  const OutOfCoreMatrix<F>& A,
+  const DistPermutation& P,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.Height() != BPre.Height() )
+          LogicError("A and B must be the same height");
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Int numPanels = A.NumPanels();
+    DistMatrix<F> AJ(A.Grid());
+    auto readPanel = [&]( Int j, Int next )
+    {
+        if( next >= 0 && next < numPanels )
+            A.Prefetch( next );
+        A.ReadPanel( j, AJ );
+    };
+
+    if( orientation == NORMAL )
+    {
+        P.PermuteRows( B );
+        for( Int j=0; j<numPanels; ++j )
+        {
+            readPanel( j, j+1 );
+            const Int off = A.PanelOffset(j);
+            const Range<Int> ind1( off, off+A.PanelWidth(j) ),
+                             ind2( off+A.PanelWidth(j), END );
+            auto L11 = AJ( ind1, ALL );
+            auto L21 = AJ( ind2, ALL );
+            auto B1 = B( ind1, ALL );
+            auto B2 = B( ind2, ALL );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, B1 );
+            Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+        }
+        for( Int j=numPanels-1; j>=0; --j )
+        {
+            if( j != numPanels-1 )
+                readPanel( j, j-1 );
+            else if( j > 0 )
+                A.Prefetch( j-1 );
+            const Int off = A.PanelOffset(j);
+            const Range<Int> ind0( 0, off ), ind1( off, off+A.PanelWidth(j) );
+            auto U01 = AJ( ind0, ALL );
+            auto U11 = AJ( ind1, ALL );
+            auto B0 = B( ind0, ALL );
+            auto B1 = B( ind1, ALL );
+            Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), U11, B1 );
+            Gemm( NORMAL, NORMAL, F(-1), U01, B1, F(1), B0 );
+        }
+    }
+    else
+    {
+        for( Int j=0; j<numPanels; ++j )
+        {
+            readPanel( j, j+1 );
+            const Int off = A.PanelOffset(j);
+            const Range<Int> ind0( 0, off ), ind1( off, off+A.PanelWidth(j) );
+            auto U01 = AJ( ind0, ALL );
+            auto U11 = AJ( ind1, ALL );
+            auto B0 = B( ind0, ALL );
+            auto B1 = B( ind1, ALL );
+            Gemm( orientation, NORMAL, F(-1), U01, B0, F(1), B1 );
+            Trsm( LEFT, UPPER, orientation, NON_UNIT, F(1), U11, B1 );
+        }
+        for( Int j=numPanels-1; j>=0; --j )
+        {
+            if( j != numPanels-1 )
+                readPanel( j, j-1 );
+            else if( j > 0 )
+                A.Prefetch( j-1 );
+            const Int off = A.PanelOffset(j);
+            const Range<Int> ind1( off, off+A.PanelWidth(j) ),
+                             ind2( off+A.PanelWidth(j), END );
+            auto L11 = AJ( ind1, ALL );
+            auto L21 = AJ( ind2, ALL );
+            auto B1 = B( ind1, ALL );
+            auto B2 = B( ind2, ALL );
+            Gemm( orientation, NORMAL, F(-1), L21, B2, F(1), B1 );
+            Trsm( LEFT, LOWER, orientation, UNIT, F(1), L11, B1 );
+        }
+        P.InversePermuteRows( B );
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_OUTOFCORE_HPP
@@ -81,7 +81,7 @@ void Panel
     F* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
-    mpi::Comm colComm = B.ColComm();
+    mpi::Comm const& colComm = B.ColComm();
     mpi::Op maxLocOp = mpi::MaxLocOp<Real>();
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
@@ -113,7 +113,8 @@ void Panel
             localPivot.index = B.GlobalRow(aB1LocalInd-(n-k)) + n;
 
         // Compute and store the location of the new pivot
-        const auto pivot = mpi::AllReduce( localPivot, maxLocOp, colComm );
+        const auto pivot = mpi::AllReduce( localPivot, maxLocOp, colComm,
+                                           SyncInfo<Device::CPU>() );
         const Int iPiv = pivot.index;
         P.Swap( k+offset, iPiv+offset );
         PB.Swap( k, iPiv );
@@ -138,7 +139,8 @@ void Panel
                     BBuf[iLoc+j*BLDim] = ABuf[k+j*ALDim];
             }
             // The owning row broadcasts within process columns
-            mpi::Broadcast( pivotBuffer.data(), n, ownerRow, colComm );
+            mpi::Broadcast( pivotBuffer.data(), n, ownerRow, colComm,
+                            SyncInfo<Device::CPU>() );
             // Overwrite the current row with the pivot row
             for( Int j=0; j<n; ++j )
                 ABuf[k+j*ALDim] = pivotBuffer[j];
@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_RECURSIVE_HPP
+#define EL_LU_RECURSIVE_HPP
+
+#include "./Panel.hpp"
+
+namespace El {
+namespace lu {
+
+// Toledo's recursive LU with partial pivoting of a tall panel: the left half
+// of the columns is factored recursively, its row swaps and triangular solve
+// are applied to the right half, and the Schur complement is then factored
+// recursively. As in lu::Panel, the swaps are recorded in both the global
+// permutation P (shifted by 'offset') and the local permutation PB.
+template<typename F>
+void RecursivePanel
+( Matrix<F>& A,
+  Permutation& P,
+  Permutation& PB,
+  Int offset,
+  Int leafSize=32 )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( m < n )
+          LogicError("Must be a column panel");
+    )
+    if( n <= leafSize )
+    {
+        lu::Panel( A, P, PB, offset );
+        return;
+    }
+    const Int n1 = n/2;
+    const IR ind1( 0, n1 ), ind2( n1, n ), indB( n1, m );
+
+    auto AL = A( ALL, ind1 );
+    auto AR = A( ALL, ind2 );
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A21 = A( indB, ind1 );
+    auto A22 = A( indB, ind2 );
+
+    Permutation PL, PR;
+    RecursivePanel( AL, P, PL, offset, leafSize );
+    PL.PermuteRows( AR );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+
+    RecursivePanel( A22, P, PR, offset+n1, leafSize );
+    PR.PermuteRows( A21 );
+
+    PB.MakeIdentity( m );
+    PB.ReserveSwaps( n );
+    PB.SwapSequence( PL );
+    PB.SwapSequence( PR, n1 );
+}
+
+template<typename F>
+void Recursive( Matrix<F>& A, Permutation& P, Int leafSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    auto AL = A( ALL, IR(0,minDim) );
+    auto AR = A( ALL, IR(minDim,n) );
+    Permutation PB;
+    RecursivePanel( AL, P, PB, 0, leafSize );
+    if( n > minDim )
+    {
+        // The panel was square, so only U12 remains to be formed
+        auto L11 = A( IR(0,minDim), IR(0,minDim) );
+        PB.PermuteRows( AR );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, AR );
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_RECURSIVE_HPP
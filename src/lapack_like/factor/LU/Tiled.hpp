@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TILED_HPP
+#define EL_LU_TILED_HPP
+
+#include "../TileDAG.hpp"
+
+namespace El {
+namespace lu {
+
+// Local LU _without_ pivoting expressed as a DAG of tile kernels which is
+// scheduled with OpenMP tasks (and executed in program order otherwise).
+// Each step factors a diagonal tile, performs the triangular solves for the
+// tiles in its block row and column, and then issues one Gemm per trailing
+// tile, so that the trailing update overlaps with the next diagonal tile.
+
+template<typename F>
+void Tiled( Matrix<F>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const vector<Int> rowOffsets = tile_dag::Offsets( m, minDim, tileSize );
+    const vector<Int> colOffsets = tile_dag::Offsets( n, minDim, tileSize );
+    const Int numRowTiles = rowOffsets.size()-1;
+    const Int numColTiles = colOffsets.size()-1;
+    const Int numSteps = (minDim+tileSize-1)/tileSize;
+    auto tile = [&]( Int i, Int j )
+    {
+        return A
+          ( IR(rowOffsets[i],rowOffsets[i+1]),
+            IR(colOffsets[j],colOffsets[j+1]) );
+    };
+
+#ifdef EL_HYBRID
+    // One sentinel per tile for the OpenMP runtime to track dependencies on
+    vector<char> sentinels( numRowTiles*numColTiles );
+    char* deps = sentinels.data();
+#endif
+    tile_dag::ExceptionTrap trap;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( Int k=0; k<numSteps; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task depend(inout:deps[k+k*numRowTiles])
+#endif
+        trap.Run( [&,k]()
+        {
+            auto Akk = tile( k, k );
+            LU( Akk );
+        });
+
+        for( Int j=k+1; j<numColTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[k+k*numRowTiles]) \
+                             depend(inout:deps[k+j*numRowTiles])
+#endif
+            trap.Run( [&,j,k]()
+            {
+                auto Akk = tile( k, k );
+                auto Akj = tile( k, j );
+                Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), Akk, Akj );
+            });
+        }
+
+        for( Int i=k+1; i<numRowTiles; ++i )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[k+k*numRowTiles]) \
+                             depend(inout:deps[i+k*numRowTiles])
+#endif
+            trap.Run( [&,i,k]()
+            {
+                auto Akk = tile( k, k );
+                auto Aik = tile( i, k );
+                Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), Akk, Aik );
+            });
+        }
+
+        for( Int j=k+1; j<numColTiles; ++j )
+        {
+            for( Int i=k+1; i<numRowTiles; ++i )
+            {
+#ifdef EL_HYBRID
+                #pragma omp task depend(in:deps[i+k*numRowTiles]) \
+                                 depend(in:deps[k+j*numRowTiles]) \
+                                 depend(inout:deps[i+j*numRowTiles])
+#endif
+                trap.Run( [&,i,j,k]()
+                {
+                    auto Aik = tile( i, k );
+                    auto Akj = tile( k, j );
+                    auto Aij = tile( i, j );
+                    Gemm( NORMAL, NORMAL, F(-1), Aik, Akj, F(1), Aij );
+                });
+            }
+        }
+    }
+    trap.Rethrow();
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TILED_HPP
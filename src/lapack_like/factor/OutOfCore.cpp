@@ -0,0 +1,338 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+namespace El {
+
+namespace {
+
+// Unwritten regions of the panel file are treated as zero
+template<typename T>
+void ReadEntries
+( const string& filename, Int offset, Int numEntries, T* buffer )
+{
+    EL_DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::in | std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekg( offset*sizeof(T) );
+    Int numRead = 0;
+    if( file )
+    {
+        file.read
+        ( reinterpret_cast<char*>(buffer), numEntries*sizeof(T) );
+        numRead = file.gcount() / sizeof(T);
+    }
+    for( Int k=numRead; k<numEntries; ++k )
+        buffer[k] = T(0);
+}
+
+template<typename T>
+void WriteEntries
+( const string& filename, Int offset, Int numEntries, const T* buffer )
+{
+    EL_DEBUG_CSE
+    std::fstream file
+    ( filename.c_str(), std::ios::in | std::ios::out | std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.seekp( offset*sizeof(T) );
+    file.write
+    ( reinterpret_cast<const char*>(buffer), numEntries*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not write panel data to ",filename);
+}
+
+// Distinguishes the panel files of matrices constructed concurrently from
+// different threads
+std::atomic<Int> outOfCoreCounter{0};
+
+} // anonymous namespace
+
+template<typename T>
+OutOfCoreMatrix<T>::OutOfCoreMatrix
+( const El::Grid& grid,
+  Int height,
+  Int width,
+  const OutOfCoreCtrl& ctrl )
+: grid_(&grid), height_(height), width_(width), ctrl_(ctrl)
+{
+    EL_DEBUG_CSE
+    const Int r = grid.Height();
+    const Int c = grid.Width();
+
+    Int nb = ctrl.panelWidth;
+    if( nb <= 0 )
+    {
+        // Keep the four resident panels within the memory budget
+        const Int maxLocHeight = Max( MaxLength(height,r), Int(1) );
+        const Int maxLocWidth =
+          ctrl.memoryBudget / (4*maxLocHeight*sizeof(T));
+        nb = maxLocWidth*c;
+        const Int bsize = Blocksize();
+        if( nb >= bsize )
+            nb = (nb/bsize)*bsize;
+        if( nb <= 0 )
+            LogicError
+            ("A memory budget of ",ctrl.memoryBudget,
+             " bytes cannot hold four panels of height ",height);
+    }
+    nb = Min( nb, Max(width,Int(1)) );
+
+    const Int colShift = grid.MCRank();
+    const Int rowShift = grid.MRRank();
+    const Int localHeight = Length( height, colShift, r );
+    panelOffsets_.push_back( 0 );
+    fileOffsets_.push_back( 0 );
+    for( Int j=0; j<width; j+=nb )
+    {
+        const Int panelWidth = Min(nb,width-j);
+        panelOffsets_.push_back( j+panelWidth );
+        fileOffsets_.push_back
+        ( fileOffsets_.back() + localHeight*Length(panelWidth,rowShift,c) );
+    }
+
+    // Agree upon a tag so that concurrent jobs sharing a directory do not
+    // collide
+    Int tag = 0;
+    if( mpi::Rank(grid.Comm()) == 0 )
+        tag = std::random_device()();
+    mpi::Broadcast( tag, 0, grid.Comm(), SyncInfo<Device::CPU>{} );
+    filename_ =
+      BuildString
+      (ctrl.directory,"/El_ooc_",tag,"_",outOfCoreCounter++,"_",
+       mpi::Rank(grid.Comm()),".bin");
+    std::ofstream file
+    ( filename_.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !file.is_open() )
+        RuntimeError("Could not create ",filename_);
+}
+
+template<typename T>
+OutOfCoreMatrix<T>::~OutOfCoreMatrix()
+{
+    try { Flush(); }
+    catch( std::exception& e ) { ReportException(e); }
+    std::remove( filename_.c_str() );
+}
+
+template<typename T>
+Int OutOfCoreMatrix<T>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename T>
+Int OutOfCoreMatrix<T>::Width() const EL_NO_EXCEPT { return width_; }
+template<typename T>
+const El::Grid& OutOfCoreMatrix<T>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+template<typename T>
+const OutOfCoreCtrl& OutOfCoreMatrix<T>::Ctrl() const EL_NO_EXCEPT
+{ return ctrl_; }
+
+template<typename T>
+Int OutOfCoreMatrix<T>::NumPanels() const EL_NO_EXCEPT
+{ return panelOffsets_.size()-1; }
+template<typename T>
+Int OutOfCoreMatrix<T>::PanelOffset( Int j ) const EL_NO_EXCEPT
+{ return panelOffsets_[j]; }
+template<typename T>
+Int OutOfCoreMatrix<T>::PanelWidth( Int j ) const EL_NO_EXCEPT
+{ return panelOffsets_[j+1]-panelOffsets_[j]; }
+
+template<typename T>
+Int OutOfCoreMatrix<T>::PanelLocalSize( Int j ) const
+{ return fileOffsets_[j+1]-fileOffsets_[j]; }
+
+template<typename T>
+void OutOfCoreMatrix<T>::WaitForWrite( Int j ) const
+{
+    EL_DEBUG_CSE
+    auto it = pendingWrites_.find( j );
+    if( it != pendingWrites_.end() )
+    {
+        auto write = it->second;
+        pendingWrites_.erase( it );
+        write.get();
+    }
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Import( const AbstractDistMatrix<T>& APre )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != height_ || APre.Width() != width_ )
+        LogicError("Imported matrix was of the wrong size");
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    DistMatrix<T> panel(*grid_);
+    for( Int j=0; j<NumPanels(); ++j )
+    {
+        auto AJ = A( ALL, IR(PanelOffset(j),PanelOffset(j+1)) );
+        panel.Empty( false );
+        panel.Align( 0, 0 );
+        panel = AJ;
+        WritePanel( j, panel );
+    }
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Export( AbstractDistMatrix<T>& APre ) const
+{
+    EL_DEBUG_CSE
+    APre.Resize( height_, width_ );
+    DistMatrixWriteProxy<T,T,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<T> panel(*grid_);
+    for( Int j=0; j<NumPanels(); ++j )
+    {
+        if( j+1 < NumPanels() )
+            Prefetch( j+1 );
+        ReadPanel( j, panel );
+        auto AJ = A( ALL, IR(PanelOffset(j),PanelOffset(j+1)) );
+        AJ = panel;
+    }
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::ReadPanel( Int j, DistMatrix<T>& panel ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( j < 0 || j >= NumPanels() )
+          LogicError("Invalid panel index");
+    )
+    if( &panel.Grid() != grid_ )
+        panel.SetGrid( *grid_ );
+    panel.Empty( false );
+    panel.Align( 0, 0 );
+    panel.Resize( height_, PanelWidth(j) );
+    const Int localHeight = panel.LocalHeight();
+    const Int localWidth = panel.LocalWidth();
+
+    vector<T> staging;
+    auto it = prefetches_.find( j );
+    if( it != prefetches_.end() )
+    {
+        it->second.first.get();
+        staging = std::move( it->second.second );
+        prefetches_.erase( it );
+    }
+    else
+    {
+        WaitForWrite( j );
+        staging.resize( PanelLocalSize(j) );
+        ReadEntries
+        ( filename_, fileOffsets_[j], PanelLocalSize(j), staging.data() );
+    }
+
+    T* buffer = panel.Buffer();
+    const Int ldim = panel.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        MemCopy
+        ( &buffer[jLoc*ldim], &staging[jLoc*localHeight], localHeight );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::WritePanel( Int j, const DistMatrix<T>& panel )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( j < 0 || j >= NumPanels() )
+          LogicError("Invalid panel index");
+      if( panel.Height() != height_ || panel.Width() != PanelWidth(j) )
+          LogicError("Panel was of the wrong size");
+      if( panel.ColAlign() != 0 || panel.RowAlign() != 0 )
+          LogicError("Panels must be aligned with the origin");
+    )
+    // Writes to the same panel must land in order and any read-ahead of
+    // this panel is now stale
+    WaitForWrite( j );
+    auto it = prefetches_.find( j );
+    if( it != prefetches_.end() )
+    {
+        it->second.first.wait();
+        prefetches_.erase( it );
+    }
+
+    const Int localHeight = panel.LocalHeight();
+    const Int localWidth = panel.LocalWidth();
+    const T* buffer = panel.LockedBuffer();
+    const Int ldim = panel.LDim();
+    vector<T> staging( PanelLocalSize(j) );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        MemCopy
+        ( &staging[jLoc*localHeight], &buffer[jLoc*ldim], localHeight );
+
+    const Int offset = fileOffsets_[j];
+    if( ctrl_.writeBehind )
+    {
+        const string filename = filename_;
+        pendingWrites_[j] =
+          std::async
+          ( std::launch::async,
+            [filename,offset,staging=std::move(staging)]()
+            {
+                WriteEntries
+                ( filename, offset, Int(staging.size()), staging.data() );
+            } ).share();
+    }
+    else
+    {
+        WriteEntries( filename_, offset, PanelLocalSize(j), staging.data() );
+    }
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Prefetch( Int j ) const
+{
+    EL_DEBUG_CSE
+    if( !ctrl_.readAhead || prefetches_.count(j) )
+        return;
+    WaitForWrite( j );
+
+    auto& entry = prefetches_[j];
+    const Int numEntries = PanelLocalSize(j);
+    entry.second.resize( numEntries );
+    T* buffer = entry.second.data();
+    const string filename = filename_;
+    const Int offset = fileOffsets_[j];
+    entry.first =
+      std::async
+      ( std::launch::async,
+        [filename,offset,numEntries,buffer]()
+        { ReadEntries( filename, offset, numEntries, buffer ); } );
+}
+
+template<typename T>
+void OutOfCoreMatrix<T>::Flush() const
+{
+    EL_DEBUG_CSE
+    for( auto& entry : prefetches_ )
+        entry.second.first.wait();
+    while( !pendingWrites_.empty() )
+        WaitForWrite( pendingWrites_.begin()->first );
+}
+
+// Panels are streamed as raw bytes, which rules out BigFloat
+#define PROTO(T) template class OutOfCoreMatrix<T>;
+#define PROTO_BIGFLOAT
+#define PROTO_COMPLEX_BIGFLOAT
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -14,6 +14,7 @@
 #include "./QR/Householder.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
+#include "./QR/Tiled.hpp"
 
 #include "./QR/ColSwap.hpp"
 
@@ -123,6 +124,11 @@ void QR
     AbstractDistMatrix<Base<F>>& signature, \
     DistPermutation& Omega, \
     const QRCtrl<Base<F>>& ctrl ); \
+  template void qr::Tiled \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    Int tileSize ); \
   template void qr::ExplicitTriang \
   ( Matrix<F>& A, const QRCtrl<Base<F>>& ctrl ); \
   template void qr::ExplicitTriang \
@@ -193,6 +199,24 @@ void QR
   ( Matrix<F>& A, \
     Matrix<F>& R ); \
   template void qr::Cholesky \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R ); \
+  template void qr::Cholesky2 \
+  ( Matrix<F>& A, \
+    Matrix<F>& R ); \
+  template void qr::Cholesky2 \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R ); \
+  template void qr::ShiftedCholesky3 \
+  ( Matrix<F>& A, \
+    Matrix<F>& R ); \
+  template void qr::ShiftedCholesky3 \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R ); \
+  template void qr::AdaptiveCholesky \
+  ( Matrix<F>& A, \
+    Matrix<F>& R ); \
+  template void qr::AdaptiveCholesky \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
   template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
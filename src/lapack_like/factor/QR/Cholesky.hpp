@@ -51,6 +51,310 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
 }
 
+// CholeskyQR2 and shifted CholeskyQR3
+// ===================================
+// A single pass of CholeskyQR loses orthogonality in proportion to cond(A)^2,
+// but a second pass applied to the computed Q restores it to working
+// precision as long as cond(A) is at most roughly eps^{-1/2}; see
+//
+//   Y. Yamamoto, Y. Nakatsukasa, Y. Yanagisawa, and T. Fukaya,
+//   "Roundoff error analysis of the CholeskyQR2 algorithm",
+//   Electronic Transactions on Numerical Analysis, 44, pp. 306--326, 2015.
+//
+// Preceding CholeskyQR2 with a pass whose Gram matrix has its diagonal
+// shifted by
+//
+//   s = 11 (m n + n (n+1)) eps || A ||_2^2
+//
+// extends this to cond(A) up to roughly eps^{-1}; see
+//
+//   T. Fukaya, R. Kannan, Y. Nakatsukasa, Y. Yamamoto, and Y. Yanagisawa,
+//   "Shifted Cholesky QR for computing the QR factorization of
+//    ill-conditioned matrices", SIAM J. Sci. Comput., 42(1), 2020.
+//
+// Each pass of the distributed variants consists of a local Herk, a single
+// AllReduce of the n x n Gram matrix, a redundant Cholesky factorization, and
+// a local Trsm against the [VC,STAR] rows of A.
+
+namespace cholesky_qr {
+
+// Overwrite R with the upper Cholesky factor of G + shift I, returning
+// whether or not the shifted Gram matrix was numerically HPD
+template<typename F>
+bool GramFactor( const Matrix<F>& G, Matrix<F>& R, Base<F> shift )
+{
+    EL_DEBUG_CSE
+    R = G;
+    if( shift != Base<F>(0) )
+        ShiftDiagonal( R, F(shift) );
+    try
+    {
+        El::Cholesky( UPPER, R );
+    }
+    catch( const NonHPDMatrixException& )
+    {
+        return false;
+    }
+    MakeTrapezoidal( UPPER, R );
+    return true;
+}
+
+template<typename F>
+Base<F> Shift( Int m, const Matrix<F>& G )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = G.Height();
+    // || A ||_2^2 <= || A ||_F^2 = trace(A^H A)
+    Real frobSquared = 0;
+    for( Int j=0; j<n; ++j )
+        frobSquared += RealPart(G(j,j));
+    const Real eps = limits::Epsilon<Real>();
+    return Real(11)*(Real(m)*n+Real(n)*(n+1))*eps*frobSquared;
+}
+
+// CholeskyQR2 succeeds to working precision when cond(A) is comfortably
+// below eps^{-1/2}
+template<typename Real>
+Real MaxCondition()
+{ return Real(1)/(Real(10)*Sqrt(limits::Epsilon<Real>())); }
+
+// The one-norm condition number of an upper-triangular Cholesky factor, which
+// is within a factor of n of the two-norm condition number and, unlike the
+// latter, does not require an SVD
+template<typename F>
+Base<F> Condition( const Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    Matrix<F> RInv( R );
+    TriangularInverse( UPPER, NON_UNIT, RInv );
+    return OneNorm( R )*OneNorm( RInv );
+}
+
+template<typename F>
+void Gram( const Matrix<F>& A, Matrix<F>& G )
+{
+    EL_DEBUG_CSE
+    Zeros( G, A.Width(), A.Width() );
+    Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), G );
+}
+
+template<typename F>
+void Gram( const DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& G )
+{
+    EL_DEBUG_CSE
+    G.Resize( A.Width(), A.Width() );
+    Gram( A.LockedMatrix(), G.Matrix() );
+    El::AllReduce( G, A.ColComm() );
+}
+
+// A := A inv(RPass) and R := RPass R
+template<typename F>
+void ApplyPass( const Matrix<F>& RPass, Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), RPass, A );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RPass, R );
+}
+
+// One pass of CholeskyQR which accumulates the triangular factor into R
+template<typename F>
+void Pass( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    Matrix<F> G, RPass;
+    Gram( A, G );
+    if( !GramFactor( G, RPass, Base<F>(0) ) )
+        throw NonHPDMatrixException("A^H A was not numerically HPD");
+    ApplyPass( RPass, A, R );
+}
+
+template<typename F>
+void Pass( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> G(A.Grid());
+    Matrix<F> RPass;
+    Gram( A, G );
+    if( !GramFactor( G.Matrix(), RPass, Base<F>(0) ) )
+        throw NonHPDMatrixException("A^H A was not numerically HPD");
+    ApplyPass( RPass, A.Matrix(), R.Matrix() );
+}
+
+template<typename F>
+void ShiftedPass( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    Matrix<F> G, RPass;
+    Gram( A, G );
+    if( !GramFactor( G, RPass, Shift( A.Height(), G ) ) )
+        throw NonHPDMatrixException("A^H A + s I was not numerically HPD");
+    ApplyPass( RPass, A, R );
+}
+
+template<typename F>
+void ShiftedPass( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> G(A.Grid());
+    Matrix<F> RPass;
+    Gram( A, G );
+    if( !GramFactor( G.Matrix(), RPass, Shift( A.Height(), G.Matrix() ) ) )
+        throw NonHPDMatrixException("A^H A + s I was not numerically HPD");
+    ApplyPass( RPass, A.Matrix(), R.Matrix() );
+}
+
+} // namespace cholesky_qr
+
+template<typename F>
+void Cholesky2( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A^H A will be singular");
+    Identity( R, A.Width(), A.Width() );
+    cholesky_qr::Pass( A, R );
+    cholesky_qr::Pass( A, R );
+}
+
+template<typename F>
+void Cholesky2( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+{
+    EL_DEBUG_CSE
+    const Int n = APre.Width();
+    if( APre.Height() < n )
+        LogicError("A^H A will be singular");
+
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& A = AProx.Get();
+    auto& R = RProx.Get();
+
+    Identity( R, n, n );
+    cholesky_qr::Pass( A, R );
+    cholesky_qr::Pass( A, R );
+}
+
+template<typename F>
+void ShiftedCholesky3( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A^H A will be singular");
+    Identity( R, A.Width(), A.Width() );
+    cholesky_qr::ShiftedPass( A, R );
+    cholesky_qr::Pass( A, R );
+    cholesky_qr::Pass( A, R );
+}
+
+template<typename F>
+void ShiftedCholesky3
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+{
+    EL_DEBUG_CSE
+    const Int n = APre.Width();
+    if( APre.Height() < n )
+        LogicError("A^H A will be singular");
+
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& A = AProx.Get();
+    auto& R = RProx.Get();
+
+    Identity( R, n, n );
+    cholesky_qr::ShiftedPass( A, R );
+    cholesky_qr::Pass( A, R );
+    cholesky_qr::Pass( A, R );
+}
+
+// Choose between CholeskyQR2 and shifted CholeskyQR3 based upon the condition
+// number of the first Cholesky factor, which is computed redundantly from the
+// Gram matrix that is formed anyway, and fall back to Householder QR if A is
+// numerically rank-deficient. The Gram matrix of the first pass is reused for
+// the shifted pass, so that no reduction is wasted.
+template<typename F>
+void AdaptiveCholesky( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("A^H A will be singular");
+    Identity( R, n, n );
+
+    Matrix<F> G, RPass;
+    cholesky_qr::Gram( A, G );
+    if( !cholesky_qr::GramFactor( G, RPass, Real(0) ) ||
+        cholesky_qr::Condition( RPass ) > cholesky_qr::MaxCondition<Real>() )
+    {
+        if( !cholesky_qr::GramFactor( G, RPass, cholesky_qr::Shift( m, G ) ) )
+        {
+            Explicit( A, R );
+            return;
+        }
+        cholesky_qr::ApplyPass( RPass, A, R );
+        cholesky_qr::Gram( A, G );
+        if( !cholesky_qr::GramFactor( G, RPass, Real(0) ) )
+        {
+            Matrix<F> RHouse;
+            Explicit( A, RHouse );
+            Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RHouse, R );
+            return;
+        }
+    }
+    cholesky_qr::ApplyPass( RPass, A, R );
+    cholesky_qr::Pass( A, R );
+}
+
+template<typename F>
+void AdaptiveCholesky
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+        LogicError("A^H A will be singular");
+
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& A = AProx.Get();
+    auto& R = RProx.Get();
+    const Grid& g = A.Grid();
+    Identity( R, n, n );
+
+    // Since the Gram matrix is identical on every process, so are the
+    // decisions below
+    DistMatrix<F,STAR,STAR> G(g);
+    Matrix<F> RPass;
+    cholesky_qr::Gram( A, G );
+    if( !cholesky_qr::GramFactor( G.Matrix(), RPass, Real(0) ) ||
+        cholesky_qr::Condition( RPass ) > cholesky_qr::MaxCondition<Real>() )
+    {
+        const Real shift = cholesky_qr::Shift( m, G.Matrix() );
+        if( !cholesky_qr::GramFactor( G.Matrix(), RPass, shift ) )
+        {
+            Explicit( A, R );
+            return;
+        }
+        cholesky_qr::ApplyPass( RPass, A.Matrix(), R.Matrix() );
+        cholesky_qr::Gram( A, G );
+        if( !cholesky_qr::GramFactor( G.Matrix(), RPass, Real(0) ) )
+        {
+            DistMatrix<F,STAR,STAR> RHouse(g);
+            Explicit( A, RHouse );
+            Trmm
+            ( LEFT, UPPER, NORMAL, NON_UNIT,
+              F(1), RHouse.Matrix(), R.Matrix() );
+            return;
+        }
+    }
+    cholesky_qr::ApplyPass( RPass, A.Matrix(), R.Matrix() );
+    cholesky_qr::Pass( A, R );
+}
+
 } // namespace qr
 } // namespace El
 
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_TILED_HPP
+#define EL_QR_TILED_HPP
+
+#include "../TileDAG.hpp"
+#include "./ApplyQ.hpp"
+#include "./PanelHouseholder.hpp"
+
+namespace El {
+namespace qr {
+
+// A task-parallel version of qr::Householder. The columns of A are split into
+// tiles; each panel factorization becomes one task and the application of its
+// reflectors to every trailing column tile becomes another, so that the panel
+// factorization of step k+1 only waits upon the update of its own column tile
+// (i.e., a dynamic lookahead). Since the panels are still factored with
+// PanelHouseholder, the result is in exactly the same implicit format as
+// qr::Householder and may be used with qr::ApplyQ, qr::SolveAfter, etc.
+
+template<typename F>
+void Tiled
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  Int tileSize )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const vector<Int> offsets = tile_dag::Offsets( n, minDim, tileSize );
+    const Int numTiles = offsets.size()-1;
+    const Int numPanels = (minDim+tileSize-1)/tileSize;
+
+#ifdef EL_HYBRID
+    // One sentinel per column tile for the OpenMP runtime to track
+    // dependencies on
+    vector<char> sentinels( numTiles );
+    char* deps = sentinels.data();
+#endif
+    tile_dag::ExceptionTrap trap;
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    for( Int k=0; k<numPanels; ++k )
+    {
+#ifdef EL_HYBRID
+        #pragma omp task depend(inout:deps[k])
+#endif
+        trap.Run( [&,k]()
+        {
+            const Range<Int> ind1( offsets[k], offsets[k+1] ),
+                             indB( offsets[k], END          );
+            auto AB1 = A( indB, ind1 );
+            auto householderScalars1 = householderScalars( ind1, ALL );
+            auto sig1 = signature( ind1, ALL );
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+        });
+
+        for( Int j=k+1; j<numTiles; ++j )
+        {
+#ifdef EL_HYBRID
+            #pragma omp task depend(in:deps[k]) depend(inout:deps[j])
+#endif
+            trap.Run( [&,j,k]()
+            {
+                const Range<Int> ind1( offsets[k], offsets[k+1] ),
+                                 indB( offsets[k], END          ),
+                                 indj( offsets[j], offsets[j+1] );
+                auto AB1 = A( indB, ind1 );
+                auto ABj = A( indB, indj );
+                auto householderScalars1 = householderScalars( ind1, ALL );
+                auto sig1 = signature( ind1, ALL );
+                ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, ABj );
+            });
+        }
+    }
+    trap.Rethrow();
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_TILED_HPP
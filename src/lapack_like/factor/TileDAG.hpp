@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_TILE_DAG_HPP
+#define EL_FACTOR_TILE_DAG_HPP
+
+#include <atomic>
+#include <exception>
+
+namespace El {
+namespace tile_dag {
+
+// Split [0,n) into tiles of width at most tileSize while forcing a boundary
+// at 'split' so that the leading tiles of a rectangular matrix line up with
+// its (square) diagonal tiles. The returned vector holds the numTiles+1
+// offsets of the tile boundaries.
+inline vector<Int> Offsets( Int n, Int split, Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( tileSize <= 0 )
+          LogicError("Tile size must be positive");
+      if( split < 0 || split > n )
+          LogicError("Invalid tile split point");
+    )
+    vector<Int> offsets;
+    for( Int k=0; k<split; k+=tileSize )
+        offsets.push_back( k );
+    for( Int k=split; k<n; k+=tileSize )
+        offsets.push_back( k );
+    offsets.push_back( n );
+    return offsets;
+}
+
+// Exceptions may not escape an OpenMP task, so each tile kernel is run
+// through a trap which records the first failure and turns the remaining
+// kernels into no-ops. The exception is rethrown once the DAG has drained.
+class ExceptionTrap
+{
+public:
+    template<typename Kernel>
+    void Run( Kernel kernel )
+    {
+        if( failed_.load() )
+            return;
+        try { kernel(); }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            #pragma omp critical(El_tile_dag_exception)
+#endif
+            {
+                if( !exception_ )
+                    exception_ = std::current_exception();
+            }
+            failed_.store( true );
+        }
+    }
+
+    void Rethrow() const
+    {
+        if( exception_ )
+            std::rethrow_exception( exception_ );
+    }
+
+private:
+    std::atomic<bool> failed_{false};
+    std::exception_ptr exception_;
+};
+
+} // namespace tile_dag
+} // namespace El
+
+#endif // ifndef EL_FACTOR_TILE_DAG_HPP
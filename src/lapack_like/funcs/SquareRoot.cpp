@@ -250,7 +250,8 @@ void HPSDSquareRoot
         const Real omega = w.GetLocal(iLoc,0);
         minLocalEig = Min(minLocalEig,omega);
     }
-    const Real minEig = mpi::AllReduce( minLocalEig, mpi::MIN, g.VCComm() );
+    const Real minEig = mpi::AllReduce( minLocalEig, mpi::MIN, g.VCComm(),
+                                        SyncInfo<Device::CPU>() );
 
     // Set the tolerance equal to n ||A||_2 eps
     const Int n = A.Height();
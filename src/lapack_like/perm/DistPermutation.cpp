@@ -12,202 +12,174 @@ namespace El {
 
 namespace {
 
+// Permute the columns of every matrix in 'As' with a single AllToAll over the
+// communicator described by the metadata. The inverse permutation simply
+// exchanges the roles of the sends and receives.
 template<typename T>
 void PermuteCols
-(       AbstractDistMatrix<T>& A,
+( const vector<AbstractDistMatrix<T>*>& As,
   const PermutationMeta& oldMeta,
   bool inverse=false )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( A.RowComm() != oldMeta.comm )
-          LogicError("Invalid communicator in metadata");
-      if( A.RowAlign() != oldMeta.align )
-          LogicError("Invalid alignment in metadata");
-    )
-    if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
+    vector<AbstractDistMatrix<T>*> active;
+    for( auto A : As )
+    {
+        EL_DEBUG_ONLY(
+          if( &A->RowComm() != oldMeta.comm )
+              LogicError("Invalid communicator in metadata");
+          if( A->RowAlign() != oldMeta.align )
+              LogicError("Invalid alignment in metadata");
+        )
+        if( A->Height() != 0 && A->Width() != 0 && A->Participating() )
+            active.push_back( A );
+    }
+    if( active.empty() )
         return;
 
-    T* ABuf = A.Buffer();
-    const Int ALDim = A.LDim();
-
-    const Int localHeight = A.LocalHeight();
+    Int localHeight = 0;
+    for( auto A : active )
+        localHeight += A->LocalHeight();
     PermutationMeta meta = oldMeta;
     meta.ScaleUp( localHeight );
 
-    if( inverse )
+    const auto& sendCounts = inverse ? meta.recvCounts : meta.sendCounts;
+    const auto& sendDispls = inverse ? meta.recvDispls : meta.sendDispls;
+    const auto& sendIdx    = inverse ? meta.recvIdx    : meta.sendIdx;
+    const auto& sendRanks  = inverse ? meta.recvRanks  : meta.sendRanks;
+    const auto& recvCounts = inverse ? meta.sendCounts : meta.recvCounts;
+    const auto& recvDispls = inverse ? meta.sendDispls : meta.recvDispls;
+    const auto& recvIdx    = inverse ? meta.sendIdx    : meta.recvIdx;
+    const auto& recvRanks  = inverse ? meta.sendRanks  : meta.recvRanks;
+
+    // Fill vectors with the send data
+    auto offsets = sendDispls;
+    const int totalSend = sendCounts.back() + sendDispls.back();
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    const int numSends = sendIdx.size();
+    for( int send=0; send<numSends; ++send )
     {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
+        const int jLoc = sendIdx[send];
+        const int rank = sendRanks[send];
+        for( auto A : active )
         {
-            const int jLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
+            const Int ALocHeight = A->LocalHeight();
+            MemCopy
+            ( &sendData[offsets[rank]], &A->Buffer()[jLoc*A->LDim()],
+              ALocHeight );
+            offsets[rank] += ALocHeight;
         }
     }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
 
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
+    // Communicate all pivot columns
+    const int totalRecv = recvCounts.back() + recvDispls.back();
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(),
+      *meta.comm, SyncInfo<Device::CPU>() );
+
+    // Unpack the recv data
+    offsets = recvDispls;
+    const int numRecvs = recvIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int jLoc = recvIdx[recv];
+        const int rank = recvRanks[recv];
+        for( auto A : active )
         {
-            const int jLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
+            const Int ALocHeight = A->LocalHeight();
+            MemCopy
+            ( &A->Buffer()[jLoc*A->LDim()], &recvData[offsets[rank]],
+              ALocHeight );
+            offsets[rank] += ALocHeight;
         }
     }
 }
 
+// Permute the rows of every matrix in 'As' with a single AllToAll
 template<typename T>
 void PermuteRows
-(       AbstractDistMatrix<T>& A,
+( const vector<AbstractDistMatrix<T>*>& As,
   const PermutationMeta& oldMeta,
   bool inverse=false )
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
-      if( A.ColComm() != oldMeta.comm )
-          LogicError("Invalid communicator in metadata");
-      if( A.ColAlign() != oldMeta.align )
-          LogicError("Invalid alignment in metadata");
-    )
-    if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
+    vector<AbstractDistMatrix<T>*> active;
+    for( auto A : As )
+    {
+        EL_DEBUG_ONLY(
+          if( &A->ColComm() != oldMeta.comm )
+              LogicError("Invalid communicator in metadata");
+          if( A->ColAlign() != oldMeta.align )
+              LogicError("Invalid alignment in metadata");
+        )
+        if( A->Height() != 0 && A->Width() != 0 && A->Participating() )
+            active.push_back( A );
+    }
+    if( active.empty() )
         return;
 
-    T* ABuf = A.Buffer();
-    const Int ALDim = A.LDim();
-
-    const Int localWidth = A.LocalWidth();
+    Int localWidth = 0;
+    for( auto A : active )
+        localWidth += A->LocalWidth();
     PermutationMeta meta = oldMeta;
     meta.ScaleUp( localWidth );
 
-    if( inverse )
+    const auto& sendCounts = inverse ? meta.recvCounts : meta.sendCounts;
+    const auto& sendDispls = inverse ? meta.recvDispls : meta.sendDispls;
+    const auto& sendIdx    = inverse ? meta.recvIdx    : meta.sendIdx;
+    const auto& sendRanks  = inverse ? meta.recvRanks  : meta.sendRanks;
+    const auto& recvCounts = inverse ? meta.sendCounts : meta.recvCounts;
+    const auto& recvDispls = inverse ? meta.sendDispls : meta.recvDispls;
+    const auto& recvIdx    = inverse ? meta.sendIdx    : meta.recvIdx;
+    const auto& recvRanks  = inverse ? meta.sendRanks  : meta.recvRanks;
+
+    // Fill vectors with the send data
+    auto offsets = sendDispls;
+    const int totalSend = sendCounts.back() + sendDispls.back();
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    const int numSends = sendIdx.size();
+    for( int send=0; send<numSends; ++send )
     {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
+        const int iLoc = sendIdx[send];
+        const int rank = sendRanks[send];
+        for( auto A : active )
         {
-            const int iLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
+            const Int ALocWidth = A->LocalWidth();
             StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
+            ( &sendData[offsets[rank]], 1, &A->Buffer()[iLoc], A->LDim(),
+              ALocWidth );
+            offsets[rank] += ALocWidth;
         }
     }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
 
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
+    // Communicate all pivot rows
+    const int totalRecv = recvCounts.back() + recvDispls.back();
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(),
+      *meta.comm, SyncInfo<Device::CPU>() );
+
+    // Unpack the recv data
+    offsets = recvDispls;
+    const int numRecvs = recvIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int iLoc = recvIdx[recv];
+        const int rank = recvRanks[recv];
+        for( auto A : active )
         {
-            const int iLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
+            const Int ALocWidth = A->LocalWidth();
             StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
+            ( &A->Buffer()[iLoc], A->LDim(), &recvData[offsets[rank]], 1,
+              ALocWidth );
+            offsets[rank] += ALocWidth;
         }
     }
 }
@@ -243,7 +215,8 @@ void InvertPermutation
     )
 
     // Compute the send counts
-    const mpi::Comm colComm = p.ColComm();
+    const mpi::Comm& colComm = p.ColComm();
+    SyncInfo<Device::CPU> syncInfo;
     const Int commSize = mpi::Size( colComm );
     vector<int> sendSizes(commSize,0), recvSizes(commSize,0);
     for( Int iLoc=0; iLoc<p.LocalHeight(); ++iLoc )
@@ -253,7 +226,8 @@ void InvertPermutation
         sendSizes[owner] += 2; // we'll send the global index and the value
     }
     // Perform a small AllToAll to get the receive counts
-    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, colComm );
+    mpi::AllToAll
+    ( sendSizes.data(), 1, recvSizes.data(), 1, colComm, syncInfo );
     vector<int> sendOffs, recvOffs;
     const int sendTotal = Scan( sendSizes, sendOffs );
     const int recvTotal = Scan( recvSizes, recvOffs );
@@ -274,7 +248,7 @@ void InvertPermutation
     vector<Int> recvBuf(recvTotal);
     mpi::AllToAll
     ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
-      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm );
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm, syncInfo );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
@@ -329,6 +303,9 @@ void DistPermutation::Empty()
     implicitSwapOrigins_ = true;
     swapDests_.Empty();
     swapOrigins_.Empty();
+    staleMoves_ = true;
+    moveOrigins_.clear();
+    moveDests_.clear();
 
     // Only used if swapSequence_ = false
     // ----------------------------------
@@ -362,6 +339,7 @@ void DistPermutation::MakeIdentity( Int size )
 
     numSwaps_ = 0;
     implicitSwapOrigins_ = true;
+    staleMoves_ = true;
 }
 
 void DistPermutation::ReserveSwaps( Int maxSwaps )
@@ -391,6 +369,7 @@ void DistPermutation::Swap( Int origin, Int dest )
 
     if( origin != dest )
         parity_ = !parity_;
+    staleMoves_ = true;
     if( swapSequence_ && numSwaps_ == swapDests_.Height() )
         MakeArbitrary();
     if( !swapSequence_ )
@@ -584,6 +563,9 @@ void DistPermutation::MakeArbitrary() const
     implicitSwapOrigins_ = true;
     swapDests_.Empty();
     swapOrigins_.Empty();
+    staleMoves_ = true;
+    moveOrigins_.clear();
+    moveDests_.clear();
 }
 
 const DistPermutation& DistPermutation::operator=( const Permutation& P )
@@ -615,6 +597,7 @@ const DistPermutation& DistPermutation::operator=( const Permutation& P )
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
     staleMeta_ = true;
+    staleMoves_ = true;
 
     return *this;
 }
@@ -643,6 +626,10 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     rowMeta_ = P.rowMeta_;
     staleMeta_ = P.staleMeta_;
 
+    staleMoves_ = P.staleMoves_;
+    moveOrigins_ = P.moveOrigins_;
+    moveDests_ = P.moveDests_;
+
     return *this;
 }
 
@@ -720,246 +707,229 @@ const DistMatrix<Int,VC,STAR> DistPermutation::SwapDestinations() const
     return swapDests_(IR(0,numSwaps_),ALL);
 }
 
-template<typename T>
-void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+void DistPermutation::FormMoves() const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
+    if( !staleMoves_ )
+        return;
+    moveOrigins_.clear();
+    moveDests_.clear();
+    staleMoves_ = false;
+    if( numSwaps_ == 0 )
+        return;
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+    auto activeInd = IR(0,numSwaps_);
+    DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
+    auto& destsLoc = dests_STAR_STAR.Matrix();
+    vector<Int> origins( numSwaps_ ), dests( numSwaps_ );
+    if( implicitSwapOrigins_ )
+    {
+        for( Int j=0; j<numSwaps_; ++j )
+            origins[j] = j;
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
+          swapOrigins_(activeInd,ALL);
+        auto& originsLoc = origins_STAR_STAR.Matrix();
+        for( Int j=0; j<numSwaps_; ++j )
+            origins[j] = originsLoc(j);
+    }
+    for( Int j=0; j<numSwaps_; ++j )
+        dests[j] = destsLoc(j);
+
+    // Only the union of the swap origins and destinations is touched
+    vector<Int> touched( origins );
+    touched.insert( touched.end(), dests.begin(), dests.end() );
+    std::sort( touched.begin(), touched.end() );
+    touched.erase
+    ( std::unique( touched.begin(), touched.end() ), touched.end() );
+    auto slot = [&]( Int i )
+      { return std::lower_bound( touched.begin(), touched.end(), i ) -
+               touched.begin(); };
+
+    // Track which original row occupies each touched index as the swaps are
+    // applied in order
+    vector<Int> source( touched );
+    for( Int j=0; j<numSwaps_; ++j )
+        std::swap( source[slot(origins[j])], source[slot(dests[j])] );
+
+    // Indices which are fixed points of the composed permutation need not move
+    const Int numTouched = touched.size();
+    for( Int k=0; k<numTouched; ++k )
+    {
+        if( source[k] != touched[k] )
         {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
+            moveOrigins_.push_back( source[k] );
+            moveDests_.push_back( touched[k] );
         }
+    }
+}
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+PermutationMeta
+DistPermutation::ExplicitMeta( Int align, const mpi::Comm& comm ) const
+{
+    EL_DEBUG_CSE
+    // TODO(poulson): Move El::InversePermutation into this class
+    if( staleInverse_ )
+    {
+        InvertPermutation( perm_, invPerm_ );
+        staleInverse_ = false;
+    }
+    DistMatrix<Int,STAR,STAR> perm_STAR_STAR( perm_ ),
+                              invPerm_STAR_STAR( invPerm_ );
+    return PermutationMeta( perm_STAR_STAR, invPerm_STAR_STAR, align, comm );
+}
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            colMeta_.emplace
-                ( std::piecewise_construct,
-                  std::forward_as_tuple(key),
-                  std::forward_as_tuple(perm_,invPerm_,align,comm) );
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second );
+const PermutationMeta& DistPermutation::ExplicitMeta
+( std::map<keyType_,PermutationMeta>& metaMap,
+  Int align, Dist dist, const mpi::Comm& comm ) const
+{
+    EL_DEBUG_CSE
+    if( staleMeta_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        staleMeta_ = false;
     }
+
+    keyType_ key( align, dist );
+    auto data = metaMap.find( key );
+    if( data == metaMap.end() )
+        data = metaMap.emplace( key, ExplicitMeta( align, comm ) ).first;
+    return data->second;
 }
 
 template<typename T>
-void DistPermutation::InversePermuteCols
-( AbstractDistMatrix<T>& A, Int offset ) const
+void DistPermutation::ApplyToCols
+( const vector<AbstractDistMatrix<T>*>& As, Int offset, bool inverse ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
+        FormMoves();
+        if( moveOrigins_.empty() )
             return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
     }
-    else
+    else if( offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
+
+    // Group the matrices by their row alignment and communicator so that each
+    // group requires a single exchange
+    typedef std::pair<Int,const mpi::Comm*> groupKey;
+    vector<groupKey> keys;
+    vector<vector<AbstractDistMatrix<T>*>> groups;
+    for( auto A : As )
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
+        groupKey key( A->RowAlign(), &A->RowComm() );
+        auto it = std::find( keys.begin(), keys.end(), key );
+        if( it == keys.end() )
         {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
+            keys.push_back( key );
+            groups.emplace_back( 1, A );
         }
+        else
+            groups[it-keys.begin()].push_back( A );
+    }
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
+    const Int numGroups = keys.size();
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int align = keys[group].first;
+        const mpi::Comm& comm = *keys[group].second;
+        const auto& A = *groups[group].front();
+        if( swapSequence_ )
         {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            colMeta_.emplace
-                ( std::piecewise_construct,
-                  std::forward_as_tuple(key),
-                  std::forward_as_tuple(perm_,invPerm_,align,comm) );
-            data = colMeta_.find( key );
+            PermutationMeta meta
+            ( moveOrigins_, moveDests_, offset, align, comm );
+            El::PermuteCols( groups[group], meta, inverse );
         }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second, true );
+        else if( &A.Grid() == grid_ )
+            El::PermuteCols
+            ( groups[group], ExplicitMeta(colMeta_,align,A.RowDist(),comm),
+              inverse );
+        else
+            El::PermuteCols
+            ( groups[group], ExplicitMeta(align,comm), inverse );
     }
 }
 
 template<typename T>
-void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
+void DistPermutation::ApplyToRows
+( const vector<AbstractDistMatrix<T>*>& As, Int offset, bool inverse ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
     if( swapSequence_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
+        FormMoves();
+        if( moveOrigins_.empty() )
             return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
+    }
+    else if( offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
+
+    // Group the matrices by their column alignment and communicator so that
+    // each group requires a single exchange
+    typedef std::pair<Int,const mpi::Comm*> groupKey;
+    vector<groupKey> keys;
+    vector<vector<AbstractDistMatrix<T>*>> groups;
+    for( auto A : As )
+    {
+        groupKey key( A->ColAlign(), &A->ColComm() );
+        auto it = std::find( keys.begin(), keys.end(), key );
+        if( it == keys.end() )
         {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
+            keys.push_back( key );
+            groups.emplace_back( 1, A );
         }
         else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+            groups[it-keys.begin()].push_back( A );
     }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
 
-        if( staleMeta_ )
+    const Int numGroups = keys.size();
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int align = keys[group].first;
+        const mpi::Comm& comm = *keys[group].second;
+        const auto& A = *groups[group].front();
+        if( swapSequence_ )
         {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
+            PermutationMeta meta
+            ( moveOrigins_, moveDests_, offset, align, comm );
+            El::PermuteRows( groups[group], meta, inverse );
         }
+        else if( &A.Grid() == grid_ )
+            El::PermuteRows
+            ( groups[group], ExplicitMeta(rowMeta_,align,A.ColDist(),comm),
+              inverse );
+        else
+            El::PermuteRows
+            ( groups[group], ExplicitMeta(align,comm), inverse );
+    }
+}
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+template<typename T>
+void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToCols( vector<AbstractDistMatrix<T>*>{&A}, offset, false );
+}
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            rowMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second );
-    }
+template<typename T>
+void DistPermutation::InversePermuteCols
+( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToCols( vector<AbstractDistMatrix<T>*>{&A}, offset, true );
+}
+
+template<typename T>
+void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToRows( vector<AbstractDistMatrix<T>*>{&A}, offset, false );
 }
 
 template<typename T>
@@ -967,78 +937,39 @@ void DistPermutation::InversePermuteRows
 ( AbstractDistMatrix<T>& A, Int offset ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
+    ApplyToRows( vector<AbstractDistMatrix<T>*>{&A}, offset, true );
+}
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-    }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
+template<typename T>
+void DistPermutation::PermuteCols
+( const vector<AbstractDistMatrix<T>*>& As, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToCols( As, offset, false );
+}
 
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
+template<typename T>
+void DistPermutation::InversePermuteCols
+( const vector<AbstractDistMatrix<T>*>& As, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToCols( As, offset, true );
+}
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+template<typename T>
+void DistPermutation::PermuteRows
+( const vector<AbstractDistMatrix<T>*>& As, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToRows( As, offset, false );
+}
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-            rowMeta_.emplace
-                ( std::piecewise_construct,
-                  std::forward_as_tuple(key),
-                  std::forward_as_tuple(perm_,invPerm_,align,comm) );
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second, true );
-    }
+template<typename T>
+void DistPermutation::InversePermuteRows
+( const vector<AbstractDistMatrix<T>*>& As, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyToRows( As, offset, true );
 }
 
 template<typename T>
@@ -1218,6 +1149,18 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
   template void DistPermutation::InversePermuteRows \
   ( AbstractDistMatrix<T>& A, \
     Int offset ) const; \
+  template void DistPermutation::PermuteCols \
+  ( const vector<AbstractDistMatrix<T>*>& As, \
+    Int offset ) const; \
+  template void DistPermutation::InversePermuteCols \
+  ( const vector<AbstractDistMatrix<T>*>& As, \
+    Int offset ) const; \
+  template void DistPermutation::PermuteRows \
+  ( const vector<AbstractDistMatrix<T>*>& As, \
+    Int offset ) const; \
+  template void DistPermutation::InversePermuteRows \
+  ( const vector<AbstractDistMatrix<T>*>& As, \
+    Int offset ) const; \
   template void DistPermutation::PermuteSymmetrically \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<T>& A, \
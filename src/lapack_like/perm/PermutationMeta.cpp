@@ -14,11 +14,11 @@ PermutationMeta::PermutationMeta
 ( const DistMatrix<Int,STAR,STAR>& perm,
   const DistMatrix<Int,STAR,STAR>& invPerm,
         Int permAlign,
-        mpi::Comm permComm )
+  const mpi::Comm& permComm )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(AssertSameGrids( perm, invPerm ))
-    comm = permComm;
+    comm = &permComm;
     align = permAlign;
     const Int permStride = mpi::Size( permComm );
     const Int permShift = Shift( mpi::Rank(permComm), permAlign, permStride );
@@ -103,4 +103,56 @@ PermutationMeta::PermutationMeta
              totalRecv);
 }
 
+PermutationMeta::PermutationMeta
+( const vector<Int>& origins,
+  const vector<Int>& dests,
+        Int offset,
+        Int permAlign,
+  const mpi::Comm& permComm )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( origins.size() != dests.size() )
+          LogicError("origins and dests must be the same length");
+    )
+    comm = &permComm;
+    align = permAlign;
+    const Int permStride = mpi::Size( permComm );
+    const Int permShift = Shift( mpi::Rank(permComm), permAlign, permStride );
+    const Int numMoves = origins.size();
+
+    // Every process walks through the same list of movements, so the order
+    // in which rows are packed for a given destination matches the order in
+    // which that destination unpacks them
+    sendCounts.resize( permStride, 0 );
+    recvCounts.resize( permStride, 0 );
+    sendIdx.resize( 0 );
+    recvIdx.resize( 0 );
+    sendRanks.resize( 0 );
+    recvRanks.resize( 0 );
+    for( Int k=0; k<numMoves; ++k )
+    {
+        const Int origin = origins[k] + offset;
+        const Int dest = dests[k] + offset;
+        if( Mod(origin,permStride) == permShift )
+        {
+            const Int iLoc = (origin-permShift) / permStride;
+            const Int sendTo = Mod(dest+permAlign,permStride);
+            sendIdx.push_back( iLoc );
+            sendRanks.push_back( sendTo );
+            ++sendCounts[sendTo];
+        }
+        if( Mod(dest,permStride) == permShift )
+        {
+            const Int iLoc = (dest-permShift) / permStride;
+            const Int recvFrom = Mod(origin+permAlign,permStride);
+            recvIdx.push_back( iLoc );
+            recvRanks.push_back( recvFrom );
+            ++recvCounts[recvFrom];
+        }
+    }
+    Scan( sendCounts, sendDispls );
+    Scan( recvCounts, recvDispls );
+}
+
 } // namespace El
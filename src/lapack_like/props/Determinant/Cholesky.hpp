@@ -81,7 +81,8 @@ SafeProduct<Base<Field>> AfterCholesky
         }
     }
     SafeProduct<Real> det( n );
-    det.kappa = mpi::AllReduce( localKappa, g.VCComm() );
+    det.kappa = mpi::AllReduce( localKappa, g.VCComm(),
+                                SyncInfo<Device::CPU>() );
     det.rho = Real(1);
 
     return det;
@@ -94,8 +94,10 @@ SafeProduct<Field> AfterLUPartialPiv
         }
     }
     SafeProduct<Field> det( n );
-    det.rho = mpi::AllReduce( localRho, mpi::PROD, g.VCComm() );
-    det.kappa = mpi::AllReduce( localKappa, mpi::SUM, g.VCComm() );
+    det.rho = mpi::AllReduce( localRho, mpi::PROD, g.VCComm(),
+                              SyncInfo<Device::CPU>() );
+    det.kappa = mpi::AllReduce( localKappa, mpi::SUM, g.VCComm(),
+                                SyncInfo<Device::CPU>() );
 
     const bool isOdd = P.Parity();
     if( isOdd )
@@ -33,6 +33,8 @@ template<typename Field>
 Base<Field> FrobeniusNorm(const Matrix<Field>& A)
 {
     EL_DEBUG_CSE
+    if (IsBlasScalar<Field>::value && ReproducibleReductions())
+        return ReproducibleFrobeniusNorm(A, mpi::COMM_SELF);
     typedef Base<Field> Real;
     Real scale = 0;
     Real scaledSquare = 1;
@@ -130,12 +132,17 @@ Base<Field> FrobeniusNorm(const AbstractDistMatrix<Field>& A)
 
         auto const& ALoc = ALocProxy.GetLocked();
 
-        for (Int jLoc=0; jLoc<localWidth; ++jLoc)
-            for (Int iLoc=0; iLoc<localHeight; ++iLoc)
-                UpdateScaledSquare
-                    (ALoc(iLoc,jLoc), localScale, localScaledSquare);
-        norm = NormFromScaledSquare
-            (localScale, localScaledSquare, A.DistComm());
+        if (IsBlasScalar<Field>::value && ReproducibleReductions())
+            norm = ReproducibleFrobeniusNorm(ALoc, A.DistComm());
+        else
+        {
+            for (Int jLoc=0; jLoc<localWidth; ++jLoc)
+                for (Int iLoc=0; iLoc<localHeight; ++iLoc)
+                    UpdateScaledSquare
+                        (ALoc(iLoc,jLoc), localScale, localScaledSquare);
+            norm = NormFromScaledSquare
+                (localScale, localScaledSquare, A.DistComm());
+        }
     }
     mpi::Broadcast(norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{});
     return norm;
@@ -88,7 +88,8 @@ KyFanSchattenNorm( const AbstractDistMatrix<Field>& A, Int k, Base<Field> p )
     const Int localHeight = sTop.LocalHeight();
     for( Int j=localHeight-1; j>=0; --j )
         localSum += Pow( sTopLoc(j), p );
-    const Real sum = mpi::AllReduce( localSum, sTop.ColComm() );
+    const Real sum = mpi::AllReduce( localSum, sTop.ColComm(),
+                                     SyncInfo<Device::CPU>() );
     return Pow( sum, 1/p );
 }
 
@@ -110,7 +111,8 @@ Base<Field> HermitianKyFanSchattenNorm
     const Int localHeight = sTop.LocalHeight();
     for( Int j=localHeight-1; j>=0; --j )
         localSum += Pow( sTopLoc(j), p );
-    const Real sum = mpi::AllReduce( localSum, sTop.ColComm() );
+    const Real sum = mpi::AllReduce( localSum, sTop.ColComm(),
+                                     SyncInfo<Device::CPU>() );
     return Pow( sum, 1/p );
 }
 
@@ -136,7 +138,8 @@ Base<Field> SymmetricKyFanSchattenNorm
     const Int localHeight = sTop.LocalHeight();
     for( Int j=localHeight-1; j>=0; --j )
         localSum += Pow( sTopLoc(j), p );
-    const Real sum = mpi::AllReduce( localSum, sTop.ColComm() );
+    const Real sum = mpi::AllReduce( localSum, sTop.ColComm(),
+                                     SyncInfo<Device::CPU>() );
     return Pow( sum, 1/p );
 }
 
@@ -98,7 +98,8 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
         // Sum our partial column sums to get the column sums over A[* ,V]
         vector<Real> myColSums( localWidth );
         mpi::AllReduce
-        ( myPartialColSums.data(), myColSums.data(), localWidth, A.ColComm() );
+        ( myPartialColSums.data(), myColSums.data(), localWidth, A.ColComm(),
+          SyncInfo<Device::CPU>() );
 
         // Find the maximum out of the column sums
         Real myMaxColSum = 0;
@@ -106,9 +107,10 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
             myMaxColSum = Max( myMaxColSum, myColSums[jLoc] );
 
         // Find the global maximum column sum by searching the row team
-        norm = mpi::AllReduce( myMaxColSum, mpi::MAX, A.RowComm() );
+        norm = mpi::AllReduce( myMaxColSum, mpi::MAX, A.RowComm(),
+                               SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return norm;
 }
 
@@ -170,7 +172,8 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
             }
             vector<Real> colSums( height );
             mpi::AllReduce
-            ( partialColSums.data(), colSums.data(), height, A.DistComm() );
+            ( partialColSums.data(), colSums.data(), height, A.DistComm(),
+              SyncInfo<Device::CPU>() );
 
             // Find the maximum sum
             for( Int j=0; j<height; ++j )
@@ -213,14 +216,16 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
             }
             vector<Real> colSums( height );
             mpi::AllReduce
-            ( partialColSums.data(), colSums.data(), height, A.DistComm() );
+            ( partialColSums.data(), colSums.data(), height, A.DistComm(),
+              SyncInfo<Device::CPU>() );
 
             // Find the maximum sum
             for( Int j=0; j<height; ++j )
                 maxColSum = Max( maxColSum, colSums[j] );
         }
     }
-    mpi::Broadcast( maxColSum, A.Root(), A.CrossComm() );
+    mpi::Broadcast( maxColSum, A.Root(), A.CrossComm(),
+                    SyncInfo<Device::CPU>() );
     return maxColSum;
 }
 
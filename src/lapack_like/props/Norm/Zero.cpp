@@ -34,10 +34,13 @@ Int ZeroNorm( const AbstractDistMatrix<T>& A, Base<T> tol )
     Int numNonzeros;
     if( A.Participating() )
     {
-        const Int numLocalNonzeros = ZeroNorm( A.LockedMatrix(), tol );
-        numNonzeros = mpi::AllReduce( numLocalNonzeros, A.DistComm() );
+        const Int numLocalNonzeros =
+          ZeroNorm( static_cast<const Matrix<T>&>(A.LockedMatrix()), tol );
+        numNonzeros = mpi::AllReduce( numLocalNonzeros, A.DistComm(),
+                                      SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( numNonzeros, A.Root(), A.CrossComm() );
+    mpi::Broadcast( numNonzeros, A.Root(), A.CrossComm(),
+                    SyncInfo<Device::CPU>() );
     return numNonzeros;
 }
 
@@ -46,9 +46,10 @@ T Trace( const AbstractDistMatrix<T>& A )
                 localTrace += A.GetLocal(iLoc,jLoc);
             }
         }
-        trace = mpi::AllReduce( localTrace, A.DistComm() );
+        trace = mpi::AllReduce( localTrace, A.DistComm(),
+                                SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( trace, A.Root(), A.CrossComm() );
+    mpi::Broadcast( trace, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return trace;
 }
 
@@ -28,12 +28,14 @@ F Col( F& chi, AbstractDistMatrix<F>& x )
           LogicError("Reflecting from incorrect process");
     )
     typedef Base<F> Real;
-    mpi::Comm colComm = x.ColComm();
+    mpi::Comm const& colComm = x.ColComm();
     const Int colStride = x.ColStride();
 
     vector<Real> localNorms(colStride);
-    Real localNorm = Nrm2( x.LockedMatrix() ); 
-    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
+    Real localNorm =
+      Nrm2( static_cast<const Matrix<F>&>(x.LockedMatrix()) );
+    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm,
+                    SyncInfo<Device::CPU>() );
     Real norm = blas::Nrm2( colStride, localNorms.data(), 1 );
 
     F alpha = chi;
@@ -65,8 +67,9 @@ F Col( F& chi, AbstractDistMatrix<F>& x )
             beta *= invOfSafeInv;
         } while( Abs(beta) < safeInv );
 
-        localNorm = Nrm2( x.LockedMatrix() );
-        mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
+        localNorm = Nrm2( static_cast<const Matrix<F>&>(x.LockedMatrix()) );
+        mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm,
+                        SyncInfo<Device::CPU>() );
         norm = blas::Nrm2( colStride, localNorms.data(), 1 );
         if( RealPart(alpha) <= 0 )
             beta = SafeNorm( alpha, norm );
@@ -96,7 +99,8 @@ F Col( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
     F alpha;
     if( chi.IsLocal(0,0) )
         alpha = chi.GetLocal(0,0);
-    mpi::Broadcast( alpha, chi.ColAlign(), chi.ColComm() );
+    mpi::Broadcast( alpha, chi.ColAlign(), chi.ColComm(),
+                    SyncInfo<Device::CPU>() );
 
     const F tau = reflector::Col( alpha, x );
     chi.Set( 0, 0, alpha );
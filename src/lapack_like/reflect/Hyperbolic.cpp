@@ -98,9 +98,10 @@ F LeftHyperbolicReflector
     {
         if( x.RowRank() == x.RowAlign() )
             tau = hyp_reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast( tau, x.RowAlign(), x.RowComm(),
+                        SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>() );
     return tau;
 }
 
@@ -117,9 +118,10 @@ F LeftHyperbolicReflector( F& chi, AbstractDistMatrix<F>& x )
     {
         if( x.RowRank() == x.RowAlign() )
             tau = hyp_reflector::Col( chi, x );
-        mpi::Broadcast( tau, x.RowAlign(), x.RowComm() );
+        mpi::Broadcast( tau, x.RowAlign(), x.RowComm(),
+                        SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>() );
     return tau;
 }
 
@@ -165,9 +167,10 @@ F RightHyperbolicReflector
     {
         if( x.ColRank() == x.ColAlign() )
             tau = hyp_reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast( tau, x.ColAlign(), x.ColComm(),
+                        SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>() );
     return tau;
 }
 
@@ -184,9 +187,10 @@ F RightHyperbolicReflector( F& chi, AbstractDistMatrix<F>& x )
     {
         if( x.ColRank() == x.ColAlign() )
             tau = hyp_reflector::Row( chi, x );
-        mpi::Broadcast( tau, x.ColAlign(), x.ColComm() );
+        mpi::Broadcast( tau, x.ColAlign(), x.ColComm(),
+                        SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( tau, x.Root(), x.CrossComm() );
+    mpi::Broadcast( tau, x.Root(), x.CrossComm(), SyncInfo<Device::CPU>() );
     return tau;
 }
 
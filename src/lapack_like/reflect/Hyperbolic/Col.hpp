@@ -27,12 +27,14 @@ F Col( F& chi, AbstractDistMatrix<F>& x )
           LogicError("chi is assumed to be real");
     )
     typedef Base<F> Real;
-    mpi::Comm colComm = x.ColComm();
+    mpi::Comm const& colComm = x.ColComm();
     const Int colStride = x.ColStride();
 
     vector<Real> localNorms(colStride);
-    Real localNorm = Nrm2( x.LockedMatrix() ); 
-    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
+    Real localNorm =
+      Nrm2( static_cast<const Matrix<F>&>(x.LockedMatrix()) );
+    mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm,
+                    SyncInfo<Device::CPU>() );
     Real norm = blas::Nrm2( colStride, localNorms.data(), 1 );
 
     const Real alpha = RealPart(chi);
@@ -66,7 +68,8 @@ F Col( AbstractDistMatrix<F>& chi, AbstractDistMatrix<F>& x )
     F alpha;
     if( chi.IsLocal(0,0) )
         alpha = chi.GetLocal(0,0);
-    mpi::Broadcast( alpha, chi.ColAlign(), chi.ColComm() );
+    mpi::Broadcast( alpha, chi.ColAlign(), chi.ColComm(),
+                    SyncInfo<Device::CPU>() );
 
     const F tau = reflector::Col( alpha, x );
     chi.Set( 0, 0, alpha );
@@ -132,8 +132,8 @@ void RowEchelon( DistMatrix<Field>& A, DistMatrix<Field>& B )
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
         lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
-        PB.PermuteRows( AB2 );
-        PB.PermuteRows( BB );
+        // When B is aligned with A, both are pivoted with a single exchange
+        PB.PermuteRows( vector<AbstractDistMatrix<Field>*>{&AB2,&BB} );
 
         A12_STAR_VR.AlignWith( A22 );
         A12_STAR_VR = A12;
@@ -267,18 +267,15 @@ void LinearSolve
     if( scalapack )
     {
 #ifdef EL_HAVE_SCALAPACK
-        ProxyCtrl proxyCtrl;
-        proxyCtrl.colConstrain = true;
-        proxyCtrl.rowConstrain = true;
-        proxyCtrl.blockHeight = DefaultBlockHeight();
-        proxyCtrl.blockWidth = DefaultBlockWidth();
-        proxyCtrl.colAlign = 0;
-        proxyCtrl.rowAlign = 0;
-        proxyCtrl.colCut = 0;
-        proxyCtrl.rowCut = 0;
-        DistMatrixReadProxy<Field,Field,MC,MR,BLOCK> AProx( A, proxyCtrl );
-        DistMatrixReadWriteProxy<Field,Field,MC,MR,BLOCK> BProx( B, proxyCtrl );
+        DistMatrixReadProxy<Field,Field,MC,MR,BLOCK>
+          AProx( A, ScaLAPACKProxyCtrl(A) );
         auto& ABlock = AProx.GetLocked();
+
+        // The rows of B must be distributed in the same manner as those of A
+        auto BCtrl = ScaLAPACKProxyCtrl( B );
+        BCtrl.blockHeight = ABlock.BlockHeight();
+        BCtrl.colAlign = ABlock.ColAlign();
+        DistMatrixReadWriteProxy<Field,Field,MC,MR,BLOCK> BProx( B, BCtrl );
         auto& BBlock = BProx.Get();
         lin_solve::ScaLAPACKHelper( ABlock, BBlock );
         return;
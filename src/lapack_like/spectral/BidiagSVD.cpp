@@ -384,7 +384,8 @@ Helper
             s.Resize( minDim, 1 );
             El::Broadcast( s.Matrix(), grid.VCComm(), 0 );
             mpi::Broadcast
-            ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm() );
+            ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm(),
+              SyncInfo<Device::CPU>() );
             UnpackQRInfo( packedQRInfo, info.qrInfo );
         }
         else
@@ -413,7 +414,8 @@ Helper
             s.Resize( minDim, 1 );
             El::Broadcast( s.Matrix(), grid.VCComm(), 0 );
             mpi::Broadcast
-            ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm() );
+            ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm(),
+              SyncInfo<Device::CPU>() );
             UnpackQRInfo( packedQRInfo, info.qrInfo );
         }
         else
@@ -442,7 +444,8 @@ Helper
             s.Resize( minDim, 1 );
             El::Broadcast( s.Matrix(), grid.VCComm(), 0 );
             mpi::Broadcast
-            ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm() );
+            ( packedQRInfo.data(), packedQRInfo.size(), 0, grid.VCComm(),
+              SyncInfo<Device::CPU>() );
             UnpackQRInfo( packedQRInfo, info.qrInfo );
         }
         else
@@ -58,7 +58,7 @@ template<typename Real>
 Int MRRREstimate
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
-        mpi::Comm wColComm,
+        mpi::Comm const& wColComm,
         Real vl,
         Real vu );
 
@@ -126,7 +126,7 @@ void InPlaceRedist( DistMatrix<F>& Q, Int rowAlign, const Base<F>* readBuffer )
     // Communicate
     mpi::AllToAll
     ( sendBuffer, portionSize,
-      recvBuffer, portionSize, g.ColComm() );
+      recvBuffer, portionSize, g.ColComm(), SyncInfo<Device::CPU>() );
 
     // Unpack
     const Int localHeight = Length(height,row,colAlign,r);
@@ -299,14 +299,18 @@ SequentialHelper
     {
         Matrix<Base<F>> wProx;
         wProx.Resize( n, 1 );
-        info = HermitianEig( uplo, A.Matrix(), wProx, ctrl );
+        info = HermitianEig
+          ( uplo, static_cast<Matrix<F>&>(A.Matrix()), wProx, ctrl );
         w.Resize( wProx.Height(), 1 );
         w.Matrix() = wProx;
     }
     else
     {
         w.Resize( n, 1 );
-        info = HermitianEig( uplo, A.Matrix(), w.Matrix(), ctrl );
+        info = HermitianEig
+          ( uplo,
+            static_cast<Matrix<F>&>(A.Matrix()),
+            static_cast<Matrix<Base<F>>&>(w.Matrix()), ctrl );
     }
 
     return info;
@@ -325,7 +329,8 @@ ScaLAPACKHelper
 {
     EL_DEBUG_CSE
 
-    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    DistMatrixReadProxy<F,F,MC,MR,BLOCK>
+      AProx( APre, ScaLAPACKProxyCtrl(APre) );
     auto& A = AProx.Get();
 
     DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> wProx( wPre );
@@ -733,7 +738,8 @@ SequentialHelper
         wProx.Resize( n, 1 );
         QProx.Resize( n, n );
 
-        info = HermitianEig( uplo, A.Matrix(), wProx, QProx, ctrl );
+        info = HermitianEig
+          ( uplo, static_cast<Matrix<F>&>(A.Matrix()), wProx, QProx, ctrl );
 
         w.Resize( wProx.Height(), 1 );
         w.Matrix() = wProx;
@@ -745,7 +751,11 @@ SequentialHelper
     {
         w.Resize( n, 1 );
         Q.Resize( n, n );
-        info = HermitianEig( uplo, A.Matrix(), w.Matrix(), Q.Matrix(), ctrl );
+        info = HermitianEig
+          ( uplo,
+            static_cast<Matrix<F>&>(A.Matrix()),
+            static_cast<Matrix<Base<F>>&>(w.Matrix()),
+            static_cast<Matrix<F>&>(Q.Matrix()), ctrl );
     }
 
     return info;
@@ -764,13 +774,15 @@ ScaLAPACKHelper
 {
     EL_DEBUG_CSE
 
-    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    DistMatrixReadProxy<F,F,MC,MR,BLOCK>
+      AProx( APre, ScaLAPACKProxyCtrl(APre) );
     auto& A = AProx.Get();
 
     DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> wProx( wPre );
     auto& w = wProx.Get();
 
-    DistMatrixWriteProxy<F,F,MC,MR,BLOCK> QProx( QPre );
+    // ScaLAPACK requires Q to share the blocking of A
+    DistMatrixWriteProxy<F,F,MC,MR,BLOCK> QProx( QPre, ScaLAPACKProxyCtrl(A) );
     auto& Q = QProx.Get();
 
     if( A.Height() != A.Width() )
@@ -865,8 +877,16 @@ MRRR
         if( A.Grid().Rank() == 0 )
             timer.Start();
     }
+    const bool twoStage = ctrl.tridiagCtrl.twoStage;
     DistMatrix<F,STAR,STAR> householderScalars(g);
-    HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
+    DistMatrix<F,STAR,VR> bulgeReflectors(g);
+    DistMatrix<F,VR,STAR> bulgeScalars(g);
+    if( twoStage )
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, bulgeReflectors, bulgeScalars,
+          ctrl.tridiagCtrl );
+    else
+        HermitianTridiag( uplo, A, householderScalars, ctrl.tridiagCtrl );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
@@ -986,7 +1006,12 @@ MRRR
             timer.Start();
         }
     }
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    if( twoStage )
+        herm_tridiag::ApplyQ
+        ( LEFT, NORMAL, ctrl.tridiagCtrl.bandwidth,
+          A, householderScalars, bulgeReflectors, bulgeScalars, Q );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
     if( ctrl.timeStages )
     {
         mpi::Barrier( A.DistComm() );
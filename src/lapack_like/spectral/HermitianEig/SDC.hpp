@@ -116,6 +116,150 @@ QDWHDivide
     return part;
 }
 
+// QDWH-eig; see Nakatsukasa and Higham, "Stable and efficient spectral divide
+// and conquer algorithms for the symmetric eigenvalue decomposition and the
+// SVD", SIAM J. Sci. Comput., 2013. The rank of the spectral projector
+// P = (sgn(G)+I)/2 is read off of its trace, and orthonormal bases for the
+// ranges of P and I-P are computed by two steps of subspace iteration with
+// CholeskyQR rather than by a Householder QR of P, so that, along with the
+// QDWH iteration itself, every step is a Gemm, Herk, or Trsm.
+template<typename F>
+ValueInt<Base<F>>
+QDWHEigDivide
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
+
+    // G := sgn(G)
+    // G := 1/2 ( G + I )
+    PolarCtrl ctrl;
+    ctrl.qdwh = true;
+    HermitianPolar( uplo, G, ctrl );
+    ShiftDiagonal( G, F(1) );
+    G *= F(1)/F(2);
+
+    ValueInt<Real> part;
+    const Int k = Int(Round(RealPart(Trace(G))));
+    if( k <= 0 || k >= n )
+    {
+        // The shift did not split the spectrum
+        part.value = limits::Max<Real>();
+        part.index = 0;
+        return part;
+    }
+
+    Matrix<F> V, X, R;
+    V.Resize( n, n );
+    auto V1 = V( ALL, IR(0,k) );
+    auto V2 = V( ALL, IR(k,n) );
+
+    // V1 := orth(P P X1)
+    Gaussian( X, n, k );
+    Gemm( NORMAL, NORMAL, F(1), G, X, F(0), V1 );
+    qr::ShiftedCholesky3( V1, R );
+    X = V1;
+    Gemm( NORMAL, NORMAL, F(1), G, X, F(0), V1 );
+    qr::Cholesky2( V1, R );
+
+    // V2 := orth((I-P) (I-P) X2)
+    Gaussian( X, n, n-k );
+    V2 = X;
+    Gemm( NORMAL, NORMAL, F(-1), G, X, F(1), V2 );
+    qr::ShiftedCholesky3( V2, R );
+    X = V2;
+    Gemm( NORMAL, NORMAL, F(-1), G, X, F(1), V2 );
+    qr::Cholesky2( V2, R );
+
+    // Remove the (small) components of V2 in the direction of V1
+    qr::Cholesky2( V, R );
+
+    // A := V^H A V
+    Gemm( ADJOINT, NORMAL, F(1), V, A, X );
+    Gemm( NORMAL, NORMAL, F(1), X, V, A );
+    if( returnQ )
+        G = V;
+
+    // Return || E21 ||1 / || A ||1 and the chosen rank
+    part = ComputePartition( A );
+    part.value /= oneA;
+    return part;
+}
+
+template<typename F>
+ValueInt<Base<F>>
+QDWHEigDivide
+( UpperOrLower uplo,
+  DistMatrix<F>& A,
+  DistMatrix<F>& G,
+  bool returnQ=false )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
+
+    // G := sgn(G)
+    // G := 1/2 ( G + I )
+    PolarCtrl ctrl;
+    ctrl.qdwh = true;
+    HermitianPolar( uplo, G, ctrl );
+    ShiftDiagonal( G, F(1) );
+    G *= F(1)/F(2);
+
+    ValueInt<Real> part;
+    const Int k = Int(Round(RealPart(Trace(G))));
+    if( k <= 0 || k >= n )
+    {
+        // The shift did not split the spectrum
+        part.value = limits::Max<Real>();
+        part.index = 0;
+        return part;
+    }
+
+    DistMatrix<F> V(g), X(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    V.Resize( n, n );
+    auto V1 = V( ALL, IR(0,k) );
+    auto V2 = V( ALL, IR(k,n) );
+
+    // V1 := orth(P P X1)
+    Gaussian( X, n, k );
+    Gemm( NORMAL, NORMAL, F(1), G, X, F(0), V1 );
+    qr::ShiftedCholesky3( V1, R );
+    X = V1;
+    Gemm( NORMAL, NORMAL, F(1), G, X, F(0), V1 );
+    qr::Cholesky2( V1, R );
+
+    // V2 := orth((I-P) (I-P) X2)
+    Gaussian( X, n, n-k );
+    V2 = X;
+    Gemm( NORMAL, NORMAL, F(-1), G, X, F(1), V2 );
+    qr::ShiftedCholesky3( V2, R );
+    X = V2;
+    Gemm( NORMAL, NORMAL, F(-1), G, X, F(1), V2 );
+    qr::Cholesky2( V2, R );
+
+    // Remove the (small) components of V2 in the direction of V1
+    qr::Cholesky2( V, R );
+
+    // A := V^H A V
+    Gemm( ADJOINT, NORMAL, F(1), V, A, X );
+    Gemm( NORMAL, NORMAL, F(1), X, V, A );
+    if( returnQ )
+        G = V;
+
+    // Return || E21 ||1 / || A ||1 and the chosen rank
+    part = ComputePartition( A );
+    part.value /= oneA;
+    return part;
+}
+
 template<typename F>
 ValueInt<Base<F>>
 RandomizedSignDivide
@@ -288,7 +432,10 @@ SpectralDivide
         G = A;
         ShiftDiagonal( G, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, G, false, ctrl );
+        if( ctrl.qdwhEig )
+            part = QDWHEigDivide( uplo, A, G, false );
+        else
+            part = RandomizedSignDivide( uplo, A, G, false, ctrl );
 
         ++it;
         if( part.value <= tol )
@@ -337,7 +484,10 @@ SpectralDivide
         Q = A;
         ShiftDiagonal( Q, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
+        if( ctrl.qdwhEig )
+            part = QDWHEigDivide( uplo, A, Q, true );
+        else
+            part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
 
         ++it;
         if( part.value <= tol )
@@ -381,12 +531,16 @@ SpectralDivide
     while( it < ctrl.maxOuterIts )
     {
         Real shift = SampleBall<Real>(-median.value,spread);
-        mpi::Broadcast( shift, 0, A.Grid().VCComm() );
+        mpi::Broadcast
+        ( shift, 0, A.Grid().VCComm(), SyncInfo<Device::CPU>() );
 
         G = A;
         ShiftDiagonal( G, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, G, false, ctrl );
+        if( ctrl.qdwhEig )
+            part = QDWHEigDivide( uplo, A, G, false );
+        else
+            part = RandomizedSignDivide( uplo, A, G, false, ctrl );
 
         ++it;
         if( part.value <= tol )
@@ -431,12 +585,16 @@ SpectralDivide
     while( it < ctrl.maxOuterIts )
     {
         Real shift = SampleBall<Real>(-median.value,spread);
-        mpi::Broadcast( shift, 0, A.Grid().VCComm() );
+        mpi::Broadcast
+        ( shift, 0, A.Grid().VCComm(), SyncInfo<Device::CPU>() );
 
         Q = A;
         ShiftDiagonal( Q, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
+        if( ctrl.qdwhEig )
+            part = QDWHEigDivide( uplo, A, Q, true );
+        else
+            part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
 
         ++it;
         if( part.value <= tol )
@@ -558,7 +716,10 @@ void SDC
     wPre.Resize( n, 1 );
     if( APre.Grid().Size() == 1 )
     {
-        HermitianEig( uplo, APre.Matrix(), wPre.Matrix() );
+        HermitianEig
+        ( uplo,
+          static_cast<Matrix<F>&>(APre.Matrix()),
+          static_cast<Matrix<Real>&>(wPre.Matrix()) );
         return;
     }
     if( n <= ctrl.cutoff )
@@ -619,7 +780,11 @@ void SDC
     QPre.Resize( n, n );
     if( APre.Grid().Size() == 1 )
     {
-        HermitianEig( uplo, APre.Matrix(), wPre.Matrix(), QPre.Matrix() );
+        HermitianEig
+        ( uplo,
+          static_cast<Matrix<F>&>(APre.Matrix()),
+          static_cast<Matrix<Real>&>(wPre.Matrix()),
+          static_cast<Matrix<F>&>(QPre.Matrix()) );
         return;
     }
     if( n <= ctrl.cutoff )
@@ -0,0 +1,448 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// A block generalization of Stewart's Krylov-Schur method, which, for
+// Hermitian operators, is equivalent to thick-restart block Lanczos with full
+// reorthogonalization. The basis V of at most m vectors satisfies
+//
+//   A V = V H + V_next C,
+//
+// where H = V^H A V is replicated on every process and the b x m matrix C
+// couples the basis to the next (orthonormal) block, V_next. Each expansion
+// applies the operator to V_next; each restart keeps the best Ritz vectors,
+// which diagonalizes H and replaces C with C Y. Ritz pairs whose residuals,
+// || C y ||_2, are sufficiently small are locked by zeroing their columns of C.
+//
+// Since the basis is stored by rows (in the [VC,STAR] distribution for the
+// distributed variants), all updates of the basis are local GEMMs, and the
+// only communication outside of the operator is the AllReduce of the b x m
+// inner products of each Gram-Schmidt sweep and the tall-skinny QR of each
+// new block.
+
+namespace El {
+namespace herm_krylov_schur {
+
+template<typename Field>
+Matrix<Field>& LocalRows( Matrix<Field>& V ) { return V; }
+template<typename Field>
+const Matrix<Field>& LocalRows( const Matrix<Field>& V ) { return V; }
+template<typename Field>
+Matrix<Field>& LocalRows( DistMatrix<Field,VC,STAR>& V )
+{ return V.Matrix(); }
+template<typename Field>
+const Matrix<Field>& LocalRows( const DistMatrix<Field,VC,STAR>& V )
+{ return V.LockedMatrix(); }
+
+// Sum a product of local rows over the owners of the rows
+template<typename Field>
+void SumOverRows( Matrix<Field>& Z, const Matrix<Field>& V ) { }
+template<typename Field>
+void SumOverRows( Matrix<Field>& Z, const DistMatrix<Field,VC,STAR>& V )
+{ AllReduce( Z, V.ColComm() ); }
+
+template<typename Field>
+bool IsRoot( const Matrix<Field>& V ) { return true; }
+template<typename Field>
+bool IsRoot( const DistMatrix<Field,VC,STAR>& V )
+{ return V.ColRank() == 0; }
+
+// Return an empty basis which is aligned with X
+template<typename Field>
+Matrix<Field> BasisLike( const Matrix<Field>& X ) { return Matrix<Field>(); }
+template<typename Field>
+DistMatrix<Field,VC,STAR> BasisLike( const DistMatrix<Field,VC,STAR>& X )
+{
+    DistMatrix<Field,VC,STAR> V( X.Grid() );
+    V.AlignWith( X );
+    return V;
+}
+
+template<typename Field>
+void Orthonormalize( Matrix<Field>& W, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    qr::Explicit( W, R );
+}
+
+template<typename Field>
+void Orthonormalize( DistMatrix<Field,VC,STAR>& W, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int m = W.Height();
+    const Int b = W.Width();
+    const Int p = mpi::Size( W.ColComm() );
+    DistMatrix<Field,STAR,STAR> RDist( W.Grid() );
+    if( W.ColAlign() == 0 && PowerOfTwo(p) && m >= p*b )
+        qr::ExplicitTS( W, RDist );
+    else
+        qr::Explicit( W, RDist );
+    R = RDist.Matrix();
+}
+
+// Orthogonalize W against the columns of V with two sweeps of block
+// classical Gram-Schmidt and return the accumulated coefficients
+template<typename Field,class Basis>
+void Orthogonalize( const Basis& V, Basis& W, Matrix<Field>& HCol )
+{
+    EL_DEBUG_CSE
+    const auto& VLoc = LocalRows( V );
+    auto& WLoc = LocalRows( W );
+    Zeros( HCol, V.Width(), W.Width() );
+    Matrix<Field> Z;
+    for( Int sweep=0; sweep<2; ++sweep )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), VLoc, WLoc, Z );
+        SumOverRows( Z, V );
+        Gemm( NORMAL, NORMAL, Field(-1), VLoc, Z, Field(1), WLoc );
+        HCol += Z;
+    }
+}
+
+// Overwrite the new block W (already orthogonal to V) with an orthonormal
+// basis for its range, W := W C^{-1}, where C is returned. The triangular
+// factor is replaced by its SVD, R = U Sigma Z^H, so that W := Q U and
+// C := Sigma Z^H; directions whose singular values are negligible relative to
+// 'deflationTol' signal that an invariant subspace has been found, and they
+// are dropped from C and replaced with random directions orthogonal to V.
+// (Testing the rows of R directly would not suffice, as a negligible column
+// of W which precedes significant ones yields a row of R which is not small.)
+//
+// Directions of W which were nearly cancelled by the Gram-Schmidt sweeps are
+// only orthogonal to V up to a relative error of eps ||A|| / sigma, so the
+// block is orthogonalized once more whenever such directions are kept.
+template<typename Field,class Basis>
+Int Normalize
+( const Basis& V,
+        Basis& W,
+        Matrix<Field>& C,
+  Base<Field> normEst )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = W.Height();
+    const Int b = W.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real deflationTol = Sqrt(Real(n))*eps*normEst;
+    const Real reorthTol = Sqrt(eps)*normEst;
+    Matrix<Field> R, U, Z;
+    Matrix<Real> sigma;
+    Orthonormalize( W, R );
+    SVD( R, U, sigma, Z );
+    auto WCopy( LocalRows(W) );
+    Gemm( NORMAL, NORMAL, Field(1), WCopy, U, LocalRows(W) );
+    Adjoint( Z, C );
+    DiagonalScale( LEFT, NORMAL, sigma, C );
+
+    Int numDeflated = 0;
+    for( Int j=0; j<b; ++j )
+    {
+        if( sigma(j) <= deflationTol )
+        {
+            auto cRow = C( IR(j), ALL );
+            Zero( cRow );
+            auto w = W( ALL, IR(j) );
+            MakeGaussian( w );
+            ++numDeflated;
+        }
+    }
+    if( numDeflated > 0 || sigma(b-1) <= reorthTol )
+    {
+        Matrix<Field> HCol;
+        Orthogonalize( V, W, HCol );
+        Orthonormalize( W, R );
+        auto CCopy( C );
+        Gemm( NORMAL, NORMAL, Field(1), R, CCopy, C );
+    }
+    return numDeflated;
+}
+
+// Reorder the Ritz values (and vectors) from the most to the least desired
+template<typename Field>
+void SortRitzPairs
+( KrylovSchurTarget target,
+  Matrix<Base<Field>>& theta,
+  Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = theta.Height();
+    vector<Int> order( m );
+    for( Int j=0; j<m; ++j )
+        order[j] = j;
+    // HermitianEig returns the eigenvalues in ascending order
+    if( target == KS_LARGEST )
+        std::reverse( order.begin(), order.end() );
+    else if( target == KS_LARGEST_MAGNITUDE )
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( const Int& i, const Int& j )
+          { return Abs(theta(i)) > Abs(theta(j)); } );
+
+    Matrix<Real> thetaOrig( theta );
+    Matrix<Field> YOrig( Y );
+    for( Int j=0; j<m; ++j )
+    {
+        theta(j) = thetaOrig(order[j]);
+        auto y = Y( ALL, IR(j) );
+        y = YOrig( ALL, IR(order[j]) );
+    }
+}
+
+template<typename Field,class Basis,class ApplyFunc>
+HermitianKrylovSchurInfo
+KrylovSchur
+( Int n,
+  const ApplyFunc& applyA,
+        Matrix<Base<Field>>& w,
+        Basis& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = ctrl.numEigs;
+    const Int b = ctrl.blocksize;
+    if( k < 1 || b < 1 )
+        LogicError("Invalid number of eigenpairs or blocksize");
+    Int m = ctrl.basisSize;
+    if( m == 0 )
+        m = Max( 2*k, k+2*b ) + 2*b;
+    m = Max( m, k+b );
+    m = ((m+b-1)/b)*b;
+    if( m+b > n )
+        LogicError
+        ("A basis of ",m," vectors plus a block of ",b," exceeds n=",n,
+         "; use HermitianEig instead");
+
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = ( ctrl.tol == Real(0) ? Sqrt(eps) : ctrl.tol );
+    const bool progress = ctrl.progress && IsRoot(X);
+    HermitianKrylovSchurInfo info;
+
+    // V holds the m basis vectors followed by the next block
+    X.Resize( n, k );
+    auto V = BasisLike( X );
+    auto W = BasisLike( X );
+    Zeros( V, n, m+b );
+    Zeros( W, n, b );
+    Matrix<Field> H, C, HCol, R, Y, CY;
+    Matrix<Real> theta;
+    Zeros( H, m, m );
+    Zeros( C, b, 0 );
+    {
+        auto V0 = V( ALL, IR(0,b) );
+        MakeGaussian( V0 );
+        Orthonormalize( V0, R );
+    }
+    Int cur = 0;
+    Real normEst = 0;
+    while( true )
+    {
+        // Expand the basis to m vectors
+        while( cur < m )
+        {
+            auto VActive = V( ALL, IR(0,cur+b) );
+            auto VNew = V( ALL, IR(cur,cur+b) );
+            auto VNext = V( ALL, IR(cur+b,cur+2*b) );
+
+            applyA( VNew, W );
+            info.numOperatorApps += b;
+            Orthogonalize( VActive, W, HCol );
+
+            // Only the lower triangle of H is referenced by the Rayleigh-Ritz
+            // step, and the previous couplings are exact in the presence of
+            // locking
+            auto HColNew = H( IR(0,cur+b), IR(cur,cur+b) );
+            HColNew = HCol;
+            auto HCouple = H( IR(cur,cur+b), IR(0,cur) );
+            HCouple = C;
+            normEst = Max( normEst, MaxNorm(HCol(IR(cur,cur+b),ALL)) );
+
+            info.numDeflations += Normalize( VActive, W, R, normEst );
+            LocalRows(VNext) = LocalRows(W);
+            Zeros( C, b, cur+b );
+            auto CNew = C( ALL, IR(cur,cur+b) );
+            CNew = R;
+            cur += b;
+        }
+
+        // Rayleigh-Ritz
+        auto HCopy( H );
+        HermitianEig( LOWER, HCopy, theta, Y );
+        SortRitzPairs( ctrl.target, theta, Y );
+        Gemm( NORMAL, NORMAL, Field(1), C, Y, CY );
+        normEst = Max( normEst, MaxNorm(theta) );
+
+        Int numConverged = 0;
+        while( numConverged < m &&
+               FrobeniusNorm(CY(ALL,IR(numConverged))) <= tol*normEst )
+            ++numConverged;
+        if( progress )
+            Output
+            ("Krylov-Schur restart ",info.numRestarts,": ",numConverged,
+             " of ",k," converged");
+
+        if( numConverged >= k || info.numRestarts == ctrl.maxRestarts )
+        {
+            info.numConverged = Min( numConverged, k );
+            Gemm
+            ( NORMAL, NORMAL, Field(1),
+              LocalRows(V)(ALL,IR(0,m)), Y(ALL,IR(0,k)), LocalRows(X) );
+            w = theta( IR(0,k), ALL );
+            break;
+        }
+
+        // Keep the best Ritz vectors and move the next block behind them
+        // (the kept count is a multiple of the blocksize so that the
+        // expansion refills exactly m vectors)
+        const Int numLocked = Min( numConverged, m-b );
+        const Int keep =
+          Max( Max( ((m+k)/(2*b))*b, b ), ((numLocked+b-1)/b)*b );
+        Matrix<Field> VKeep;
+        Gemm
+        ( NORMAL, NORMAL, Field(1),
+          LocalRows(V)(ALL,IR(0,m)), Y(ALL,IR(0,keep)), VKeep );
+        auto VKeepLoc = LocalRows(V)( ALL, IR(0,keep) );
+        VKeepLoc = VKeep;
+        auto VNextLoc = LocalRows(V)( ALL, IR(keep,keep+b) );
+        VNextLoc = LocalRows(V)( ALL, IR(m,m+b) );
+
+        Zero( H );
+        for( Int j=0; j<keep; ++j )
+            H(j,j) = theta(j);
+        C = CY( ALL, IR(0,keep) );
+        for( Int j=0; j<Min(numConverged,keep); ++j )
+        {
+            auto cCol = C( ALL, IR(j) );
+            Zero( cCol );
+        }
+        cur = keep;
+        ++info.numRestarts;
+    }
+    return info;
+}
+
+} // namespace herm_krylov_schur
+
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( Int n,
+  function<void(const Matrix<Field>&,Matrix<Field>&)> applyA,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return herm_krylov_schur::KrylovSchur<Field>( n, applyA, w, X, ctrl );
+}
+
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( const Grid& grid,
+  Int n,
+  function<void(const DistMatrix<Field,VC,STAR>&,
+                      DistMatrix<Field,VC,STAR>&)> applyA,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        AbstractDistMatrix<Field>& XPre,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( XPre.Grid() != grid || wPre.Grid() != grid )
+        LogicError("Grids did not match");
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    DistMatrixWriteProxy<Field,Field,VC,STAR> XProx( XPre );
+    auto& w = wProx.Get();
+    auto& X = XProx.Get();
+
+    Matrix<Real> wLoc;
+    auto info =
+      herm_krylov_schur::KrylovSchur<Field>( n, applyA, wLoc, X, ctrl );
+    w.Resize( wLoc.Height(), 1 );
+    w.Matrix() = wLoc;
+    return info;
+}
+
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    auto applyA =
+      [&]( const Matrix<Field>& Z, Matrix<Field>& Y )
+      { Hemm( LEFT, uplo, Field(1), A, Z, Field(0), Y ); };
+    return HermitianKrylovSchur<Field>( A.Height(), applyA, w, X, ctrl );
+}
+
+template<typename Field>
+HermitianKrylovSchurInfo
+HermitianKrylovSchur
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& X,
+  const HermitianKrylovSchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    auto applyA =
+      [&]( const DistMatrix<Field,VC,STAR>& Z, DistMatrix<Field,VC,STAR>& Y )
+      { Hemm( LEFT, uplo, Field(1), A, Z, Field(0), Y ); };
+    return HermitianKrylovSchur<Field>
+      ( A.Grid(), A.Height(), applyA, w, X, ctrl );
+}
+
+#define PROTO(Field) \
+  template HermitianKrylovSchurInfo HermitianKrylovSchur \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const HermitianKrylovSchurCtrl<Base<Field>>& ctrl ); \
+  template HermitianKrylovSchurInfo HermitianKrylovSchur \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          AbstractDistMatrix<Field>& X, \
+    const HermitianKrylovSchurCtrl<Base<Field>>& ctrl ); \
+  template HermitianKrylovSchurInfo HermitianKrylovSchur \
+  ( Int n, \
+    function<void(const Matrix<Field>&,Matrix<Field>&)> applyA, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const HermitianKrylovSchurCtrl<Base<Field>>& ctrl ); \
+  template HermitianKrylovSchurInfo HermitianKrylovSchur \
+  ( const Grid& grid, \
+    Int n, \
+    function<void(const DistMatrix<Field,VC,STAR>&, \
+                        DistMatrix<Field,VC,STAR>&)> applyA, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          AbstractDistMatrix<Field>& X, \
+    const HermitianKrylovSchurCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -1441,7 +1441,7 @@ template<typename Real,
 Int MRRREstimateHelper
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
-        mpi::Comm wColComm,
+        mpi::Comm const& wColComm,
         Real vl,
         Real vu )
 {
@@ -1467,7 +1467,7 @@ template<typename Real,
 Int MRRREstimateHelper
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
-        mpi::Comm wColComm,
+        mpi::Comm const& wColComm,
         Real vl,
         Real vu )
 {
@@ -1555,7 +1555,7 @@ template<typename Real>
 Int MRRREstimate
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
-        mpi::Comm wColComm,
+        mpi::Comm const& wColComm,
         Real vl,
         Real vu )
 {
@@ -1624,7 +1624,7 @@ MRRRPostEstimate
   template Int herm_tridiag_eig::MRRREstimate \
   ( const AbstractDistMatrix<Real>& d, \
     const AbstractDistMatrix<Real>& dSub, \
-          mpi::Comm wColComm, Real vl, Real vu ); \
+          mpi::Comm const& wColComm, Real vl, Real vu ); \
   template HermitianTridiagEigInfo herm_tridiag_eig::MRRRPostEstimate \
   ( const AbstractDistMatrix<Real>& d, \
     const AbstractDistMatrix<Real>& dSub, \
@@ -13,6 +13,8 @@
 #include "../Schur/SDC.hpp"
 using El::schur::SplitGrid;
 
+#include "../SecularEVD/Batch.hpp"
+
 namespace El {
 namespace herm_tridiag_eig {
 
@@ -431,59 +433,47 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
     {
-        auto minusShift = QSecular( ALL, IR(j) );
-
+        auto dSecular = d( undeflatedInd, ALL );
         auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular eigenvalue ",j," is ",d(j));
-
+          secular_evd::Batch
+          ( dUndeflated, rho, zUndeflated, 0, 1, dSecular, QSecular,
+            rCorrected, dcCtrl.secularCtrl );
         secularInfo.numIterations += valueInfo.numIterations;
         secularInfo.numAlternations += valueInfo.numAlternations;
         secularInfo.numCubicIterations += valueInfo.numCubicIterations;
         secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
-
-    // Compute the unnormalized eigenvectors.
     if( ctrl.progress )
-        Output("Computing unnormalized eigenvectors");
+        for( Int j=0; j<numUndeflated; ++j )
+            Output("Secular eigenvalue ",j," is ",d(j));
     for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto q = QSecular(ALL,IR(j));
-        for( Int i=0; i<numUndeflated; ++i )
-            q(i) = rCorrected(i) / q(i);
-    }
+        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
-    // Form the normalized right singular vectors with the rows permuted by
-    // the inverse of the packing permutation in U. This allows the product
-    // of QPacked with U to be equal to the unpacked Q times the eigenvectors
-    // from the secular equation.
+    // Compute the unnormalized eigenvectors and then form the normalized
+    // right singular vectors with the rows permuted by the inverse of the
+    // packing permutation in U. This allows the product of QPacked with U to
+    // be equal to the unpacked Q times the eigenvectors from the secular
+    // equation.
     Matrix<Real> U;
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
-    for( Int j=0; j<numUndeflated; ++j )
+    secular_evd::ForEachBlock<Real>
+    ( numUndeflated, [&]( Int jBeg, Int jEnd )
     {
-        auto q = QSecular(ALL,IR(j));
-        auto u = U(ALL,IR(j));
-        const Real qFrob = FrobeniusNorm( q );
-        for( Int i=0; i<numUndeflated; ++i )
-            u(i) = q(packingPerm.Preimage(i)) / qFrob;
-    }
+        for( Int j=jBeg; j<jEnd; ++j )
+        {
+            auto q = QSecular(ALL,IR(j));
+            for( Int i=0; i<numUndeflated; ++i )
+                q(i) = rCorrected(i) / q(i);
+
+            auto u = U(ALL,IR(j));
+            const Real qFrob = FrobeniusNorm( q );
+            for( Int i=0; i<numUndeflated; ++i )
+                u(i) = q(packingPerm.Preimage(i)) / qFrob;
+        }
+    });
     // Overwrite the first 'numUndeflated' columns of Q with the updated
     // eigenvectors by exploiting the partitioning of Z = QPacked as
     //
@@ -974,32 +964,25 @@ Merge
     auto& QSecularLoc = QSecular.Matrix();
 
     const Int numUndeflatedLoc = QSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
-        const Int j = QSecular.GlobalCol(jLoc);
-        auto minusShift = QSecularLoc( ALL, IR(jLoc) );
-
+        // Each process solves for the roots which it owns in QSecular
         auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
-            minusShift, dcCtrl.secularCtrl );
-        if( ctrl.progress && amRoot )
-            Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
+          secular_evd::Batch
+          ( dUndeflated, rho, zUndeflated,
+            QSecular.RowShift(), QSecular.RowStride(),
+            dSecularLoc, QSecularLoc, rCorrected, dcCtrl.secularCtrl );
 
         // We will sum these across all of the processors at the top-level
         secularInfo.numIterations += valueInfo.numIterations;
         secularInfo.numAlternations += valueInfo.numAlternations;
         secularInfo.numCubicIterations += valueInfo.numCubicIterations;
         secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
     }
+    if( ctrl.progress && amRoot )
+        for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+            Output
+            ("Secular eigenvalue ",QSecular.GlobalCol(jLoc)," is ",
+             dSecularLoc(jLoc));
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1012,13 +995,16 @@ Merge
     // Compute the unnormalized eigenvectors.
     if( ctrl.progress && amRoot )
         Output("Computing unnormalized eigenvectors");
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+    secular_evd::ForEachBlock<Real>
+    ( numUndeflatedLoc, [&]( Int jBeg, Int jEnd )
     {
-        auto q = QSecularLoc(ALL,IR(jLoc));
-        for( Int i=0; i<numUndeflated; ++i )
-            q(i) = rCorrected(i) / q(i);
-    }
-
+        for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+        {
+            auto q = QSecularLoc(ALL,IR(jLoc));
+            for( Int i=0; i<numUndeflated; ++i )
+                q(i) = rCorrected(i) / q(i);
+        }
+    });
 
     // Form the normalized eigenvectors with the rows permuted by
     // the inverse of the packing permutation in U. This allows the product
@@ -1029,14 +1015,18 @@ Merge
     DistMatrix<Real,STAR,VR> U(g);
     U.Resize( numUndeflated, numUndeflated );
     auto& ULoc = U.Matrix();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+    secular_evd::ForEachBlock<Real>
+    ( numUndeflatedLoc, [&]( Int jBeg, Int jEnd )
     {
-        auto q = QSecularLoc(ALL,IR(jLoc));
-        auto u = ULoc(ALL,IR(jLoc));
-        const Real qFrob = FrobeniusNorm( q );
-        for( Int i=0; i<numUndeflated; ++i )
-            u(i) = q(packingPerm.Preimage(i)) / qFrob;
-    }
+        for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+        {
+            auto q = QSecularLoc(ALL,IR(jLoc));
+            auto u = ULoc(ALL,IR(jLoc));
+            const Real qFrob = FrobeniusNorm( q );
+            for( Int i=0; i<numUndeflated; ++i )
+                u(i) = q(packingPerm.Preimage(i)) / qFrob;
+        }
+    });
     // Overwrite the first 'numUndeflated' columns of Q with the updated
     // eigenvectors by exploiting the partitioning of Z = QPacked as
     //
@@ -1133,7 +1123,22 @@ DivideAndConquer
 
     DCInfo info;
     auto& secularInfo = info.secularInfo;
-    if( n <= Max(dcCtrl.cutoff,3) )
+    const bool leaf = ( n <= Max(dcCtrl.cutoff,3) );
+#ifdef EL_HYBRID
+    // The two subproblems of each split are independent and are solved as
+    // OpenMP tasks within a single parallel region (the merges then spawn
+    // tasks for their secular equations). Arithmetic on the MPFR-backed types
+    // allocates, so they remain sequential.
+    if( IsPacked<Real>::value && !leaf && !omp_in_parallel() &&
+        omp_get_max_threads() > 1 )
+    {
+        #pragma omp parallel
+        #pragma omp single
+        info = DivideAndConquer( mainDiag, superDiag, w, Q, ctrl );
+        return info;
+    }
+#endif
+    if( leaf )
     {
         auto ctrlMod( ctrl );
         ctrlMod.alg = HERM_TRIDIAG_EIG_QR;
@@ -1179,11 +1184,17 @@ DivideAndConquer
         Zeros( Q1, 2, n-split );
     }
 
-    Matrix<Real> w0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
-
-    Matrix<Real> w1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+    Matrix<Real> w0, w1;
+    DCInfo info0, info1;
+#ifdef EL_HYBRID
+    const bool spawn = IsPacked<Real>::value && omp_in_parallel();
+    #pragma omp task if(spawn) default(shared)
+#endif
+    info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
+    info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+#ifdef EL_HYBRID
+    #pragma omp taskwait
+#endif
 
     if( !ctrl.wantEigVecs )
     {
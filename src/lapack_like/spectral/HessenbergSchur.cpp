@@ -64,15 +64,12 @@ ScaLAPACKHelper
     AssertScaLAPACKSupport();
     HessenbergSchurInfo info;
 
-    ProxyCtrl proxyCtrl;
-    proxyCtrl.colConstrain = true;
-    proxyCtrl.rowConstrain = true;
-    proxyCtrl.blockHeight = ctrl.blockHeight;
-    proxyCtrl.blockWidth = ctrl.blockHeight;
+    // The ScaLAPACK Hessenberg QR routines assume that the matrix is owned
+    // starting from the first process; ctrl.blockHeight is only used if H
+    // otherwise needs to be redistributed
+    auto proxyCtrl = ScaLAPACKProxyCtrl( HPre, ctrl.blockHeight );
     proxyCtrl.colAlign = 0;
     proxyCtrl.rowAlign = 0;
-    proxyCtrl.colCut = 0;
-    proxyCtrl.rowCut = 0;
 
     DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> HProx( HPre, proxyCtrl );
     auto& H = HProx.Get();
@@ -131,15 +128,12 @@ ScaLAPACKHelper
     AssertScaLAPACKSupport();
     HessenbergSchurInfo info;
 
-    ProxyCtrl proxyCtrl;
-    proxyCtrl.colConstrain = true;
-    proxyCtrl.rowConstrain = true;
-    proxyCtrl.blockHeight = ctrl.blockHeight;
-    proxyCtrl.blockWidth = ctrl.blockHeight;
+    // The ScaLAPACK Hessenberg QR routines assume that the matrix is owned
+    // starting from the first process; ctrl.blockHeight is only used if H
+    // otherwise needs to be redistributed
+    auto proxyCtrl = ScaLAPACKProxyCtrl( HPre, ctrl.blockHeight );
     proxyCtrl.colAlign = 0;
     proxyCtrl.rowAlign = 0;
-    proxyCtrl.colCut = 0;
-    proxyCtrl.rowCut = 0;
 
     DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> HProx( HPre, proxyCtrl );
     auto& H = HProx.Get();
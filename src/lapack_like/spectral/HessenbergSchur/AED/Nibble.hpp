@@ -396,6 +396,224 @@ AEDInfo Nibble
     return info;
 }
 
+template<typename Real>
+void ReformEigenvalues
+( const Matrix<Real>& tMain,
+  const Matrix<Real>& tSub,
+  const Matrix<Real>& tSuper,
+        Matrix<Complex<Real>>& w,
+        Int numUnconverged )
+{
+    EL_DEBUG_CSE
+    const Int n = tMain.Height();
+    for( Int i=n-1; i>=numUnconverged; )
+    {
+        if( i == numUnconverged || tSub(i-1) == Real(0) )
+        {
+            // 1x1 block
+            w(i) = tMain(i);
+            i -= 1;
+        }
+        else
+        {
+            // 2x2 block
+            Real alpha00 = tMain(i-1);
+            Real alpha10 = tSub(i-1);
+            Real alpha01 = tSuper(i-1);
+            Real alpha11 = tMain(i);
+            schur::TwoByTwo
+            ( alpha00, alpha01,
+              alpha10, alpha11,
+              w(i-1), w(i) );
+            i -= 2;
+        }
+    }
+}
+
+template<typename Real>
+void ReformEigenvalues
+( const Matrix<Complex<Real>>& tMain,
+  const Matrix<Complex<Real>>& tSub,
+  const Matrix<Complex<Real>>& tSuper,
+        Matrix<Complex<Real>>& w,
+        Int numUnconverged )
+{
+    EL_DEBUG_CSE
+    const Int n = tMain.Height();
+    for( Int i=n-1; i>=numUnconverged; --i )
+        w(i) = tMain(i);
+}
+
+// The distributed analogue of NibbleHelper: the deflation window H is
+// redistributed to a subgridDim x subgridDim subgrid of the processes which
+// own its leading blocks, where it is reduced to Schur form with the
+// distributed algorithm, its spike is deflated (and reordered) with
+// SpikeDeflation, and the remaining spike is condensed. The results, including
+// the accumulated transformation V, are then made available to every process.
+//
+// The spike value will be overwritten
+template<typename Field>
+AEDInfo SubgridNibbleHelper
+( DistMatrix<Field,MC,MR,BLOCK>& H,
+  Field& spikeValue,
+  DistMatrix<Complex<Base<Field>>,STAR,STAR>& w,
+  Matrix<Field>& V,
+  Int subgridDim,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = H.Height();
+    const Grid& grid = H.Grid();
+    const Field zero(0);
+    AEDInfo info;
+
+    // Form the subgrid (in column-major order) from the processes which own
+    // the leading subgridDim x subgridDim blocks of the window
+    const int rowOwner = H.RowOwner(0);
+    const int colOwner = H.ColOwner(0);
+    vector<int> ranks(subgridDim*subgridDim);
+    for( Int j=0; j<subgridDim; ++j )
+        for( Int i=0; i<subgridDim; ++i )
+            ranks[i+j*subgridDim] =
+              Mod(rowOwner+i,grid.Height()) +
+              Mod(colOwner+j,grid.Width())*grid.Height();
+    mpi::Group subgroup;
+    mpi::Incl( grid.OwningGroup(), ranks.size(), ranks.data(), subgroup );
+    mpi::Comm viewers;
+    mpi::Dup( grid.VCComm(), viewers );
+    const Grid subgrid
+    ( std::move(viewers), subgroup, subgridDim, COLUMN_MAJOR );
+    mpi::Free( subgroup );
+    const int root = ranks[0];
+
+    DistMatrix<Field,MC,MR,BLOCK>
+      T(subgrid,H.BlockHeight(),H.BlockWidth()),
+      Q(subgrid,H.BlockHeight(),H.BlockWidth());
+    DistMatrix<Complex<Real>,STAR,STAR> wSub(subgrid);
+    copy::GeneralPurpose( H, T );
+
+    bool transform = false;
+    if( subgrid.InGrid() )
+    {
+        auto ctrlSub( ctrl );
+        ctrlSub.winBeg = 0;
+        ctrlSub.winEnd = n;
+        ctrlSub.fullTriangle = true;
+        ctrlSub.wantSchurVecs = true;
+        ctrlSub.accumulateSchurVecs = false;
+        ctrlSub.demandConverged = false;
+        ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                          : HESSENBERG_SCHUR_MULTIBULGE );
+        auto infoSub = HessenbergSchur( T, wSub, Q, ctrlSub );
+
+        info = SpikeDeflation( T, Q, spikeValue, infoSub.numUnconverged );
+        if( ctrl.progress && subgrid.Rank() == 0 )
+        {
+            if( info.numUnconverged > 0 )
+                Output
+                ("  ",info.numUnconverged," AED eigenvalues did not converge");
+            Output("  ",info.numDeflated," of ",n," AED eigenvalues deflated");
+        }
+        const Int spikeSize = info.numUnconverged + info.numShiftCandidates;
+        if( spikeSize == 0 )
+        {
+            // The entire spike has deflated
+            spikeValue = zero;
+        }
+
+        // Reform the eigenvalues and shift candidates
+        DistMatrix<Field,STAR,STAR> tMain(subgrid), tSub(subgrid),
+          tSuper(subgrid);
+        util::GatherTridiagonal( T, IR(0,n), tMain, tSub, tSuper );
+        ReformEigenvalues
+        ( tMain.Matrix(), tSub.Matrix(), tSuper.Matrix(), wSub.Matrix(),
+          info.numUnconverged );
+
+        // Unless there were no deflations and we have a coupling, rotate the
+        // deflation window into Schur form
+        transform = ( spikeSize < n || spikeValue == zero );
+        if( transform )
+        {
+            // Force T to be upper Hessenberg
+            MakeTrapezoidal( UPPER, T, -1 );
+
+            if( spikeSize > 1 && spikeValue != zero )
+            {
+                // The spike needs to be reduced to length one while
+                // maintaining the Hessenberg form of the deflation window.
+                // The (comparatively small) undeflated portion is condensed
+                // and reduced back to Hessenberg form by a single process, and
+                // the accumulated transformation is applied in parallel.
+                auto condenseSpike =
+                  [&]( Matrix<Field>& TWin, const Matrix<Field>& vWin,
+                       Matrix<Field>& QWin )
+                  {
+                      vector<Field> u(spikeSize);
+                      for( Int i=0; i<spikeSize; ++i )
+                          u[i] = Conj(vWin(0,i));
+                      Field beta = u[0];
+                      Field tau =
+                        lapack::Reflector( spikeSize, beta, &u[1], 1 );
+                      u[0] = Field(1);
+                      for( Int j=0; j<spikeSize; ++j )
+                          for( Int i=0; i<spikeSize; ++i )
+                              QWin(i,j) -= Conj(tau)*u[i]*Conj(u[j]);
+
+                      Matrix<Field> W;
+                      Gemm( ADJOINT, NORMAL, Field(1), QWin, TWin, W );
+                      Gemm( NORMAL, NORMAL, Field(1), W, QWin, TWin );
+
+                      Matrix<Field> householderScalars;
+                      Hessenberg( UPPER, TWin, householderScalars );
+                      hessenberg::ApplyQ
+                      ( RIGHT, UPPER, NORMAL, TWin, householderScalars, QWin );
+                      MakeTrapezoidal( UPPER, TWin, -1 );
+                      return Int(0);
+                  };
+                UpdateWindow( T, Q, IR(0,spikeSize), condenseSpike );
+            }
+            spikeValue *= Conj(Q.Get(0,0));
+        }
+    }
+
+    // Make the results available to the entire grid
+    Int infoBuf[4] =
+      { info.numUnconverged, info.numShiftCandidates, info.numDeflated,
+        Int(transform) };
+    mpi::Broadcast
+    ( infoBuf, 4, root, grid.VCComm(), SyncInfo<Device::CPU>{} );
+    info.numUnconverged = infoBuf[0];
+    info.numShiftCandidates = infoBuf[1];
+    info.numDeflated = infoBuf[2];
+    transform = infoBuf[3];
+    mpi::Broadcast
+    ( spikeValue, root, grid.VCComm(), SyncInfo<Device::CPU>{} );
+    if( grid.VCRank() == root )
+        w.Matrix() = wSub.LockedMatrix();
+    El::Broadcast( w, grid.VCComm(), root );
+
+    if( transform )
+    {
+        copy::GeneralPurpose( T, H );
+
+        DistMatrix<Field,CIRC,CIRC> Q_CIRC_CIRC(subgrid);
+        if( subgrid.InGrid() )
+            Q_CIRC_CIRC = Q;
+        if( grid.VCRank() == root )
+            V = Q_CIRC_CIRC.LockedMatrix();
+        else
+            V.Resize( n, n );
+        El::Broadcast( V, grid.VCComm(), root );
+    }
+    else
+    {
+        V.Resize( 0, 0 );
+    }
+
+    return info;
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
@@ -423,44 +641,57 @@ AEDInfo Nibble
     auto HDefl = H( deflateInd, deflateInd );
     auto wDefl = w( deflateInd, ALL );
 
-    const int owner = HDefl.Owner(0,0);
-    DistMatrix<Field,CIRC,CIRC> HDefl_CIRC_CIRC( grid, owner );
-    HDefl_CIRC_CIRC = HDefl;
     Field spikeValue =
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
-    Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+
+    // Large deflation windows are reduced over a square subgrid with (at
+    // least) two distribution blocks per process row and column
+    const Int subgridDim =
+      Min( Min(grid.Height(),grid.Width()), blockSize/(2*H.BlockHeight()) );
+    if( blockSize >= ctrl.minDistAEDSize && subgridDim > 1 )
     {
         info =
-          NibbleHelper
-          ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V, ctrl );
-        VSize = V.Height();
+          SubgridNibbleHelper( HDefl, spikeValue, wDefl, V, subgridDim, ctrl );
     }
-    El::Broadcast( wDefl, HDefl_CIRC_CIRC.CrossComm(), HDefl_CIRC_CIRC.Root() );
-
-    if( deflateBeg > winBeg )
+    else
     {
-        mpi::Broadcast
-        ( spikeValue, HDefl_CIRC_CIRC.Root(), HDefl_CIRC_CIRC.CrossComm() );
-        H.Set( deflateBeg, deflateBeg-1, spikeValue );
+        const int owner = HDefl.Owner(0,0);
+        DistMatrix<Field,CIRC,CIRC> HDefl_CIRC_CIRC( grid, owner );
+        HDefl_CIRC_CIRC = HDefl;
+        Int infoBuf[3] = { 0, 0, 0 };
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            info =
+              NibbleHelper
+              ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V,
+                ctrl );
+            infoBuf[0] = info.numDeflated;
+            infoBuf[1] = info.numShiftCandidates;
+            infoBuf[2] = V.Height();
+        }
+        const int root = HDefl_CIRC_CIRC.Root();
+        mpi::Comm const& crossComm = HDefl_CIRC_CIRC.CrossComm();
+        El::Broadcast( wDefl, crossComm, root );
+        mpi::Broadcast( spikeValue, root, crossComm, SyncInfo<Device::CPU>{} );
+        mpi::Broadcast( infoBuf, 3, root, crossComm, SyncInfo<Device::CPU>{} );
+        info.numDeflated = infoBuf[0];
+        info.numShiftCandidates = infoBuf[1];
+        const Int VSize = infoBuf[2];
+        if( VSize > 0 )
+        {
+            V.Resize( VSize, VSize );
+            El::Broadcast( V, crossComm, root );
+            HDefl = HDefl_CIRC_CIRC;
+        }
     }
-
-    // TODO(poulson): Combine these broadcasts?
-    mpi::Broadcast
-    ( info.numDeflated, HDefl_CIRC_CIRC.Root(), HDefl_CIRC_CIRC.CrossComm() );
-    mpi::Broadcast
-    ( info.numShiftCandidates,
-      HDefl_CIRC_CIRC.Root(), HDefl_CIRC_CIRC.CrossComm() );
-    mpi::Broadcast
-    ( VSize, HDefl_CIRC_CIRC.Root(), HDefl_CIRC_CIRC.CrossComm() );
-    if( VSize == 0 )
+    if( deflateBeg > winBeg )
+        H.Set( deflateBeg, deflateBeg-1, spikeValue );
+    if( V.Height() == 0 )
     {
+        // It was signalled that no transformation was required
         return info;
     }
-    V.Resize( VSize, VSize );
-    El::Broadcast( V, HDefl_CIRC_CIRC.CrossComm(), HDefl_CIRC_CIRC.Root() );
-    HDefl = HDefl_CIRC_CIRC;
 
     if( ctrl.fullTriangle )
     {
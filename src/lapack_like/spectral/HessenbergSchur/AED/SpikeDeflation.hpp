@@ -21,12 +21,17 @@ struct AEDInfo
 
 namespace aed {
 
-template<typename Real,typename=EnableIf<IsReal<Real>>>
+// The entries of the spike (up to a factor of eta) are queried through
+// spikeEntry(j), which should return the j'th entry of the first row of the
+// accumulated transformation V; the windowed variant used by the distributed
+// algorithm only holds a local piece of that row.
+template<typename Real,typename SpikeEntry,typename=EnableIf<IsReal<Real>>>
 AEDInfo SpikeDeflation
 (       Matrix<Real>& T,
         Matrix<Real>& V,
   const Real& eta,
         Int numUnconverged,
+        SpikeEntry spikeEntry,
         vector<Real>& work )
 {
     EL_DEBUG_CSE
@@ -79,8 +84,8 @@ AEDInfo SpikeDeflation
               ( spectralRadius > 0 ? spectralRadius : Abs(eta) );
 
             // The relevant two entries of spike V^T [eta; zeros(n-1,1)]
-            const Real sigma0 = eta*V(0,winEnd-2);
-            const Real sigma1 = eta*V(0,winEnd-1);
+            const Real sigma0 = eta*spikeEntry(winEnd-2);
+            const Real sigma1 = eta*spikeEntry(winEnd-1);
 
             if( Max( Abs(sigma0), Abs(sigma1) ) <= Max( smallNum, ulp*scale ) )
             {
@@ -103,7 +108,8 @@ AEDInfo SpikeDeflation
               ( spectralRadius > 0 ? spectralRadius : Abs(eta) );
 
             // The relevant entry of the spike V^T [eta; zeros(n-1,1)]
-            if( Abs(eta)*Abs(V(0,winEnd-1)) <= Max( smallNum, ulp*scale ) )
+            if( Abs(eta)*Abs(spikeEntry(winEnd-1)) <=
+                Max( smallNum, ulp*scale ) )
             {
                 // The one-by-one block satisfies the "nearby-diagonal" test
                 winEnd -= 1;
@@ -126,12 +132,13 @@ AEDInfo SpikeDeflation
     return info;
 }
 
-template<typename Real>
+template<typename Real,typename SpikeEntry>
 AEDInfo SpikeDeflation
 (       Matrix<Complex<Real>>& T,
         Matrix<Complex<Real>>& V,
   const Complex<Real>& eta,
         Int numUnconverged,
+        SpikeEntry spikeEntry,
         vector<Complex<Real>>& work )
 {
     EL_DEBUG_CSE
@@ -151,7 +158,8 @@ AEDInfo SpikeDeflation
           ( spectralRadius > 0 ? spectralRadius : OneAbs(eta) );
 
         // The relevant entry of the spike V' [eta; zeros(n-1,1)]
-        if( OneAbs(eta)*OneAbs(V(0,winEnd-1)) <= Max( smallNum, ulp*scale ) )
+        if( OneAbs(eta)*OneAbs(spikeEntry(winEnd-1)) <=
+            Max( smallNum, ulp*scale ) )
         {
             // The one-by-one block satisfies the "nearby-diagonal" test
             winEnd -= 1;
@@ -172,6 +180,212 @@ AEDInfo SpikeDeflation
     return info;
 }
 
+template<typename Field>
+AEDInfo SpikeDeflation
+(       Matrix<Field>& T,
+        Matrix<Field>& V,
+  const Field& eta,
+        Int numUnconverged,
+        vector<Field>& work )
+{
+    EL_DEBUG_CSE
+    auto spikeEntry = [&]( Int j ) { return V(0,j); };
+    return SpikeDeflation( T, V, eta, numUnconverged, spikeEntry, work );
+}
+
+// Move the diagonal blocks of the quasi-triangular matrix T which lie within
+// [from,from+size) to the top of T (preserving their order) while
+// accumulating the transformations into Q
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+void MoveToTop
+( Matrix<Real>& T,
+  Matrix<Real>& Q,
+  Int from,
+  Int size )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Height();
+    vector<Real> work(n);
+    Int to = 0;
+    for( Int i=from; i<from+size; )
+    {
+        const bool twoByTwo = ( i+1 < from+size && T(i+1,i) != Real(0) );
+        lapack::SchurExchange
+        ( n, &T(0,0), T.LDim(), &Q(0,0), Q.LDim(), i, to, work.data() );
+        const Int blockSize = ( twoByTwo ? 2 : 1 );
+        to += blockSize;
+        i += blockSize;
+    }
+}
+
+template<typename Real>
+void MoveToTop
+( Matrix<Complex<Real>>& T,
+  Matrix<Complex<Real>>& Q,
+  Int from,
+  Int size )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Height();
+    for( Int i=from; i<from+size; ++i )
+        lapack::SchurExchange
+        ( n, &T(0,0), T.LDim(), &Q(0,0), Q.LDim(), i, i-from );
+}
+
+// Gather the diagonal window T(ind,ind), along with the corresponding portion
+// of the first row of V, to the process owning its top-left entry, which
+// overwrites the window via localUpdate(TWin,vWin,Q) while accumulating the
+// orthogonal transformation Q (starting from the identity). The
+// transformation is then applied to the remainder of T and to V in parallel,
+// and the integer returned by the local update is broadcast.
+template<typename Field,typename LocalUpdate>
+Int UpdateWindow
+( DistMatrix<Field,MC,MR,BLOCK>& T,
+  DistMatrix<Field,MC,MR,BLOCK>& V,
+  const IR& ind,
+  LocalUpdate localUpdate )
+{
+    EL_DEBUG_CSE
+    const Int winSize = ind.end - ind.beg;
+    const Grid& grid = T.Grid();
+    auto TWin = T( ind, ind );
+    auto vWin = V( IR(0,1), ind );
+
+    const int owner = TWin.Owner(0,0);
+    DistMatrix<Field,CIRC,CIRC> TWin_CIRC_CIRC( grid, owner ),
+      vWin_CIRC_CIRC( grid, owner );
+    TWin_CIRC_CIRC = TWin;
+    vWin_CIRC_CIRC = vWin;
+
+    Int result = 0;
+    Matrix<Field> Q;
+    if( TWin_CIRC_CIRC.CrossRank() == TWin_CIRC_CIRC.Root() )
+    {
+        Identity( Q, winSize, winSize );
+        result =
+          localUpdate
+          ( TWin_CIRC_CIRC.Matrix(), vWin_CIRC_CIRC.LockedMatrix(), Q );
+    }
+    else
+    {
+        Q.Resize( winSize, winSize );
+    }
+    mpi::Broadcast
+    ( result, TWin_CIRC_CIRC.Root(), TWin_CIRC_CIRC.CrossComm(),
+      SyncInfo<Device::CPU>{} );
+    El::Broadcast( Q, TWin_CIRC_CIRC.CrossComm(), TWin_CIRC_CIRC.Root() );
+    TWin = TWin_CIRC_CIRC;
+
+    auto TRight = T( ind, IR(ind.end,END) );
+    multibulge::TransformRows( Q, TRight );
+
+    auto TAbove = T( IR(0,ind.beg), ind );
+    multibulge::TransformColumns( Q, TAbove );
+
+    auto VWin = V( ALL, ind );
+    multibulge::TransformColumns( Q, VWin );
+
+    return result;
+}
+
+// Cf. Granat, Kagstrom, and Kressner, "A novel parallel QR algorithm for
+// hybrid distributed memory HPC systems", SIAM J. Sci. Comput., 32(4), 2010.
+//
+// The spike is deflated from the bottom up in chunks of at most twice the
+// distribution block size, each of which is handled by a single process. The
+// undeflatable blocks of each chunk are then moved to the top of the window
+// through a sequence of overlapping windows of the same size, so that the
+// reordering of the (possibly thousands of) eigenvalues is carried out by
+// level 3 updates distributed over the entire grid.
+template<typename Field>
+AEDInfo SpikeDeflation
+( DistMatrix<Field,MC,MR,BLOCK>& T,
+  DistMatrix<Field,MC,MR,BLOCK>& V,
+  const Field& eta,
+        Int numUnconverged )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Height();
+    const Field zero(0);
+    const Int chunkSize = Max( 2*T.BlockHeight(), Int(4) );
+    const Int bundleSize = chunkSize / 2;
+
+    // Clear everything below the subdiagonal for SchurExchange
+    MakeTrapezoidal( UPPER, T, -1 );
+
+    // Windows should not split the 2x2 diagonal blocks of a real Schur form
+    auto blockBoundary = [&]( Int i )
+      { return IsComplex<Field>::value || T.Get(i,i-1) == zero; };
+
+    auto deflateChunk =
+      [&]( Matrix<Field>& TWin, const Matrix<Field>& vWin, Matrix<Field>& Q )
+      {
+          const Int winSize = TWin.Height();
+          auto spikeEntry = [&]( Int j )
+            {
+                Field entry = zero;
+                for( Int i=0; i<winSize; ++i )
+                    entry += vWin(0,i)*Q(i,j);
+                return entry;
+            };
+          vector<Field> work;
+          auto chunkInfo = SpikeDeflation( TWin, Q, eta, 0, spikeEntry, work );
+          return chunkInfo.numShiftCandidates;
+      };
+
+    Int winBeg = numUnconverged;
+    Int winEnd = n;
+    while( winBeg < winEnd )
+    {
+        // Deflate within the bottom chunk of the remaining window, which
+        // leaves its undeflatable blocks at the top of the chunk
+        Int chunkBeg = Max( winBeg, winEnd-chunkSize );
+        if( chunkBeg > winBeg && !blockBoundary(chunkBeg) )
+            --chunkBeg;
+        const Int numKept =
+          UpdateWindow( T, V, IR(chunkBeg,winEnd), deflateChunk );
+        const Int keptEnd = chunkBeg + numKept;
+
+        // Move the undeflatable blocks of the chunk up to winBeg in bundles of
+        // at most half of a chunk
+        Int dest = winBeg;
+        Int bundleBeg = chunkBeg;
+        while( bundleBeg < keptEnd )
+        {
+            Int bundleEnd = Min( bundleBeg+bundleSize, keptEnd );
+            if( bundleEnd < keptEnd && !blockBoundary(bundleEnd) )
+                ++bundleEnd;
+            const Int numBundle = bundleEnd - bundleBeg;
+            auto moveBundle =
+              [&]( Matrix<Field>& TWin, const Matrix<Field>&,
+                   Matrix<Field>& Q )
+              {
+                  MoveToTop( TWin, Q, TWin.Height()-numBundle, numBundle );
+                  return Int(0);
+              };
+            for( Int from=bundleBeg; from>dest; )
+            {
+                Int top = Max( dest, from-(chunkSize-numBundle) );
+                if( top > dest && !blockBoundary(top) )
+                    --top;
+                UpdateWindow( T, V, IR(top,from+numBundle), moveBundle );
+                from = top;
+            }
+            dest += numBundle;
+            bundleBeg = bundleEnd;
+        }
+
+        winBeg += numKept;
+        winEnd = keptEnd;
+    }
+
+    AEDInfo info;
+    info.numUnconverged = numUnconverged;
+    info.numShiftCandidates = winBeg-numUnconverged;
+    info.numDeflated = n-winBeg;
+    return info;
+}
+
 } // namespace aed
 } // namespace hess_schur
 } // namespace El
@@ -42,7 +42,8 @@ Int ConsistentlyComputeEigenvalues
     El::Broadcast( w.Matrix(), H_CIRC_CIRC.CrossComm(), H_CIRC_CIRC.Root() );
     if( !ctrl.demandConverged )
         mpi::Broadcast
-        ( numUnconverged, H_CIRC_CIRC.Root(), H_CIRC_CIRC.CrossComm() );
+        ( numUnconverged, H_CIRC_CIRC.Root(), H_CIRC_CIRC.CrossComm(),
+          SyncInfo<Device::CPU>{} );
     return numUnconverged;
 }
 
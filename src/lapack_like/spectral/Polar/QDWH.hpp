@@ -22,6 +22,126 @@ namespace El {
 // The careful calculation of the coefficients is due to a suggestion from
 // Gregorio Quintana Orti.
 
+// The QR-based iterations require the orthonormal factor of the stacked
+// matrix [sqrt(c) A; I]. Since the identity block bounds the smallest singular
+// value of the stacked matrix from below by one, its condition number is at
+// most sqrt(1+c) (A is scaled to have a two-norm of roughly one), which allows
+// for choosing between CholeskyQR2 and shifted CholeskyQR3 a priori; see
+// Fukaya et al., "Shifted Cholesky QR for computing the QR factorization of
+// ill-conditioned matrices", SIAM J. Sci. Comput., 2020.
+//
+// The stacked matrix is never formed: the first Gram matrix is c A^H A + I,
+// the first bottom block is the inverse of the first triangular factor, and
+// every subsequent pass costs a Herk of each block and a Trsm of each block.
+// Each of the resulting bottom blocks is upper triangular, so that the update
+// QT QB^H is a single Trmm.
+//
+// If even shifted CholeskyQR3 cannot be trusted, or a Cholesky factorization
+// breaks down, false is returned and the caller should fall back to a
+// Householder QR factorization of the explicitly stacked matrix.
+
+namespace qdwh {
+
+template<typename Real>
+bool StackedCholeskyQRIsSafe( Int m, Int n, Real c, bool& shifted )
+{
+    const Real eps = limits::Epsilon<Real>();
+    const Real kappa = Sqrt(1+c);
+    shifted = ( kappa > Real(1)/(10*Sqrt(eps)) );
+    const Real stackedSize = m*n + n*(n+1);
+    return kappa <= Real(1)/(Sqrt(11*stackedSize)*eps);
+}
+
+template<typename F>
+bool StackedCholeskyQR
+( const Matrix<F>& A, Base<F> c, Matrix<F>& QT, Matrix<F>& QB )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    bool shifted;
+    if( !StackedCholeskyQRIsSafe( m+n, n, c, shifted ) )
+        return false;
+
+    Matrix<F> R;
+    Identity( R, n, n );
+    Herk( UPPER, ADJOINT, c, A, Real(1), R );
+    if( shifted )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        const Real frobSquared = RealPart(Trace(R));
+        const Real shift = 11*((m+n)*n+n*(n+1))*eps*frobSquared;
+        ShiftDiagonal( R, F(shift) );
+    }
+    try { Cholesky( UPPER, R ); }
+    catch( NonHPDMatrixException& e ) { return false; }
+    MakeTrapezoidal( UPPER, R );
+    QT = A;
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(Sqrt(c)), R, QT );
+    QB = R;
+    TriangularInverse( UPPER, NON_UNIT, QB );
+
+    const Int numPasses = ( shifted ? 2 : 1 );
+    for( Int pass=0; pass<numPasses; ++pass )
+    {
+        Herk( UPPER, ADJOINT, Real(1), QT, R );
+        Herk( UPPER, ADJOINT, Real(1), QB, Real(1), R );
+        try { Cholesky( UPPER, R ); }
+        catch( NonHPDMatrixException& e ) { return false; }
+        MakeTrapezoidal( UPPER, R );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, QT );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, QB );
+    }
+    return true;
+}
+
+template<typename F>
+bool StackedCholeskyQR
+( const DistMatrix<F>& A, Base<F> c, DistMatrix<F>& QT, DistMatrix<F>& QB )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    bool shifted;
+    if( !StackedCholeskyQRIsSafe( m+n, n, c, shifted ) )
+        return false;
+
+    DistMatrix<F> R(A.Grid());
+    Identity( R, n, n );
+    Herk( UPPER, ADJOINT, c, A, Real(1), R );
+    if( shifted )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        const Real frobSquared = RealPart(Trace(R));
+        const Real shift = 11*((m+n)*n+n*(n+1))*eps*frobSquared;
+        ShiftDiagonal( R, F(shift) );
+    }
+    try { Cholesky( UPPER, R ); }
+    catch( NonHPDMatrixException& e ) { return false; }
+    MakeTrapezoidal( UPPER, R );
+    QT = A;
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(Sqrt(c)), R, QT );
+    QB = R;
+    TriangularInverse( UPPER, NON_UNIT, QB );
+
+    const Int numPasses = ( shifted ? 2 : 1 );
+    for( Int pass=0; pass<numPasses; ++pass )
+    {
+        Herk( UPPER, ADJOINT, Real(1), QT, R );
+        Herk( UPPER, ADJOINT, Real(1), QB, Real(1), R );
+        try { Cholesky( UPPER, R ); }
+        catch( NonHPDMatrixException& e ) { return false; }
+        MakeTrapezoidal( UPPER, R );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, QT );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, QB );
+    }
+    return true;
+}
+
+} // namespace qdwh
+
 namespace polar {
 
 template<typename F>
@@ -81,13 +201,25 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
         if( c > 100 )
         {
             //
-            // The standard QR-based algorithm
+            // The QR-based algorithm, preferably via CholeskyQR of the
+            // implicitly stacked matrix
             //
-            QT = A;
-            QT *= Sqrt(c);
-            MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
-            Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            if( !ctrl.colPiv && qdwh::StackedCholeskyQR( A, c, QT, QB ) )
+            {
+                Trmm
+                ( RIGHT, UPPER, ADJOINT, NON_UNIT,
+                  F(alpha/Sqrt(c)), QB, QT );
+                A *= beta;
+                Axpy( F(1), QT, A );
+            }
+            else
+            {
+                QT = A;
+                QT *= Sqrt(c);
+                MakeIdentity( QB );
+                qr::ExplicitUnitary( Q, true, qrCtrl );
+                Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            }
             ++info.numQRIts;
         }
         else
@@ -156,8 +288,8 @@ QDWHInfo QDWH( Matrix<F>& A, Matrix<F>& P, const QDWHCtrl& ctrl )
     EL_DEBUG_CSE
     Matrix<F> ACopy( A );
     auto info = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return info;
 }
@@ -227,13 +359,25 @@ QDWHInner
         if( c > 100 )
         {
             //
-            // The standard QR-based algorithm
+            // The QR-based algorithm, preferably via CholeskyQR of the
+            // implicitly stacked matrix
             //
-            QT = A;
-            QT *= Sqrt(c);
-            MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
-            Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            if( !ctrl.colPiv && qdwh::StackedCholeskyQR( A, c, QT, QB ) )
+            {
+                Trmm
+                ( RIGHT, UPPER, ADJOINT, NON_UNIT,
+                  F(alpha/Sqrt(c)), QB, QT );
+                A *= beta;
+                Axpy( F(1), QT, A );
+            }
+            else
+            {
+                QT = A;
+                QT *= Sqrt(c);
+                MakeIdentity( QB );
+                qr::ExplicitUnitary( Q, true, qrCtrl );
+                Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            }
             ++info.numQRIts;
         }
         else
@@ -317,8 +461,8 @@ QDWH
 
     DistMatrix<F> ACopy( A );
     auto info = QDWH( A, ctrl );
-    Zeros( P, A.Height(), A.Height() );
-    Trrk( LOWER, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    Zeros( P, A.Width(), A.Width() );
+    Trrk( LOWER, ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
     MakeHermitian( LOWER, P );
     return info;
 }
@@ -390,14 +534,28 @@ QDWHInner
         if( c > 100 )
         {
             //
-            // The standard QR-based algorithm
+            // The QR-based algorithm, preferably via CholeskyQR of the
+            // implicitly stacked matrix
             //
             MakeHermitian( uplo, A );
-            QT = A;
-            QT *= Sqrt(c);
-            MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
-            Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            if( !ctrl.colPiv && qdwh::StackedCholeskyQR( A, c, QT, QB ) )
+            {
+                Trmm
+                ( RIGHT, UPPER, ADJOINT, NON_UNIT,
+                  F(alpha/Sqrt(c)), QB, QT );
+                A *= beta;
+                Axpy( F(1), QT, A );
+            }
+            else
+            {
+                QT = A;
+                QT *= Sqrt(c);
+                MakeIdentity( QB );
+                qr::ExplicitUnitary( Q, true, qrCtrl );
+                Trrk
+                ( uplo, NORMAL, ADJOINT,
+                  F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            }
             ++info.numQRIts;
         }
         else
@@ -542,14 +700,28 @@ QDWHInner
         if( c > 100 )
         {
             //
-            // The standard QR-based algorithm
+            // The QR-based algorithm, preferably via CholeskyQR of the
+            // implicitly stacked matrix
             //
             MakeHermitian( uplo, A );
-            QT = A;
-            QT *= Sqrt(c);
-            MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
-            Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            if( !ctrl.colPiv && qdwh::StackedCholeskyQR( A, c, QT, QB ) )
+            {
+                Trmm
+                ( RIGHT, UPPER, ADJOINT, NON_UNIT,
+                  F(alpha/Sqrt(c)), QB, QT );
+                A *= beta;
+                Axpy( F(1), QT, A );
+            }
+            else
+            {
+                QT = A;
+                QT *= Sqrt(c);
+                MakeIdentity( QB );
+                qr::ExplicitUnitary( Q, true, qrCtrl );
+                Trrk
+                ( uplo, NORMAL, ADJOINT,
+                  F(alpha/Sqrt(c)), QT, QB, F(beta), A );
+            }
             ++info.numQRIts;
         }
         else
@@ -14,6 +14,7 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Adaptive.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -570,112 +571,15 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 
 namespace pspec {
 
-template<typename Real>
-Matrix<Int> Helper
-( const Matrix<Real>& A,
-  const Matrix<Complex<Real>>& shifts,
-        Matrix<Real>& invNorms,
-        PseudospecCtrl<Real> psCtrl )
-{
-    EL_DEBUG_CSE
-    typedef Complex<Real> C;
-
-    if( psCtrl.forceComplexSchur )
-    {
-        Matrix<C> ACpx;
-        Copy( A, ACpx );
-        return SpectralCloud( ACpx, shifts, invNorms, psCtrl );
-    }
-
-    if( !psCtrl.schur )
-        LogicError("Real Hessenberg algorithm not yet supported");
-    Matrix<Real> U( A );
-    Matrix<C> w;
-    auto schurCtrl( psCtrl.schurCtrl );
-    schurCtrl.hessSchurCtrl.fullTriangle = true;
-    if( psCtrl.norm == PS_TWO_NORM )
-    {
-
-        Schur( U, w, schurCtrl );
-        if( psCtrl.forceComplexPs )
-        {
-            Matrix<C> UCpx;
-            schur::RealToComplex( U, UCpx );
-            return TriangularSpectralCloud( UCpx, shifts, invNorms, psCtrl );
-        }
-        return QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-    }
-    else
-    {
-        Matrix<Real> Q;
-        Schur( U, w, Q, schurCtrl );
-        if( psCtrl.forceComplexPs )
-        {
-            Matrix<C> UCpx, QCpx;
-            schur::RealToComplex( U, Q, UCpx, QCpx );
-            return TriangularSpectralCloud
-                   ( UCpx, QCpx, shifts, invNorms, psCtrl );
-        }
-        return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-    }
-}
-
-template<typename Real>
-DistMatrix<Int,VR,STAR> Helper
-( const AbstractDistMatrix<Real>& A,
-  const AbstractDistMatrix<Complex<Real>>& shifts,
-        AbstractDistMatrix<Real>& invNorms,
-        PseudospecCtrl<Real> psCtrl )
-{
-    EL_DEBUG_CSE
-    typedef Complex<Real> C;
-    const Grid& g = A.Grid();
-
-    if( psCtrl.forceComplexSchur )
-    {
-        DistMatrix<C> ACpx(g);
-        Copy( A, ACpx );
-        return SpectralCloud( ACpx, shifts, invNorms, psCtrl );
-    }
-
-    if( !psCtrl.schur )
-        LogicError("Real Hessenberg algorithm not yet supported");
-    DistMatrix<Real> U( A );
-    DistMatrix<C,VR,STAR> w(g);
-    auto schurCtrl( psCtrl.schurCtrl );
-    schurCtrl.hessSchurCtrl.fullTriangle = true;
-    if( psCtrl.norm == PS_TWO_NORM )
-    {
-        Schur( U, w, schurCtrl );
-        if( psCtrl.forceComplexPs )
-        {
-            DistMatrix<C> UCpx(g);
-            schur::RealToComplex( U, UCpx );
-            return TriangularSpectralCloud( UCpx, shifts, invNorms, psCtrl );
-        }
-        return QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-    }
-    else
-    {
-        DistMatrix<Real> Q(g);
-        Schur( U, w, Q, schurCtrl );
-        if( psCtrl.forceComplexPs )
-        {
-            DistMatrix<C> UCpx(g), QCpx(g);
-            schur::RealToComplex( U, Q, UCpx, QCpx );
-            return TriangularSpectralCloud
-                   ( UCpx, QCpx, shifts, invNorms, psCtrl );
-        }
-        return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-    }
-}
-
-template<typename Real>
-Matrix<Int> Helper
+// Reduce A to the (quasi-)triangular or Hessenberg form requested by psCtrl
+// and hand the result to the visitor, so that every consumer of the reduced
+// form (a spectral cloud, or each refinement level of a window) shares a
+// single reduction
+template<typename Real,class Visitor>
+auto Reduce
 ( const Matrix<Complex<Real>>& A,
-  const Matrix<Complex<Real>>& shifts,
-        Matrix<Real>& invNorms,
-        PseudospecCtrl<Real> psCtrl )
+  const PseudospecCtrl<Real>& psCtrl,
+  const Visitor& visitor )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -689,12 +593,12 @@ Matrix<Int> Helper
             auto schurCtrl( psCtrl.schurCtrl );
             schurCtrl.hessSchurCtrl.fullTriangle = true;
             Schur( U, w, schurCtrl );
-            return TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+            return visitor.Triangular( U );
         }
         else
         {
             hessenberg::ExplicitCondensed( UPPER, U );
-            return HessenbergSpectralCloud( U, shifts, invNorms, psCtrl );
+            return visitor.Hessenberg( U );
         }
     }
     else
@@ -706,7 +610,7 @@ Matrix<Int> Helper
             auto schurCtrl( psCtrl.schurCtrl );
             schurCtrl.hessSchurCtrl.fullTriangle = true;
             Schur( U, w, Q, schurCtrl );
-            return TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+            return visitor.Triangular( U, Q );
         }
         else
         {
@@ -714,17 +618,16 @@ Matrix<Int> Helper
             Hessenberg( UPPER, U, t );
             Identity( Q, A.Height(), A.Height() );
             hessenberg::ApplyQ( LEFT, UPPER, NORMAL, U, t, Q );
-            return HessenbergSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+            return visitor.Hessenberg( U, Q );
         }
     }
 }
 
-template<typename Real>
-DistMatrix<Int,VR,STAR> Helper
+template<typename Real,class Visitor>
+auto Reduce
 ( const AbstractDistMatrix<Complex<Real>>& A,
-  const AbstractDistMatrix<Complex<Real>>& shifts,
-        AbstractDistMatrix<Real>& invNorms,
-        PseudospecCtrl<Real> psCtrl )
+  const PseudospecCtrl<Real>& psCtrl,
+  const Visitor& visitor )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -740,12 +643,12 @@ DistMatrix<Int,VR,STAR> Helper
             auto schurCtrl( psCtrl.schurCtrl );
             schurCtrl.hessSchurCtrl.fullTriangle = true;
             Schur( U, w, schurCtrl );
-            return TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+            return visitor.Triangular( U );
         }
         else
         {
             hessenberg::ExplicitCondensed( UPPER, U );
-            return HessenbergSpectralCloud( U, shifts, invNorms, psCtrl );
+            return visitor.Hessenberg( U );
         }
     }
     else
@@ -757,7 +660,7 @@ DistMatrix<Int,VR,STAR> Helper
             auto schurCtrl( psCtrl.schurCtrl );
             schurCtrl.hessSchurCtrl.fullTriangle = true;
             Schur( U, w, Q, schurCtrl );
-            return TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+            return visitor.Triangular( U, Q );
         }
         else
         {
@@ -765,11 +668,180 @@ DistMatrix<Int,VR,STAR> Helper
             Hessenberg( UPPER, U, t );
             Identity( Q, U.Height(), U.Height() );
             hessenberg::ApplyQ( LEFT, UPPER, NORMAL, U, t, Q );
-            return HessenbergSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+            return visitor.Hessenberg( U, Q );
         }
     }
 }
 
+template<typename Real,class Visitor>
+auto Reduce
+( const Matrix<Real>& A,
+  const PseudospecCtrl<Real>& psCtrl,
+  const Visitor& visitor )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+
+    if( psCtrl.forceComplexSchur )
+    {
+        Matrix<C> ACpx;
+        Copy( A, ACpx );
+        return Reduce( ACpx, psCtrl, visitor );
+    }
+
+    if( !psCtrl.schur )
+        LogicError("Real Hessenberg algorithm not yet supported");
+    Matrix<Real> U( A );
+    Matrix<C> w;
+    auto schurCtrl( psCtrl.schurCtrl );
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+
+        Schur( U, w, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            Matrix<C> UCpx;
+            schur::RealToComplex( U, UCpx );
+            return visitor.Triangular( UCpx );
+        }
+        return visitor.QuasiTriangular( U );
+    }
+    else
+    {
+        Matrix<Real> Q;
+        Schur( U, w, Q, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            Matrix<C> UCpx, QCpx;
+            schur::RealToComplex( U, Q, UCpx, QCpx );
+            return visitor.Triangular( UCpx, QCpx );
+        }
+        return visitor.QuasiTriangular( U, Q );
+    }
+}
+
+template<typename Real,class Visitor>
+auto Reduce
+( const AbstractDistMatrix<Real>& A,
+  const PseudospecCtrl<Real>& psCtrl,
+  const Visitor& visitor )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+
+    if( psCtrl.forceComplexSchur )
+    {
+        DistMatrix<C> ACpx(g);
+        Copy( A, ACpx );
+        return Reduce( ACpx, psCtrl, visitor );
+    }
+
+    if( !psCtrl.schur )
+        LogicError("Real Hessenberg algorithm not yet supported");
+    DistMatrix<Real> U( A );
+    DistMatrix<C,VR,STAR> w(g);
+    auto schurCtrl( psCtrl.schurCtrl );
+    schurCtrl.hessSchurCtrl.fullTriangle = true;
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        Schur( U, w, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            DistMatrix<C> UCpx(g);
+            schur::RealToComplex( U, UCpx );
+            return visitor.Triangular( UCpx );
+        }
+        return visitor.QuasiTriangular( U );
+    }
+    else
+    {
+        DistMatrix<Real> Q(g);
+        Schur( U, w, Q, schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            DistMatrix<C> UCpx(g), QCpx(g);
+            schur::RealToComplex( U, Q, UCpx, QCpx );
+            return visitor.Triangular( UCpx, QCpx );
+        }
+        return visitor.QuasiTriangular( U, Q );
+    }
+}
+
+
+template<typename Real,class ShiftsMatrix,class InvNormsMatrix>
+struct CloudVisitor
+{
+    const ShiftsMatrix& shifts;
+    InvNormsMatrix& invNorms;
+    const PseudospecCtrl<Real>& psCtrl;
+
+    template<class UMatrix>
+    auto Triangular( const UMatrix& U ) const
+    { return TriangularSpectralCloud( U, shifts, invNorms, psCtrl ); }
+    template<class UMatrix>
+    auto Triangular( const UMatrix& U, const UMatrix& Q ) const
+    { return TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl ); }
+
+    template<class UMatrix>
+    auto QuasiTriangular( const UMatrix& U ) const
+    { return QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl ); }
+    template<class UMatrix>
+    auto QuasiTriangular( const UMatrix& U, const UMatrix& Q ) const
+    { return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl ); }
+
+    template<class HMatrix>
+    auto Hessenberg( const HMatrix& H ) const
+    { return HessenbergSpectralCloud( H, shifts, invNorms, psCtrl ); }
+    template<class HMatrix>
+    auto Hessenberg( const HMatrix& H, const HMatrix& Q ) const
+    { return HessenbergSpectralCloud( H, Q, shifts, invNorms, psCtrl ); }
+};
+
+template<typename Real,class MapMatrix>
+struct WindowVisitor
+{
+    MapMatrix& invNormMap;
+    Complex<Real> center;
+    Real realWidth, imagWidth;
+    Int realSize, imagSize;
+    const PseudospecCtrl<Real>& psCtrl;
+
+    template<class UMatrix>
+    auto Triangular( const UMatrix& U ) const
+    { return TriangularSpectralWindow
+             ( U, invNormMap, center, realWidth, imagWidth,
+               realSize, imagSize, psCtrl ); }
+    template<class UMatrix>
+    auto Triangular( const UMatrix& U, const UMatrix& Q ) const
+    { return TriangularSpectralWindow
+             ( U, Q, invNormMap, center, realWidth, imagWidth,
+               realSize, imagSize, psCtrl ); }
+
+    template<class UMatrix>
+    auto QuasiTriangular( const UMatrix& U ) const
+    { return QuasiTriangularSpectralWindow
+             ( U, invNormMap, center, realWidth, imagWidth,
+               realSize, imagSize, psCtrl ); }
+    template<class UMatrix>
+    auto QuasiTriangular( const UMatrix& U, const UMatrix& Q ) const
+    { return QuasiTriangularSpectralWindow
+             ( U, Q, invNormMap, center, realWidth, imagWidth,
+               realSize, imagSize, psCtrl ); }
+
+    template<class HMatrix>
+    auto Hessenberg( const HMatrix& H ) const
+    { return HessenbergSpectralWindow
+             ( H, invNormMap, center, realWidth, imagWidth,
+               realSize, imagSize, psCtrl ); }
+    template<class HMatrix>
+    auto Hessenberg( const HMatrix& H, const HMatrix& Q ) const
+    { return HessenbergSpectralWindow
+             ( H, Q, invNormMap, center, realWidth, imagWidth,
+               realSize, imagSize, psCtrl ); }
+};
+
 } // namespace pspec
 
 template<typename Field>
@@ -780,7 +852,11 @@ Matrix<Int> SpectralCloud
         PseudospecCtrl<Base<Field>> psCtrl )
 {
     EL_DEBUG_CSE
-    return pspec::Helper( A, shifts, invNorms, psCtrl );
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    pspec::CloudVisitor<Real,Matrix<C>,Matrix<Real>>
+      visitor{ shifts, invNorms, psCtrl };
+    return pspec::Reduce( A, psCtrl, visitor );
 }
 
 template<typename Field>
@@ -791,7 +867,12 @@ DistMatrix<Int,VR,STAR> SpectralCloud
         PseudospecCtrl<Base<Field>> psCtrl )
 {
     EL_DEBUG_CSE
-    return pspec::Helper( A, shifts, invNorms, psCtrl );
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    pspec::CloudVisitor
+    <Real,AbstractDistMatrix<C>,AbstractDistMatrix<Real>>
+      visitor{ shifts, invNorms, psCtrl };
+    return pspec::Reduce( A, psCtrl, visitor );
 }
 
 // Treat each pixel as being located a cell center and tesselate a box with
@@ -821,6 +902,17 @@ Matrix<Int> TriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+        const Matrix<C> w = schur::QuasiTriangEig( U );
+        return pspec::AdaptiveWindow
+          ( cloud, w, invNormMap, corner, realStep, imagStep, realSize,
+            imagSize, psCtrl );
+    }
     Matrix<C> shifts( realSize*imagSize, 1 );
     for( Int j=0; j<realSize*imagSize; ++j )
     {
@@ -866,6 +958,17 @@ Matrix<Int> TriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+        const Matrix<C> w = schur::QuasiTriangEig( U );
+        return pspec::AdaptiveWindow
+          ( cloud, w, invNormMap, corner, realStep, imagStep, realSize,
+            imagSize, psCtrl );
+    }
     Matrix<C> shifts( realSize*imagSize, 1 );
     for( Int j=0; j<realSize*imagSize; ++j )
     {
@@ -909,6 +1012,17 @@ Matrix<Int> QuasiTriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return QuasiTriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+        const Matrix<C> w = schur::QuasiTriangEig( U );
+        return pspec::AdaptiveWindow
+          ( cloud, w, invNormMap, corner, realStep, imagStep, realSize,
+            imagSize, psCtrl );
+    }
     Matrix<C> shifts( realSize*imagSize, 1 );
     for( Int j=0; j<realSize*imagSize; ++j )
     {
@@ -953,6 +1067,18 @@ Matrix<Int> QuasiTriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return QuasiTriangularSpectralCloud
+                   ( U, Q, shifts, invNorms, ctrl ); };
+        const Matrix<C> w = schur::QuasiTriangEig( U );
+        return pspec::AdaptiveWindow
+          ( cloud, w, invNormMap, corner, realStep, imagStep, realSize,
+            imagSize, psCtrl );
+    }
     Matrix<C> shifts( realSize*imagSize, 1 );
     for( Int j=0; j<realSize*imagSize; ++j )
     {
@@ -998,6 +1124,17 @@ Matrix<Int> HessenbergSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+        // The eigenvalues of a Hessenberg matrix are not readily available
+        return pspec::AdaptiveWindow
+          ( cloud, Matrix<C>(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     Matrix<C> shifts( realSize*imagSize, 1 );
     for( Int j=0; j<realSize*imagSize; ++j )
     {
@@ -1043,6 +1180,17 @@ Matrix<Int> HessenbergSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+        // The eigenvalues of a Hessenberg matrix are not readily available
+        return pspec::AdaptiveWindow
+          ( cloud, Matrix<C>(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     Matrix<C> shifts( realSize*imagSize, 1 );
     for( Int j=0; j<realSize*imagSize; ++j )
     {
@@ -1088,6 +1236,18 @@ DistMatrix<Int> TriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+        DistMatrix<C,STAR,STAR> w( schur::QuasiTriangEig( U ) );
+        return pspec::AdaptiveWindow
+          ( g, cloud, w.Matrix(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
     const Int numLocShifts = shifts.LocalHeight();
     for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
@@ -1137,6 +1297,18 @@ DistMatrix<Int> TriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+        DistMatrix<C,STAR,STAR> w( schur::QuasiTriangEig( U ) );
+        return pspec::AdaptiveWindow
+          ( g, cloud, w.Matrix(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
     const Int numLocShifts = shifts.LocalHeight();
     for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
@@ -1184,6 +1356,18 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return QuasiTriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+        DistMatrix<C,STAR,STAR> w( schur::QuasiTriangEig( U ) );
+        return pspec::AdaptiveWindow
+          ( g, cloud, w.Matrix(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
     const Int numLocShifts = shifts.LocalHeight();
     for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
@@ -1232,6 +1416,19 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return QuasiTriangularSpectralCloud
+                   ( U, Q, shifts, invNorms, ctrl ); };
+        DistMatrix<C,STAR,STAR> w( schur::QuasiTriangEig( U ) );
+        return pspec::AdaptiveWindow
+          ( g, cloud, w.Matrix(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
     const Int numLocShifts = shifts.LocalHeight();
     for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
@@ -1281,6 +1478,18 @@ DistMatrix<Int> HessenbergSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+        // The eigenvalues of a Hessenberg matrix are not readily available
+        return pspec::AdaptiveWindow
+          ( g, cloud, Matrix<C>(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
     const Int numLocShifts = shifts.LocalHeight();
     for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
@@ -1330,6 +1539,18 @@ DistMatrix<Int> HessenbergSpectralWindow
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
+    if( psCtrl.refineSteps > 0 )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl )
+          { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+        // The eigenvalues of a Hessenberg matrix are not readily available
+        return pspec::AdaptiveWindow
+          ( g, cloud, Matrix<C>(), invNormMap, corner, realStep, imagStep,
+            realSize, imagSize, psCtrl );
+    }
     DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
     const Int numLocShifts = shifts.LocalHeight();
     for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
@@ -1365,35 +1586,10 @@ Matrix<Int> SpectralWindow
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    typedef Complex<Real> C;
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = SpectralCloud( A, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap;
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    pspec::WindowVisitor<Real,Matrix<Real>>
+      visitor{ invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+               psCtrl };
+    return pspec::Reduce( A, psCtrl, visitor );
 }
 
 template<typename Field>
@@ -1409,39 +1605,10 @@ DistMatrix<Int> SpectralWindow
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    typedef Complex<Real> C;
-    const Grid& g = A.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = SpectralCloud( A, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g);
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    pspec::WindowVisitor<Real,AbstractDistMatrix<Real>>
+      visitor{ invNormMap, center, realWidth, imagWidth, realSize, imagSize,
+               psCtrl };
+    return pspec::Reduce( A, psCtrl, visitor );
 }
 
 template<typename Field>
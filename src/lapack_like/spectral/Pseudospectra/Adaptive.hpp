@@ -0,0 +1,374 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+#define EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+
+// Adaptive refinement of spectral windows: the pixels are first sampled on a
+// lattice which is 2^refineSteps times coarser in each direction, and cells of
+// the lattice are only bisected while the estimates at their corners straddle
+// one of the requested contours or while they contain an eigenvalue. Since
+// the norm of the resolvent is subharmonic, every component of a
+// pseudospectrum contains an eigenvalue, and so islands which are smaller
+// than the coarse cells are still resolved. Each refinement level is handed
+// to a single spectral cloud so that all of its shifts are iterated upon
+// simultaneously; as converged shifts are deflated from the active set, the
+// remaining work stays spread over the entire process grid rather than being
+// bound to the chunk it started in. The reduced (Schur or Hessenberg) form is
+// computed once by the caller and reused by every level.
+
+namespace El {
+namespace pspec {
+
+struct RefineCell
+{
+    Int xBeg, xEnd, yBeg, yEnd; // inclusive corners
+};
+
+// The (fractional) pixel coordinates of the eigenvalues within the window
+template<typename Real>
+void EigenvaluePixels
+( const Matrix<Complex<Real>>& eigs,
+  Complex<Real> corner,
+  Real realStep,
+  Real imagStep,
+  Int realSize,
+  Int imagSize,
+  vector<Real>& xPixels,
+  vector<Real>& yPixels )
+{
+    xPixels.resize( 0 );
+    yPixels.resize( 0 );
+    for( Int i=0; i<eigs.Height(); ++i )
+    {
+        const Real x = RealPart(eigs(i)-corner)/realStep - Real(1)/2;
+        const Real y = -ImagPart(eigs(i)-corner)/imagStep - Real(1)/2;
+        if( x >= Real(-1)/2 && x <= realSize-Real(1)/2 &&
+            y >= Real(-1)/2 && y <= imagSize-Real(1)/2 )
+        {
+            xPixels.push_back( Max( Min( x, Real(realSize-1) ), Real(0) ) );
+            yPixels.push_back( Max( Min( y, Real(imagSize-1) ), Real(0) ) );
+        }
+    }
+}
+
+template<typename Real>
+bool CellContainsEigenvalue
+( const RefineCell& cell,
+  const vector<Real>& xPixels,
+  const vector<Real>& yPixels )
+{
+    for( size_t i=0; i<xPixels.size(); ++i )
+        if( xPixels[i] >= cell.xBeg && xPixels[i] <= cell.xEnd &&
+            yPixels[i] >= cell.yBeg && yPixels[i] <= cell.yEnd )
+            return true;
+    return false;
+}
+
+template<typename Real>
+bool CellStraddles
+( const RefineCell& cell,
+  const Matrix<Real>& estimates,
+  Int imagSize,
+  const vector<Real>& contours )
+{
+    const Real a = estimates(cell.xBeg*imagSize+cell.yBeg);
+    const Real b = estimates(cell.xBeg*imagSize+cell.yEnd);
+    const Real c = estimates(cell.xEnd*imagSize+cell.yBeg);
+    const Real d = estimates(cell.xEnd*imagSize+cell.yEnd);
+    const Real minEst = Min( Min(a,b), Min(c,d) );
+    const Real maxEst = Max( Max(a,b), Max(c,d) );
+    if( contours.size() == 0 )
+        return maxEst > 10*minEst;
+    for( const auto& contour : contours )
+        if( minEst < contour && contour <= maxEst )
+            return true;
+    return false;
+}
+
+// Fill in the unevaluated pixels of a cell by bilinear interpolation of the
+// logarithms of its corner estimates
+template<typename Real>
+void InterpolateCell
+( const RefineCell& cell,
+  const Matrix<Int>& evaluated,
+        Matrix<Real>& estimates,
+  Int imagSize )
+{
+    const Real minEst = limits::Min<Real>();
+    auto logEst = [&]( Int x, Int y )
+      { return Log( Max( estimates(x*imagSize+y), minEst ) ); };
+    const Real a = logEst( cell.xBeg, cell.yBeg );
+    const Real b = logEst( cell.xBeg, cell.yEnd );
+    const Real c = logEst( cell.xEnd, cell.yBeg );
+    const Real d = logEst( cell.xEnd, cell.yEnd );
+    const Real xWidth = Max( cell.xEnd-cell.xBeg, Int(1) );
+    const Real yWidth = Max( cell.yEnd-cell.yBeg, Int(1) );
+    for( Int x=cell.xBeg; x<=cell.xEnd; ++x )
+    {
+        const Real s = (x-cell.xBeg) / xWidth;
+        for( Int y=cell.yBeg; y<=cell.yEnd; ++y )
+        {
+            const Int j = x*imagSize + y;
+            if( evaluated(j) )
+                continue;
+            const Real t = (y-cell.yBeg) / yWidth;
+            estimates(j) =
+              Exp( (1-s)*((1-t)*a+t*b) + s*((1-t)*c+t*d) );
+        }
+    }
+}
+
+// Drive the refinement, where evaluate(batch) must fill in the estimates and
+// iteration counts of the pixels listed in 'batch'. The bookkeeping is
+// redundant (and identical) on every process.
+template<typename Real,class EvalFunc>
+void Refine
+( const Matrix<Complex<Real>>& eigs,
+  Complex<Real> corner,
+  Real realStep,
+  Real imagStep,
+  Int realSize,
+  Int imagSize,
+  const PseudospecCtrl<Real>& psCtrl,
+  const EvalFunc& evaluate,
+        Matrix<Real>& estimates,
+        Matrix<Int>& itCounts )
+{
+    EL_DEBUG_CSE
+    vector<Real> xPixels, yPixels;
+    EigenvaluePixels
+    ( eigs, corner, realStep, imagStep, realSize, imagSize, xPixels, yPixels );
+
+    const Int numPixels = realSize*imagSize;
+    Zeros( estimates, numPixels, 1 );
+    Zeros( itCounts, numPixels, 1 );
+    Matrix<Int> evaluated;
+    Zeros( evaluated, numPixels, 1 );
+
+    vector<Int> batch;
+    auto request = [&]( Int x, Int y )
+    {
+        const Int j = x*imagSize + y;
+        if( !evaluated(j) )
+        {
+            evaluated(j) = 1;
+            batch.push_back( j );
+        }
+    };
+
+    // Form the coarse lattice, which always includes the last row and column
+    // of pixels
+    const Int stride = Int(1) << psCtrl.refineSteps;
+    vector<Int> xLattice, yLattice;
+    for( Int x=0; x<realSize-1; x+=stride )
+        xLattice.push_back( x );
+    xLattice.push_back( realSize-1 );
+    for( Int y=0; y<imagSize-1; y+=stride )
+        yLattice.push_back( y );
+    yLattice.push_back( imagSize-1 );
+
+    vector<RefineCell> active, unrefined;
+    for( const auto& x : xLattice )
+        for( const auto& y : yLattice )
+            request( x, y );
+    for( size_t i=0; i+1<Max(xLattice.size(),size_t(2)); ++i )
+    {
+        for( size_t j=0; j+1<Max(yLattice.size(),size_t(2)); ++j )
+        {
+            RefineCell cell;
+            cell.xBeg = xLattice[i];
+            cell.xEnd = xLattice[Min(i+1,xLattice.size()-1)];
+            cell.yBeg = yLattice[j];
+            cell.yEnd = yLattice[Min(j+1,yLattice.size()-1)];
+            active.push_back( cell );
+        }
+    }
+    evaluate( batch );
+    if( psCtrl.progress )
+        Output("Evaluated ",batch.size()," coarse shifts");
+
+    while( active.size() != 0 )
+    {
+        batch.clear();
+        vector<RefineCell> children;
+        for( const auto& cell : active )
+        {
+            const bool divisible =
+              cell.xEnd-cell.xBeg > 1 || cell.yEnd-cell.yBeg > 1;
+            if( !divisible ||
+                (!CellStraddles( cell, estimates, imagSize, psCtrl.contours ) &&
+                 !CellContainsEigenvalue( cell, xPixels, yPixels )) )
+            {
+                unrefined.push_back( cell );
+                continue;
+            }
+            // Bisect each dimension of the cell which has interior pixels
+            vector<Int> xSplit(1,cell.xBeg), ySplit(1,cell.yBeg);
+            if( cell.xEnd-cell.xBeg > 1 )
+                xSplit.push_back( (cell.xBeg+cell.xEnd)/2 );
+            xSplit.push_back( cell.xEnd );
+            if( cell.yEnd-cell.yBeg > 1 )
+                ySplit.push_back( (cell.yBeg+cell.yEnd)/2 );
+            ySplit.push_back( cell.yEnd );
+            for( const auto& x : xSplit )
+                for( const auto& y : ySplit )
+                    request( x, y );
+            for( size_t i=0; i+1<xSplit.size(); ++i )
+            {
+                for( size_t j=0; j+1<ySplit.size(); ++j )
+                {
+                    RefineCell child;
+                    child.xBeg = xSplit[i];
+                    child.xEnd = xSplit[i+1];
+                    child.yBeg = ySplit[j];
+                    child.yEnd = ySplit[j+1];
+                    children.push_back( child );
+                }
+            }
+        }
+        if( batch.size() != 0 )
+        {
+            evaluate( batch );
+            if( psCtrl.progress )
+                Output("Evaluated ",batch.size()," refined shifts");
+        }
+        active.swap( children );
+    }
+
+    for( const auto& cell : unrefined )
+        InterpolateCell( cell, evaluated, estimates, imagSize );
+}
+
+// The eigenvalues (which may be empty, e.g., for Hessenberg matrices) are
+// always refined around
+template<typename Real,class CloudFunc>
+Matrix<Int> AdaptiveWindow
+( const CloudFunc& cloud,
+  const Matrix<Complex<Real>>& eigs,
+        Matrix<Real>& invNormMap,
+  Complex<Real> corner,
+  Real realStep,
+  Real imagStep,
+  Int realSize,
+  Int imagSize,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+
+    // Snapshots of partial sets of shifts cannot be reshaped into the window
+    auto batchCtrl( psCtrl );
+    batchCtrl.snapCtrl.realSize = 0;
+    batchCtrl.snapCtrl.imagSize = 0;
+
+    Matrix<Real> estimates;
+    Matrix<Int> itCounts;
+    auto evaluate = [&]( const vector<Int>& batch )
+    {
+        const Int numBatch = batch.size();
+        Matrix<C> shifts( numBatch, 1 );
+        for( Int k=0; k<numBatch; ++k )
+        {
+            const Int x = batch[k] / imagSize;
+            const Int y = batch[k] % imagSize;
+            shifts(k) = corner + C((x+0.5)*realStep,-(y+0.5)*imagStep);
+        }
+        Matrix<Real> invNorms;
+        auto batchItCounts = cloud( shifts, invNorms, batchCtrl );
+        for( Int k=0; k<numBatch; ++k )
+        {
+            estimates(batch[k]) = invNorms(k);
+            itCounts(batch[k]) = batchItCounts(k);
+        }
+    };
+    Refine
+    ( eigs, corner, realStep, imagStep, realSize, imagSize, psCtrl, evaluate,
+      estimates, itCounts );
+
+    auto snapCtrl( psCtrl.snapCtrl );
+    FinalSnapshot( estimates, itCounts, snapCtrl );
+
+    Matrix<Int> itCountMap;
+    ReshapeIntoGrid( realSize, imagSize, estimates, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+template<typename Real,class CloudFunc>
+DistMatrix<Int> AdaptiveWindow
+( const Grid& g,
+  const CloudFunc& cloud,
+  const Matrix<Complex<Real>>& eigs,
+        AbstractDistMatrix<Real>& invNormMap,
+  Complex<Real> corner,
+  Real realStep,
+  Real imagStep,
+  Int realSize,
+  Int imagSize,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+
+    // Snapshots of partial sets of shifts cannot be reshaped into the window
+    auto batchCtrl( psCtrl );
+    batchCtrl.snapCtrl.realSize = 0;
+    batchCtrl.snapCtrl.imagSize = 0;
+
+    Matrix<Real> estimates;
+    Matrix<Int> itCounts;
+    auto evaluate = [&]( const vector<Int>& batch )
+    {
+        const Int numBatch = batch.size();
+        DistMatrix<C,VR,STAR> shifts( numBatch, 1, g );
+        const Int numLocShifts = shifts.LocalHeight();
+        for( Int kLoc=0; kLoc<numLocShifts; ++kLoc )
+        {
+            const Int k = shifts.GlobalRow(kLoc);
+            const Int x = batch[k] / imagSize;
+            const Int y = batch[k] % imagSize;
+            shifts.SetLocal
+            ( kLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+        }
+        DistMatrix<Real,VR,STAR> invNorms(g);
+        auto batchItCounts = cloud( shifts, invNorms, batchCtrl );
+        DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNorms );
+        DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( batchItCounts );
+        for( Int k=0; k<numBatch; ++k )
+        {
+            estimates(batch[k]) = invNorms_STAR_STAR.GetLocal(k,0);
+            itCounts(batch[k]) = itCounts_STAR_STAR.GetLocal(k,0);
+        }
+    };
+    Refine
+    ( eigs, corner, realStep, imagStep, realSize, imagSize, psCtrl, evaluate,
+      estimates, itCounts );
+
+    DistMatrix<Real,VR,STAR> estimates_VR_STAR( realSize*imagSize, 1, g );
+    DistMatrix<Int,VR,STAR> itCounts_VR_STAR( realSize*imagSize, 1, g );
+    const Int numLocPixels = estimates_VR_STAR.LocalHeight();
+    for( Int jLoc=0; jLoc<numLocPixels; ++jLoc )
+    {
+        const Int j = estimates_VR_STAR.GlobalRow(jLoc);
+        estimates_VR_STAR.SetLocal( jLoc, 0, estimates(j) );
+        itCounts_VR_STAR.SetLocal( jLoc, 0, itCounts(j) );
+    }
+    auto snapCtrl( psCtrl.snapCtrl );
+    FinalSnapshot( estimates_VR_STAR, itCounts_VR_STAR, snapCtrl );
+
+    DistMatrix<Int> itCountMap(g);
+    ReshapeIntoGrid( realSize, imagSize, estimates_VR_STAR, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts_VR_STAR, itCountMap );
+    return itCountMap;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
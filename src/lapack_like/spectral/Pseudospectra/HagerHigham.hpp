@@ -144,7 +144,7 @@ OneNormConvergenceTest
     }
     mpi::AllReduce
     ( valueInts.data(), numLocShifts, mpi::MaxLocOp<Real>(),
-      activeZ.ColComm() );
+      activeZ.ColComm(), SyncInfo<Device::CPU>() );
 
     // Compute the real parts of the inner products of each column of Z and X
     // NOTE: Except in the first iteration, each column of X should only have
@@ -159,14 +159,16 @@ OneNormConvergenceTest
         innerProds[jLoc] = RealPart(innerProd);
     }
     mpi::AllReduce
-    ( innerProds.data(), numLocShifts, mpi::SUM, activeZ.ColComm() );
+    ( innerProds.data(), numLocShifts, mpi::SUM, activeZ.ColComm(),
+      SyncInfo<Device::CPU>() );
 
     // Compute the one norms
     vector<Real> oneNorms(numLocShifts);
     for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
         oneNorms[jLoc] = blas::Nrm1( nLoc, activeY.LockedBuffer(0,jLoc), 1 );
     mpi::AllReduce
-    ( oneNorms.data(), numLocShifts, mpi::SUM, activeY.ColComm() );
+    ( oneNorms.data(), numLocShifts, mpi::SUM, activeY.ColComm(),
+      SyncInfo<Device::CPU>() );
 
     // Check for convergence
     for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
@@ -702,7 +704,8 @@ HagerHigham
     vector<Real> oneNorms(numLocShifts);
     for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
         oneNorms[jLoc] = blas::Nrm1( nLoc, X.LockedBuffer(0,jLoc), 1 );
-    mpi::AllReduce( oneNorms.data(), numLocShifts, mpi::SUM, g.ColComm() );
+    mpi::AllReduce( oneNorms.data(), numLocShifts, mpi::SUM, g.ColComm(),
+                    SyncInfo<Device::CPU>() );
     DistMatrix<Real,MR,STAR> invNorms_MR_STAR(g);
     invNorms_MR_STAR.AlignWith( X );
     invNorms_MR_STAR = invNorms;
@@ -927,7 +930,8 @@ HagerHigham
     vector<Real> oneNorms(numLocShifts);
     for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
         oneNorms[jLoc] = blas::Nrm1( nLoc, X.LockedBuffer(0,jLoc), 1 );
-    mpi::AllReduce( oneNorms.data(), numLocShifts, mpi::SUM, g.ColComm() );
+    mpi::AllReduce( oneNorms.data(), numLocShifts, mpi::SUM, g.ColComm(),
+                    SyncInfo<Device::CPU>() );
     DistMatrix<Real,MR,STAR> invNorms_MR_STAR(g);
     invNorms_MR_STAR.AlignWith( X );
     invNorms_MR_STAR = invNorms;
@@ -169,10 +169,12 @@ void Deflate
                     const Int partner = activeX.ColOwner(swapTo);
                     mpi::TaggedSendRecv
                     ( HDiagList[localFrom].Buffer(), n,
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
+                      partner, swapFrom, partner, swapFrom, activeX.RowComm(),
+                      SyncInfo<Device::CPU>() );
                     mpi::TaggedSendRecv
                     ( HSubdiagList[localFrom].Buffer(), n,
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
+                      partner, swapFrom, partner, swapFrom, activeX.RowComm(),
+                      SyncInfo<Device::CPU>() );
                 }
                 else if( activeX.IsLocalCol(swapTo) )
                 {
@@ -186,10 +188,12 @@ void Deflate
                     const Int partner = activeX.ColOwner(swapFrom);
                     mpi::TaggedSendRecv
                     ( HDiagList[localTo].Buffer(), n,
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
+                      partner, swapFrom, partner, swapFrom, activeX.RowComm(),
+                      SyncInfo<Device::CPU>() );
                     mpi::TaggedSendRecv
                     ( HSubdiagList[localTo].Buffer(), n,
-                      partner, swapFrom, partner, swapFrom, activeX.RowComm() );
+                      partner, swapFrom, partner, swapFrom, activeX.RowComm(),
+                      SyncInfo<Device::CPU>() );
                 }
 
                 RowSwap( shiftsCopy,    swapFrom, swapTo );
@@ -251,7 +251,8 @@ void InnerProducts
     )
     InnerProducts( X.LockedMatrix(), Y.LockedMatrix(), innerProds );
     const Int numLocShifts = X.LocalWidth();
-    mpi::AllReduce( innerProds.Buffer(), numLocShifts, mpi::SUM, X.ColComm() );
+    mpi::AllReduce( innerProds.Buffer(), numLocShifts, mpi::SUM, X.ColComm(),
+                    SyncInfo<Device::CPU>() );
 }
 
 template<typename Real>
@@ -287,7 +288,8 @@ void InnerProducts
     )
     InnerProducts( X.LockedMatrix(), Y.LockedMatrix(), innerProds );
     const Int numLocShifts = X.LocalWidth();
-    mpi::AllReduce( innerProds.Buffer(), numLocShifts, mpi::SUM, X.ColComm() );
+    mpi::AllReduce( innerProds.Buffer(), numLocShifts, mpi::SUM, X.ColComm(),
+                    SyncInfo<Device::CPU>() );
 }
 
 template<typename Real>
@@ -307,7 +309,8 @@ void InnerProducts
       YReal.LockedMatrix(), YImag.LockedMatrix(), innerProds );
     const Int numLocShifts = XReal.LocalWidth();
     mpi::AllReduce
-    ( innerProds.Buffer(), numLocShifts, mpi::SUM, XReal.ColComm() );
+    ( innerProds.Buffer(), numLocShifts, mpi::SUM, XReal.ColComm(),
+      SyncInfo<Device::CPU>() );
 }
 
 template<typename Field>
@@ -10,6 +10,7 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/Randomized.hpp"
 
 namespace El {
 
@@ -714,6 +715,103 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized low-rank SVD
+// =======================
+
+template<typename Field>
+void RandomizedRangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int l = svd::randomized::NumSamples<Field>
+      ( A.Height(), A.Width(), ctrl );
+    svd::randomized::RangeFinder( A, Q, l, ctrl );
+}
+
+template<typename Field>
+void RandomizedRangeFinder
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& QPre,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,VC,STAR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& Q = QProx.Get();
+    const Int l = svd::randomized::NumSamples<Field>
+      ( A.Height(), A.Width(), ctrl );
+    svd::randomized::RangeFinder( A, Q, l, ctrl );
+}
+
+template<typename Field>
+SVDInfo RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int l = svd::randomized::NumSamples<Field>( m, n, ctrl );
+    Matrix<Field> Q;
+    if( m >= n )
+    {
+        svd::randomized::RangeFinder( A, Q, l, ctrl );
+        return svd::randomized::ProjectedSVD( A, Q, U, s, V, ctrl );
+    }
+    else
+    {
+        // Sample the row space instead, since A^H = V Sigma U^H
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        svd::randomized::RangeFinder( AAdj, Q, l, ctrl );
+        return svd::randomized::ProjectedSVD( AAdj, Q, V, s, U, ctrl );
+    }
+}
+
+template<typename Field>
+SVDInfo RandomizedSVD
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& UPre,
+        AbstractDistMatrix<Base<Field>>& sPre,
+        AbstractDistMatrix<Field>& VPre,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int l = svd::randomized::NumSamples<Field>( m, n, ctrl );
+
+    DistMatrixWriteProxy<Field,Field,VC,STAR> UProx( UPre );
+    DistMatrixWriteProxy<Base<Field>,Base<Field>,STAR,STAR> sProx( sPre );
+    DistMatrixWriteProxy<Field,Field,VC,STAR> VProx( VPre );
+    auto& U = UProx.Get();
+    auto& s = sProx.Get();
+    auto& V = VProx.Get();
+
+    DistMatrix<Field,VC,STAR> Q( APre.Grid() );
+    if( m >= n )
+    {
+        DistMatrixReadProxy<Field,Field,VC,STAR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        svd::randomized::RangeFinder( A, Q, l, ctrl );
+        return svd::randomized::ProjectedSVD( A, Q, U, s, V, ctrl );
+    }
+    else
+    {
+        // Sample the row space instead, since A^H = V Sigma U^H
+        DistMatrix<Field,VC,STAR> AAdj( APre.Grid() );
+        Adjoint( APre, AAdj );
+        svd::randomized::RangeFinder( AAdj, Q, l, ctrl );
+        return svd::randomized::ProjectedSVD( AAdj, Q, V, s, U, ctrl );
+    }
+}
+
 #define PROTO(Field) \
   template SVDInfo SVD \
   (       Matrix<Field>& A, \
@@ -766,7 +864,27 @@ SVDInfo TSQR
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& U, \
           AbstractDistMatrix<Base<Field>>& s, \
-          AbstractDistMatrix<Field>& V );
+          AbstractDistMatrix<Field>& V ); \
+  template void RandomizedRangeFinder \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& Q, \
+    const RandomizedSVDCtrl<Base<Field>>& ctrl ); \
+  template void RandomizedRangeFinder \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& Q, \
+    const RandomizedSVDCtrl<Base<Field>>& ctrl ); \
+  template SVDInfo RandomizedSVD \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+    const RandomizedSVDCtrl<Base<Field>>& ctrl ); \
+  template SVDInfo RandomizedSVD \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+    const RandomizedSVDCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,344 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_RANDOMIZED_HPP
+#define EL_SVD_RANDOMIZED_HPP
+
+// Randomized range finders and low-rank SVDs in the spirit of
+//
+//   N. Halko, P.G. Martinsson, and J.A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//    constructing approximate matrix decompositions",
+//   SIAM Review, 53(2), pp. 217--288, 2011.
+//
+// The distributed variants store A in a [VC,STAR] distribution so that every
+// product with a thin sketch is a local GEMM, followed (when multiplying with
+// A^H) by a single AllReduce of an n x l matrix, while the orthonormalization
+// of the tall-skinny samples uses TSQR whenever it is applicable and
+// otherwise CholeskyQR2 (with its shifted and Householder fallbacks), which
+// requires a single AllReduce per pass.
+
+namespace El {
+namespace svd {
+namespace randomized {
+
+template<typename Field>
+Int NumSamples( Int m, Int n, const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    if( ctrl.rank < 0 )
+        LogicError("Rank must be non-negative");
+    if( ctrl.oversampling < 0 )
+        LogicError("Oversampling must be non-negative");
+    if( ctrl.numPowerIts < 0 )
+        LogicError("Number of power iterations must be non-negative");
+    return Min( ctrl.rank+ctrl.oversampling, Min(m,n) );
+}
+
+// Draw the random signs and the sampled columns of a subsampled randomized
+// Hadamard transform of an n-vector into an l-vector, where the Hadamard
+// matrix is of order N, the first power of two which is at least n
+inline void DrawHadamardSketch
+( Int n, Int l, Matrix<Int>& signs, Matrix<Int>& sampleInds )
+{
+    EL_DEBUG_CSE
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    signs.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        signs(j) = ( BooleanCoinFlip() ? 1 : -1 );
+
+    // Sample l of the N columns without replacement via a partial
+    // Fisher-Yates shuffle
+    vector<Int> perm( N );
+    for( Int j=0; j<N; ++j )
+        perm[j] = j;
+    sampleInds.Resize( l, 1 );
+    for( Int t=0; t<l; ++t )
+    {
+        const Int s = SampleUniform( t, N );
+        std::swap( perm[t], perm[s] );
+        sampleInds(t) = perm[t];
+    }
+}
+
+// Y := A D H S / sqrt(l), where D = diag(signs), H is the (unnormalized)
+// Hadamard matrix of order N, and S selects the columns 'sampleInds'.
+//
+// Blocks of rows of A are padded to width N and transformed in place with
+// the fast Walsh-Hadamard butterflies, which act upon contiguous columns,
+// so that the cost is O(m N log N) rather than the O(m n l) of a dense sketch.
+template<typename Field>
+void HadamardSketch
+( const Matrix<Field>& A,
+  const Matrix<Int>& signs,
+  const Matrix<Int>& sampleInds,
+        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int l = sampleInds.Height();
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    const Real scale = Real(1) / Sqrt(Real(l));
+
+    Y.Resize( m, l );
+    const Int bsize = Blocksize();
+    Matrix<Field> W;
+    for( Int iBeg=0; iBeg<m; iBeg+=bsize )
+    {
+        const Int mb = Min( bsize, m-iBeg );
+        Zeros( W, mb, N );
+        for( Int j=0; j<n; ++j )
+        {
+            const Field* aCol = A.LockedBuffer(iBeg,j);
+                  Field* wCol = W.Buffer(0,j);
+            if( signs(j) > 0 )
+                for( Int i=0; i<mb; ++i )
+                    wCol[i] = aCol[i];
+            else
+                for( Int i=0; i<mb; ++i )
+                    wCol[i] = -aCol[i];
+        }
+
+        for( Int h=1; h<N; h*=2 )
+        {
+            for( Int jBeg=0; jBeg<N; jBeg+=2*h )
+            {
+                for( Int j=jBeg; j<jBeg+h; ++j )
+                {
+                    Field* x = W.Buffer(0,j);
+                    Field* y = W.Buffer(0,j+h);
+                    for( Int i=0; i<mb; ++i )
+                    {
+                        const Field alpha = x[i];
+                        const Field beta = y[i];
+                        x[i] = alpha + beta;
+                        y[i] = alpha - beta;
+                    }
+                }
+            }
+        }
+
+        for( Int t=0; t<l; ++t )
+        {
+            const Field* wCol = W.LockedBuffer(0,sampleInds(t));
+                  Field* yCol = Y.Buffer(iBeg,t);
+            for( Int i=0; i<mb; ++i )
+                yCol[i] = scale*wCol[i];
+        }
+    }
+}
+
+// Y := A Omega, where Omega is an n x l sketching matrix
+template<typename Field>
+void Sketch
+( const Matrix<Field>& A,
+        Matrix<Field>& Y,
+  Int l,
+  SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    if( sketch == HADAMARD_SKETCH )
+    {
+        Matrix<Int> signs, sampleInds;
+        DrawHadamardSketch( n, l, signs, sampleInds );
+        HadamardSketch( A, signs, sampleInds, Y );
+    }
+    else
+    {
+        Matrix<Field> Omega;
+        Gaussian( Omega, n, l );
+        Gemm( NORMAL, NORMAL, Field(1), A, Omega, Y );
+    }
+}
+
+// The sketch is drawn identically on every process, so that each process
+// can apply it to its own rows of A without communication
+template<typename Field>
+void Sketch
+( const DistMatrix<Field,VC,STAR>& A,
+        DistMatrix<Field,VC,STAR>& Y,
+  Int l,
+  SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& g = A.Grid();
+    Y.AlignWith( A );
+    Y.Resize( m, l );
+    if( sketch == HADAMARD_SKETCH )
+    {
+        Matrix<Int> signs, sampleInds;
+        if( g.VCRank() == 0 )
+            DrawHadamardSketch( n, l, signs, sampleInds );
+        else
+        {
+            signs.Resize( n, 1 );
+            sampleInds.Resize( l, 1 );
+        }
+        Broadcast( signs, g.VCComm(), 0 );
+        Broadcast( sampleInds, g.VCComm(), 0 );
+        HadamardSketch( A.LockedMatrix(), signs, sampleInds, Y.Matrix() );
+    }
+    else
+    {
+        DistMatrix<Field,STAR,STAR> Omega(g);
+        Gaussian( Omega, n, l );
+        LocalGemm( NORMAL, NORMAL, Field(1), A, Omega, Y );
+    }
+}
+
+// Overwrite the tall-skinny Y with an orthonormal basis for its range
+template<typename Field>
+void Orthonormalize( DistMatrix<Field,VC,STAR>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = Y.Height();
+    const Int l = Y.Width();
+    const Int p = mpi::Size( Y.ColComm() );
+    if( Y.ColAlign() == 0 && PowerOfTwo(p) && m >= p*l )
+    {
+        DistMatrix<Field,STAR,STAR> R(Y.Grid());
+        qr::ExplicitTS( Y, R );
+    }
+    else
+    {
+        DistMatrix<Field,STAR,STAR> R(Y.Grid());
+        qr::AdaptiveCholesky( Y, R );
+    }
+}
+
+// Z := A^H Y, where A and Y are distributed by rows, is formed redundantly
+template<typename Field>
+void AdjointProduct
+( const DistMatrix<Field,VC,STAR>& A,
+  const DistMatrix<Field,VC,STAR>& Y,
+        DistMatrix<Field,STAR,STAR>& Z )
+{
+    EL_DEBUG_CSE
+    Z.Resize( A.Width(), Y.Width() );
+    LocalGemm( ADJOINT, NORMAL, Field(1), A, Y, Z );
+    AllReduce( Z, A.ColComm() );
+}
+
+template<typename Field>
+void RangeFinder
+( const Matrix<Field>& A,
+        Matrix<Field>& Q,
+  Int l,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Sketch( A, Q, l, ctrl.sketch );
+    qr::ExplicitUnitary( Q );
+
+    Matrix<Field> Z;
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), A, Q, Z );
+        qr::ExplicitUnitary( Z );
+        Gemm( NORMAL, NORMAL, Field(1), A, Z, Q );
+        qr::ExplicitUnitary( Q );
+    }
+}
+
+template<typename Field>
+void RangeFinder
+( const DistMatrix<Field,VC,STAR>& A,
+        DistMatrix<Field,VC,STAR>& Q,
+  Int l,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Sketch( A, Q, l, ctrl.sketch );
+    Orthonormalize( Q );
+
+    // The n x l iterates Z = A^H Q are small enough to be orthonormalized
+    // redundantly
+    DistMatrix<Field,STAR,STAR> Z(A.Grid());
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        AdjointProduct( A, Q, Z );
+        qr::ExplicitUnitary( Z.Matrix() );
+        LocalGemm( NORMAL, NORMAL, Field(1), A, Z, Q );
+        Orthonormalize( Q );
+    }
+}
+
+// Given an orthonormal basis Q for the approximate range of A, form the
+// truncated SVD of the projection Q Q^H A = (Q U_B) Sigma V^H
+template<typename Field>
+SVDInfo ProjectedSVD
+( const Matrix<Field>& A,
+  const Matrix<Field>& Q,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> B;
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+
+    Matrix<Field> UB;
+    auto info = SVD( B, UB, s, V, ctrl.svdCtrl );
+    const Int k = Min( ctrl.rank, s.Height() );
+    s.Resize( k, 1 );
+    V.Resize( V.Height(), k );
+    Gemm( NORMAL, NORMAL, Field(1), Q, UB(ALL,IR(0,k)), U );
+    return info;
+}
+
+// The l x n projection B = Q^H A is decomposed redundantly, after which the
+// left singular vectors Q U_B are formed locally
+template<typename Field>
+SVDInfo ProjectedSVD
+( const DistMatrix<Field,VC,STAR>& A,
+  const DistMatrix<Field,VC,STAR>& Q,
+        DistMatrix<Field,VC,STAR>& U,
+        DistMatrix<Base<Field>,STAR,STAR>& s,
+        DistMatrix<Field,VC,STAR>& V,
+  const RandomizedSVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<Field,STAR,STAR> BAdj(g);
+    AdjointProduct( A, Q, BAdj );
+
+    // Since B^H = V Sigma U_B^H, the roles of the singular vectors swap
+    Matrix<Field> UB, VB;
+    Matrix<Base<Field>> sB;
+    auto info = SVD( BAdj.Matrix(), VB, sB, UB, ctrl.svdCtrl );
+    const Int k = Min( ctrl.rank, sB.Height() );
+    s.Resize( k, 1 );
+    s.Matrix() = sB( IR(0,k), ALL );
+
+    DistMatrix<Field,STAR,STAR> UBTrunc(g), VBTrunc(g);
+    UBTrunc.Resize( UB.Height(), k );
+    VBTrunc.Resize( VB.Height(), k );
+    UBTrunc.Matrix() = UB( ALL, IR(0,k) );
+    VBTrunc.Matrix() = VB( ALL, IR(0,k) );
+
+    U.AlignWith( Q );
+    U.Resize( Q.Height(), k );
+    LocalGemm( NORMAL, NORMAL, Field(1), Q, UBTrunc, U );
+    V = VBTrunc;
+    return info;
+}
+
+} // namespace randomized
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_RANDOMIZED_HPP
@@ -104,8 +104,8 @@ ValueInt<Base<F>> ComputePartition( DistMatrix<F>& A )
             }
         }
     }
-    mpi::AllReduce( colSums.data(), n-1, g.VCComm() );
-    mpi::AllReduce( rowSums.data(), n-1, g.VCComm() );
+    mpi::AllReduce( colSums.data(), n-1, g.VCComm(), SyncInfo<Device::CPU>() );
+    mpi::AllReduce( rowSums.data(), n-1, g.VCComm(), SyncInfo<Device::CPU>() );
 
     // Compute the list of norms and its minimum value/index
     // TODO: Think of the proper way to parallelize this if necessary
@@ -649,7 +649,7 @@ SpectralDivide( DistMatrix<Real>& A, const SDCCtrl<Real>& ctrl )
     {
         ++it;
         Real shift = SampleBall<Real>(-median.value,spread);
-        mpi::Broadcast( shift, 0, g.VCComm() );
+        mpi::Broadcast( shift, 0, g.VCComm(), SyncInfo<Device::CPU>() );
 
         G = A;
         ShiftDiagonal( G, shift );
@@ -717,13 +717,13 @@ SpectralDivide( DistMatrix<Complex<Real>>& A, const SDCCtrl<Real>& ctrl )
         ++it;
         const Real angle = SampleUniform<Real>(0,2*Pi<Real>());
         F gamma = F(Cos(angle),Sin(angle));
-        mpi::Broadcast( gamma, 0, A.Grid().VCComm() );
+        mpi::Broadcast( gamma, 0, A.Grid().VCComm(), SyncInfo<Device::CPU>() );
         G = A;
         G *= gamma;
 
         const auto median = Median(GetRealPartOfDiagonal(G));
         F shift = SampleBall<F>(-median.value,spread);
-        mpi::Broadcast( shift, 0, g.VCComm() );
+        mpi::Broadcast( shift, 0, g.VCComm(), SyncInfo<Device::CPU>() );
         ShiftDiagonal( G, shift );
 
         if( ctrl.progress && g.Rank() == 0 )
@@ -792,7 +792,7 @@ SpectralDivide
     {
         ++it;
         Real shift = SampleBall<Real>(-median.value,spread);
-        mpi::Broadcast( shift, 0, g.VCComm() );
+        mpi::Broadcast( shift, 0, g.VCComm(), SyncInfo<Device::CPU>() );
 
         Q = A;
         ShiftDiagonal( Q, shift );
@@ -863,13 +863,13 @@ SpectralDivide
         ++it;
         const Real angle = SampleUniform<Real>(0,2*Pi<Real>());
         F gamma = F(Cos(angle),Sin(angle));
-        mpi::Broadcast( gamma, 0, g.VCComm() );
+        mpi::Broadcast( gamma, 0, g.VCComm(), SyncInfo<Device::CPU>() );
         Q = A;
         Q *= gamma;
 
         const auto median = Median(GetRealPartOfDiagonal(Q));
         F shift = SampleBall<F>(-median.value,spread);
-        mpi::Broadcast( shift, 0, g.VCComm() );
+        mpi::Broadcast( shift, 0, g.VCComm(), SyncInfo<Device::CPU>() );
         ShiftDiagonal( Q, shift );
 
         if( ctrl.progress && g.Rank() == 0 )
@@ -1075,8 +1075,11 @@ inline bool SplitGrid
                  << ", so split " << p << " processes into "
                  << rLeft << " x " << pLeft/rLeft << " and "
                  << rRight << " x " << pRight/rRight << " grids" << endl;
-        leftGrid = new Grid( grid.VCComm(), leftGroup, rLeft );
-        rightGrid = new Grid( grid.VCComm(), rightGroup, rRight );
+        mpi::Comm leftComm, rightComm;
+        mpi::Dup( grid.VCComm(), leftComm );
+        mpi::Dup( grid.VCComm(), rightComm );
+        leftGrid = new Grid( std::move(leftComm), leftGroup, rLeft );
+        rightGrid = new Grid( std::move(rightComm), rightGroup, rRight );
         mpi::Free( leftGroup );
         mpi::Free( rightGroup );
         return true;
@@ -21,6 +21,7 @@
 #endif
 
 #include "./SecularEVD/TwoByTwo.hpp"
+#include "./SecularEVD/Batch.hpp"
 
 namespace El {
 
@@ -1272,8 +1273,6 @@ SecularEVD
         return info;
     }
 
-    // TODO(poulson): Batch secular equation solvers?
-    //
     // Compute all of the eigenvalues and the vector r ~= sqrt(rho) z which
     // would produce the given eigenvalues to high relative accuracy.
     //
@@ -1297,45 +1296,31 @@ SecularEVD
     //      prod_{k=0  }^{i-1} (lambda_k - d(i)) / (d(k) - d(i)) *
     //      prod_{k=i+1}^{n-1} (lambda_k - d(i)) / (d(k) - d(i)).
     //
-    // Given that we have available only one lambda_j at a time, we greedily
-    // update all r(i) products given each lambda_j
-    // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
+    // The eigenvalues are computed concurrently, with d - lambda_j
+    // temporarily stored in the j'th column of Q, and the r(i) products are
+    // then accumulated (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
     //
     Q.Resize( n, n );
     Matrix<Real> r;
     Ones( r, n, 1 );
-    for( Int j=0; j<n; ++j )
-    {
-        // While we will temporarily store dMinusShift in the j'th column of Q.
-        auto q = Q(ALL,IR(j));
-        auto valueInfo = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
-
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
-
-        r(j) *= q(j);
-        for( Int k=0; k<n; ++k )
-        {
-            if( k == j )
-                continue;
-            r(k) *= q(k) / (d(j)-d(k));
-        }
-    }
+    info = secular_evd::Batch( d, rho, z, 0, 1, w, Q, r, ctrl );
     for( Int j=0; j<n; ++j )
         r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
-    for( Int j=0; j<n; ++j )
+    secular_evd::ForEachBlock<Real>( n, [&]( Int jBeg, Int jEnd )
     {
-        // Compute the j'th eigenvectors via Eqs. (3.4) and (3.3), respectively.
-        auto q = Q(ALL,IR(j));
-        for( Int i=0; i<n; ++i )
+        for( Int j=jBeg; j<jEnd; ++j )
         {
-            q(i) = r(i) / q(i);
+            // Compute the j'th eigenvectors via Eqs. (3.4) and (3.3),
+            // respectively.
+            auto q = Q(ALL,IR(j));
+            for( Int i=0; i<n; ++i )
+            {
+                q(i) = r(i) / q(i);
+            }
+            q *= Real(1) / FrobeniusNorm( q );
         }
-        q *= Real(1) / FrobeniusNorm( q );
-    }
+    });
 
     return info;
 }
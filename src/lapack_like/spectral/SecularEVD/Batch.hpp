@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SECULAR_EVD_BATCH_HPP
+#define EL_SECULAR_EVD_BATCH_HPP
+
+namespace El {
+namespace secular_evd {
+
+// The number of roots (or eigenvectors) handled by each OpenMP task
+const Int batchBlocksize = 16;
+
+// Call body(jBeg,jEnd) for consecutive blocks of [0,n). With EL_HYBRID, the
+// blocks are executed as OpenMP tasks, and a parallel region is opened unless
+// one is already active (e.g., within the divide and conquer recursion).
+// Arithmetic on the MPFR-backed types allocates, so they remain sequential.
+template<typename Real,typename Body>
+void ForEachBlock( Int n, Body body )
+{
+#ifdef EL_HYBRID
+    if( IsPacked<Real>::value && n > batchBlocksize &&
+        omp_get_max_threads() > 1 )
+    {
+        auto spawn = [&]()
+        {
+            for( Int jBeg=0; jBeg<n; jBeg+=batchBlocksize )
+            {
+                const Int jEnd = Min( jBeg+batchBlocksize, n );
+                #pragma omp task default(shared) firstprivate(jBeg,jEnd)
+                body( jBeg, jEnd );
+            }
+            #pragma omp taskwait
+        };
+        if( omp_in_parallel() )
+        {
+            spawn();
+        }
+        else
+        {
+            #pragma omp parallel
+            #pragma omp single
+            spawn();
+        }
+        return;
+    }
+#endif
+    body( 0, n );
+}
+
+// Solve for the eigenvalues with indices shift+jLoc*stride of the secular
+// equation, for 0 <= jLoc < dMinusShifts.Width(), storing each in values(jLoc)
+// and d - lambda_j in the jLoc'th column of dMinusShifts. The contributions
+// of these eigenvalues to the products which yield the corrected update
+// vector (see SecularEVD) are then multiplied into r.
+//
+// Since the roots are independent, they are solved for concurrently; the
+// products are afterwards accumulated row by row in the same order as a
+// sequential loop over the roots would, so that the results do not depend
+// upon the number of threads.
+template<typename Real>
+SecularEVDInfo
+Batch
+( const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+  Int shift,
+  Int stride,
+        Matrix<Real>& values,
+        Matrix<Real>& dMinusShifts,
+        Matrix<Real>& r,
+  const SecularEVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Int numLocal = dMinusShifts.Width();
+
+    vector<SecularEVDInfo> valueInfos( numLocal );
+    ForEachBlock<Real>( numLocal, [&]( Int jBeg, Int jEnd )
+    {
+        for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+        {
+            auto minusShift = dMinusShifts( ALL, IR(jLoc) );
+            valueInfos[jLoc] =
+              SecularEigenvalue
+              ( shift+jLoc*stride, d, rho, z, values(jLoc), minusShift,
+                ctrl );
+        }
+    });
+
+    ForEachBlock<Real>( n, [&]( Int kBeg, Int kEnd )
+    {
+        for( Int k=kBeg; k<kEnd; ++k )
+        {
+            Real rk = r(k);
+            for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+            {
+                const Int j = shift + jLoc*stride;
+                if( k == j )
+                    rk *= dMinusShifts(k,jLoc);
+                else
+                    rk *= dMinusShifts(k,jLoc) / (d(j)-d(k));
+            }
+            r(k) = rk;
+        }
+    });
+
+    SecularEVDInfo info;
+    for( const auto& valueInfo : valueInfos )
+    {
+        info.numIterations += valueInfo.numIterations;
+        info.numAlternations += valueInfo.numAlternations;
+        info.numCubicIterations += valueInfo.numCubicIterations;
+        info.numCubicFailures += valueInfo.numCubicFailures;
+    }
+    return info;
+}
+
+} // namespace secular_evd
+} // namespace El
+
+#endif // ifndef EL_SECULAR_EVD_BATCH_HPP
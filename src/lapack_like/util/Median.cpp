@@ -10,6 +10,10 @@
 
 namespace El {
 
+// The median is the entry of rank floor(n/2), with ties broken by the
+// original indices; the selection requires O(n) work (or O(n/p) local work
+// per process for distributed vectors) rather than a sort
+
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
 ValueInt<Real> Median( const Matrix<Real>& x )
@@ -19,20 +23,8 @@ ValueInt<Real> Median( const Matrix<Real>& x )
     const Int n = x.Width();
     if( m != 1 && n != 1 )
         LogicError("Median is meant for a single vector");
-
     const Int k = ( n==1 ? m : n );
-    const Int stride = ( n==1 ? 1 : x.LDim() );
-    const Real* xBuffer = x.LockedBuffer();
-
-    vector<ValueInt<Real>> pairs( k );
-    for( Int i=0; i<k; ++i )
-    {
-        pairs[i].value = xBuffer[i*stride];
-        pairs[i].index = i;
-    }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-
-    return pairs[k/2];
+    return NthElement( x, k/2 );
 }
 
 template<typename Real,
@@ -40,15 +32,12 @@ template<typename Real,
 ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
 {
     EL_DEBUG_CSE
-    if( x.ColDist() == STAR && x.RowDist() == STAR )
-    {
-        return Median( x.LockedMatrix() );
-    }
-    else
-    {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return Median( x_STAR_STAR.LockedMatrix() );
-    }
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    const Int k = ( n==1 ? m : n );
+    return NthElement( x, k/2 );
 }
 
 #define PROTO(Real) \
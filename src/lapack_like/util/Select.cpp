@@ -0,0 +1,345 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <algorithm>
+
+namespace El {
+
+namespace select {
+
+// Below this many remaining candidates, the distributed selection gathers
+// the candidates onto every process and finishes sequentially
+const Int minDistSize = 1024;
+
+// A strict total order on (value,index) pairs, so that every rank is held by
+// exactly one entry even in the presence of ties
+template<typename Real>
+bool LessPair( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value < b.value || (a.value == b.value && a.index < b.index); }
+
+// A request for the entry of rank 'rank' (relative to the current set of
+// candidates), which is to be stored in results[slot]
+struct RankRequest
+{
+    Int rank;
+    Int slot;
+};
+
+// Sequential multi-selection via nested calls to std::nth_element: the
+// middle request splits the array and the remaining requests are satisfied
+// on either side of it. The requests must be sorted by rank.
+template<typename Real>
+void LocalMultiSelect
+( ValueInt<Real>* begin, ValueInt<Real>* end,
+  const RankRequest* requestsBeg, const RankRequest* requestsEnd,
+  vector<ValueInt<Real>>& results )
+{
+    if( requestsBeg == requestsEnd )
+        return;
+    const RankRequest* middle = requestsBeg + (requestsEnd-requestsBeg)/2;
+    ValueInt<Real>* nth = begin + middle->rank;
+    std::nth_element( begin, nth, end, LessPair<Real> );
+    results[middle->slot] = *nth;
+
+    LocalMultiSelect( begin, nth, requestsBeg, middle, results );
+    vector<RankRequest> rightRequests( middle+1, requestsEnd );
+    const Int offset = middle->rank + 1;
+    for( auto& request : rightRequests )
+        request.rank -= offset;
+    LocalMultiSelect
+    ( nth+1, end,
+      rightRequests.data(), rightRequests.data()+rightRequests.size(),
+      results );
+}
+
+// Distributed multi-selection over the candidates [begin,end) held by each
+// process, where the requested ranks refer to the union of the candidates.
+// Each round chooses the weighted median of the local medians (weighted by
+// the local candidate counts) as a pivot, which requires an AllGather of a
+// single pair and count per process, and then counts the candidates below
+// the pivot with an AllReduce. At least a quarter of the candidates lie on
+// either side of the pivot, so each round discards at least a quarter of
+// the candidates with O(n/p) local work; once few candidates remain, they
+// are gathered and the selection is finished sequentially.
+template<typename Real>
+void DistMultiSelect
+( ValueInt<Real>* begin, ValueInt<Real>* end,
+  const vector<RankRequest>& requests,
+  vector<ValueInt<Real>>& results,
+  mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    if( requests.empty() )
+        return;
+    SyncInfo<Device::CPU> syncInfo;
+    const int commSize = mpi::Size( comm );
+    const Int localSize = end - begin;
+    const Int totalSize = mpi::AllReduce( localSize, comm, syncInfo );
+
+    if( totalSize <= Max(minDistSize,Int(4*commSize)) )
+    {
+        const int localSizeInt = localSize;
+        vector<int> sizes( commSize ), offsets;
+        mpi::AllGather( &localSizeInt, 1, sizes.data(), 1, comm, syncInfo );
+        Scan( sizes, offsets );
+        vector<ValueInt<Real>> candidates( totalSize );
+        mpi::AllGather
+        ( begin, localSizeInt,
+          candidates.data(), sizes.data(), offsets.data(), comm, syncInfo );
+        LocalMultiSelect
+        ( candidates.data(), candidates.data()+totalSize,
+          requests.data(), requests.data()+requests.size(), results );
+        return;
+    }
+
+    // Gather the local medians and their weights
+    ValueInt<Real> localMedian;
+    localMedian.value = 0;
+    localMedian.index = -1;
+    if( localSize > 0 )
+    {
+        ValueInt<Real>* nth = begin + localSize/2;
+        std::nth_element( begin, nth, end, LessPair<Real> );
+        localMedian = *nth;
+    }
+    vector<ValueInt<Real>> medians( commSize );
+    vector<Int> weights( commSize );
+    mpi::AllGather( &localMedian, 1, medians.data(), 1, comm, syncInfo );
+    mpi::AllGather( &localSize, 1, weights.data(), 1, comm, syncInfo );
+
+    // Every process computes the same weighted median of the medians
+    vector<Int> order;
+    for( int q=0; q<commSize; ++q )
+        if( weights[q] > 0 )
+            order.push_back( q );
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( const Int& a, const Int& b )
+      { return LessPair( medians[a], medians[b] ); } );
+    ValueInt<Real> pivot = medians[order.back()];
+    Int cumulativeWeight = 0;
+    for( const Int& q : order )
+    {
+        cumulativeWeight += weights[q];
+        if( 2*cumulativeWeight >= totalSize )
+        {
+            pivot = medians[q];
+            break;
+        }
+    }
+
+    // Partition into the candidates below the pivot, the pivot itself (which
+    // is held by exactly one process), and those above it
+    ValueInt<Real>* lessEnd =
+      std::partition
+      ( begin, end,
+        [&]( const ValueInt<Real>& a ) { return LessPair( a, pivot ); } );
+    ValueInt<Real>* greaterBeg =
+      std::partition
+      ( lessEnd, end,
+        [&]( const ValueInt<Real>& a ) { return !LessPair( pivot, a ); } );
+    const Int numLess =
+      mpi::AllReduce( Int(lessEnd-begin), comm, syncInfo );
+
+    vector<RankRequest> lessRequests, greaterRequests;
+    for( const auto& request : requests )
+    {
+        if( request.rank < numLess )
+            lessRequests.push_back( request );
+        else if( request.rank == numLess )
+            results[request.slot] = pivot;
+        else
+        {
+            RankRequest shifted = request;
+            shifted.rank -= numLess + 1;
+            greaterRequests.push_back( shifted );
+        }
+    }
+    DistMultiSelect( begin, lessEnd, lessRequests, results, comm );
+    DistMultiSelect( greaterBeg, end, greaterRequests, results, comm );
+}
+
+// Convert the quantiles into sorted rank requests for a vector of length n
+inline vector<RankRequest>
+QuantileRequests( const vector<double>& quantiles, Int n )
+{
+    EL_DEBUG_CSE
+    if( n == 0 )
+        LogicError("Cannot select from an empty vector");
+    const Int numQuantiles = quantiles.size();
+    vector<RankRequest> requests( numQuantiles );
+    for( Int j=0; j<numQuantiles; ++j )
+    {
+        const double q = quantiles[j];
+        if( q < 0. || q > 1. )
+            LogicError("Quantiles must lie in [0,1]");
+        requests[j].rank = Min( Int(q*n), n-1 );
+        requests[j].slot = j;
+    }
+    std::sort
+    ( requests.begin(), requests.end(),
+      []( const RankRequest& a, const RankRequest& b )
+      { return a.rank < b.rank; } );
+    return requests;
+}
+
+template<typename Real>
+vector<ValueInt<Real>> LocalPairs( const Matrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Selection is meant for a single vector");
+
+    const Int k = ( n==1 ? m : n );
+    const Int stride = ( n==1 ? 1 : x.LDim() );
+    const Real* xBuffer = x.LockedBuffer();
+    vector<ValueInt<Real>> pairs( k );
+    for( Int i=0; i<k; ++i )
+    {
+        pairs[i].value = xBuffer[i*stride];
+        pairs[i].index = i;
+    }
+    return pairs;
+}
+
+// Spread the vector over every process without replication and return the
+// local (value,index) pairs
+template<typename Real>
+vector<ValueInt<Real>> DistPairs( const AbstractDistMatrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    if( x.Height() != 1 && x.Width() != 1 )
+        LogicError("Selection is meant for a single vector");
+
+    vector<ValueInt<Real>> pairs;
+    if( x.Width() == 1 )
+    {
+        DistMatrix<Real,VC,STAR> x_VC_STAR( x );
+        const Int localHeight = x_VC_STAR.LocalHeight();
+        pairs.resize( localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            pairs[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+            pairs[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+        }
+    }
+    else
+    {
+        DistMatrix<Real,STAR,VC> x_STAR_VC( x );
+        const Int localWidth = x_STAR_VC.LocalWidth();
+        pairs.resize( localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            pairs[jLoc].value = x_STAR_VC.GetLocal(0,jLoc);
+            pairs[jLoc].index = x_STAR_VC.GlobalCol(jLoc);
+        }
+    }
+    return pairs;
+}
+
+} // namespace select
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+vector<ValueInt<Real>>
+QuantileSelect( const Matrix<Real>& x, const vector<double>& quantiles )
+{
+    EL_DEBUG_CSE
+    auto pairs = select::LocalPairs( x );
+    const Int n = pairs.size();
+    auto requests = select::QuantileRequests( quantiles, n );
+    vector<ValueInt<Real>> results( quantiles.size() );
+    select::LocalMultiSelect
+    ( pairs.data(), pairs.data()+n,
+      requests.data(), requests.data()+requests.size(), results );
+    return results;
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+vector<ValueInt<Real>>
+QuantileSelect
+( const AbstractDistMatrix<Real>& x, const vector<double>& quantiles )
+{
+    EL_DEBUG_CSE
+    if( x.ColDist() == STAR && x.RowDist() == STAR )
+        return QuantileSelect
+        ( static_cast<Matrix<Real,Device::CPU> const&>(x.LockedMatrix()),
+          quantiles );
+
+    const Int n = ( x.Width()==1 ? x.Height() : x.Width() );
+    auto requests = select::QuantileRequests( quantiles, n );
+    auto pairs = select::DistPairs( x );
+    vector<ValueInt<Real>> results( quantiles.size() );
+    select::DistMultiSelect
+    ( pairs.data(), pairs.data()+pairs.size(), requests, results,
+      x.Grid().VCComm() );
+    return results;
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> NthElement( const Matrix<Real>& x, Int rank )
+{
+    EL_DEBUG_CSE
+    auto pairs = select::LocalPairs( x );
+    const Int n = pairs.size();
+    if( rank < 0 || rank >= n )
+        LogicError("Invalid rank ",rank," for a vector of length ",n);
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+rank, pairs.end(),
+      select::LessPair<Real> );
+    return pairs[rank];
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> NthElement( const AbstractDistMatrix<Real>& x, Int rank )
+{
+    EL_DEBUG_CSE
+    if( x.ColDist() == STAR && x.RowDist() == STAR )
+        return NthElement
+        ( static_cast<Matrix<Real,Device::CPU> const&>(x.LockedMatrix()),
+          rank );
+
+    const Int n = ( x.Width()==1 ? x.Height() : x.Width() );
+    if( rank < 0 || rank >= n )
+        LogicError("Invalid rank ",rank," for a vector of length ",n);
+    vector<select::RankRequest> requests( 1 );
+    requests[0].rank = rank;
+    requests[0].slot = 0;
+    auto pairs = select::DistPairs( x );
+    vector<ValueInt<Real>> results( 1 );
+    select::DistMultiSelect
+    ( pairs.data(), pairs.data()+pairs.size(), requests, results,
+      x.Grid().VCComm() );
+    return results[0];
+}
+
+#define PROTO(Real) \
+  template ValueInt<Real> NthElement( const Matrix<Real>& x, Int rank ); \
+  template ValueInt<Real> NthElement \
+  ( const AbstractDistMatrix<Real>& x, Int rank ); \
+  template vector<ValueInt<Real>> QuantileSelect \
+  ( const Matrix<Real>& x, const vector<double>& quantiles ); \
+  template vector<ValueInt<Real>> QuantileSelect \
+  ( const AbstractDistMatrix<Real>& x, const vector<double>& quantiles );
+
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
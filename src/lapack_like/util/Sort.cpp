@@ -12,6 +12,175 @@
 
 namespace El {
 
+namespace sorting {
+
+// Vectors with fewer entries are sorted by a single thread
+const Int minParallelSortSize = 16384;
+
+template<typename T,class Compare>
+void SequentialSort( T* begin, T* end, Compare comp, bool stable )
+{
+    if( stable )
+        std::stable_sort( begin, end, comp );
+    else
+        std::sort( begin, end, comp );
+}
+
+// Merge the consecutive sorted runs [offsets[k],offsets[k+1]) of the array
+// in pairs until a single sorted run remains. Since std::inplace_merge is
+// stable, so is the result whenever the runs are in their original order.
+template<typename Real,typename T,class Compare>
+void MergeRuns( T* begin, vector<Int> offsets, Compare comp )
+{
+    EL_DEBUG_CSE
+    while( offsets.size() > 2 )
+    {
+        const Int numRuns = offsets.size()-1;
+        const Int numPairs = numRuns/2;
+#ifdef EL_HYBRID
+        const bool parallel = IsPacked<Real>::value && !omp_in_parallel();
+        #pragma omp parallel for if(parallel)
+#endif
+        for( Int k=0; k<numPairs; ++k )
+            std::inplace_merge
+            ( begin+offsets[2*k], begin+offsets[2*k+1], begin+offsets[2*k+2],
+              comp );
+
+        vector<Int> newOffsets;
+        newOffsets.reserve( numPairs+2 );
+        for( Int k=0; k<=numPairs; ++k )
+            newOffsets.push_back( offsets[2*k] );
+        if( numRuns % 2 == 1 )
+            newOffsets.push_back( offsets[numRuns] );
+        offsets.swap( newOffsets );
+    }
+}
+
+// With EL_HYBRID, large arrays are split into one contiguous chunk per
+// thread, the chunks are sorted concurrently, and the sorted runs are then
+// merged pairwise. The MPFR-backed types remain sequential since their
+// arithmetic allocates.
+template<typename Real,typename T,class Compare>
+void LocalSort( T* begin, T* end, Compare comp, bool stable )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const Int n = end - begin;
+    const Int numThreads = omp_get_max_threads();
+    if( IsPacked<Real>::value && numThreads > 1 && !omp_in_parallel() &&
+        n >= minParallelSortSize )
+    {
+        vector<Int> offsets( numThreads+1 );
+        for( Int t=0; t<=numThreads; ++t )
+            offsets[t] = (t*n)/numThreads;
+        #pragma omp parallel for
+        for( Int t=0; t<numThreads; ++t )
+            SequentialSort
+            ( begin+offsets[t], begin+offsets[t+1], comp, stable );
+        MergeRuns<Real>( begin, offsets, comp );
+        return;
+    }
+#endif
+    SequentialSort( begin, end, comp, stable );
+}
+
+// A strict total order on (value,index) pairs: the values are ordered as
+// requested and ties are broken by the (unique) original indices, so that
+// any sorting algorithm yields the result of a stable sort and equal values
+// can still be split between processes
+template<typename Real>
+bool AscendingPair( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value < b.value || (a.value == b.value && a.index < b.index); }
+
+template<typename Real>
+bool DescendingPair( const ValueInt<Real>& a, const ValueInt<Real>& b )
+{ return a.value > b.value || (a.value == b.value && a.index < b.index); }
+
+// Sample sort (with regular sampling) of the (value,index) pairs distributed
+// over the communicator. On exit, the returned pairs are this process's
+// portion of the globally sorted sequence, and the portions are ordered by
+// rank. Each process sorts its local pairs, contributes commSize-1 evenly
+// spaced samples, and every process chooses the same commSize-1 splitters
+// from the sorted samples. A single AllToAll then delivers each process its
+// bucket as commSize sorted runs, which are merged. No process ever holds
+// more than a small multiple of its share of the entries.
+template<typename Real,class Compare>
+vector<ValueInt<Real>>
+SampleSort
+( vector<ValueInt<Real>>& pairs, Compare comp, mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    typedef ValueInt<Real> PairType;
+    LocalSort<Real>( pairs.data(), pairs.data()+pairs.size(), comp, false );
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+        return pairs;
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Gather the regular samples from every process
+    const Int numLocal = pairs.size();
+    const int numSamples = Min( Int(commSize-1), numLocal );
+    vector<PairType> samples( numSamples );
+    for( int s=0; s<numSamples; ++s )
+        samples[s] = pairs[((s+1)*numLocal)/(numSamples+1)];
+    vector<int> sampleSizes( commSize ), sampleOffs;
+    mpi::AllGather( &numSamples, 1, sampleSizes.data(), 1, comm, syncInfo );
+    const int totalSamples = Scan( sampleSizes, sampleOffs );
+    if( totalSamples == 0 )
+        return pairs;
+    vector<PairType> allSamples( totalSamples );
+    mpi::AllGather
+    ( samples.data(), numSamples,
+      allSamples.data(), sampleSizes.data(), sampleOffs.data(),
+      comm, syncInfo );
+    std::sort( allSamples.begin(), allSamples.end(), comp );
+
+    // Process q receives the pairs between the (q-1)'th and q'th splitters
+    vector<int> sendSizes( commSize ), sendOffs;
+    Int offset = 0;
+    for( int q=0; q<commSize-1; ++q )
+    {
+        const PairType& splitter = allSamples[((q+1)*totalSamples)/commSize];
+        const Int bound =
+          std::lower_bound
+          ( pairs.begin()+offset, pairs.end(), splitter, comp ) -
+          pairs.begin();
+        sendSizes[q] = bound - offset;
+        offset = bound;
+    }
+    sendSizes[commSize-1] = numLocal - offset;
+    Scan( sendSizes, sendOffs );
+
+    vector<int> recvSizes( commSize ), recvOffs;
+    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm, syncInfo );
+    const int numRecv = Scan( recvSizes, recvOffs );
+    vector<PairType> bucket( numRecv );
+    mpi::AllToAll
+    ( pairs.data(), sendSizes.data(), sendOffs.data(),
+      bucket.data(), recvSizes.data(), recvOffs.data(), comm, syncInfo );
+    pairs.clear();
+    pairs.shrink_to_fit();
+
+    // Each of the received runs is already sorted
+    vector<Int> runOffsets( recvOffs.begin(), recvOffs.end() );
+    runOffsets.push_back( numRecv );
+    MergeRuns<Real>( bucket.data(), runOffsets, comp );
+    return bucket;
+}
+
+template<typename Real>
+vector<ValueInt<Real>>
+SampleSort
+( vector<ValueInt<Real>>& pairs, SortType sort, mpi::Comm const& comm )
+{
+    if( sort == ASCENDING )
+        return SampleSort( pairs, AscendingPair<Real>, comm );
+    else
+        return SampleSort( pairs, DescendingPair<Real>, comm );
+}
+
+} // namespace sorting
+
 // Sort each column of the real matrix X
 
 template<typename Real,
@@ -27,19 +196,11 @@ void Sort( Matrix<Real>& X, SortType sort, bool stable )
     {
         Real* XCol = X.Buffer(0,j);
         if( sort == ASCENDING )
-        {
-            if( stable )
-                std::stable_sort( XCol, XCol+m );
-            else
-                std::sort( XCol, XCol+m );
-        }
+            sorting::LocalSort<Real>
+            ( XCol, XCol+m, std::less<Real>(), stable );
         else
-        {
-            if( stable )
-                std::stable_sort( XCol, XCol+m, std::greater<Real>() );
-            else
-                std::sort( XCol, XCol+m, std::greater<Real>() );
-        }
+            sorting::LocalSort<Real>
+            ( XCol, XCol+m, std::greater<Real>(), stable );
     }
 }
 
@@ -55,19 +216,58 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
         (X.ColDist()==CIRC && X.RowDist()==CIRC) )
     {
         if( X.Participating() )
-            Sort( X.Matrix(), sort, stable );
+            Sort
+            ( static_cast<Matrix<Real,Device::CPU>&>(X.Matrix()),
+              sort, stable );
     }
     else
     {
-        // TODO(poulson): Distributed sort
-
-        // Get a copy on a single process, sort, and then redistribute
-        DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
-        if( X_CIRC_CIRC.Participating() )
-            Sort( X_CIRC_CIRC.Matrix(), sort, stable );
-
-        // Refill the distributed X with the sorted values
-        Copy( X_CIRC_CIRC, X );
+        // Spread the rows over every process and sample sort each column.
+        // Since ties are broken by the original row indices, the result is
+        // that of a stable sort regardless of 'stable'.
+        DistMatrix<Real,VC,STAR> X_VC_STAR( X );
+        if( X_VC_STAR.Participating() )
+        {
+            mpi::Comm const& comm = X_VC_STAR.ColComm();
+            const int commSize = mpi::Size( comm );
+            const Int n = X_VC_STAR.Width();
+            const Int localHeight = X_VC_STAR.LocalHeight();
+            Matrix<Real>& XLoc = X_VC_STAR.Matrix();
+            for( Int j=0; j<n; ++j )
+            {
+                vector<ValueInt<Real>> pairs( localHeight );
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                {
+                    pairs[iLoc].value = XLoc(iLoc,j);
+                    pairs[iLoc].index = X_VC_STAR.GlobalRow(iLoc);
+                }
+                auto bucket = sorting::SampleSort( pairs, sort, comm );
+
+                // The k'th entry of the bucket has the global rank
+                // offset+k and is sent to the owner of that row
+                const Int bucketSize = bucket.size();
+                const Int offset = mpi::Scan( bucketSize, comm ) - bucketSize;
+                vector<int> sendSizes( commSize, 0 ), sendOffs;
+                for( Int k=0; k<bucketSize; ++k )
+                    ++sendSizes[X_VC_STAR.RowOwner(offset+k)];
+                Scan( sendSizes, sendOffs );
+                vector<ValueInt<Real>> sendBuf( bucketSize );
+                auto offs = sendOffs;
+                for( Int k=0; k<bucketSize; ++k )
+                {
+                    const int owner = X_VC_STAR.RowOwner(offset+k);
+                    sendBuf[offs[owner]].value = bucket[k].value;
+                    sendBuf[offs[owner]].index = offset+k;
+                    ++offs[owner];
+                }
+                bucket.clear();
+                auto recvBuf =
+                  mpi::AllToAll( sendBuf, sendSizes, sendOffs, comm );
+                for( const auto& entry : recvBuf )
+                    XLoc(X_VC_STAR.LocalRow(entry.index),j) = entry.value;
+            }
+        }
+        Copy( X_VC_STAR, X );
     }
 }
 
@@ -96,21 +296,11 @@ TaggedSort( const Matrix<Real>& x, SortType sort, bool stable )
     }
 
     if( sort == ASCENDING )
-    {
-        if( stable )
-            std::stable_sort
-            ( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-        else
-            std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
-    }
+        sorting::LocalSort<Real>
+        ( pairs.data(), pairs.data()+k, ValueInt<Real>::Lesser, stable );
     else if( sort == DESCENDING )
-    {
-        if( stable )
-            std::stable_sort
-            ( pairs.begin(), pairs.end(), ValueInt<Real>::Greater );
-        else
-            std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Greater );
-    }
+        sorting::LocalSort<Real>
+        ( pairs.data(), pairs.data()+k, ValueInt<Real>::Greater, stable );
 
     return pairs;
 }
@@ -123,13 +313,63 @@ TaggedSort( const AbstractDistMatrix<Real>& x, SortType sort, bool stable )
     EL_DEBUG_CSE
     if( x.ColDist()==STAR && x.RowDist()==STAR )
     {
-        return TaggedSort( x.LockedMatrix(), sort, stable );
+        return TaggedSort
+        ( static_cast<Matrix<Real,Device::CPU> const&>(x.LockedMatrix()),
+          sort, stable );
     }
-    else
+    else if( sort == UNSORTED )
     {
         DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
         return TaggedSort( x_STAR_STAR.LockedMatrix(), sort, stable );
     }
+    else
+    {
+        if( x.Height() != 1 && x.Width() != 1 )
+            LogicError("TaggedSort is meant for a single vector");
+
+        // Sample sort the entries of the vector spread over every process
+        // (ties are broken by the original index, which is stable), and
+        // then gather the sorted portions
+        mpi::Comm const& comm = x.Grid().VCComm();
+        vector<ValueInt<Real>> pairs;
+        if( x.Width() == 1 )
+        {
+            DistMatrix<Real,VC,STAR> x_VC_STAR( x );
+            const Int localHeight = x_VC_STAR.LocalHeight();
+            pairs.resize( localHeight );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                pairs[iLoc].value = x_VC_STAR.GetLocal(iLoc,0);
+                pairs[iLoc].index = x_VC_STAR.GlobalRow(iLoc);
+            }
+        }
+        else
+        {
+            DistMatrix<Real,STAR,VC> x_STAR_VC( x );
+            const Int localWidth = x_STAR_VC.LocalWidth();
+            pairs.resize( localWidth );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            {
+                pairs[jLoc].value = x_STAR_VC.GetLocal(0,jLoc);
+                pairs[jLoc].index = x_STAR_VC.GlobalCol(jLoc);
+            }
+        }
+        auto bucket = sorting::SampleSort( pairs, sort, comm );
+
+        const int commSize = mpi::Size( comm );
+        const int bucketSize = bucket.size();
+        vector<int> bucketSizes( commSize ), bucketOffs;
+        mpi::AllGather
+        ( &bucketSize, 1, bucketSizes.data(), 1, comm,
+          SyncInfo<Device::CPU>() );
+        const int totalSize = Scan( bucketSizes, bucketOffs );
+        vector<ValueInt<Real>> sortedPairs( totalSize );
+        mpi::AllGather
+        ( bucket.data(), bucketSize,
+          sortedPairs.data(), bucketSizes.data(), bucketOffs.data(), comm,
+          SyncInfo<Device::CPU>() );
+        return sortedPairs;
+    }
 }
 
 template<typename Real,typename Field>
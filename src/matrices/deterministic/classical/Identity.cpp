@@ -44,12 +44,42 @@ void Identity( AbstractDistMatrix<T>& I, Int m, Int n )
     MakeIdentity( I );
 }
 
+template<typename T>
+void Identity( SparseMatrix<T>& I, Int m, Int n )
+{
+    EL_DEBUG_CSE
+    Zeros( I, m, n );
+    const Int minDim = Min( m, n );
+    I.Reserve( minDim );
+    for( Int j=0; j<minDim; ++j )
+        I.QueueUpdate( j, j, T(1) );
+    I.ProcessQueues();
+}
+
+template<typename T>
+void Identity( DistSparseMatrix<T>& I, Int m, Int n )
+{
+    EL_DEBUG_CSE
+    Zeros( I, m, n );
+    const Int localHeight = I.LocalHeight();
+    const Int firstLocalRow = I.FirstLocalRow();
+    I.Reserve( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        if( i < n )
+            I.QueueLocalUpdate( iLoc, i, T(1) );
+    }
+    I.ProcessLocalQueues();
+}
 
 #define PROTO(T) \
   template void MakeIdentity( Matrix<T>& I ); \
   template void MakeIdentity( AbstractDistMatrix<T>& I ); \
   template void Identity( Matrix<T>& I, Int m, Int n ); \
-  template void Identity( AbstractDistMatrix<T>& I, Int m, Int n );
+  template void Identity( AbstractDistMatrix<T>& I, Int m, Int n ); \
+  template void Identity( SparseMatrix<T>& I, Int m, Int n ); \
+  template void Identity( DistSparseMatrix<T>& I, Int m, Int n );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
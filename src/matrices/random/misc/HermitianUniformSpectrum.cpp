@@ -60,7 +60,7 @@ void HermitianUniformSpectrum
     if( grid.Rank() == 0 )
         for( Int j=0; j<n; ++j )
             d[j] = SampleUniform<Real>( lower, upper );
-    mpi::Broadcast( d.data(), n, 0, grid.Comm() );
+    mpi::Broadcast( d.data(), n, 0, grid.Comm(), SyncInfo<Device::CPU>() );
     Diagonal( A, d );
 
     // Apply a Haar matrix from both sides
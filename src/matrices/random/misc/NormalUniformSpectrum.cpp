@@ -57,7 +57,7 @@ void NormalUniformSpectrum
     if( grid.Rank() == 0 )
         for( Int j=0; j<n; ++j )
             d[j] = SampleBall<C>( center, radius );
-    mpi::Broadcast( d.data(), n, 0, grid.Comm() );
+    mpi::Broadcast( d.data(), n, 0, grid.Comm(), SyncInfo<Device::CPU>() );
     Diagonal( A, d );
 
     // Apply a Haar matrix from both sides
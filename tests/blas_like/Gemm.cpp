@@ -80,12 +80,14 @@ void TestGemm
  T alpha, T beta,
  const Grid& g,
  bool print, bool correctness,
+ Int strassenCutoff,
  Int colAlignA=0, Int rowAlignA=0,
  Int colAlignB=0, Int rowAlignB=0,
  Int colAlignC=0, Int rowAlignC=0)
 {
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
     PushIndent();
+    SetStrassenCutoff<T>(strassenCutoff);
 
     double runTime, realGFlops, gFlops;
     DistMatrix<T,MC,MR,ELEMENT,D> A(g), B(g), COrig(g), C(g);
@@ -223,6 +225,30 @@ void TestGemm
                 (orientA, orientB, alpha, A, B, beta, COrig, C, print);
         PopIndent();
     }
+
+    if (D == Device::CPU)
+    {
+        // Test the Strassen-Winograd variant
+        OutputFromRoot(g.Comm(),"Strassen Algorithm:");
+        PushIndent();
+        C = COrig;
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_STRASSEN);
+        mpi::Barrier(g.Comm());
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot
+            (g.Comm(),"Finished in ",runTime," seconds (",gFlops,
+             " classical GFlop/s)");
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+    }
     PopIndent();
 #ifdef HYDROGEN_HAVE_CUDA
     cudaEventDestroy(start);
@@ -230,6 +256,73 @@ void TestGemm
 #endif
 }
 
+// The generic (i.e., non-BLAS) blas::Gemm recursively splits its operands,
+// so compare it against a triple loop in exact integer arithmetic using
+// dimensions which straddle several recursion leaves
+void TestGenericGemm(Int m, Int n, Int k)
+{
+    Output("Testing generic recursive Gemm with Int");
+    PushIndent();
+    const Int alpha = 3, beta = -2;
+    for (const char transA : {'N','T'})
+    {
+        for (const char transB : {'N','T'})
+        {
+            Matrix<Int> A, B, C;
+            if (transA == 'N')
+                A.Resize(m, k);
+            else
+                A.Resize(k, m);
+            if (transB == 'N')
+                B.Resize(k, n);
+            else
+                B.Resize(n, k);
+            C.Resize(m, n);
+            for (Int j=0; j<A.Width(); ++j)
+                for (Int i=0; i<A.Height(); ++i)
+                    A(i,j) = (7*i+3*j) % 11 - 5;
+            for (Int j=0; j<B.Width(); ++j)
+                for (Int i=0; i<B.Height(); ++i)
+                    B(i,j) = (5*i+2*j) % 13 - 6;
+            for (Int j=0; j<n; ++j)
+                for (Int i=0; i<m; ++i)
+                    C(i,j) = (i+j) % 7 - 3;
+
+            Matrix<Int> CRef(m, n);
+            for (Int j=0; j<n; ++j)
+            {
+                for (Int i=0; i<m; ++i)
+                {
+                    Int sum = 0;
+                    for (Int l=0; l<k; ++l)
+                    {
+                        const Int alpha_il =
+                            (transA == 'N' ? A(i,l) : A(l,i));
+                        const Int beta_lj =
+                            (transB == 'N' ? B(l,j) : B(j,l));
+                        sum += alpha_il*beta_lj;
+                    }
+                    CRef(i,j) = alpha*sum + beta*C(i,j);
+                }
+            }
+
+            blas::Gemm
+                (transA, transB, m, n, k,
+                 alpha, A.LockedBuffer(), A.LDim(),
+                 B.LockedBuffer(), B.LDim(),
+                 beta, C.Buffer(), C.LDim());
+            for (Int j=0; j<n; ++j)
+                for (Int i=0; i<m; ++i)
+                    if (C(i,j) != CRef(i,j))
+                        LogicError
+                            ("Generic Gemm",transA,transB," differed at (",
+                             i,",",j,"): ",C(i,j)," vs. ",CRef(i,j));
+            Output(transA,transB,": passed");
+        }
+    }
+    PopIndent();
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -246,6 +339,8 @@ main(int argc, char* argv[])
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int strassenCutoff =
+            Input("--strassenCutoff","Strassen recursion cutoff",32);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -271,6 +366,9 @@ main(int argc, char* argv[])
         ComplainIfDebug();
         OutputFromRoot(g.Comm(),"Will test Gemm",transA,transB);
 
+        if (testCPU && g.Rank() == 0)
+            TestGenericGemm(m+50, n+30, k+40);
+
 #ifdef HYDROGEN_HAVE_CUDA
         if (testGPU)
         {
@@ -280,6 +378,7 @@ main(int argc, char* argv[])
                  float(3), float(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -289,6 +388,7 @@ main(int argc, char* argv[])
                  double(3), double(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -304,6 +404,7 @@ main(int argc, char* argv[])
                  float(3), float(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -313,6 +414,7 @@ main(int argc, char* argv[])
                  Complex<float>(3), Complex<float>(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -323,6 +425,7 @@ main(int argc, char* argv[])
                  double(3), double(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -332,6 +435,7 @@ main(int argc, char* argv[])
                  Complex<double>(3), Complex<double>(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -343,6 +447,7 @@ main(int argc, char* argv[])
                  DoubleDouble(3), DoubleDouble(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -352,6 +457,7 @@ main(int argc, char* argv[])
                  QuadDouble(3), QuadDouble(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -362,6 +468,7 @@ main(int argc, char* argv[])
                  Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -371,6 +478,7 @@ main(int argc, char* argv[])
                  Complex<QuadDouble>(3), Complex<QuadDouble>(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -383,6 +491,7 @@ main(int argc, char* argv[])
                  Quad(3), Quad(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -392,6 +501,7 @@ main(int argc, char* argv[])
                  Complex<Quad>(3), Complex<Quad>(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -404,6 +514,7 @@ main(int argc, char* argv[])
                  BigFloat(3), BigFloat(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -413,6 +524,7 @@ main(int argc, char* argv[])
                  Complex<BigFloat>(3), Complex<BigFloat>(4),
                  g,
                  print, correctness,
+                 strassenCutoff,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
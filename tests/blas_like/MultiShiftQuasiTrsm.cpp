@@ -139,10 +139,98 @@ void TestMultiShiftQuasiTrsm
       "|| H ||_F = ",HFrob,"\n",Indent(),
       "|| X ||_F = ",XFrob,"\n",Indent(),
       "|| E ||_F = ",EFrob);
+    const Real eps = limits::Epsilon<Real>();
+    const Real relError = EFrob / (eps*Max(m,n)*XFrob);
+    OutputFromRoot
+    (g.Comm(),"|| E ||_F / (eps Max(m,n) || X ||_F) = ",relError);
+    if( !(relError <= Real(10)) )
+        LogicError("Unacceptably large relative error");
 
     PopIndent();
 }
 
+void TestAllTypes
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  Int m,
+  Int n,
+  const Grid& g,
+  bool print )
+{
+    TestMultiShiftQuasiTrsm<float>
+    ( side, uplo, orientation,
+      m, n,
+      float(3),
+      g, print );
+    TestMultiShiftQuasiTrsm<Complex<float>>
+    ( side, uplo, orientation,
+      m, n,
+      Complex<float>(3),
+      g, print );
+
+    TestMultiShiftQuasiTrsm<double>
+    ( side, uplo, orientation,
+      m, n,
+      double(3),
+      g, print );
+    TestMultiShiftQuasiTrsm<Complex<double>>
+    ( side, uplo, orientation,
+      m, n,
+      Complex<double>(3),
+      g, print );
+
+#ifdef EL_HAVE_QD
+    TestMultiShiftQuasiTrsm<DoubleDouble>
+    ( side, uplo, orientation,
+      m, n,
+      DoubleDouble(3),
+      g, print );
+    TestMultiShiftQuasiTrsm<QuadDouble>
+    ( side, uplo, orientation,
+      m, n,
+      QuadDouble(3),
+      g, print );
+
+    TestMultiShiftQuasiTrsm<Complex<DoubleDouble>>
+    ( side, uplo, orientation,
+      m, n,
+      Complex<DoubleDouble>(3),
+      g, print );
+    TestMultiShiftQuasiTrsm<Complex<QuadDouble>>
+    ( side, uplo, orientation,
+      m, n,
+      Complex<QuadDouble>(3),
+      g, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+    TestMultiShiftQuasiTrsm<Quad>
+    ( side, uplo, orientation,
+      m, n,
+      Quad(3),
+      g, print );
+    TestMultiShiftQuasiTrsm<Complex<Quad>>
+    ( side, uplo, orientation,
+      m, n,
+      Complex<Quad>(3),
+      g, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+    TestMultiShiftQuasiTrsm<BigFloat>
+    ( side, uplo, orientation,
+      m, n,
+      BigFloat(3),
+      g, print );
+    TestMultiShiftQuasiTrsm<Complex<BigFloat>>
+    ( side, uplo, orientation,
+      m, n,
+      Complex<BigFloat>(3),
+      g, print );
+#endif
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -154,13 +242,9 @@ main( int argc, char* argv[] )
         int gridHeight = Input("--gridHeight","height of process grid",0);
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const char sideChar = Input("--side","side to solve from: L/R",'L');
-        const char uploChar = Input
-            ("--uplo","lower or upper quasi-triangular: L/U",'L');
-        const char transChar = Input
-            ("--trans","orientation of quasi-triangular matrix: N/T/C",'N');
         const Int m = Input("--m","height of result",100);
         const Int n = Input("--n","width of result",100);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -170,87 +254,25 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid g(std::move(comm), gridHeight, order );
         const LeftOrRight side = CharToLeftOrRight( sideChar );
-        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
-        const Orientation orientation = CharToOrientation( transChar );
         SetBlocksize( nb );
 
         ComplainIfDebug();
-        OutputFromRoot
-        (comm,"Testing MultiShiftQuasiTrsm ",sideChar,uploChar,transChar);
-
-        TestMultiShiftQuasiTrsm<float>
-        ( side, uplo, orientation,
-          m, n,
-          float(3),
-          g, print );
-        TestMultiShiftQuasiTrsm<Complex<float>>
-        ( side, uplo, orientation,
-          m, n,
-          Complex<float>(3),
-          g, print );
-
-        TestMultiShiftQuasiTrsm<double>
-        ( side, uplo, orientation,
-          m, n,
-          double(3),
-          g, print );
-        TestMultiShiftQuasiTrsm<Complex<double>>
-        ( side, uplo, orientation,
-          m, n,
-          Complex<double>(3),
-          g, print );
-
-#ifdef EL_HAVE_QD
-        TestMultiShiftQuasiTrsm<DoubleDouble>
-        ( side, uplo, orientation,
-          m, n,
-          DoubleDouble(3),
-          g, print );
-        TestMultiShiftQuasiTrsm<QuadDouble>
-        ( side, uplo, orientation,
-          m, n,
-          QuadDouble(3),
-          g, print );
-
-        TestMultiShiftQuasiTrsm<Complex<DoubleDouble>>
-        ( side, uplo, orientation,
-          m, n,
-          Complex<DoubleDouble>(3),
-          g, print );
-        TestMultiShiftQuasiTrsm<Complex<QuadDouble>>
-        ( side, uplo, orientation,
-          m, n,
-          Complex<QuadDouble>(3),
-          g, print );
-#endif
-
-#ifdef EL_HAVE_QUAD
-        TestMultiShiftQuasiTrsm<Quad>
-        ( side, uplo, orientation,
-          m, n,
-          Quad(3),
-          g, print );
-        TestMultiShiftQuasiTrsm<Complex<Quad>>
-        ( side, uplo, orientation,
-          m, n,
-          Complex<Quad>(3),
-          g, print );
-#endif
-
-#ifdef EL_HAVE_MPC
-        TestMultiShiftQuasiTrsm<BigFloat>
-        ( side, uplo, orientation,
-          m, n,
-          BigFloat(3),
-          g, print );
-        TestMultiShiftQuasiTrsm<Complex<BigFloat>>
-        ( side, uplo, orientation,
-          m, n,
-          Complex<BigFloat>(3),
-          g, print );
-#endif
+        const char uploChars[] = { 'L', 'U' };
+        const char transChars[] = { 'N', 'T', 'C' };
+        for( const char uploChar : uploChars )
+        {
+            for( const char transChar : transChars )
+            {
+                OutputFromRoot
+                (g.Comm(),
+                 "Testing MultiShiftQuasiTrsm ",sideChar,uploChar,transChar);
+                TestAllTypes
+                ( side, CharToUpperOrLower(uploChar),
+                  CharToOrientation(transChar), m, n, g, print );
+            }
+        }
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
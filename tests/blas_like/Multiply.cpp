@@ -10,6 +10,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <limits>
 #include <random>
 #include <stdexcept>
 
@@ -45,6 +46,179 @@ void TestMultiply(Int m, Int n=1)
         Output("Test passed");
 }
 
+// A small integer-valued entry (with a nonzero imaginary part in the complex
+// case) so that all of the products below are computed exactly
+template<typename T>
+T TestEntry( Int i, Int j )
+{
+    T value = T((i+2*j) % 5 + 1);
+    if( IsComplex<T>::value )
+        SetImagPart( value, Base<T>((3*i+j) % 4 - 2) );
+    return value;
+}
+
+// The nonzero pattern of the sparse test matrices
+bool InPattern( Int i, Int j )
+{ return i == j || (3*i+7*j) % 5 == 0; }
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& Y, const Matrix<T>& YRef, const string& label )
+{
+    for( Int j=0; j<Y.Width(); ++j )
+        for( Int i=0; i<Y.Height(); ++i )
+            if( !(Y(i,j) == YRef(i,j)) )
+                LogicError
+                (label,": Y(",i,",",j,")=",Y(i,j)," but the dense result is ",
+                 YRef(i,j));
+}
+
+// Compare each orientation of the sequential sparse Multiply against Gemm,
+// with both a zero beta applied to a Y full of NaN and a nonzero beta
+template<typename T>
+void TestSequentialMultiply( Int m, Int n, Int numRHS )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    Output("Testing sequential orientations with ",TypeName<T>());
+
+    // Queue every nonzero as the sum of two updates
+    SparseMatrix<T> A;
+    Matrix<T> ADense;
+    Zeros( A, m, n );
+    Zeros( ADense, m, n );
+    for( Int i=0; i<m; ++i )
+        for( Int j=0; j<n; ++j )
+            if( InPattern(i,j) )
+            {
+                const T value = TestEntry<T>(i,j);
+                A.QueueUpdate( i, j, value-T(1) );
+                A.QueueUpdate( i, j, T(1) );
+                ADense(i,j) = value;
+            }
+    A.ProcessQueues();
+
+    const T alpha = T(2);
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+    for( Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int XHeight = ( orientation==NORMAL ? n : m );
+        const Int YHeight = ( orientation==NORMAL ? m : n );
+        Matrix<T> X, Y, YRef;
+        Zeros( X, XHeight, numRHS );
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<XHeight; ++i )
+                X(i,j) = TestEntry<T>(j,i);
+
+        for( const T beta : {T(0),T(-1)} )
+        {
+            Zeros( Y, YHeight, numRHS );
+            Zeros( YRef, YHeight, numRHS );
+            for( Int j=0; j<numRHS; ++j )
+                for( Int i=0; i<YHeight; ++i )
+                {
+                    Y(i,j) = ( beta == T(0) ? T(nan) : TestEntry<T>(i,j) );
+                    YRef(i,j) = ( beta == T(0) ? T(0) : Y(i,j) );
+                }
+            Multiply( orientation, alpha, A, X, beta, Y );
+            Gemm( orientation, NORMAL, alpha, ADense, X, beta, YRef );
+            CheckEqual( Y, YRef, "Sparse Multiply" );
+        }
+    }
+}
+
+// Compare each orientation of the distributed sparse Multiply against a
+// redundant Gemm. Both the sparse matrix and the multivectors are built
+// from remote queued updates from every process, and each nonzero is split
+// into several duplicate updates which must be summed.
+template<typename T>
+void TestDistMultiply( const Grid& g, Int m, Int n, Int numRHS )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing distributed orientations with ",TypeName<T>());
+    const int commRank = g.Rank();
+    const int commSize = g.Size();
+
+    DistSparseMatrix<T> A(g);
+    Matrix<T> ADense;
+    Zeros( A, m, n );
+    Zeros( ADense, m, n );
+    Int numNonzeros = 0;
+    for( Int i=0; i<m; ++i )
+        for( Int j=0; j<n; ++j )
+            if( InPattern(i,j) )
+            {
+                const T value = TestEntry<T>(i,j);
+                A.QueueUpdate( i, j, T(1) );
+                if( (i+2*j) % commSize == commRank )
+                    A.QueueUpdate( i, j, value-T(commSize) );
+                ADense(i,j) = value;
+                ++numNonzeros;
+            }
+    A.ProcessQueues();
+
+    // The duplicates must have been merged into a single entry
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+        if( A.Value(e) != ADense(A.Row(e),A.Col(e)) )
+            LogicError
+            ("A(",A.Row(e),",",A.Col(e),")=",A.Value(e),
+             " after summing the queued updates rather than ",
+             ADense(A.Row(e),A.Col(e)));
+    const Int numEntries =
+      mpi::AllReduce( numLocalEntries, g.Comm(), SyncInfo<Device::CPU>() );
+    if( numEntries != numNonzeros )
+        LogicError("Duplicate updates were not merged");
+
+    const T alpha = T(2);
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+    for( Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int XHeight = ( orientation==NORMAL ? n : m );
+        const Int YHeight = ( orientation==NORMAL ? m : n );
+        DistMultiVec<T> X(g), Y(g);
+        Matrix<T> XDense, YRef;
+        Zeros( X, XHeight, numRHS );
+        Zeros( XDense, XHeight, numRHS );
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<XHeight; ++i )
+            {
+                XDense(i,j) = TestEntry<T>(j,i);
+                X.QueueUpdate( i, j, T(1) );
+                if( (i+j) % commSize == commRank )
+                    X.QueueUpdate( i, j, XDense(i,j)-T(commSize) );
+            }
+        X.ProcessQueues();
+        for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+            for( Int j=0; j<numRHS; ++j )
+                if( X.GetLocal(iLoc,j) != XDense(X.GlobalRow(iLoc),j) )
+                    LogicError("Queued DistMultiVec updates were not summed");
+
+        for( const T beta : {T(0),T(-1)} )
+        {
+            Zeros( Y, YHeight, numRHS );
+            Zeros( YRef, YHeight, numRHS );
+            for( Int j=0; j<numRHS; ++j )
+                for( Int i=0; i<YHeight; ++i )
+                    YRef(i,j) = ( beta == T(0) ? T(0) : TestEntry<T>(i,j) );
+            for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+                for( Int j=0; j<numRHS; ++j )
+                    Y.SetLocal
+                    ( iLoc, j,
+                      beta == T(0) ? T(nan) : YRef(Y.GlobalRow(iLoc),j) );
+            Multiply( orientation, alpha, A, X, beta, Y );
+            Gemm( orientation, NORMAL, alpha, ADense, XDense, beta, YRef );
+
+            auto YRefLoc = YRef( IR(Y.FirstLocalRow(),
+                                    Y.FirstLocalRow()+Y.LocalHeight()), ALL );
+            CheckEqual( Y.LockedMatrix(), Matrix<T>(YRefLoc),
+                        "Distributed sparse Multiply" );
+        }
+    }
+}
+
 void RunTests( Int m )
 {
     PushIndent();
@@ -72,8 +246,10 @@ void RunTests( Int m )
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
     try
     {
+        const Grid g( std::move(comm) );
         Int m = 1;
         for( Int e=1; e<4; ++e )
         {    
@@ -81,7 +257,19 @@ int main( int argc, char* argv[] )
             Output("Testing with matrix height of ",m);
             RunTests(m);
         }
+
+        PushIndent();
+        TestSequentialMultiply<float>( 37, 23, 3 );
+        TestSequentialMultiply<double>( 37, 23, 3 );
+        TestSequentialMultiply<Complex<double>>( 37, 23, 3 );
+        for( const Int height : {Int(37),Int(3)} )
+        {
+            TestDistMultiply<float>( g, height, 23, 3 );
+            TestDistMultiply<double>( g, height, 23, 3 );
+            TestDistMultiply<Complex<double>>( g, height, 23, 3 );
+        }
+        PopIndent();
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
     return 0;
 }
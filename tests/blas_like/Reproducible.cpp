@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstring>
+using namespace El;
+
+template<typename T>
+bool SameBits( const T& alpha, const T& beta )
+{ return std::memcmp( &alpha, &beta, sizeof(T) ) == 0; }
+
+// A deterministic entry with a random-looking sign and a magnitude between
+// 2^-20 and 2^21, so that the partial sums cancel and their rounding depends
+// upon the order of summation
+template<typename Real>
+Real HashedEntry( Int i, Int j, Int seed )
+{
+    const unsigned long long hash =
+      (unsigned long long)(7919*i + 104729*j + 15485863*seed) * 2654435761ULL;
+    const Real fraction = Real((hash>>8) % 1000) / 1000;
+    const Real magnitude =
+      (1 + fraction) * std::ldexp( Real(1), int(hash%41)-20 );
+    return ( (hash>>20) & 1 ) ? -magnitude : magnitude;
+}
+
+template<typename Real>
+void MakeEntry( Int i, Int j, Int seed, Real& alpha )
+{ alpha = HashedEntry<Real>( i, j, seed ); }
+
+template<typename Real>
+void MakeEntry( Int i, Int j, Int seed, Complex<Real>& alpha )
+{
+    alpha = Complex<Real>
+      ( HashedEntry<Real>( i, j, seed ), HashedEntry<Real>( i, j, seed+1 ) );
+}
+
+template<typename T>
+void Fill( AbstractDistMatrix<T>& A, Int seed )
+{
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            MakeEntry
+            ( A.GlobalRow(iLoc), A.GlobalCol(jLoc), seed,
+              A.Matrix()(iLoc,jLoc) );
+}
+
+template<typename T>
+void Fill( Matrix<T>& A, Int seed )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            MakeEntry( i, j, seed, A(i,j) );
+}
+
+template<typename T>
+struct Results
+{
+    T dot;
+    Base<T> frobNorm;
+    Matrix<Base<T>> colNorms;
+};
+
+template<typename T>
+void CheckSameBits
+( const Results<T>& results, const Results<T>& reference,
+  const string& label )
+{
+    if( !SameBits( results.dot, reference.dot ) )
+        LogicError
+        (label,": Dot was ",results.dot," rather than ",reference.dot);
+    if( !SameBits( results.frobNorm, reference.frobNorm ) )
+        LogicError
+        (label,": FrobeniusNorm was ",results.frobNorm," rather than ",
+         reference.frobNorm);
+    for( Int j=0; j<reference.colNorms.Height(); ++j )
+        if( !SameBits( results.colNorms(j,0), reference.colNorms(j,0) ) )
+            LogicError
+            (label,": ColumnTwoNorms entry ",j," was ",results.colNorms(j,0),
+             " rather than ",reference.colNorms(j,0));
+}
+
+template<typename T,Dist U,Dist V>
+Results<T> DistResults( const Grid& g, Int m, Int n )
+{
+    DistMatrix<T,U,V> A(g), B(g);
+    A.Resize( m, n );
+    B.Resize( m, n );
+    Fill( A, 0 );
+    Fill( B, 2 );
+
+    Results<T> results;
+    results.dot = Dot( A, B );
+    results.frobNorm = FrobeniusNorm( A );
+    DistMatrix<Base<T>,V,STAR> colNorms(g);
+    ColumnTwoNorms( A, colNorms );
+    DistMatrix<Base<T>,STAR,STAR> colNorms_STAR_STAR( colNorms );
+    results.colNorms = colNorms_STAR_STAR.Matrix();
+    return results;
+}
+
+// Compare the results over grids of every size and shape (formed from the
+// first k processes, for each k) and over several numbers of threads against
+// those of the sequential routines
+template<typename T>
+void TestReproducible( const mpi::Comm& comm, Int m, Int n, Int maxThreads )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+
+    Results<T> reference;
+    Matrix<T> A( m, n ), B( m, n );
+    Fill( A, 0 );
+    Fill( B, 2 );
+    reference.dot = Dot( A, B );
+    reference.frobNorm = FrobeniusNorm( A );
+    ColumnTwoNorms( A, reference.colNorms );
+
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    for( Int numThreads=1; numThreads<=maxThreads; ++numThreads )
+    {
+#ifdef _OPENMP
+        omp_set_num_threads( numThreads );
+#endif
+        OutputFromRoot(comm,numThreads," thread(s)");
+        PushIndent();
+        Results<T> results;
+        results.dot = Dot( A, B );
+        results.frobNorm = FrobeniusNorm( A );
+        ColumnTwoNorms( A, results.colNorms );
+        CheckSameBits( results, reference, "Sequential" );
+
+        for( int k=1; k<=commSize; ++k )
+        {
+            mpi::Comm subComm;
+            mpi::Split( comm, commRank < k ? 0 : 1, commRank, subComm );
+            for( int height=1; height<=k; ++height )
+            {
+                if( k % height != 0 )
+                    continue;
+                OutputFromRoot(comm,"Grids of size ",height," x ",k/height);
+                if( commRank >= k )
+                    continue;
+                mpi::Comm gridComm;
+                mpi::Dup( subComm, gridComm );
+                const Grid g( std::move(gridComm), height );
+                const string label =
+                  BuildString(height," x ",k/height," grid");
+                CheckSameBits
+                ( DistResults<T,MC,MR>( g, m, n ), reference,
+                  label+" with [MC,MR]" );
+                CheckSameBits
+                ( DistResults<T,VC,STAR>( g, m, n ), reference,
+                  label+" with [VC,STAR]" );
+            }
+            mpi::Barrier( comm );
+        }
+        PopIndent();
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--height","height of matrices",400);
+        const Int n = Input("--width","width of matrices",25);
+#ifdef _OPENMP
+        const Int maxThreads =
+          Input("--maxThreads","maximum number of threads",3);
+        const int origNumThreads = omp_get_max_threads();
+#else
+        const Int maxThreads = 1;
+#endif
+        ProcessInput();
+        PrintInputReport();
+
+        SetReproducibleReductions( false );
+        TestReproducible<float>( comm, m, n, maxThreads );
+        TestReproducible<double>( comm, m, n, maxThreads );
+        TestReproducible<Complex<float>>( comm, m, n, maxThreads );
+        TestReproducible<Complex<double>>( comm, m, n, maxThreads );
+        SetReproducibleReductions( false );
+#ifdef _OPENMP
+        omp_set_num_threads( origNumThreads );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
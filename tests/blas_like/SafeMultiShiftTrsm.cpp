@@ -38,6 +38,9 @@ void TestSafeMultiShiftTrsm
         Uniform( shifts, m, 1, F(0), Real(1) );
     }
     MakeTrapezoidal( uplo, A );
+    // Make the first system exactly singular so that it must be scaled
+    if( side == LEFT && m > 0 && n > 0 )
+        shifts.Set( 0, 0, A.Get(m/2,m/2) );
     Uniform( B, m, n );
     if( print )
     {
@@ -140,6 +143,10 @@ void TestSafeMultiShiftTrsm
      "min( || xj ||_2 ) = ",minNorm,"\n",Indent(),
      "min( sj ) = ",minScales);
 
+    const Real eps = limits::Epsilon<Real>();
+    if( !(maxRelErr <= Real(100)*Max(m,n)*eps) )
+        LogicError("Unacceptably large relative residual");
+
     PopIndent();
 }
 
@@ -160,7 +167,7 @@ main( int argc, char* argv[] )
             ("--trans","orientation of quasi-triangular matrix: N/T/C",'N');
         const Int m = Input("--m","height of result",100);
         const Int n = Input("--n","width of result",100);
-        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -176,7 +183,7 @@ main( int argc, char* argv[] )
 
         ComplainIfDebug();
         OutputFromRoot
-        (comm,"Will test SafeMultiShiftTrsm ",sideChar,uploChar,transChar);
+        (g.Comm(),"Will test SafeMultiShiftTrsm ",sideChar,uploChar,transChar);
 
         TestSafeMultiShiftTrsm<float>
         ( print, side, uplo, orientation, m, n, float(3), g );
@@ -214,7 +221,7 @@ main( int argc, char* argv[] )
         ( print, side, uplo, orientation, m, n, Complex<BigFloat>(3), g );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestLyapunov
+( const Grid& g,
+  Int n,
+  Int k,
+  bool krylov,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing ",(krylov?"Krylov":"ADI")," with ",TypeName<F>(),
+     " and n=",n,", k=",k);
+    PushIndent();
+
+    // Shift a random matrix so that its spectrum is in the right half-plane
+    DistMatrix<F> A(g), G(g), Z(g);
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(2*n) );
+    Uniform( G, n, k );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( G, "G" );
+    }
+
+    LowRankCtrl<Real> ctrl;
+    ctrl.krylov = krylov;
+    ctrl.tol = Real(1e-8);
+    auto info = LowRankLyapunov( A, G, Z, ctrl );
+    if( print )
+        Print( Z, "Z" );
+    OutputFromRoot
+    (g.Comm(),"Z is ",Z.Height()," x ",Z.Width()," after ",info.numIts,
+     " iterations");
+
+    // Form A Z Z^H + Z Z^H A^H - G G^H explicitly
+    DistMatrix<F> X(g), AX(g), R(g);
+    Gemm( NORMAL, ADJOINT, F(1), Z, Z, X );
+    Gemm( NORMAL, NORMAL, F(1), A, X, AX );
+    Gemm( NORMAL, ADJOINT, F(1), G, G, R );
+    const Real normRHS = FrobeniusNorm( R );
+    const Real normAX = FrobeniusNorm( AX );
+    R *= F(-1);
+    R += AX;
+    Adjoint( AX, X );
+    R += X;
+    const Real relResidual = FrobeniusNorm( R ) / normRHS;
+    OutputFromRoot
+    (g.Comm(),"|| A Z Z^H + Z Z^H A^H - G G^H ||_F / || G G^H ||_F = ",
+     relResidual,", reported ",info.relResidual);
+    PopIndent();
+
+    // Forming the residual explicitly loses about eps || A Z Z^H ||_F
+    const Real eps = limits::Epsilon<Real>();
+    const Real roundoff = 10*n*eps*normAX/normRHS;
+    if( Z.Width() == 0 )
+        LogicError("Returned an empty solution factor");
+    if( info.relResidual > ctrl.tol )
+        LogicError("Did not converge");
+    if( Abs(relResidual-info.relResidual) > 10*ctrl.tol + roundoff )
+        LogicError("Reported residual does not match the true residual");
+}
+
+template<typename F>
+void TestAll( const Grid& g, Int n, Int k, bool print )
+{
+    TestLyapunov<F>( g, n, k, false, print );
+    TestLyapunov<F>( g, n, k, true, print );
+    // The Krylov basis only has room for one block, so ADI is used instead
+    TestLyapunov<F>( g, k+1, k, true, print );
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--n","height of matrix",60);
+        const Int k = Input("--k","width of right-hand side factor",3);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( std::move(comm), order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestAll<double>( g, n, k, print );
+        TestAll<Complex<double>>( g, n, k, print );
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
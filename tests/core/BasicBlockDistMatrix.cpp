@@ -9,6 +9,109 @@
 #include <El.hpp>
 using namespace El;
 
+// Ensure that ScaLAPACK-compatible block-cyclic matrices are aliased by the
+// ScaLAPACK proxies and that everything else is redistributed into an uncut
+// square-block proxy holding the same entries
+template<typename T>
+void TestScaLAPACKProxy( const Grid& g, Int n, Int mb, Int nb )
+{
+    OutputFromRoot(g.Comm(),"Testing ScaLAPACK proxies with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T,MC,MR,BLOCK> A(n,n,g,mb,mb);
+    Uniform( A, n, n );
+    if( !ScaLAPACKCompatible( A ) )
+        LogicError("Uncut square-block [MC,MR] matrix was incompatible");
+    {
+        DistMatrixReadProxy<T,T,MC,MR,BLOCK>
+          AProx( A, ScaLAPACKProxyCtrl(A) );
+        if( &AProx.GetLocked() != &A )
+            LogicError("Compatible matrix was redistributed by read proxy");
+    }
+    {
+        DistMatrixReadWriteProxy<T,T,MC,MR,BLOCK>
+          AProx( A, ScaLAPACKProxyCtrl(A) );
+        if( &AProx.Get() != &A )
+            LogicError("Compatible matrix was redistributed by proxy");
+    }
+
+    DistMatrix<T,MC,MR,BLOCK> ARect(n,n,g,mb,nb);
+    Uniform( ARect, n, n );
+    DistMatrix<T> AElem( A );
+
+    // A view starting in the middle of a block has nonzero cuts
+    const Int offset = Min( Int(1), n );
+    auto ACut = A( IR(offset,n), IR(offset,n) );
+    vector<const AbstractDistMatrix<T>*> incompatible;
+    if( mb != nb )
+        incompatible.push_back( &ARect );
+    if( mb > 1 )
+        incompatible.push_back( &ACut );
+    incompatible.push_back( &AElem );
+    for( auto B : incompatible )
+    {
+        if( ScaLAPACKCompatible( *B ) )
+            LogicError("Incompatible matrix was reported as compatible");
+        DistMatrixReadProxy<T,T,MC,MR,BLOCK>
+          BProx( *B, ScaLAPACKProxyCtrl(*B) );
+        const auto& BBlock = BProx.GetLocked();
+        if( BBlock.ColCut() != 0 || BBlock.RowCut() != 0 ||
+            BBlock.BlockHeight() != BBlock.BlockWidth() )
+            LogicError("Proxy of incompatible matrix is not compatible");
+        if( !ScaLAPACKCompatible( BBlock ) )
+            LogicError("Proxy of incompatible matrix is not compatible");
+
+        DistMatrix<T> BOrig( *B ), BProxElem( BBlock );
+        BProxElem -= BOrig;
+        if( FrobeniusNorm( BProxElem ) != Base<T>(0) )
+            LogicError("Proxy of incompatible matrix changed its entries");
+    }
+    OutputFromRoot(g.Comm(),"Passed");
+    PopIndent();
+}
+
+// Assigning a block-cyclic matrix to an elemental one must preserve the
+// entries, whether or not the blocks are element-compatible (unit blocks)
+template<typename T>
+void TestBlockToElement( const Grid& g, Int m, Int n, Int mb, Int nb )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing BLOCK to ELEMENT assignment with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T,MC,MR,BLOCK> AUnit(m,n,g,1,1), ABlock(m,n,g,mb,nb);
+    Uniform( AUnit, m, n );
+    Uniform( ABlock, m, n );
+
+    // Views of unit-block matrices have shifted alignments but no cuts
+    const Int offset = Min( Int(1), Min(m,n) );
+    auto AUnitView = AUnit( IR(offset,m), IR(offset,n) );
+
+    vector<const DistMatrix<T,MC,MR,BLOCK>*> sources;
+    sources.push_back( &AUnit );
+    sources.push_back( &AUnitView );
+    sources.push_back( &ABlock );
+    for( auto B : sources )
+    {
+        DistMatrix<T> AElem(g);
+        AElem = *B;
+        if( AElem.Height() != B->Height() || AElem.Width() != B->Width() )
+            LogicError("BLOCK to ELEMENT assignment changed the size");
+
+        // Compare on every process using the block-cyclic redistributions
+        DistMatrix<T,STAR,STAR> AElem_STAR_STAR( AElem );
+        DistMatrix<T,STAR,STAR,BLOCK> B_STAR_STAR( *B );
+        for( Int j=0; j<B->Width(); ++j )
+            for( Int i=0; i<B->Height(); ++i )
+                if( AElem_STAR_STAR.GetLocal(i,j) !=
+                    B_STAR_STAR.GetLocal(i,j) )
+                    LogicError("BLOCK to ELEMENT assignment changed (",i,",",
+                               j,")");
+    }
+    OutputFromRoot(g.Comm(),"Passed");
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -36,6 +139,11 @@ main( int argc, char* argv[] )
         SchurCtrl<double> ctrl;
         ctrl.hessSchurCtrl.fullTriangle = fullTriangle;
 
+        TestScaLAPACKProxy<double>( g, n, mb, nb );
+        TestScaLAPACKProxy<Complex<double>>( g, n, mb, nb+1 );
+        TestBlockToElement<double>( g, n, n+3, mb, nb );
+        TestBlockToElement<Complex<double>>( g, n, n+3, mb, nb+1 );
+
         DistMatrix<Complex<double>,MC,MR,BLOCK> A(n,n,g,mb,nb);
         Fill( A, Complex<double>(1) );
         A.Matrix() *= double(commRank);
@@ -63,7 +171,7 @@ main( int argc, char* argv[] )
         }
 #endif
     }
-    catch( std::exception& e ) { ReportException(e); }
+    catch( std::exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
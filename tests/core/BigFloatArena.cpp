@@ -0,0 +1,219 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef HYDROGEN_HAVE_MPC
+
+// Entries (i,j) of a matrix with a non-terminating binary expansion
+void FillThirds( Matrix<BigFloat>& A )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            A(i,j) = BigFloat(i+2*j+1) / BigFloat(3);
+}
+
+void CheckEqual
+( const Matrix<BigFloat>& A, const Matrix<BigFloat>& B, const string& label )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A(i,j) != B(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",A(i,j)," rather than ",
+                 B(i,j));
+}
+
+void CheckArena( const Matrix<BigFloat>& A, const string& label )
+{
+    if( A.MemoryMode() != LimbArenaMemoryMode )
+        LogicError(label,": the memory mode was ",A.MemoryMode());
+    const Int size = A.Height()*A.Width();
+    if( size == 0 )
+        return;
+    // The matrix is not a view, so its entries are contiguous
+    const BigFloat* buf = A.LockedBuffer();
+    const size_t numLimbs = buf[0].NumLimbs();
+    for( Int k=0; k<size; ++k )
+    {
+        if( buf[k].OwnsLimbs() )
+            LogicError(label,": entry ",k," owns its limbs");
+        if( k > 0 &&
+            buf[k].LockedPointer()->_mpfr_d !=
+            buf[k-1].LockedPointer()->_mpfr_d + numLimbs )
+            LogicError(label,": the limbs of entry ",k," are not contiguous");
+    }
+}
+
+void TestAllocation( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing the allocation of a limb arena");
+    PushIndent();
+    Matrix<BigFloat> A;
+    A.SetMemoryMode( LimbArenaMemoryMode );
+    A.Resize( m, n );
+    CheckArena( A, "A" );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A(i,j) != BigFloat(0) )
+                LogicError("A(",i,",",j,") was not initially zero");
+
+    // Growing the matrix reallocates the arena
+    A.Resize( 2*m, 2*n );
+    CheckArena( A, "A after resizing" );
+
+    // Switching modes moves into and out of an arena
+    Matrix<BigFloat> B( m, n );
+    FillThirds( B );
+    Matrix<BigFloat> BRef( B );
+    B.SetMemoryMode( LimbArenaMemoryMode );
+    CheckArena( B, "B" );
+    FillThirds( B );
+    CheckEqual( B, BRef, "B in an arena" );
+    B.SetMemoryMode( 0 );
+    FillThirds( B );
+    CheckEqual( B, BRef, "B after leaving the arena" );
+    PopIndent();
+}
+
+void TestArithmetic( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing arithmetic within a limb arena");
+    PushIndent();
+    Matrix<BigFloat> A, B, C;
+    A.SetMemoryMode( LimbArenaMemoryMode );
+    B.SetMemoryMode( LimbArenaMemoryMode );
+    C.SetMemoryMode( LimbArenaMemoryMode );
+    A.Resize( m, n );
+    B.Resize( n, m );
+    FillThirds( A );
+    FillThirds( B );
+    Zeros( C, m, m );
+    CheckArena( C, "C" );
+    Gemm( NORMAL, NORMAL, BigFloat(1), A, B, BigFloat(0), C );
+
+    // Every operation is rounded to the same precision as with MPFR's own
+    // allocations, so the results are identical
+    Matrix<BigFloat> ARef( m, n ), BRef( n, m ), CRef;
+    FillThirds( ARef );
+    FillThirds( BRef );
+    Zeros( CRef, m, m );
+    Gemm( NORMAL, NORMAL, BigFloat(1), ARef, BRef, BigFloat(0), CRef );
+    CheckEqual( C, CRef, "A B" );
+    PopIndent();
+}
+
+void TestMoves( const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing moves and swaps with limb arena entries");
+    PushIndent();
+    Matrix<BigFloat> A;
+    A.SetMemoryMode( LimbArenaMemoryMode );
+    A.Resize( 4, 1 );
+    FillThirds( A );
+    const BigFloat third = BigFloat(1) / BigFloat(3);
+
+    // Moving from an entry copies it so that no limbs leave the arena
+    BigFloat alpha( std::move(A(0,0)) );
+    if( !alpha.OwnsLimbs() || alpha != third || A(0,0) != third )
+        LogicError("Moving from an arena entry did not copy it");
+
+    // Moving into an entry keeps its limbs within the arena
+    BigFloat beta( 7 );
+    A(1,0) = std::move( beta );
+    if( A(1,0).OwnsLimbs() || A(1,0) != BigFloat(7) )
+        LogicError("Moving into an arena entry exchanged its limbs");
+
+    const BigFloat gamma( A(2,0) ), delta( A(3,0) );
+    std::swap( A(2,0), A(3,0) );
+    if( A(2,0) != delta || A(3,0) != gamma )
+        LogicError("Swapping arena entries failed");
+    CheckArena( A, "A after moves and swaps" );
+    PopIndent();
+}
+
+void TestPrecision( const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing precision changes of limb arena entries");
+    PushIndent();
+    const mpfr_prec_t prec = mpfr::Precision();
+    Matrix<BigFloat> A;
+    A.SetMemoryMode( LimbArenaMemoryMode );
+    A.Resize( 2, 1 );
+
+    // The precision can be lowered and then restored
+    A(0,0).SetPrecision( prec/2 );
+    A(0,0) = BigFloat(1) / BigFloat(3);
+    if( A(0,0).Precision() != prec/2 )
+        LogicError("The precision was not lowered");
+    A(0,0).SetPrecision( prec );
+    A(0,0) = BigFloat(1) / BigFloat(3);
+    if( A(0,0).Precision() != prec || A(0,0) != BigFloat(1)/BigFloat(3) )
+        LogicError("The precision was not restored");
+
+    // but can not exceed that of the arena
+    bool threw = false;
+    try { A(1,0).SetPrecision( 2*prec ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw )
+        LogicError("Raising the precision above that of the arena succeeded");
+    CheckArena( A, "A after precision changes" );
+    PopIndent();
+}
+
+void TestCommunication( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing the communication of limb arenas");
+    PushIndent();
+    Matrix<BigFloat> A;
+    A.SetMemoryMode( LimbArenaMemoryMode );
+    A.Resize( m, n );
+    FillThirds( A );
+    mpi::AllReduce
+    ( A.Buffer(), m*n, g.Comm(), SyncInfo<Device::CPU>() );
+    CheckArena( A, "A after an AllReduce" );
+
+    Matrix<BigFloat> ARef( m, n );
+    FillThirds( ARef );
+    mpi::AllReduce
+    ( ARef.Buffer(), m*n, g.Comm(), SyncInfo<Device::CPU>() );
+    CheckEqual( A, ARef, "AllReduce(A)" );
+    PopIndent();
+}
+
+#endif // ifdef HYDROGEN_HAVE_MPC
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",20);
+        const Int n = Input("--width","width of matrix",15);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+#ifdef HYDROGEN_HAVE_MPC
+        TestAllocation( g, m, n );
+        TestArithmetic( g, m, n );
+        TestMoves( g );
+        TestPrecision( g );
+        TestCommunication( g, m, n );
+#else
+        OutputFromRoot(g.Comm(),"Skipping the limb arena tests: no MPC");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
@@ -64,13 +64,73 @@ main( int argc, char* argv[] )
         A = ASqrt;
         if( print )
             Print( A, "A := ASqrt" );
+        {
+            DistMatrix<double> E(grid);
+            Identity( E, m, n );
+            E *= 2;
+            E -= A;
+            if( FrobeniusNorm( E ) != 0. )
+                LogicError("Round trip through the square grid failed");
+        }
+
+        // Every process, including those outside of the square grid, queues
+        // an update of each diagonal entry and a pull of the (0,0) entry
+        Zeros( ASqrt, m, n );
+        const Int minDim = Min(m,n);
+        ASqrt.Reserve( minDim );
+        for( Int i=0; i<minDim; ++i )
+            ASqrt.QueueUpdate( i, i, double(i+1) );
+        ASqrt.ProcessQueues();
+        if( minDim > 0 )
+        {
+            ASqrt.ReservePulls( 1 );
+            ASqrt.QueuePull( 0, 0 );
+            vector<double> pulls;
+            ASqrt.ProcessPullQueue( pulls );
+            if( pulls.size() != 1 || pulls[0] != double(commSize) )
+                LogicError("Pulled ",pulls[0]," instead of ",commSize);
+        }
+        A = ASqrt;
+        {
+            DistMatrix<double> E(grid);
+            Zeros( E, m, n );
+            for( Int i=0; i<minDim; ++i )
+                E.Set( i, i, double(commSize*(i+1)) );
+            E -= A;
+            if( FrobeniusNorm( E ) != 0. )
+                LogicError("Queued updates on the square grid were wrong");
+        }
+
+        // Broadcast a local matrix over the square grid
+        if( sqrtGrid.InGrid() )
+        {
+            Matrix<double> B;
+            if( sqrtGrid.Rank() == 0 )
+                Uniform( B, m, n );
+            else
+                Zeros( B, m, n );
+            Broadcast( B, sqrtGrid.Comm(), 0 );
+            vector<double> sums(2,0.);
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                {
+                    sums[0] += B(i,j);
+                    sums[1] += B(i,j)*B(i,j);
+                }
+            vector<double> rootSums( sums );
+            mpi::Broadcast
+            ( rootSums.data(), 2, 0, sqrtGrid.Comm(),
+              SyncInfo<Device::CPU>() );
+            if( sums != rootSums )
+                LogicError("Broadcast matrix differs from the root's");
+        }
 
         const Grid newGrid( mpi::NewWorldComm(), order );
         A.SetGrid( newGrid );
         if( print )
             Print( A, "A after changing grid" );
     }
-    catch( std::exception& e ) { ReportException(e); }
+    catch( std::exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
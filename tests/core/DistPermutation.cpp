@@ -0,0 +1,220 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Build the same pivot sequence, as formed by partial pivoting, into a
+// distributed and a sequential permutation
+void MakePivots
+( DistPermutation& P, Permutation& PSeq, Int n, bool explicitPerm )
+{
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+    PSeq.MakeIdentity( n );
+    PSeq.ReserveSwaps( n );
+    for( Int i=0; i<n; ++i )
+    {
+        const Int dest = i + (7919*i+13) % (n-i);
+        P.Swap( i, dest );
+        PSeq.Swap( i, dest );
+    }
+    if( explicitPerm )
+    {
+        P.MakeArbitrary();
+        PSeq.MakeArbitrary();
+    }
+}
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const Matrix<T>& ARef, const string& label )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const Matrix<T>& ALoc = A_STAR_STAR.Matrix();
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( ALoc(i,j) != ARef(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",ALoc(i,j),
+                 " rather than ",ARef(i,j));
+}
+
+template<typename T>
+void TestPermutation
+( const Grid& g, Int m, Int n, Int offset, bool explicitPerm, bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing ",(explicitPerm?"explicit":"swap sequence"),
+     " permutations with offset ",offset," and ",TypeName<T>());
+    PushIndent();
+
+    // Matrices over different communicators and alignments, which are
+    // exchanged in separate groups by the batched routines
+    DistMatrix<T> A(g), C(g);
+    DistMatrix<T,VC,STAR> B(g);
+    DistMatrix<T,STAR,VR> D(g);
+    C.Align( Min(1,g.Height()-1), Min(1,g.Width()-1) );
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( C, m, n );
+    Uniform( D, m, n );
+    const vector<AbstractDistMatrix<T>*> mats = { &A, &B, &C, &D };
+    const vector<string> labels = { "[MC,MR]", "[VC,STAR]",
+                                    "[MC,MR] (realigned)", "[STAR,VR]" };
+    vector<Matrix<T>> orig;
+    for( auto M : mats )
+    {
+        DistMatrix<T,STAR,STAR> M_STAR_STAR( *M );
+        orig.push_back( M_STAR_STAR.Matrix() );
+    }
+    if( print )
+        Print( A, "A" );
+
+    // Rows
+    // ====
+    DistPermutation P(g);
+    Permutation PSeq;
+    MakePivots( P, PSeq, m-offset, explicitPerm );
+
+    // Apply P to each matrix separately and compare against the sequential
+    // permutation
+    for( size_t k=0; k<mats.size(); ++k )
+    {
+        P.PermuteRows( *mats[k], offset );
+        Matrix<T> ref( orig[k] );
+        PSeq.PermuteRows( ref, offset );
+        CheckEqual( *mats[k], ref, "P A for "+labels[k] );
+    }
+    // Then apply P^T to all of them at once
+    P.InversePermuteRows( mats, offset );
+    for( size_t k=0; k<mats.size(); ++k )
+        CheckEqual( *mats[k], orig[k], "P^T P A for "+labels[k] );
+
+    // The same round trip with the batched application of P, twice so that
+    // any cached metadata is reused
+    for( Int rep=0; rep<2; ++rep )
+    {
+        P.PermuteRows( mats, offset );
+        for( size_t k=0; k<mats.size(); ++k )
+        {
+            Matrix<T> ref( orig[k] );
+            PSeq.PermuteRows( ref, offset );
+            CheckEqual( *mats[k], ref, "Batched P A for "+labels[k] );
+        }
+        P.InversePermuteRows( mats, offset );
+        for( size_t k=0; k<mats.size(); ++k )
+            CheckEqual
+            ( *mats[k], orig[k], "Batched P^T P A for "+labels[k] );
+    }
+
+    // Columns
+    // =======
+    DistPermutation Q(g);
+    Permutation QSeq;
+    MakePivots( Q, QSeq, n-offset, explicitPerm );
+    for( Int rep=0; rep<2; ++rep )
+    {
+        Q.PermuteCols( mats, offset );
+        for( size_t k=0; k<mats.size(); ++k )
+        {
+            Matrix<T> ref( orig[k] );
+            QSeq.PermuteCols( ref, offset );
+            CheckEqual( *mats[k], ref, "Batched A Q^T for "+labels[k] );
+        }
+        Q.InversePermuteCols( mats, offset );
+        for( size_t k=0; k<mats.size(); ++k )
+            CheckEqual
+            ( *mats[k], orig[k], "Batched A Q^T Q for "+labels[k] );
+    }
+    PopIndent();
+}
+
+// Apply a permutation to matrices over other grids, each of which is freed
+// before the next is created, so that their communicators may well be
+// allocated at the same addresses
+template<typename T>
+void TestOtherGrids( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing an explicit permutation over other grids with ",
+     TypeName<T>());
+    PushIndent();
+    DistPermutation P(g);
+    Permutation PSeq;
+    MakePivots( P, PSeq, m, true );
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> ref( A_STAR_STAR.Matrix() );
+    PSeq.PermuteRows( ref );
+    P.PermuteRows( A );
+    CheckEqual( A, ref, "P A" );
+
+    const Int commSize = mpi::Size( g.Comm() );
+    for( Int height : { Int(1), commSize } )
+    {
+        const Grid gOther( mpi::NewWorldComm(), height );
+        DistMatrix<T> AOther(gOther);
+        AOther.Resize( m, n );
+        for( Int jLoc=0; jLoc<AOther.LocalWidth(); ++jLoc )
+            for( Int iLoc=0; iLoc<AOther.LocalHeight(); ++iLoc )
+                AOther.SetLocal
+                ( iLoc, jLoc,
+                  A_STAR_STAR.GetLocal
+                  (AOther.GlobalRow(iLoc),AOther.GlobalCol(jLoc)) );
+        P.PermuteRows( AOther );
+        CheckEqual( AOther, ref, "P A over another grid" );
+        P.InversePermuteRows( AOther );
+        CheckEqual
+        ( AOther, A_STAR_STAR.Matrix(), "P^T P A over another grid" );
+    }
+    PopIndent();
+}
+
+template<typename T>
+void TestAll( const Grid& g, Int m, Int n, bool print )
+{
+    for( bool explicitPerm : {false,true} )
+    {
+        TestPermutation<T>( g, m, n, 0, explicitPerm, print );
+        // General permutations do not support offsets
+        if( !explicitPerm )
+            TestPermutation<T>( g, m, n, 3, explicitPerm, print );
+    }
+    TestOtherGrids<T>( g, m, n );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",40);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( std::move(comm), order );
+        ComplainIfDebug();
+
+        TestAll<double>( g, m, n, print );
+        TestAll<Complex<double>>( g, m, n, print );
+        TestAll<Int>( g, m, n, print );
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cmath>
+#include <limits>
+using namespace El;
+
+// The double-double kernels behind blas::Axpy, Dot and Nrm2 only require
+// IEEE doubles, so they are tested directly (on interleaved (hi,lo) arrays)
+// whether or not QD is available
+#include "../../src/core/imports/blas/DoubleDouble.hpp"
+
+#ifdef __SIZEOF_FLOAT128__
+
+// A binary128 reference, whose 113-bit significand is more precise than the
+// roughly 106 bits of a double-double
+typedef __float128 RefReal;
+
+// The unit roundoff of double-double arithmetic
+const double ddEps = std::ldexp( 1., -104 );
+
+RefReal RefAbs( RefReal alpha ) { return alpha < 0 ? -alpha : alpha; }
+
+// Interleaved (hi,lo) pairs whose values have mixed signs and magnitudes
+// within a factor of 2^20 of 'scale', so that the sums cancel
+vector<double> MakeVector( BlasInt n, double scale, int seed )
+{
+    vector<double> x( 2*n );
+    for( BlasInt i=0; i<n; ++i )
+    {
+        const double hi =
+          scale * SampleUniform<double>(-1,1) *
+          std::ldexp( 1., int((7*i+seed) % 21)-10 );
+        // The low word must be at most half an ulp of the high word
+        const double lo =
+          hi * std::ldexp( 1., -54 ) * SampleUniform<double>(-1,1);
+        x[2*i] = hi + lo;
+        x[2*i+1] = lo - (x[2*i]-hi);
+    }
+    return x;
+}
+
+RefReal Value( const vector<double>& x, BlasInt i )
+{ return RefReal(x[2*i]) + RefReal(x[2*i+1]); }
+
+// The entry i of a vector with stride inc as seen by the BLAS
+BlasInt Index( BlasInt n, BlasInt i, BlasInt inc )
+{ return inc >= 0 ? i*inc : (n-1-i)*(-inc); }
+
+void TestDot( BlasInt n, BlasInt incx, BlasInt incy, double scale )
+{
+    const BlasInt absIncx = Max(incx,-incx), absIncy = Max(incy,-incy);
+    auto x = MakeVector( n*absIncx, scale, 1 );
+    auto y = MakeVector( n*absIncy, 1/scale, 2 );
+    double sumHi, sumLo;
+    blas::dd::Dot( n, x.data(), incx, y.data(), incy, sumHi, sumLo );
+
+    RefReal sum=0, sumAbs=0;
+    for( BlasInt i=0; i<n; ++i )
+    {
+        const RefReal prod =
+          Value(x,Index(n,i,incx)) * Value(y,Index(n,i,incy));
+        sum += prod;
+        sumAbs += RefAbs(prod);
+    }
+    const RefReal error = RefAbs( (RefReal(sumHi)+RefReal(sumLo)) - sum );
+    if( !(error <= 4*n*ddEps*sumAbs) )
+        LogicError
+        ("Dot of length ",n," with strides ",incx,",",incy," and scale ",
+         scale," had a relative error of ",double(error/sumAbs));
+}
+
+void TestAxpy( BlasInt n, BlasInt incx, BlasInt incy, double scale )
+{
+    const BlasInt absIncx = Max(incx,-incx), absIncy = Max(incy,-incy);
+    auto x = MakeVector( n*absIncx, scale, 3 );
+    auto y = MakeVector( n*absIncy, scale, 4 );
+    auto alpha = MakeVector( 1, 1, 5 );
+    const auto yOrig = y;
+    blas::dd::Axpy( n, alpha.data(), x.data(), incx, y.data(), incy );
+
+    // Entries which are not part of the strided vector are untouched
+    for( BlasInt i=0; i<n*absIncy; ++i )
+        if( i % absIncy != 0 &&
+            (y[2*i] != yOrig[2*i] || y[2*i+1] != yOrig[2*i+1]) )
+            LogicError("Axpy modified an entry outside of y");
+    for( BlasInt i=0; i<n; ++i )
+    {
+        const BlasInt ix = Index(n,i,incx), iy = Index(n,i,incy);
+        const RefReal update = Value(alpha,0)*Value(x,ix);
+        const RefReal eta = Value(yOrig,iy) + update;
+        // Near the underflow threshold the low words lose their precision
+        const RefReal bound =
+          4*ddEps*(RefAbs(Value(yOrig,iy))+RefAbs(update)) +
+          4*RefReal(std::numeric_limits<double>::denorm_min());
+        const RefReal error = RefAbs( Value(y,iy) - eta );
+        if( !(error <= bound) )
+            LogicError
+            ("Axpy entry ",i," with strides ",incx,",",incy," and scale ",
+             scale," had an error of ",double(error)," > ",double(bound));
+    }
+}
+
+// || x ||_2^2 is returned as 2^(2 exponent) (sumHi,sumLo)
+void TestNrm2( BlasInt n, BlasInt incx, double scale )
+{
+    const BlasInt absIncx = Max(incx,-incx);
+    auto x = MakeVector( n*absIncx, scale, 6 );
+    double sumHi, sumLo;
+    int exponent;
+    blas::dd::ScaledSumOfSquares( n, x.data(), incx, sumHi, sumLo, exponent );
+
+    // The range of binary128 is wide enough to hold the unscaled sum
+    RefReal sum=0;
+    for( BlasInt i=0; i<n; ++i )
+    {
+        const RefReal chi = Value(x,Index(n,i,incx));
+        sum += chi*chi;
+    }
+    const RefReal factor = std::ldexp( 1., -exponent );
+    const RefReal scaledSum = sum*factor*factor;
+    const RefReal error =
+      RefAbs( (RefReal(sumHi)+RefReal(sumLo)) - scaledSum );
+    if( !(error <= 4*n*ddEps*scaledSum) )
+        LogicError
+        ("Sum of squares of length ",n," with scale ",scale,
+         " had a relative error of ",double(error/scaledSum));
+}
+
+void TestNonFinite( BlasInt n )
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    auto y = MakeVector( n, 1, 7 );
+    double sumHi, sumLo;
+    int exponent;
+
+    auto x = MakeVector( n, 1, 8 );
+    x[2*(n/2)] = nan;
+    x[2*(n/2)+1] = 0;
+    blas::dd::Dot( n, x.data(), 1, y.data(), 1, sumHi, sumLo );
+    if( !std::isnan(sumHi) )
+        LogicError("Dot did not propagate a NaN");
+    blas::dd::ScaledSumOfSquares( n, x.data(), 1, sumHi, sumLo, exponent );
+    if( !std::isnan(sumHi) )
+        LogicError("Nrm2 did not propagate a NaN");
+
+    // Only the NaN entry of y is affected
+    auto alpha = MakeVector( 1, 1, 9 );
+    auto z = y;
+    blas::dd::Axpy( n, alpha.data(), x.data(), 1, z.data(), 1 );
+    for( BlasInt i=0; i<n; ++i )
+        if( std::isnan(z[2*i]) != (i == n/2) )
+            LogicError("Axpy did not confine the NaN to its entry");
+
+    x = MakeVector( n, 1, 10 );
+    x[2*(n/3)] = -inf;
+    x[2*(n/3)+1] = 0;
+    blas::dd::Dot( n, x.data(), 1, y.data(), 1, sumHi, sumLo );
+    if( std::isfinite(sumHi) )
+        LogicError("Dot of a vector with an infinity was finite");
+    blas::dd::ScaledSumOfSquares( n, x.data(), 1, sumHi, sumLo, exponent );
+    if( sumHi != inf )
+        LogicError("Nrm2 of a vector with an infinity was not infinite");
+}
+
+void TestAll()
+{
+    // Scales whose squares (and, for the Dot, whose products with their
+    // reciprocals) would overflow or underflow in double precision
+    for( const double scale : {1., 1e150, 1e-150, 1e300, 1e-300} )
+    {
+        for( const BlasInt n : {BlasInt(1),BlasInt(7),BlasInt(1000)} )
+        {
+            for( const BlasInt inc : {BlasInt(1),BlasInt(3),BlasInt(-1),
+                                      BlasInt(-2)} )
+            {
+                TestDot( n, inc, 1, scale );
+                TestDot( n, 2, inc, scale );
+                TestAxpy( n, inc, 1, scale );
+                TestAxpy( n, 1, inc, scale );
+                TestNrm2( n, inc, scale );
+            }
+        }
+    }
+    TestNonFinite( 100 );
+}
+
+#endif // ifdef __SIZEOF_FLOAT128__
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+#ifdef __SIZEOF_FLOAT128__
+        TestAll();
+        OutputFromRoot(comm,"Double-double kernels passed");
+#else
+        OutputFromRoot
+        (comm,"Skipping the double-double tests: no binary128 reference");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
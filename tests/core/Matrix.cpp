@@ -38,6 +38,108 @@ void TestMatrix( Int m, Int n, Int ldim )
     Output("passed");
 }
 
+template<typename T>
+void TestCopyOwnership( Int m, Int n, Int ldim )
+{
+    Output("Testing copies of views with ",TypeName<T>());
+
+    vector<T> buffer(ldim*n);
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            buffer[i+j*ldim] = i+j*m;
+
+    // Copying a view must yield a matrix which owns its own buffer
+    Matrix<T> A( m, n, buffer.data(), ldim );
+    Matrix<T> ACopy( A );
+    if( ACopy.Viewing() || ACopy.Locked() )
+        LogicError("Copy of a view did not own its buffer");
+    if( m > 0 && n > 0 && ACopy.LockedBuffer() == A.LockedBuffer() )
+        LogicError("Copy of a view aliased the viewed buffer");
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( ACopy.Get(i,j) != buffer[i+j*ldim] )
+                LogicError("Copy of a view has the wrong entries");
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            ACopy.Set( i, j, T(-1) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( buffer[i+j*ldim] != T(i+j*m) )
+                LogicError("Modifying a copy changed the viewed buffer");
+
+    // ...and the same holds for locked views, whose copies are writable
+    const Matrix<T> B( m, n, (const T*)buffer.data(), ldim );
+    Matrix<T> BCopy( B );
+    if( BCopy.Viewing() || BCopy.Locked() )
+        LogicError("Copy of a locked view did not own its buffer");
+    if( m > 0 && n > 0 )
+    {
+        BCopy.Set( 0, 0, T(-1) );
+        if( buffer[0] != T(0) )
+            LogicError("Modifying a copy changed the locked buffer");
+    }
+
+    Output("passed");
+}
+
+template<typename T>
+void TestScale( Int m, Int n )
+{
+    Output("Testing AbstractMatrix::operator*= with ",TypeName<T>());
+
+    Matrix<T> A( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A.Set( i, j, T(i+j*m) );
+
+    AbstractMatrix<T>& AAbs = A;
+    AAbs *= T(2);
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.Get(i,j) != T(2)*T(i+j*m) )
+                LogicError("AbstractMatrix::operator*= did not scale A");
+
+    Output("passed");
+}
+
+template<typename T>
+void TestUpdate( Int m, Int n )
+{
+    Output("Testing AbstractMatrix::operator+= and -= with ",TypeName<T>());
+
+    Matrix<T> A( m, n ), B( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            A.Set( i, j, T(i+j*m) );
+            B.Set( i, j, T(i) );
+        }
+
+    AbstractMatrix<T>& AAbs = A;
+    const AbstractMatrix<T>& BAbs = B;
+    AAbs += BAbs;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.Get(i,j) != T(i+j*m) + T(i) )
+                LogicError("AbstractMatrix::operator+= did not add B");
+    AAbs -= BAbs;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.Get(i,j) != T(i+j*m) )
+                LogicError("AbstractMatrix::operator-= did not subtract B");
+
+    Output("passed");
+}
+
+template<typename T>
+void TestAll( Int m, Int n, Int ldim )
+{
+    TestMatrix<T>( m, n, ldim );
+    TestCopyOwnership<T>( m, n, ldim );
+    TestScale<T>( m, n );
+    TestUpdate<T>( m, n );
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -52,30 +154,30 @@ main( int argc, char* argv[] )
 
         if( mpi::Rank(mpi::COMM_WORLD) == 0 )
         {
-            TestMatrix<float>( m, n, ldim );
-            TestMatrix<Complex<float>>( m, n, ldim );
+            TestAll<float>( m, n, ldim );
+            TestAll<Complex<float>>( m, n, ldim );
 
-            TestMatrix<double>( m, n, ldim );
-            TestMatrix<Complex<double>>( m, n, ldim );
+            TestAll<double>( m, n, ldim );
+            TestAll<Complex<double>>( m, n, ldim );
 
 #ifdef EL_HAVE_QD
-            TestMatrix<DoubleDouble>( m, n, ldim );
-            TestMatrix<QuadDouble>( m, n, ldim );
+            TestAll<DoubleDouble>( m, n, ldim );
+            TestAll<QuadDouble>( m, n, ldim );
 #endif
 
 #ifdef EL_HAVE_QUAD
-            TestMatrix<Quad>( m, n, ldim );
-            TestMatrix<Complex<Quad>>( m, n, ldim );
+            TestAll<Quad>( m, n, ldim );
+            TestAll<Complex<Quad>>( m, n, ldim );
 #endif
 
 #ifdef EL_HAVE_MPC
-            TestMatrix<BigInt>( m, n, ldim );
-            TestMatrix<BigFloat>( m, n, ldim );
-            TestMatrix<Complex<BigFloat>>( m, n, ldim );
+            TestAll<BigInt>( m, n, ldim );
+            TestAll<BigFloat>( m, n, ldim );
+            TestAll<Complex<BigFloat>>( m, n, ldim );
 #endif
         }
     }
-    catch( std::exception& e ) { ReportException(e); }
+    catch( std::exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef HYDROGEN_HAVE_MPC
+
+// Entry i on process 'rank' is (rank+i+1)/4, which every reduction ordering
+// sums exactly for both BigInt's and BigFloat's
+template<typename T>
+T Contribution( Int rank, Int i )
+{ return T(rank+i+1) / T(4); }
+
+template<typename T>
+void TestAllReduce
+( const mpi::Comm& comm, Int count, mpi::Op op, const string& opName,
+  bool inPlace )
+{
+    OutputFromRoot
+    (comm,"Testing ",(inPlace?"in-place ":""),opName," of ",count," ",
+     TypeName<T>(),"'s");
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    vector<T> send( count ), recv( count );
+    for( Int i=0; i<count; ++i )
+        send[i] = Contribution<T>( commRank, i );
+    if( inPlace )
+    {
+        recv = send;
+        mpi::AllReduce
+        ( recv.data(), count, op, comm, SyncInfo<Device::CPU>() );
+    }
+    else
+    {
+        mpi::AllReduce
+        ( send.data(), recv.data(), count, op, comm,
+          SyncInfo<Device::CPU>() );
+        for( Int i=0; i<count; ++i )
+            if( send[i] != Contribution<T>( commRank, i ) )
+                LogicError(opName," modified its send buffer");
+    }
+
+    for( Int i=0; i<count; ++i )
+    {
+        T expected = Contribution<T>( 0, i );
+        for( Int rank=1; rank<commSize; ++rank )
+        {
+            const T contrib = Contribution<T>( rank, i );
+            if( op == mpi::SUM )
+                expected += contrib;
+            else if( op == mpi::MAX )
+                expected = Max( expected, contrib );
+            else
+                expected = Min( expected, contrib );
+        }
+        if( recv[i] != expected )
+            LogicError
+            (opName," entry ",i," of ",count," was ",recv[i]," rather than ",
+             expected);
+    }
+}
+
+// Each thread reuses its packing buffers across reductions but releases them
+// after a reduction large enough to exceed the retained size, so alternate
+// between small and large reductions
+template<typename T>
+void TestAll( const mpi::Comm& comm, Int smallCount, Int largeCount )
+{
+    for( const Int count : { smallCount, largeCount, smallCount, smallCount,
+                             largeCount } )
+        for( bool inPlace : {false,true} )
+        {
+            TestAllReduce<T>( comm, count, mpi::SUM, "SUM", inPlace );
+            TestAllReduce<T>( comm, count, mpi::MAX, "MAX", inPlace );
+            TestAllReduce<T>( comm, count, mpi::MIN, "MIN", inPlace );
+        }
+}
+
+#endif // ifdef HYDROGEN_HAVE_MPC
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int smallCount = Input("--small","small message length",10);
+        const Int largeCount =
+          Input("--large","large message length",100000);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef HYDROGEN_HAVE_MPC
+        TestAll<BigInt>( comm, smallCount, largeCount );
+        TestAll<BigFloat>( comm, smallCount, largeCount );
+#else
+        OutputFromRoot
+        (comm,"Skipping the serialized AllReduce tests: no MPC");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
@@ -81,10 +81,38 @@ void TestCorrectness
         LogicError("Relative error was unacceptably large");
 }
 
+// Compare the recursive variant against the blocked one on a well-conditioned
+// matrix so that the factors should agree to within a modest multiple of eps
+template<typename F>
+void TestRecursiveCholesky( UpperOrLower uplo, Int m, Int leafSize, bool print )
+{
+    typedef Base<F> Real;
+    Output("Comparing recursive and blocked Cholesky...");
+    PushIndent();
+    Matrix<F> A, ARec;
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    ARec = A;
+    Cholesky( uplo, A );
+    cholesky::Recursive( uplo, ARec, leafSize );
+    if( print )
+        Print( ARec, "A after recursive factorization" );
+    MakeTrapezoidal( uplo, A );
+    MakeTrapezoidal( uplo, ARec );
+    ARec -= A;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relDiff = FrobeniusNorm( ARec ) / FrobeniusNorm( A );
+    Output("|| L_recursive - L ||_F / || L ||_F = ",relDiff);
+    if( relDiff > Real(100)*m*eps )
+        LogicError("Recursive and blocked factors differ");
+    PopIndent();
+}
+
 template<typename F>
 void TestSequentialCholesky
 ( UpperOrLower uplo,
   bool pivot,
+  Int tileSize,
+  Int leafSize,
   Int m,
   bool print,
   bool printDiag,
@@ -106,6 +134,8 @@ void TestSequentialCholesky
     timer.Start();
     if( pivot )
         Cholesky( uplo, A, p );
+    else if( tileSize > 0 )
+        cholesky::Tiled( uplo, A, tileSize );
     else
         Cholesky( uplo, A );
     const double runTime = timer.Stop();
@@ -126,6 +156,8 @@ void TestSequentialCholesky
         Print( GetRealPartOfDiagonal(A), "diag(A)" );
     if( correctness )
         TestCorrectness( pivot, uplo, A, p, AOrig );
+    if( leafSize > 0 )
+        TestRecursiveCholesky<F>( uplo, m, leafSize, print );
     PopIndent();
 }
 
@@ -188,11 +220,71 @@ void TestCholesky
     PopIndent();
 }
 
+template<typename F>
+void TestOutOfCoreCholesky
+( const Grid& g,
+  Int m,
+  Int panelWidth,
+  bool print,
+  bool correctness,
+  Int numRHS=100 )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing out-of-core Cholesky with ",TypeName<F>());
+    PushIndent();
+    DistMatrix<F> A(g);
+    HermitianUniformSpectrum( A, m, 1e-9, 10 );
+    if( print )
+        Print( A, "A" );
+
+    OutOfCoreCtrl ctrl;
+    ctrl.panelWidth = panelWidth;
+    OutOfCoreMatrix<F> AOOC( g, m, m, ctrl );
+    AOOC.Import( A );
+    OutputFromRoot
+    (g.Comm(),"Elemental out-of-core Cholesky with ",AOOC.NumPanels(),
+     " panels...");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    Cholesky( LOWER, AOOC );
+    mpi::Barrier( g.Comm() );
+    const double runTime = timer.Stop();
+    const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot(g.Comm(),runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+    {
+        DistMatrix<F> L(g);
+        AOOC.Export( L );
+        Print( L, "A after factorization" );
+    }
+    if( correctness )
+    {
+        const Real eps = limits::Epsilon<Real>();
+        DistMatrix<F> X(g), Y(g);
+        Uniform( X, m, numRHS );
+        Zeros( Y, m, numRHS );
+        Hemm( LEFT, LOWER, F(1), A, X, F(0), Y );
+        const Real oneNormY = OneNorm( Y );
+        cholesky::SolveAfter( LOWER, NORMAL, AOOC, Y );
+        X -= Y;
+        const Real infNormE = InfinityNorm( X );
+        const Real relErr = infNormE / (eps*m*oneNormY);
+        OutputFromRoot
+        (g.Comm(), "||X - A \\ Y ||_oo / (eps n || Y ||_1) = ",relErr);
+        if( relErr > Real(100) )
+            LogicError("Relative error was unacceptably large");
+    }
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -203,6 +295,14 @@ main( int argc, char* argv[] )
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool pivot = Input("--pivot","use pivoting?",false);
+        const Int tileSize = Input
+            ("--tileSize","tile size of sequential variant (0 for blocked)",32);
+        const Int leafSize = Input
+            ("--leafSize","leaf size of recursive variant (0 to skip it)",8);
+        const bool outOfCore =
+          Input("--outOfCore","test the out-of-core variant?",true);
+        const Int oocWidth =
+          Input("--oocWidth","out-of-core panel width (0 for auto)",32);
         const bool correctness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -226,47 +326,59 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid g( comm, gridHeight, order );
+        const Grid g( std::move(comm), gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
 
         ComplainIfDebug();
 
-        if( sequential && mpi::Rank(comm) == 0 )
+        if( sequential && g.Rank() == 0 )
         {
             TestSequentialCholesky<float>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<Complex<float>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<double>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<Complex<double>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
 
 #ifdef EL_HAVE_QD
             TestSequentialCholesky<DoubleDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<QuadDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
 
             TestSequentialCholesky<Complex<DoubleDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<Complex<QuadDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSequentialCholesky<Quad>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<Complex<Quad>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSequentialCholesky<BigFloat>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
             TestSequentialCholesky<Complex<BigFloat>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tileSize, leafSize, m,
+              print, printDiag, correctness );
 #endif
         }
 
@@ -316,8 +428,18 @@ main( int argc, char* argv[] )
         ( g, uplo, pivot, m, nbLocal,
           print, printDiag, correctness, scalapack );
 #endif
+
+        if( outOfCore )
+        {
+            TestOutOfCoreCholesky<float>( g, m, oocWidth, print, correctness );
+            TestOutOfCoreCholesky<Complex<float>>
+            ( g, m, oocWidth, print, correctness );
+            TestOutOfCoreCholesky<double>( g, m, oocWidth, print, correctness );
+            TestOutOfCoreCholesky<Complex<double>>
+            ( g, m, oocWidth, print, correctness );
+        }
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
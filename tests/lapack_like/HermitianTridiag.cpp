@@ -164,6 +164,165 @@ void TestCorrectness
         LogicError("Relative orthogonality error was unacceptably large");
 }
 
+template<typename Real,typename=EnableIf<IsBlasScalar<Real>>>
+bool TridiagEigenvalues( Matrix<Real> d, Matrix<Real> e, Matrix<Real>& w )
+{
+    const Int m = d.Height();
+    w.Resize( m, 1 );
+    lapack::SymmetricTridiagEig( m, d.Buffer(), e.Buffer(), w.Buffer() );
+    return true;
+}
+
+template<typename Real,typename=DisableIf<IsBlasScalar<Real>>,typename=void>
+bool TridiagEigenvalues( Matrix<Real> d, Matrix<Real> e, Matrix<Real>& w )
+{ return false; }
+
+// The one-stage and two-stage tridiagonal matrices need not agree, but their
+// eigenvalues should (the spectral module is avoided so that LAPACK's
+// tridiagonal eigensolver is used when it supports the datatype)
+template<typename Real>
+void CompareEigenvalues
+( const Matrix<Real>& dOne, const Matrix<Real>& eOne,
+  const Matrix<Real>& dTwo, const Matrix<Real>& eTwo,
+  Real normA, mpi::Comm const& comm )
+{
+    Matrix<Real> wOne, wTwo;
+    if( !TridiagEigenvalues( dOne, eOne, wOne ) ||
+        !TridiagEigenvalues( dTwo, eTwo, wTwo ) )
+        return;
+    const Int m = dOne.Height();
+    const Real eps = limits::Epsilon<Real>();
+    wTwo -= wOne;
+    const Real relDiff = MaxNorm( wTwo ) / (eps*m*normA);
+    OutputFromRoot
+    (comm,"max_i |w_i^{one} - w_i^{two}| / (eps m ||A||_F) = ",relDiff);
+    if( relDiff > Real(10) )
+        LogicError("One-stage and two-stage eigenvalues differ");
+}
+
+template<typename Field>
+void TestTwoStage
+( UpperOrLower uplo,
+  const Matrix<Field>& AOrig,
+  Int bandwidth,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( AOrig );
+    Output("Two-stage algorithm with bandwidth ",bandwidth,":");
+    PushIndent();
+
+    HermitianTridiagCtrl<Field> ctrl;
+    ctrl.bandwidth = bandwidth;
+    Matrix<Field> A( AOrig );
+    Matrix<Field> householderScalars, bulgeReflectors, bulgeScalars;
+    herm_tridiag::TwoStage
+    ( uplo, A, householderScalars, bulgeReflectors, bulgeScalars, ctrl );
+    if( print )
+        Print( A, "A after two-stage reduction" );
+
+    // The two-stage reduction always returns the subdiagonal
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,-1);
+    Matrix<Field> B;
+    Zeros( B, m, m );
+    SetRealPartOfDiagonal( B, d );
+    SetRealPartOfDiagonal( B, e, -1 );
+    SetRealPartOfDiagonal( B, e,  1 );
+    herm_tridiag::ApplyQ
+    ( LEFT, NORMAL, bandwidth,
+      A, householderScalars, bulgeReflectors, bulgeScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, ADJOINT, bandwidth,
+      A, householderScalars, bulgeReflectors, bulgeScalars, B );
+    B -= AOrig;
+    const Real relError = FrobeniusNorm( B ) / (eps*m*frobA);
+    Output("||A - Q T Q^H||_F / (eps m ||A||_F) = ",relError);
+    if( relError > Real(10) )
+        LogicError("Two-stage relative error was unacceptably large");
+
+    Matrix<Field> AOne( AOrig ), householderScalarsOne;
+    HermitianTridiag( uplo, AOne, householderScalarsOne );
+    auto dOne = GetRealPartOfDiagonal(AOne);
+    auto eOne = GetRealPartOfDiagonal(AOne,(uplo==LOWER ? -1 : +1));
+    CompareEigenvalues( dOne, eOne, d, e, frobA, mpi::COMM_SELF );
+    PopIndent();
+}
+
+template<typename Field>
+void TestTwoStage
+( UpperOrLower uplo,
+  const DistMatrix<Field>& AOrig,
+  Int bandwidth,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = AOrig.Grid();
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( AOrig );
+    OutputFromRoot
+    (grid.Comm(),"Two-stage algorithm with bandwidth ",bandwidth,":");
+    PushIndent();
+
+    HermitianTridiagCtrl<Field> ctrl;
+    ctrl.bandwidth = bandwidth;
+    DistMatrix<Field> A( AOrig );
+    DistMatrix<Field,STAR,STAR> householderScalars(grid);
+    DistMatrix<Field,STAR,VR> bulgeReflectors(grid);
+    DistMatrix<Field,VR,STAR> bulgeScalars(grid);
+    herm_tridiag::TwoStage
+    ( uplo, A, householderScalars, bulgeReflectors, bulgeScalars, ctrl );
+    if( print )
+        Print( A, "A after two-stage reduction" );
+
+    auto d = GetRealPartOfDiagonal(A);
+    auto e = GetRealPartOfDiagonal(A,-1);
+    DistMatrix<Field> B(grid);
+    B.AlignWith( A );
+    Zeros( B, m, m );
+    SetRealPartOfDiagonal( B, d );
+    SetRealPartOfDiagonal( B, e, -1 );
+    SetRealPartOfDiagonal( B, e,  1 );
+    herm_tridiag::ApplyQ
+    ( LEFT, NORMAL, bandwidth,
+      A, householderScalars, bulgeReflectors, bulgeScalars, B );
+    herm_tridiag::ApplyQ
+    ( RIGHT, ADJOINT, bandwidth,
+      A, householderScalars, bulgeReflectors, bulgeScalars, B );
+    B -= AOrig;
+    const Real relError = FrobeniusNorm( B ) / (eps*m*frobA);
+    OutputFromRoot
+    (grid.Comm(),"||A - Q T Q^H||_F / (eps m ||A||_F) = ",relError);
+    if( relError > Real(10) )
+        LogicError("Two-stage relative error was unacceptably large");
+
+    // ExplicitCondensed should perform the same reduction
+    DistMatrix<Field> T( AOrig );
+    ctrl.twoStage = true;
+    herm_tridiag::ExplicitCondensed( uplo, T, ctrl );
+    auto dCondensed = GetRealPartOfDiagonal(T);
+    auto eCondensed = GetRealPartOfDiagonal(T,-1);
+    dCondensed -= d;
+    eCondensed -= e;
+    if( MaxNorm(dCondensed) > eps*frobA || MaxNorm(eCondensed) > eps*frobA )
+        LogicError("ExplicitCondensed did not use the two-stage reduction");
+
+    DistMatrix<Field> AOne( AOrig );
+    DistMatrix<Field,STAR,STAR> householderScalarsOne(grid);
+    ctrl.approach = HERMITIAN_TRIDIAG_DEFAULT;
+    HermitianTridiag( uplo, AOne, householderScalarsOne, ctrl );
+    DistMatrix<Real,STAR,STAR> dOne( GetRealPartOfDiagonal(AOne) ),
+      eOne( GetRealPartOfDiagonal(AOne,(uplo==LOWER ? -1 : +1)) ),
+      dTwo( d ), eTwo( e );
+    CompareEigenvalues
+    ( dOne.Matrix(), eOne.Matrix(), dTwo.Matrix(), eTwo.Matrix(), frobA,
+      grid.Comm() );
+    PopIndent();
+}
+
 template<typename Field>
 void InnerTestHermitianTridiag
 ( UpperOrLower uplo,
@@ -246,6 +405,7 @@ template<typename Field>
 void TestHermitianTridiag
 ( UpperOrLower uplo,
   Int m,
+  Int bandwidth,
   bool correctness,
   bool print,
   bool display )
@@ -266,6 +426,8 @@ void TestHermitianTridiag
     Output("Sequential algorithm:");
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, correctness, print, display );
+    if( correctness && bandwidth > 0 )
+        TestTwoStage( uplo, AOrig, bandwidth, print );
 
     PopIndent();
 }
@@ -276,6 +438,7 @@ void TestHermitianTridiag
   UpperOrLower uplo,
   Int m,
   Int nbLocal,
+  Int bandwidth,
   bool avoidTrmv,
   bool correctness,
   bool print,
@@ -303,17 +466,15 @@ void TestHermitianTridiag
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
 
-    OutputFromRoot(grid.Comm(),"Square row-major algorithm:");
-    ctrl.approach = HERMITIAN_TRIDIAG_SQUARE;
-    ctrl.order = ROW_MAJOR;
+    // HERMITIAN_TRIDIAG_SQUARE redistributes between grids, which is no
+    // longer supported, so the square algorithm is only tested in place
+    OutputFromRoot(grid.Comm(),"Default algorithm:");
+    ctrl.approach = HERMITIAN_TRIDIAG_DEFAULT;
     InnerTestHermitianTridiag
     ( uplo, A, householderScalars, ctrl, correctness, print, display );
 
-    OutputFromRoot(grid.Comm(),"Square column-major algorithm:");
-    ctrl.approach = HERMITIAN_TRIDIAG_SQUARE;
-    ctrl.order = COLUMN_MAJOR;
-    InnerTestHermitianTridiag
-    ( uplo, A, householderScalars, ctrl, correctness, print, display );
+    if( correctness && bandwidth > 0 )
+        TestTwoStage( uplo, AOrig, bandwidth, print );
     PopIndent();
 }
 
@@ -321,7 +482,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -331,6 +492,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",75);
         const Int nb = Input("--nb","algorithmic blocksize",32);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 to skip)",8);
         const bool avoidTrmv =
           Input("--avoidTrmv","avoid Trmv local Symv",true);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -353,109 +516,120 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid grid( comm, gridHeight, order );
+        const Grid grid( std::move(comm), gridHeight, order );
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         SetBlocksize( nb );
 
         ComplainIfDebug();
         OutputFromRoot(grid.Comm(),"Will test HermitianTridiag",uploChar);
 
-        if( sequential && mpi::Rank() == 0 )
+        if( sequential && grid.Rank() == 0 )
         {
             if( testReal )
                 TestHermitianTridiag<float>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<float>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
             if( testReal )
                 TestHermitianTridiag<double>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<double>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 
 #ifdef EL_HAVE_QD
             if( testReal )
             {
                 TestHermitianTridiag<DoubleDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<QuadDouble>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
             if( testCpx )
             {
                 TestHermitianTridiag<Complex<DoubleDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
                 TestHermitianTridiag<Complex<QuadDouble>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             }
 #endif
 
 #ifdef EL_HAVE_QUAD
             if( testReal )
                 TestHermitianTridiag<Quad>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
             if( testCpx )
                 TestHermitianTridiag<Complex<Quad>>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
             if( testReal )
                 TestHermitianTridiag<BigFloat>
-                ( uplo, m, correctness, print, display );
+                ( uplo, m, bandwidth, correctness, print, display );
 #endif
         }
 
         if( testReal )
             TestHermitianTridiag<float>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<float>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
 
         if( testReal )
             TestHermitianTridiag<double>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<double>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
 
 #ifdef EL_HAVE_QD
         if( testReal )
         {
             TestHermitianTridiag<DoubleDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
             TestHermitianTridiag<QuadDouble>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
         }
         if( testCpx )
         {
             TestHermitianTridiag<Complex<DoubleDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
             TestHermitianTridiag<Complex<QuadDouble>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
         }
 #endif
 
 #ifdef EL_HAVE_QUAD
         if( testReal )
             TestHermitianTridiag<Quad>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
         if( testCpx )
             TestHermitianTridiag<Complex<Quad>>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         if( testReal )
             TestHermitianTridiag<BigFloat>
-            ( grid, uplo, m, nbLocal, avoidTrmv, correctness, print, display );
+            ( grid, uplo, m, nbLocal, bandwidth, avoidTrmv,
+              correctness, print, display );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
@@ -103,10 +103,65 @@ void TestCorrectness
     PopIndent();
 }
 
+// The tiled variant does not pivot, so compare its factors against those of
+// the blocked unpivoted LU of a diagonally dominant matrix
+template<typename Field>
+void TestTiledLU( Int m, Int tileSize, bool print )
+{
+    typedef Base<Field> Real;
+    Output("Comparing tiled and blocked unpivoted LU...");
+    PushIndent();
+    Matrix<Field> A, ATiled;
+    Uniform( A, m, m );
+    ShiftDiagonal( A, Field(m) );
+    ATiled = A;
+    LU( A );
+    lu::Tiled( ATiled, tileSize );
+    if( print )
+        Print( ATiled, "A after tiled factorization" );
+    ATiled -= A;
+    const Real eps = limits::Epsilon<Real>();
+    const Real relDiff = FrobeniusNorm( ATiled ) / FrobeniusNorm( A );
+    Output("|| LU_tiled - LU ||_F / || LU ||_F = ",relDiff);
+    if( relDiff > Real(100)*m*eps )
+        LogicError("Tiled and blocked factors differ");
+    PopIndent();
+}
+
+// Partial pivoting makes the recursive and blocked factors sensitive to
+// near-ties in the pivot search, so check the backward error of the solves
+template<typename Field>
+void TestRecursiveLU( Int m, Int leafSize, bool print )
+{
+    typedef Base<Field> Real;
+    Output("Testing recursive LU with partial pivoting...");
+    PushIndent();
+    Matrix<Field> A, B, X;
+    Permutation P;
+    Uniform( A, m, m );
+    Uniform( B, m, 10 );
+    const Matrix<Field> AOrig( A );
+    lu::Recursive( A, P, leafSize );
+    if( print )
+        Print( A, "A after recursive factorization" );
+    X = B;
+    lu::SolveAfter( NORMAL, A, P, X );
+    Gemm( NORMAL, NORMAL, Field(-1), AOrig, X, Field(1), B );
+    const Real eps = limits::Epsilon<Real>();
+    const Real relError =
+      FrobeniusNorm( B ) / (eps*m*FrobeniusNorm(AOrig)*FrobeniusNorm(X));
+    Output("|| A X - B ||_F / (eps m || A ||_F || X ||_F) = ",relError);
+    if( relError > Real(100) )
+        LogicError("Recursive LU residual was unacceptably large");
+    PopIndent();
+}
+
 template<typename Field>
 void TestLU
 ( Int m,
   Int pivoting,
+  Int tileSize,
+  Int leafSize,
   bool correctness,
   bool forceGrowth,
   bool print )
@@ -171,6 +226,10 @@ void TestLU
     }
     if( correctness )
         TestCorrectness( AOrig, A, P, Q, pivoting, print );
+    if( tileSize > 0 )
+        TestTiledLU<Field>( m, tileSize, print );
+    if( leafSize > 0 )
+        TestRecursiveLU<Field>( m, leafSize, print );
     PopIndent();
 }
 
@@ -252,7 +311,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -261,6 +320,10 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int tileSize = Input
+            ("--tileSize","tile size of tiled variant (0 to skip it)",32);
+        const Int leafSize = Input
+            ("--leafSize","leaf size of recursive variant (0 to skip it)",8);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
@@ -282,7 +345,7 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid grid( comm, gridHeight, order );
+        const Grid grid( std::move(comm), gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
         if( pivot == 0 )
@@ -295,39 +358,39 @@ main( int argc, char* argv[] )
         if( sequential && mpi::Rank() == 0 )
         {
             TestLU<float>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
             TestLU<Complex<float>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
 
             TestLU<double>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
             TestLU<Complex<double>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
 
 #ifdef EL_HAVE_QD
             TestLU<DoubleDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
             TestLU<QuadDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
 
             TestLU<Complex<DoubleDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
             TestLU<Complex<QuadDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestLU<Quad>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
             TestLU<Complex<Quad>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestLU<BigFloat>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
             TestLU<Complex<BigFloat>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tileSize, leafSize, correctness, forceGrowth, print );
 #endif
         }
 
@@ -367,7 +430,7 @@ main( int argc, char* argv[] )
         ( grid, m, pivot, correctness, forceGrowth, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
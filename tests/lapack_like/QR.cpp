@@ -128,6 +128,7 @@ template<typename Field>
 void TestQR
 ( Int m,
   Int n,
+  Int tileSize,
   bool correctness,
   bool print )
 {
@@ -148,7 +149,10 @@ void TestQR
     Timer timer;
     Output("Starting QR factorization...");
     timer.Start();
-    QR( A, householderScalars, signature );
+    if( tileSize > 0 )
+        qr::Tiled( A, householderScalars, signature, tileSize );
+    else
+        QR( A, householderScalars, signature );
     const double runTime = timer.Stop();
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
@@ -211,7 +215,7 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
@@ -221,6 +225,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const Int tileSize = Input
+            ("--tileSize","tile size of sequential variant (0 for blocked)",32);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -237,46 +243,46 @@ main( int argc, char* argv[] )
         if( gridHeight == 0 )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
-        const Grid grid( comm, gridHeight, order );
+        const Grid grid( std::move(comm), gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
 
         if( sequential && mpi::Rank() == 0 )
         {
             TestQR<float>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
             TestQR<Complex<float>>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
 
             TestQR<double>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
             TestQR<Complex<double>>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
 
 #ifdef EL_HAVE_QD
             TestQR<DoubleDouble>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
             TestQR<QuadDouble>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
 
             TestQR<Complex<DoubleDouble>>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
             TestQR<Complex<QuadDouble>>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestQR<Quad>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
             TestQR<Complex<Quad>>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestQR<BigFloat>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
             TestQR<Complex<BigFloat>>
-            ( m, n, correctness, print );
+            ( m, n, tileSize, correctness, print );
 #endif
         }
 
@@ -316,7 +322,7 @@ main( int argc, char* argv[] )
         ( grid, m, n, correctness, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }
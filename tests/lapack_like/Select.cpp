@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <algorithm>
+using namespace El;
+
+template<typename Real>
+void CheckEntry
+( const ValueInt<Real>& entry, const ValueInt<Real>& reference,
+  const string& label )
+{
+    if( entry.value != reference.value || entry.index != reference.index )
+        LogicError
+        (label," returned (",entry.value,",",entry.index,
+         ") but the reference is (",reference.value,",",reference.index,")");
+}
+
+template<typename Real>
+void TestSelect
+( const Grid& g, Int n, Int numValues, bool rowVector, bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing selection from a ",(rowVector?"row":"column"),
+     " vector of length ",n," with ",numValues," distinct values and ",
+     TypeName<Real>());
+    PushIndent();
+
+    // Draw the entries from a small set so that there are many duplicates
+    DistMatrix<Real> x(g);
+    if( rowVector )
+        x.Resize( 1, n );
+    else
+        x.Resize( n, 1 );
+    for( Int jLoc=0; jLoc<x.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        {
+            const Int i = ( rowVector ? x.GlobalCol(jLoc) : x.GlobalRow(iLoc) );
+            x.SetLocal( iLoc, jLoc, Real((7919*i) % numValues) );
+        }
+    if( print )
+        Print( x, "x" );
+
+    // Ties are broken by the original index, i.e., as by a stable sort
+    DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+    const Matrix<Real>& xLoc = x_STAR_STAR.Matrix();
+    vector<ValueInt<Real>> sorted( n );
+    for( Int i=0; i<n; ++i )
+    {
+        sorted[i].value = ( rowVector ? xLoc(0,i) : xLoc(i,0) );
+        sorted[i].index = i;
+    }
+    std::stable_sort( sorted.begin(), sorted.end(), ValueInt<Real>::Lesser );
+
+    // Ranks at both ends, around the middle, and the quantiles that map to
+    // them
+    vector<Int> ranks = { 0, 1, n/2-1, n/2, n/2+1, n-2, n-1 };
+    for( const Int rank : ranks )
+    {
+        if( rank < 0 || rank >= n )
+            continue;
+        CheckEntry
+        ( NthElement( x, rank ), sorted[rank], "Distributed NthElement" );
+        CheckEntry
+        ( NthElement( xLoc, rank ), sorted[rank], "Sequential NthElement" );
+    }
+    CheckEntry( Median( x ), sorted[n/2], "Distributed Median" );
+    CheckEntry( Median( xLoc ), sorted[n/2], "Sequential Median" );
+
+    const vector<double> quantiles = { 0., 0.1, 0.25, 0.5, 0.75, 0.99, 1. };
+    auto distQuantiles = QuantileSelect( x, quantiles );
+    auto seqQuantiles = QuantileSelect( xLoc, quantiles );
+    for( size_t q=0; q<quantiles.size(); ++q )
+    {
+        const Int rank = Min( Int(quantiles[q]*n), n-1 );
+        CheckEntry
+        ( distQuantiles[q], sorted[rank], "Distributed QuantileSelect" );
+        CheckEntry
+        ( seqQuantiles[q], sorted[rank], "Sequential QuantileSelect" );
+    }
+    PopIndent();
+}
+
+template<typename Real>
+void TestAll( const Grid& g, Int n, Int numValues, bool print )
+{
+    for( bool rowVector : {false,true} )
+    {
+        TestSelect<Real>( g, n, numValues, rowVector, print );
+        // Every entry is a duplicate
+        TestSelect<Real>( g, n, 1, rowVector, print );
+        // Distinct entries
+        TestSelect<Real>( g, n, n+1, rowVector, print );
+        // Fewer entries than processes
+        TestSelect<Real>( g, 3, numValues, rowVector, print );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--n","length of vector",1001);
+        const Int numValues =
+          Input("--numValues","number of distinct values",17);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( std::move(comm), order );
+        ComplainIfDebug();
+
+        TestAll<float>( g, n, numValues, print );
+        TestAll<double>( g, n, numValues, print );
+        TestAll<Int>( g, n, numValues, print );
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
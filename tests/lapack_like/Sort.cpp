@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <algorithm>
+using namespace El;
+
+// Fill with values drawn from a small set so that there are many duplicates
+template<typename Real>
+void FillWithDuplicates( AbstractDistMatrix<Real>& X, Int numValues )
+{
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = X.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = X.GlobalRow(iLoc);
+            X.SetLocal( iLoc, jLoc, Real((7919*i+104729*j) % numValues) );
+        }
+    }
+}
+
+template<typename Real>
+void TestSort
+( const Grid& g, Int m, Int n, Int numValues, SortType sort, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing Sort with ",TypeName<Real>());
+    PushIndent();
+
+    DistMatrix<Real> X(g);
+    X.Resize( m, n );
+    FillWithDuplicates( X, numValues );
+    if( print )
+        Print( X, "X" );
+
+    // Sort every column of a redundant copy on each process as a reference
+    DistMatrix<Real,STAR,STAR> XRef( X );
+    Sort( XRef.Matrix(), sort, true );
+
+    Sort( X, sort );
+    if( print )
+        Print( X, "sort(X)" );
+
+    DistMatrix<Real,STAR,STAR> X_STAR_STAR( X );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( X_STAR_STAR.GetLocal(i,j) != XRef.GetLocal(i,j) )
+                LogicError
+                ("Sort(X)(",i,",",j,")=",X_STAR_STAR.GetLocal(i,j),
+                 " but the reference is ",XRef.GetLocal(i,j));
+    PopIndent();
+}
+
+template<typename Real>
+void TestTaggedSort
+( const Grid& g, Int n, Int numValues, bool rowVector, SortType sort,
+  bool print )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing TaggedSort of a ",(rowVector?"row":"column"),
+     " vector with ",TypeName<Real>());
+    PushIndent();
+
+    DistMatrix<Real> x(g);
+    if( rowVector )
+        x.Resize( 1, n );
+    else
+        x.Resize( n, 1 );
+    FillWithDuplicates( x, numValues );
+    if( print )
+        Print( x, "x" );
+
+    // Ties are broken by the original index, i.e., as by a stable sort
+    DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+    vector<ValueInt<Real>> pairsRef( n );
+    for( Int i=0; i<n; ++i )
+    {
+        pairsRef[i].value =
+          ( rowVector ? x_STAR_STAR.GetLocal(0,i)
+                      : x_STAR_STAR.GetLocal(i,0) );
+        pairsRef[i].index = i;
+    }
+    if( sort == ASCENDING )
+        std::stable_sort
+        ( pairsRef.begin(), pairsRef.end(), ValueInt<Real>::Lesser );
+    else
+        std::stable_sort
+        ( pairsRef.begin(), pairsRef.end(), ValueInt<Real>::Greater );
+
+    auto pairs = TaggedSort( x, sort );
+    if( Int(pairs.size()) != n )
+        LogicError("TaggedSort returned ",pairs.size()," of ",n," entries");
+    vector<bool> seen( n, false );
+    for( Int i=0; i<n; ++i )
+    {
+        const Int index = pairs[i].index;
+        if( index < 0 || index >= n || seen[index] )
+            LogicError("The indices are not a permutation");
+        seen[index] = true;
+        if( pairs[i].value != pairsRef[i].value ||
+            pairs[i].index != pairsRef[i].index )
+            LogicError
+            ("Entry ",i," of TaggedSort is (",pairs[i].value,",",
+             pairs[i].index,") but the reference is (",pairsRef[i].value,",",
+             pairsRef[i].index,")");
+    }
+    PopIndent();
+}
+
+template<typename Real>
+void TestAll( const Grid& g, Int m, Int n, Int numValues, bool print )
+{
+    for( SortType sort : {ASCENDING,DESCENDING} )
+    {
+        TestSort<Real>( g, m, n, numValues, sort, print );
+        TestTaggedSort<Real>( g, m, numValues, false, sort, print );
+        TestTaggedSort<Real>( g, m, numValues, true, sort, print );
+        // Every entry is a duplicate
+        TestTaggedSort<Real>( g, m, 1, false, sort, print );
+        // Fewer entries than processes
+        TestTaggedSort<Real>( g, 2, numValues, false, sort, print );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",1000);
+        const Int n = Input("--width","width of matrix",5);
+        const Int numValues =
+          Input("--numValues","number of distinct values",17);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( std::move(comm), order );
+        ComplainIfDebug();
+
+        TestAll<float>( g, m, n, numValues, print );
+        TestAll<double>( g, m, n, numValues, print );
+        TestAll<Int>( g, m, n, numValues, print );
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
@@ -100,12 +100,12 @@ int
 main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
-    mpi::Comm comm = mpi::COMM_WORLD;
+    mpi::Comm comm = mpi::NewWorldComm();
 
     try
     {
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
-        const Int m = Input("--height","height of matrix",100);
+        const Int m = Input("--height","height of matrix",400);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool correctness =
@@ -122,10 +122,10 @@ main( int argc, char* argv[] )
 #endif
 
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
-        const Grid g( comm, order );
+        const Grid g( std::move(comm), order );
         SetBlocksize( nb );
         ComplainIfDebug();
-        OutputFromRoot(comm,"Will test TSQR");
+        OutputFromRoot(g.Comm(),"Will test TSQR");
 
         TestQR<float>
         ( g, m, n, correctness, print );
@@ -163,7 +163,7 @@ main( int argc, char* argv[] )
         ( g, m, n, correctness, print );
 #endif
     }
-    catch( exception& e ) { ReportException(e); }
+    catch( exception& e ) { ReportException(e); return 1; }
 
     return 0;
 }